@@ -44,10 +44,14 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/Band.h>
+#include <blaze/math/BatchMatrix.h>
 #include <blaze/math/BLAS.h>
 #include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedSoAMatrix.h>
+#include <blaze/math/CompressedSoAVector.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constraints.h>
+#include <blaze/math/CustomCompressedMatrix.h>
 #include <blaze/math/CustomMatrix.h>
 #include <blaze/math/CustomVector.h>
 #include <blaze/math/DiagonalMatrix.h>
@@ -55,6 +59,7 @@
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Epsilon.h>
 #include <blaze/math/Functors.h>
+#include <blaze/math/Fuse.h>
 #include <blaze/math/GroupTag.h>
 #include <blaze/math/IdentityMatrix.h>
 #include <blaze/math/Infinity.h>
@@ -64,6 +69,7 @@
 #include <blaze/math/HermitianMatrix.h>
 #include <blaze/math/HybridMatrix.h>
 #include <blaze/math/HybridVector.h>
+#include <blaze/math/IterativeSolvers.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/PaddingFlag.h>
@@ -71,7 +77,9 @@
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
+#include <blaze/math/SlicedEllMatrix.h>
 #include <blaze/math/SMP.h>
+#include <blaze/math/SparseSolvers.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/StorageOrder.h>
@@ -2404,6 +2404,35 @@
    fix( a ) = b;  // Throws an exception: Vector cannot be resized!
    \endcode
 
+// \n \subsection vector_operations_fuse fuse()
+//
+// Every assignment is evaluated in a separate pass over the involved vectors. Thus a sequence of
+// memory bound statements on large vectors streams the same vectors through memory several
+// times. Via the \c fuse() function it is possible to evaluate several element-wise assignments
+// and reductions in a single sweep. For that purpose the statements are created via the
+// \c lazyAssign(), \c lazyAddAssign(), \c lazySubAssign(), \c lazyMultAssign(),
+// \c lazyDivAssign(), \c lazyReduce(), \c lazySum(), \c lazySqrNorm(), and \c lazyNorm()
+// functions and passed to \c fuse(), which evaluates all statements block by block in the
+// given order:
+
+   \code
+   blaze::DynamicVector<double> b, r, x, y;
+   double a, n;
+   // ... Resizing and initialization
+
+   // Same result as 'y = a*x + y; r = b - y; n = norm( r );', but only a single pass
+   blaze::fuse( blaze::lazyAssign( y, a*x + y )
+              , blaze::lazyAssign( r, b - y )
+              , blaze::lazyNorm( n, r ) );
+   \endcode
+
+// In contrast to a regular assignment, the target vectors are not resized. In case the sizes of
+// the statements don't match, a \c std::invalid_argument exception is thrown. Statements that
+// depend on complete vectors modified within the same group (as for instance \c r=b-A*y in
+// combination with an update of \c y) are detected and cause a sequential evaluation of all
+// statements. Note however that all other operands must be element-wise with respect to the
+// targets of the statements, i.e. shifted views on a target vector are not permitted.
+//
 // \n \section vector_operations_modifying_operations Modifying Operations
 // <hr>
 //
@@ -14915,6 +14944,48 @@
 // In the context of C++11 threads, the function will return the previously specified number of
 // threads.
 //
+// By default, the operating system is free to move the threads between cores. On Linux systems
+// it is possible to pin the threads to individual cores via the environment variable
+// \c BLAZE_THREAD_AFFINITY
+
+   \code
+   export BLAZE_THREAD_AFFINITY=compact  // Consecutive threads on neighboring cores
+   export BLAZE_THREAD_AFFINITY=scatter  // Consecutive threads spread over packages and cores
+   export BLAZE_THREAD_AFFINITY=0-7,16   // Explicit list of cores
+   \endcode
+
+// or alternatively via the \c setThreadAffinity() function:
+
+   \code
+   blaze::setThreadAffinity( "scatter" );
+   \endcode
+
+// Only cores of the process cpuset (as for instance restricted via \c taskset or \c numactl)
+// are used. In combination with the work-stealing thread pool (see the
+// \c BLAZE_USE_WORK_STEALING_THREAD_POOL switch in <tt><blaze/config/SMP.h></tt>) every thread
+// is assigned the same part of a vector or matrix in successive assignments. Therefore the data
+// stays in the caches of the threads and, in combination with a partitioned allocation policy
+// (see the \c setAllocationPolicy() function), in the memory of their NUMA nodes.
+//
+// The work-stealing thread pool additionally provides a low-latency mode: Via the environment
+// variable \c BLAZE_SPIN_BUDGET or the \c setSpinBudget() function it is possible to specify the
+// time (in microseconds) idle threads keep spinning for a new task before they block:
+
+   \code
+   blaze::setSpinBudget( 200 );  // Spinning for up to 200 microseconds
+   \endcode
+
+// As long as the threads are spinning, the dispatch of a parallel operation and the following join
+// do not require any condition variable notification and the worker threads do not acquire any
+// mutex (only the scheduling thread briefly locks an uncontended mutex per scheduled task). This
+// reduces the overhead of a parallel operation from several microseconds to a few hundred
+// nanoseconds, which enables the profitable parallelization of comparatively small operations that
+// are executed many times (in case the \c BLAZE_USE_RUNTIME_SMP_THRESHOLDS switch is enabled, the
+// according thresholds can be lowered via the \c setSMPThreshold() function). Since spinning
+// threads keep their cores busy, the spin budget should only be used if the number of threads does
+// not exceed the number of available cores. By default, the spin budget is 0, i.e. spinning is
+// disabled.
+//
 //
 // \n \section cpp_threads_configuration C++11 Thread Configuration
 // <hr>
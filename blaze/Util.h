@@ -43,7 +43,10 @@
 #include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/AlignedArray.h>
 #include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/AllocationPolicy.h>
 #include <blaze/util/Algorithms.h>
+#include <blaze/util/Arena.h>
+#include <blaze/util/ArenaAllocator.h>
 #include <blaze/util/AsConst.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/CheckedDelete.h>
@@ -68,6 +71,7 @@
 #include <blaze/util/NonCreatable.h>
 #include <blaze/util/NullAllocator.h>
 #include <blaze/util/NullType.h>
+#include <blaze/util/NumaAllocator.h>
 #include <blaze/util/NumericCast.h>
 #include <blaze/util/PointerCast.h>
 #include <blaze/util/Policies.h>
@@ -75,10 +79,13 @@
 #include <blaze/util/Serialization.h>
 #include <blaze/util/Singleton.h>
 #include <blaze/util/SmallArray.h>
+#include <blaze/util/SpinWait.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Suffix.h>
 #include <blaze/util/Thread.h>
+#include <blaze/util/ThreadAffinity.h>
 #include <blaze/util/ThreadPool.h>
+#include <blaze/util/WorkStealingThreadPool.h>
 #include <blaze/util/Time.h>
 #include <blaze/util/Timing.h>
 #include <blaze/util/TypeList.h>
@@ -86,5 +93,6 @@
 #include <blaze/util/TypeTraits.h>
 #include <blaze/util/UnsignedValue.h>
 #include <blaze/util/ValueTraits.h>
+#include <blaze/util/Workspace.h>
 
 #endif
@@ -232,3 +232,41 @@
 #define BLAZE_BLAS_INCLUDE_FILE <cblas.h>
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the LAPACK mode.
+// \ingroup config
+//
+// This compilation switch specifies whether a LAPACK library is available or not. In case the
+// LAPACK mode is enabled, the dense LU, Cholesky, and QR decompositions (see the \c lu(), \c llh(),
+// and \c qr() functions) are computed by the according LAPACK functions (\c getrf(), \c potrf(),
+// and \c geqrf()). In case the LAPACK mode is disabled, the decompositions are computed by the
+// native blocked implementations of the Blaze library, which do not require a LAPACK library
+// and which are parallelized via the shared memory parallelization of Blaze. Note that all
+// remaining LAPACK-based functionality (as for instance the matrix inversion or the eigenvalue
+// computation) still requires a LAPACK library.
+//
+// Possible settings for the switch:
+//  - Disabled: \b 0
+//  - Enabled : \b 1 (default)
+//
+// \warning Changing the setting of the LAPACK mode requires a recompilation of all code using
+// the Blaze library!
+//
+// \note It is possible to (de-)activate the LAPACK mode via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_LAPACK_MODE=1 ...
+   \endcode
+
+   \code
+   #define BLAZE_LAPACK_MODE 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_LAPACK_MODE
+#define BLAZE_LAPACK_MODE 1
+#endif
+//*************************************************************************************************
@@ -59,3 +59,55 @@
 #define BLAZE_CACHE_SIZE 3145728UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief L1 cache size of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size of the L1 data cache (per core) in Byte of the used target
+// architecture. It is used to determine the block sizes of the packed dense matrix
+// multiplication kernels. The default corresponds to 32 KiByte.
+//
+// \note It is possible to specify the L1 cache size via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_L1_CACHE_SIZE=32768 ...
+   \endcode
+
+   \code
+   #define BLAZE_L1_CACHE_SIZE 32768UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_L1_CACHE_SIZE
+#define BLAZE_L1_CACHE_SIZE 32768UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief L2 cache size of the target architecture.
+// \ingroup config
+//
+// This setting specifies the size of the L2 data cache (per core) in Byte of the used target
+// architecture. It is used to determine the block sizes of the packed dense matrix
+// multiplication kernels. The default corresponds to 256 KiByte.
+//
+// \note It is possible to specify the L2 cache size via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_L2_CACHE_SIZE=262144 ...
+   \endcode
+
+   \code
+   #define BLAZE_L2_CACHE_SIZE 262144UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_L2_CACHE_SIZE
+#define BLAZE_L2_CACHE_SIZE 262144UL
+#endif
+//*************************************************************************************************
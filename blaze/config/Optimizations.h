@@ -136,6 +136,73 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Configuration switch for the packed dense matrix multiplication kernels.
+// \ingroup config
+//
+// This configuration switch enables/disables the packed dense matrix multiplication kernels for
+// large floating point matrices in case no BLAS library is used. These kernels pack blocks of
+// both operands into contiguous, aligned buffers and apply register-blocked SIMD micro-kernels
+// to them (GEBP scheme). The block sizes are derived from the cache sizes specified in
+// <tt><blaze/config/CacheSize.h></tt>. In case the switch is set to 1 the packed kernels are
+// used whenever possible. In case the switch is set to 0 the unpacked kernels are used.
+//
+// Possible settings for the packed matrix multiplication kernels:
+//  - Disabled: \b 0
+//  - Enabled : \b 1
+//
+// \note It is possible to (de-)activate the packed matrix multiplication kernels via command
+// line or by defining this symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_USE_PACKED_MMM_KERNELS=1 ...
+   \endcode
+
+   \code
+   #define BLAZE_USE_PACKED_MMM_KERNELS 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_PACKED_MMM_KERNELS
+#define BLAZE_USE_PACKED_MMM_KERNELS 1
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration switch for the SIMD transpose kernels.
+// \ingroup config
+//
+// This configuration switch enables/disables the SIMD transpose kernels for the assignment of
+// dense matrices with opposite storage order (as for instance the assignment of a row-major
+// matrix to a column-major matrix or the assignment of a transposed matrix). These kernels
+// transpose square micro-tiles of 4x4 or 8x8 elements in SIMD registers and traverse the
+// matrices in cache-oblivious order. In case the switch is set to 1 the SIMD transpose kernels
+// are used whenever possible. In case the switch is set to 0 the matrices are copied element
+// by element.
+//
+// Possible settings for the SIMD transpose kernels:
+//  - Disabled: \b 0
+//  - Enabled : \b 1
+//
+// \note It is possible to (de-)activate the SIMD transpose kernels via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_USE_SIMD_TRANSPOSE_KERNELS=1 ...
+   \endcode
+
+   \code
+   #define BLAZE_USE_SIMD_TRANSPOSE_KERNELS 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_SIMD_TRANSPOSE_KERNELS
+#define BLAZE_USE_SIMD_TRANSPOSE_KERNELS 1
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Configuration switch for the initialization in default constructors.
 // \ingroup config
@@ -167,3 +234,44 @@
 #define BLAZE_USE_DEFAULT_INITIALIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration switch for reproducible reductions.
+// \ingroup config
+//
+// This configuration switch enables/disables the reproducible evaluation of floating point
+// reductions of dense vectors and matrices (i.e. \c reduce(), \c sum(), \c prod(), all norms
+// and the dense vector inner product). By default, the order in which the elements are combined
+// depends on the width of the SIMD vectors of the target architecture and on the number of
+// threads, which may change the result in the last bits. In case the switch is set to 1 the
+// elements are combined in a fixed order that depends only on the size of the operands, which
+// yields bitwise identical results independent of the instruction set and the number of threads.
+// In case the switch is set to 0 the fastest available order is used.
+//
+// Possible settings for the reproducible reductions:
+//  - Disabled: \b 0
+//  - Enabled : \b 1
+//
+// \note Bitwise reproducibility across different instruction sets additionally requires the
+// compiler not to contract multiplications and additions into fused multiply-add instructions
+// (e.g. \c -ffp-contract=off for GCC and Clang). Since GCC fuses complex multiplications during
+// SLP vectorization irrespective of this setting, the inner product of complex vectors also
+// requires \c -fno-tree-slp-vectorize for GCC.
+//
+// \note It is possible to (de-)activate the reproducible reductions via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_USE_REPRODUCIBLE_REDUCTIONS=1 ...
+   \endcode
+
+   \code
+   #define BLAZE_USE_REPRODUCIBLE_REDUCTIONS 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_REPRODUCIBLE_REDUCTIONS
+#define BLAZE_USE_REPRODUCIBLE_REDUCTIONS 0
+#endif
+//*************************************************************************************************
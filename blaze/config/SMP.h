@@ -62,3 +62,36 @@
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the work-stealing thread pool of the thread-based parallelization.
+// \ingroup config
+//
+// This compilation switch selects the thread pool used by the C++11 and Boost thread-based
+// parallelization. In case the switch is set to 1, every thread of the pool owns a lock-free
+// work-stealing queue (see the WorkStealingThreadPool class template). This reduces the
+// synchronization overhead for large numbers of threads. In case the switch is set to 0, all
+// threads share a single task queue that is protected by a single mutex (see the ThreadPool
+// class template).
+//
+// Possible settings for the work-stealing thread pool switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the work-stealing thread pool via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_USE_WORK_STEALING_THREAD_POOL=1 ...
+   \endcode
+
+   \code
+   #define BLAZE_USE_WORK_STEALING_THREAD_POOL 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_WORK_STEALING_THREAD_POOL
+#define BLAZE_USE_WORK_STEALING_THREAD_POOL 0
+#endif
+//*************************************************************************************************
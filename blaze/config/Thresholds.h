@@ -431,6 +431,39 @@
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime configuration of the SMP thresholds.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime configuration of all SMP thresholds. In
+// case the switch is set to 0, the SMP thresholds are compile time constants. In case the switch
+// is set to 1, the following SMP thresholds only serve as defaults and can be changed at runtime
+// via the setSMPThreshold() function, can be loaded from a tuning file via the
+// loadSMPThresholds() function or via the \c BLAZE_SMP_THRESHOLDS environment variable, and can
+// be determined for the current system via the calibrateSMPThresholds() function.
+//
+// Possible settings for the runtime SMP threshold switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the runtime configuration of the SMP thresholds via
+// command line or by defining this symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_USE_RUNTIME_SMP_THRESHOLDS=1 ...
+   \endcode
+
+   \code
+   #define BLAZE_USE_RUNTIME_SMP_THRESHOLDS 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_RUNTIME_SMP_THRESHOLDS
+#define BLAZE_USE_RUNTIME_SMP_THRESHOLDS 0
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP dense vector assignment threshold.
 // \ingroup config
@@ -2276,3 +2309,117 @@
 #define BLAZE_SMP_SMATREDUCE_THRESHOLD 180UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a total reduction of a dense vector (as for instance the sum,
+// the minimum, a norm or an inner product) can be executed in parallel. In case the number of
+// elements of the dense vector is larger or equal to this threshold, the operation is executed
+// in parallel. If the number of elements is below this threshold the operation is executed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_DVECREDUCE_THRESHOLD=38000 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_DVECREDUCE_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECREDUCE_THRESHOLD
+#define BLAZE_SMP_DVECREDUCE_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix total reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a total reduction of a dense matrix (as for instance the sum,
+// the minimum or a norm of all elements) can be executed in parallel. In case the number of
+// elements of the dense matrix is larger or equal to this threshold, the operation is executed
+// in parallel. If the number of elements is below this threshold the operation is executed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 48400. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_DMATFULLREDUCE_THRESHOLD=48400 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_DMATFULLREDUCE_THRESHOLD 48400UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DMATFULLREDUCE_THRESHOLD
+#define BLAZE_SMP_DMATFULLREDUCE_THRESHOLD 48400UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batched small matrix operation threshold.
+// \ingroup config
+//
+// This threshold specifies when a batched operation on a batch of small matrices (as for instance
+// the batched multiplication or inversion of a BatchMatrix) can be executed in parallel. In case
+// the total number of elements of the batch is larger or equal to this threshold, the operation
+// is executed in parallel. If the number of elements is below this threshold the operation is
+// executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 16384. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_SMP_BATCH_THRESHOLD=16384 ...
+   \endcode
+
+   \code
+   #define BLAZE_SMP_BATCH_THRESHOLD 16384UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_BATCH_THRESHOLD
+#define BLAZE_SMP_BATCH_THRESHOLD 16384UL
+#endif
+//*************************************************************************************************
@@ -129,3 +129,37 @@
 #define BLAZE_USE_XSIMD 0
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for enabling/disabling the built-in vectorized math kernels.
+// \ingroup config
+//
+// In case neither the Intel SVML, nor Sleef, nor XSIMD is available, Blaze can vectorize the
+// exponential function (\c exp()), the natural logarithm (\c log()), the trigonometric functions
+// \c sin() and \c cos(), the hyperbolic tangent (\c tanh()), and the error function (\c erf())
+// for \c float and \c double by means of built-in, header-only polynomial kernels for SSE2,
+// AVX2, and AVX-512. The maximum error of all kernels is at most 3 ULP. In case the switch is
+// set to 0, these operations are not vectorized unless one of the libraries mentioned above is
+// used.
+//
+// Possible settings for the built-in vectorized math switch:
+//  - Deactivated: \b 0
+//  - Activated  : \b 1 (default)
+//
+// \note It is possible to enable/disable the built-in vectorized math kernels via command line
+// or by defining this symbol manually before including any Blaze header file:
+
+   \code
+   g++ ... -DBLAZE_USE_BUILTIN_SIMD_MATH=0 ...
+   \endcode
+
+   \code
+   #define BLAZE_USE_BUILTIN_SIMD_MATH 0
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_BUILTIN_SIMD_MATH
+#define BLAZE_USE_BUILTIN_SIMD_MATH 1
+#endif
+//*************************************************************************************************
@@ -0,0 +1,226 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/CompressedSoAMatrix.h
+//  \brief Header file for the complete CompressedSoAMatrix implementation
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+#ifndef _BLAZE_MATH_COMPRESSEDSOAMATRIX_H_
+#define _BLAZE_MATH_COMPRESSEDSOAMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/sparse/CompressedSoAMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/util/Random.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for CompressedSoAMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of CompressedSoAMatrix. The
+// random matrices are set up by means of the according CompressedMatrix specialization.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Tag type
+        , typename IT >   // Index type
+class Rand< CompressedSoAMatrix<Type,SO,Tag,IT> >
+{
+ public:
+   //**********************************************************************************************
+   /*!\brief Generation of a random CompressedSoAMatrix.
+   //
+   // \param m The number of rows of the random matrix.
+   // \param n The number of columns of the random matrix.
+   // \return The generated random matrix.
+   */
+   inline const CompressedSoAMatrix<Type,SO,Tag,IT> generate( size_t m, size_t n ) const
+   {
+      CompressedSoAMatrix<Type,SO,Tag,IT> matrix( m, n );
+      randomize( matrix );
+
+      return matrix;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Generation of a random CompressedSoAMatrix.
+   //
+   // \param m The number of rows of the random matrix.
+   // \param n The number of columns of the random matrix.
+   // \param nonzeros The number of non-zero elements of the random matrix.
+   // \return The generated random matrix.
+   // \exception std::invalid_argument Invalid number of non-zero elements.
+   */
+   inline const CompressedSoAMatrix<Type,SO,Tag,IT>
+      generate( size_t m, size_t n, size_t nonzeros ) const
+   {
+      CompressedSoAMatrix<Type,SO,Tag,IT> matrix( m, n );
+      randomize( matrix, nonzeros );
+
+      return matrix;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Generation of a random CompressedSoAMatrix.
+   //
+   // \param m The number of rows of the random matrix.
+   // \param n The number of columns of the random matrix.
+   // \param min The smallest possible value for a matrix element.
+   // \param max The largest possible value for a matrix element.
+   // \return The generated random matrix.
+   */
+   template< typename Arg >  // Min/max argument type
+   inline const CompressedSoAMatrix<Type,SO,Tag,IT>
+      generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
+   {
+      CompressedSoAMatrix<Type,SO,Tag,IT> matrix( m, n );
+      randomize( matrix, min, max );
+
+      return matrix;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Generation of a random CompressedSoAMatrix.
+   //
+   // \param m The number of rows of the random matrix.
+   // \param n The number of columns of the random matrix.
+   // \param nonzeros The number of non-zero elements of the random matrix.
+   // \param min The smallest possible value for a matrix element.
+   // \param max The largest possible value for a matrix element.
+   // \return The generated random matrix.
+   // \exception std::invalid_argument Invalid number of non-zero elements.
+   */
+   template< typename Arg >  // Min/max argument type
+   inline const CompressedSoAMatrix<Type,SO,Tag,IT>
+      generate( size_t m, size_t n, size_t nonzeros,
+                const Arg& min, const Arg& max ) const
+   {
+      CompressedSoAMatrix<Type,SO,Tag,IT> matrix( m, n );
+      randomize( matrix, nonzeros, min, max );
+
+      return matrix;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Randomization of a CompressedSoAMatrix.
+   //
+   // \param matrix The matrix to be randomized.
+   // \return void
+   */
+   inline void randomize( CompressedSoAMatrix<Type,SO,Tag,IT>& matrix ) const
+   {
+      CompressedMatrix<Type,SO,Tag> tmp( matrix.rows(), matrix.columns() );
+      blaze::randomize( tmp );
+      matrix = tmp;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Randomization of a CompressedSoAMatrix.
+   //
+   // \param matrix The matrix to be randomized.
+   // \param nonzeros The number of non-zero elements of the random matrix.
+   // \return void
+   // \exception std::invalid_argument Invalid number of non-zero elements.
+   */
+   inline void randomize( CompressedSoAMatrix<Type,SO,Tag,IT>& matrix, size_t nonzeros ) const
+   {
+      CompressedMatrix<Type,SO,Tag> tmp( matrix.rows(), matrix.columns() );
+      blaze::randomize( tmp, nonzeros );
+      matrix = tmp;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Randomization of a CompressedSoAMatrix.
+   //
+   // \param matrix The matrix to be randomized.
+   // \param min The smallest possible value for a matrix element.
+   // \param max The largest possible value for a matrix element.
+   // \return void
+   */
+   template< typename Arg >  // Min/max argument type
+   inline void randomize( CompressedSoAMatrix<Type,SO,Tag,IT>& matrix,
+                          const Arg& min, const Arg& max ) const
+   {
+      CompressedMatrix<Type,SO,Tag> tmp( matrix.rows(), matrix.columns() );
+      blaze::randomize( tmp, min, max );
+      matrix = tmp;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Randomization of a CompressedSoAMatrix.
+   //
+   // \param matrix The matrix to be randomized.
+   // \param nonzeros The number of non-zero elements of the random matrix.
+   // \param min The smallest possible value for a matrix element.
+   // \param max The largest possible value for a matrix element.
+   // \return void
+   // \exception std::invalid_argument Invalid number of non-zero elements.
+   */
+   template< typename Arg >  // Min/max argument type
+   inline void randomize( CompressedSoAMatrix<Type,SO,Tag,IT>& matrix,
+                          size_t nonzeros, const Arg& min, const Arg& max ) const
+   {
+      CompressedMatrix<Type,SO,Tag> tmp( matrix.rows(), matrix.columns() );
+      blaze::randomize( tmp, nonzeros, min, max );
+      matrix = tmp;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
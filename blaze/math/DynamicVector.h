@@ -44,6 +44,7 @@
 #include <blaze/math/dense/StaticVector.h>
 #include <blaze/math/DenseVector.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/UniformVector.h>
 #include <blaze/math/ZeroVector.h>
 #include <blaze/util/Random.h>
 
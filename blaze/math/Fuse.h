@@ -0,0 +1,1188 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/Fuse.h
+//  \brief Header file for the fused evaluation of dense vector and matrix statements
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_FUSE_H_
+#define _BLAZE_MATH_FUSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <tuple>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Restricted.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DenseVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Noop.h>
+#include <blaze/math/functors/Sqrt.h>
+#include <blaze/math/smp/Reduction.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegerSequence.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The number of elements per statement processed in a single block of a fused evaluation.
+// \ingroup math
+//
+// During a fused evaluation all statements are evaluated block by block. This value specifies
+// the (approximate) number of elements of each operand that are processed per block. It is
+// chosen such that the blocks of several operands fit into the private caches of a core.
+*/
+constexpr size_t fusedBlockSize = 2048UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows of the given dense vector in a fused evaluation.
+// \ingroup math
+//
+// \param dv The given dense vector.
+// \return The size of the dense vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline size_t fusedRows( const DenseVector<VT,TF>& dv ) noexcept
+{
+   return (*dv).size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows of the given dense matrix in a fused evaluation.
+// \ingroup math
+//
+// \param dm The given dense matrix.
+// \return The number of rows of the dense matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t fusedRows( const DenseMatrix<MT,SO>& dm ) noexcept
+{
+   return (*dm).rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of elements per row of the given dense vector in a fused evaluation.
+// \ingroup math
+//
+// \param dv The given dense vector.
+// \return 1.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline size_t fusedColumns( const DenseVector<VT,TF>& dv ) noexcept
+{
+   MAYBE_UNUSED( dv );
+
+   return 1UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of elements per row of the given dense matrix in a fused evaluation.
+// \ingroup math
+//
+// \param dm The given dense matrix.
+// \return The number of columns of the dense matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline size_t fusedColumns( const DenseMatrix<MT,SO>& dm ) noexcept
+{
+   return (*dm).columns();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the block of the given dense vector processed in a fused evaluation.
+// \ingroup math
+//
+// \param dv The given dense vector.
+// \param index The index of the first element of the block.
+// \param size The number of elements of the block.
+// \return View on the specified elements of the dense vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) fusedBlock( DenseVector<VT,TF>& dv, size_t index, size_t size )
+{
+   return subvector( *dv, index, size, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the block of the given constant dense vector processed in a fused evaluation.
+// \ingroup math
+//
+// \param dv The given constant dense vector.
+// \param index The index of the first element of the block.
+// \param size The number of elements of the block.
+// \return View on the specified elements of the dense vector.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) fusedBlock( const DenseVector<VT,TF>& dv, size_t index, size_t size )
+{
+   return subvector( *dv, index, size, unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the block of the given dense matrix processed in a fused evaluation.
+// \ingroup math
+//
+// \param dm The given dense matrix.
+// \param index The index of the first row of the block.
+// \param size The number of rows of the block.
+// \return View on the specified rows of the dense matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline decltype(auto) fusedBlock( DenseMatrix<MT,SO>& dm, size_t index, size_t size )
+{
+   return submatrix( *dm, index, 0UL, size, (*dm).columns(), unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the block of the given constant dense matrix processed in a fused evaluation.
+// \ingroup math
+//
+// \param dm The given constant dense matrix.
+// \param index The index of the first row of the block.
+// \param size The number of rows of the block.
+// \return View on the specified rows of the dense matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline decltype(auto) fusedBlock( const DenseMatrix<MT,SO>& dm, size_t index, size_t size )
+{
+   return submatrix( *dm, index, 0UL, size, (*dm).columns(), unchecked );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS FOR FUSED OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment operation of a fused evaluation.
+// \ingroup math
+*/
+struct FusedAssign
+{
+   template< typename T1, typename T2 >
+   static void block( T1& lhs, const T2& rhs ) { assign( lhs, rhs ); }
+
+   template< typename T1, typename T2 >
+   static void whole( T1& lhs, const T2& rhs ) { lhs = rhs; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment operation of a fused evaluation.
+// \ingroup math
+*/
+struct FusedAddAssign
+{
+   template< typename T1, typename T2 >
+   static void block( T1& lhs, const T2& rhs ) { addAssign( lhs, rhs ); }
+
+   template< typename T1, typename T2 >
+   static void whole( T1& lhs, const T2& rhs ) { lhs += rhs; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment operation of a fused evaluation.
+// \ingroup math
+*/
+struct FusedSubAssign
+{
+   template< typename T1, typename T2 >
+   static void block( T1& lhs, const T2& rhs ) { subAssign( lhs, rhs ); }
+
+   template< typename T1, typename T2 >
+   static void whole( T1& lhs, const T2& rhs ) { lhs -= rhs; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Componentwise multiplication assignment operation of a fused evaluation.
+// \ingroup math
+*/
+struct FusedMultAssign
+{
+   template< typename T1, typename T2 >
+   static void block( T1& lhs, const T2& rhs ) { multAssign( lhs, rhs ); }
+
+   template< typename T1, typename T2 >
+   static void whole( T1& lhs, const T2& rhs ) { lhs *= rhs; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Componentwise division assignment operation of a fused evaluation.
+// \ingroup math
+*/
+struct FusedDivAssign
+{
+   template< typename T1, typename T2 >
+   static void block( T1& lhs, const T2& rhs ) { divAssign( lhs, rhs ); }
+
+   template< typename T1, typename T2 >
+   static void whole( T1& lhs, const T2& rhs ) { lhs /= rhs; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block kernel of a fused reduction operation.
+// \ingroup math
+*/
+template< typename OP >  // Type of the reduction operation
+struct FusedReduceKernel
+{
+   template< typename T >
+   decltype(auto) operator()( const T& a ) const { return reduce( a, op_ ); }
+
+   OP op_;  //!< The reduction operation.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block kernel of a fused squared norm computation.
+// \ingroup math
+*/
+struct FusedSqrNormKernel
+{
+   template< typename T >
+   decltype(auto) operator()( const T& a ) const { return sqrNorm( a ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE FUSEDASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lazy assignment statement of a fused evaluation.
+// \ingroup math
+//
+// The FusedAssignment class represents a single (compound) assignment of a dense vector or
+// matrix expression to a dense vector or matrix, which is evaluated as part of a fused
+// evaluation via the fuse() function. Objects of this class are created via the lazyAssign(),
+// lazyAddAssign(), lazySubAssign(), lazyMultAssign(), and lazyDivAssign() functions.
+*/
+template< typename LT    // Type of the left-hand side dense vector or matrix
+        , typename RT    // Type of the right-hand side dense vector or matrix
+        , typename OP >  // Type of the assignment operation
+class FusedAssignment
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite type of the right-hand side operand.
+   using Operand = If_t< IsExpression_v<RT>, const RT, const RT& >;
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using PartialType = bool;  //!< Type of the partial results of a block.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the SMP evaluation of the statement.
+   static constexpr bool smpAssignable = ( IsSMPAssignable_v<LT> && IsSMPAssignable_v<RT> );
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedAssignment class.
+   //
+   // \param lhs The left-hand side target of the assignment.
+   // \param rhs The right-hand side operand of the assignment.
+   */
+   inline FusedAssignment( LT& lhs, const RT& rhs ) noexcept
+      : lhs_( lhs )  // The left-hand side target of the assignment
+      , rhs_( rhs )  // The right-hand side operand of the assignment
+   {}
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the number of rows (or elements) of the statement.
+   //
+   // \return The number of rows of the statement.
+   */
+   inline size_t rows() const noexcept {
+      return fusedRows( lhs_ );
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the number of elements per row of the statement.
+   //
+   // \return The number of elements per row of the statement.
+   */
+   inline size_t columns() const noexcept {
+      return fusedColumns( lhs_ );
+   }
+   //**********************************************************************************************
+
+   //**IsAliased function**************************************************************************
+   /*!\brief Returns whether the block-wise evaluation of the statement reads the given address.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the block-wise evaluation depends on the alias, \a false if not.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return RequiresEvaluation_v<RT> && rhs_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**Conflicts function**************************************************************************
+   /*!\brief Returns whether the given statement depends on the target of this statement.
+   //
+   // \param stmt The statement to be checked.
+   // \return \a true in case a block-wise evaluation is not possible, \a false if it is.
+   */
+   template< typename ST >
+   inline bool conflicts( const ST& stmt ) const noexcept {
+      return stmt.isAliased( &lhs_ );
+   }
+   //**********************************************************************************************
+
+   //**Evaluate function***************************************************************************
+   /*!\brief Evaluates the statement for the given block of rows.
+   //
+   // \param index The index of the first row of the block.
+   // \param size The number of rows of the block.
+   // \return void
+   */
+   inline void evaluate( size_t index, size_t size, PartialType&, bool ) const {
+      auto target( fusedBlock( lhs_, index, size ) );
+      OP::block( target, fusedBlock( rhs_, index, size ) );
+   }
+   //**********************************************************************************************
+
+   //**Combine function****************************************************************************
+   /*!\brief Combines the partial results of two subranges.
+   //
+   // \param a The partial result of the first subrange.
+   // \return The combined partial result.
+   */
+   inline PartialType combine( const PartialType& a, const PartialType& ) const noexcept {
+      return a;
+   }
+   //**********************************************************************************************
+
+   //**Finalize function***************************************************************************
+   /*!\brief Finalizes the statement after all blocks have been evaluated.
+   //
+   // \return void
+   */
+   inline void finalize( const PartialType& ) const noexcept {}
+   //**********************************************************************************************
+
+   //**Sequential function*************************************************************************
+   /*!\brief Evaluates the complete statement by means of the according assignment operator.
+   //
+   // \return void
+   */
+   inline void sequential() const {
+      OP::whole( lhs_, rhs_ );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LT&     lhs_;  //!< The left-hand side target of the assignment.
+   Operand rhs_;  //!< The right-hand side operand of the assignment.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE FUSEDREDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lazy reduction statement of a fused evaluation.
+// \ingroup math
+//
+// The FusedReduction class represents a single reduction of a dense vector or matrix expression,
+// which is evaluated as part of a fused evaluation via the fuse() function. The partial result
+// of each block is computed via the kernel \a KF and the partial results are combined via the
+// operation \a OP. The final result is transformed via \a FT and stored in the given target.
+// Objects of this class are created via the lazyReduce(), lazySum(), lazySqrNorm(), and
+// lazyNorm() functions.
+*/
+template< typename T     // Type of the target
+        , typename VT    // Type of the reduced dense vector or matrix
+        , typename KF    // Type of the block kernel
+        , typename OP    // Type of the combine operation
+        , typename FT >  // Type of the final transformation
+class FusedReduction
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite type of the reduced operand.
+   using Operand = If_t< IsExpression_v<VT>, const VT, const VT& >;
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of the partial results of a block.
+   using PartialType = RemoveCVRef_t<
+      decltype( std::declval<const KF&>()( fusedBlock( std::declval<const VT&>(), 0UL, 0UL ) ) ) >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the SMP evaluation of the statement.
+   static constexpr bool smpAssignable = !IsSMPAssignable_v< ElementType_t<VT> >;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedReduction class.
+   //
+   // \param result The target of the reduction.
+   // \param expr The reduced operand.
+   // \param kernel The block kernel.
+   // \param op The combine operation.
+   // \param final The final transformation.
+   */
+   inline FusedReduction( T& result, const VT& expr, KF kernel, OP op, FT final )
+      : result_( result )             // The target of the reduction
+      , expr_  ( expr )               // The reduced operand
+      , kernel_( std::move(kernel) )  // The block kernel
+      , op_    ( std::move(op) )      // The combine operation
+      , final_ ( std::move(final) )   // The final transformation
+   {}
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the number of rows (or elements) of the statement.
+   //
+   // \return The number of rows of the statement.
+   */
+   inline size_t rows() const noexcept {
+      return fusedRows( expr_ );
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the number of elements per row of the statement.
+   //
+   // \return The number of elements per row of the statement.
+   */
+   inline size_t columns() const noexcept {
+      return fusedColumns( expr_ );
+   }
+   //**********************************************************************************************
+
+   //**IsAliased function**************************************************************************
+   /*!\brief Returns whether the block-wise evaluation of the statement reads the given address.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the block-wise evaluation depends on the alias, \a false if not.
+   */
+   template< typename Other >
+   inline bool isAliased( const Other* alias ) const noexcept {
+      return RequiresEvaluation_v<VT> && expr_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**Conflicts function**************************************************************************
+   /*!\brief Returns whether the given statement depends on the target of this statement.
+   //
+   // \return \a false since the target of a reduction is not a dense vector or matrix.
+   */
+   template< typename ST >
+   inline bool conflicts( const ST& ) const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**Evaluate function***************************************************************************
+   /*!\brief Evaluates the statement for the given block of rows.
+   //
+   // \param index The index of the first row of the block.
+   // \param size The number of rows of the block.
+   // \param partial The partial result of the current subrange.
+   // \param first \a true for the first block of the current subrange, \a false otherwise.
+   // \return void
+   */
+   inline void evaluate( size_t index, size_t size, PartialType& partial, bool first ) const {
+      PartialType value( kernel_( fusedBlock( expr_, index, size ) ) );
+      partial = ( first ? std::move( value ) : op_( partial, value ) );
+   }
+   //**********************************************************************************************
+
+   //**Combine function****************************************************************************
+   /*!\brief Combines the partial results of two subranges.
+   //
+   // \param a The partial result of the first subrange.
+   // \param b The partial result of the second subrange.
+   // \return The combined partial result.
+   */
+   inline PartialType combine( const PartialType& a, const PartialType& b ) const {
+      return op_( a, b );
+   }
+   //**********************************************************************************************
+
+   //**Finalize function***************************************************************************
+   /*!\brief Stores the final result of the reduction in the target.
+   //
+   // \param partial The combined partial result of all subranges.
+   // \return void
+   */
+   inline void finalize( const PartialType& partial ) const {
+      result_ = final_( partial );
+   }
+   //**********************************************************************************************
+
+   //**Sequential function*************************************************************************
+   /*!\brief Evaluates the complete reduction without blocking.
+   //
+   // \return void
+   */
+   inline void sequential() const {
+      result_ = final_( kernel_( expr_ ) );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   T&      result_;  //!< The target of the reduction.
+   Operand expr_;    //!< The reduced operand.
+   KF      kernel_;  //!< The block kernel.
+   OP      op_;      //!< The combine operation.
+   FT      final_;   //!< The final transformation.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a lazy assignment of a dense vector to a dense vector.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be assigned.
+// \return The lazy assignment statement.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function creates a lazy assignment of the dense vector \a rhs to the dense vector \a lhs,
+// which is not evaluated immediately but as part of a fused evaluation via the fuse() function.
+// In contrast to a regular assignment, the target vector is never resized. Thus in case the
+// sizes of the two vectors don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline decltype(auto) lazyAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_RESTRICTED( VT1 );
+
+   if( (*lhs).size() != (*rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return FusedAssignment<VT1,VT2,FusedAssign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a lazy addition assignment of a dense vector to a dense vector.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be added.
+// \return The lazy addition assignment statement.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function creates a lazy addition assignment of the dense vector \a rhs to the dense
+// vector \a lhs, which is evaluated as part of a fused evaluation via the fuse() function.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline decltype(auto) lazyAddAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_RESTRICTED( VT1 );
+
+   if( (*lhs).size() != (*rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return FusedAssignment<VT1,VT2,FusedAddAssign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a lazy subtraction assignment of a dense vector to a dense vector.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return The lazy subtraction assignment statement.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function creates a lazy subtraction assignment of the dense vector \a rhs to the dense
+// vector \a lhs, which is evaluated as part of a fused evaluation via the fuse() function.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline decltype(auto) lazySubAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_RESTRICTED( VT1 );
+
+   if( (*lhs).size() != (*rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return FusedAssignment<VT1,VT2,FusedSubAssign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a lazy componentwise multiplication assignment of a dense vector.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return The lazy multiplication assignment statement.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function creates a lazy componentwise multiplication assignment of the dense vector
+// \a rhs to the dense vector \a lhs, which is evaluated as part of a fused evaluation via the
+// fuse() function.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline decltype(auto) lazyMultAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_RESTRICTED( VT1 );
+
+   if( (*lhs).size() != (*rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return FusedAssignment<VT1,VT2,FusedMultAssign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a lazy componentwise division assignment of a dense vector.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector divisor.
+// \return The lazy division assignment statement.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function creates a lazy componentwise division assignment of the dense vector \a rhs
+// to the dense vector \a lhs, which is evaluated as part of a fused evaluation via the fuse()
+// function.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline decltype(auto) lazyDivAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_RESTRICTED( VT1 );
+
+   if( (*lhs).size() != (*rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return FusedAssignment<VT1,VT2,FusedDivAssign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a lazy assignment of a dense matrix to a dense matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return The lazy assignment statement.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function creates a lazy assignment of the dense matrix \a rhs to the dense matrix \a lhs,
+// which is not evaluated immediately but as part of a fused evaluation via the fuse() function.
+// In contrast to a regular assignment, the target matrix is never resized. Thus in case the
+// sizes of the two matrices don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline decltype(auto) lazyAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_RESTRICTED( MT1 );
+
+   if( (*lhs).rows() != (*rhs).rows() || (*lhs).columns() != (*rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return FusedAssignment<MT1,MT2,FusedAssign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a lazy addition assignment of a dense matrix to a dense matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be added.
+// \return The lazy addition assignment statement.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function creates a lazy addition assignment of the dense matrix \a rhs to the dense
+// matrix \a lhs, which is evaluated as part of a fused evaluation via the fuse() function.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline decltype(auto) lazyAddAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_RESTRICTED( MT1 );
+
+   if( (*lhs).rows() != (*rhs).rows() || (*lhs).columns() != (*rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return FusedAssignment<MT1,MT2,FusedAddAssign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a lazy subtraction assignment of a dense matrix to a dense matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return The lazy subtraction assignment statement.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function creates a lazy subtraction assignment of the dense matrix \a rhs to the dense
+// matrix \a lhs, which is evaluated as part of a fused evaluation via the fuse() function.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO2 >    // Storage order of the right-hand side dense matrix
+inline decltype(auto) lazySubAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_RESTRICTED( MT1 );
+
+   if( (*lhs).rows() != (*rhs).rows() || (*lhs).columns() != (*rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return FusedAssignment<MT1,MT2,FusedSubAssign>( *lhs, *rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a lazy reduction of a dense vector or matrix.
+// \ingroup math
+//
+// \param result The target of the reduction.
+// \param dt The dense vector or matrix to be reduced.
+// \param op The reduction operation.
+// \return The lazy reduction statement.
+//
+// This function creates a lazy total reduction of the dense vector or matrix \a dt by means of
+// the binary operation \a op. The result is stored in \a result as part of a fused evaluation
+// via the fuse() function. The same restrictions as for the reduce() function apply, i.e. the
+// operation \a op has to be associative and commutative.
+*/
+template< typename T     // Type of the target
+        , typename DT    // Type of the dense vector or matrix
+        , typename OP >  // Type of the reduction operation
+inline decltype(auto) lazyReduce( T& result, const DT& dt, OP op )
+{
+   using KF = FusedReduceKernel<OP>;
+
+   return FusedReduction<T,DT,KF,OP,Noop>( result, dt, KF{ op }, op, Noop() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a lazy summation of a dense vector or matrix.
+// \ingroup math
+//
+// \param result The target of the summation.
+// \param dt The dense vector or matrix to be summed up.
+// \return The lazy reduction statement.
+//
+// This function creates a lazy summation of all elements of the dense vector or matrix \a dt,
+// whose result is stored in \a result as part of a fused evaluation via the fuse() function.
+*/
+template< typename T     // Type of the target
+        , typename DT >  // Type of the dense vector or matrix
+inline decltype(auto) lazySum( T& result, const DT& dt )
+{
+   return lazyReduce( result, dt, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a lazy squared Euclidean norm computation of a dense vector or matrix.
+// \ingroup math
+//
+// \param result The target of the squared norm.
+// \param dt The given dense vector or matrix.
+// \return The lazy reduction statement.
+//
+// This function creates a lazy computation of the squared L2 norm of the dense vector or matrix
+// \a dt, whose result is stored in \a result as part of a fused evaluation via the fuse()
+// function.
+*/
+template< typename T     // Type of the target
+        , typename DT >  // Type of the dense vector or matrix
+inline decltype(auto) lazySqrNorm( T& result, const DT& dt )
+{
+   return FusedReduction<T,DT,FusedSqrNormKernel,Add,Noop>(
+      result, dt, FusedSqrNormKernel(), Add(), Noop() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a lazy Euclidean norm computation of a dense vector or matrix.
+// \ingroup math
+//
+// \param result The target of the norm.
+// \param dt The given dense vector or matrix.
+// \return The lazy reduction statement.
+//
+// This function creates a lazy computation of the L2 norm of the dense vector or matrix \a dt,
+// whose result is stored in \a result as part of a fused evaluation via the fuse() function.
+*/
+template< typename T     // Type of the target
+        , typename DT >  // Type of the dense vector or matrix
+inline decltype(auto) lazyNorm( T& result, const DT& dt )
+{
+   return FusedReduction<T,DT,FusedSqrNormKernel,Add,Sqrt>(
+      result, dt, FusedSqrNormKernel(), Add(), Sqrt() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether any of the given statements depends on the target of a statement.
+// \ingroup math
+//
+// \param stmt The statement whose target is checked.
+// \param stmts The tuple of all statements of the fused evaluation.
+// \return \a true in case any statement depends on the target of \a stmt, \a false if not.
+*/
+template< typename ST      // Type of the checked statement
+        , typename TT      // Type of the tuple of statements
+        , size_t... Is >   // Indices of the statements
+inline bool isFusedConflict( const ST& stmt, const TT& stmts, index_sequence<Is...> ) noexcept
+{
+   using Expand = int[];
+
+   bool conflict( false );
+   (void)Expand{ 0, ( conflict = conflict || stmt.conflicts( std::get<Is>( stmts ) ), 0 )... };
+   return conflict;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the fused evaluation of several statements.
+// \ingroup math
+//
+// \param stmts The tuple of all statements of the fused evaluation.
+// \return void
+// \exception std::invalid_argument Sizes of the fused statements do not match.
+*/
+template< typename... STs  // Types of the statements
+        , size_t... Is >   // Indices of the statements
+void fuse_backend( const std::tuple<const STs&...>& stmts, index_sequence<Is...> )
+{
+   using Expand = int[];
+   using PT = std::tuple< typename STs::PartialType... >;
+   using Indices = make_index_sequence< sizeof...(STs) >;
+
+   const size_t m( std::get<0UL>( stmts ).rows() );
+
+   bool matching( true );
+   (void)Expand{ 0, ( matching = matching && std::get<Is>( stmts ).rows() == m, 0 )... };
+
+   if( !matching ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Sizes of the fused statements do not match" );
+   }
+
+   bool aliased( false );
+   (void)Expand{ 0, ( aliased = aliased ||
+                                isFusedConflict( std::get<Is>( stmts ), stmts, Indices() ), 0 )... };
+
+   if( m == 0UL || aliased ) {
+      (void)Expand{ 0, ( std::get<Is>( stmts ).sequential(), 0 )... };
+      return;
+   }
+
+   size_t n( 1UL );
+   bool smpAssignable( true );
+   (void)Expand{ 0, ( n = max( n, std::get<Is>( stmts ).columns() ),
+                      smpAssignable = smpAssignable && STs::smpAssignable, 0 )... };
+
+   const size_t block( max( fusedBlockSize / n, 1UL ) );
+
+   auto kernel = [&stmts,block]( size_t index, size_t size )
+   {
+      PT partials{};
+
+      for( size_t i=index; i<index+size; i+=block ) {
+         const size_t rows( min( block, index+size-i ) );
+         const bool first( i == index );
+         (void)Expand{ 0, ( std::get<Is>( stmts ).evaluate(
+                               i, rows, std::get<Is>( partials ), first ), 0 )... };
+      }
+
+      return partials;
+   };
+
+   auto combine = [&stmts]( const PT& a, const PT& b )
+   {
+      return PT( std::get<Is>( stmts ).combine( std::get<Is>( a ), std::get<Is>( b ) )... );
+   };
+
+   const PT partials( smpAssignable && m*n >= SMP_DVECASSIGN_THRESHOLD
+                      ? smpReduce( m, block, kernel, combine )
+                      : kernel( 0UL, m ) );
+
+   (void)Expand{ 0, ( std::get<Is>( stmts ).finalize( std::get<Is>( partials ) ), 0 )... };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused evaluation of several dense vector and matrix statements.
+// \ingroup math
+//
+// \param stmts The statements to be evaluated.
+// \return void
+// \exception std::invalid_argument Sizes of the fused statements do not match.
+//
+// This function evaluates the given lazy statements in a single sweep over the common index
+// range. Each statement is either a (compound) assignment created via the lazyAssign(),
+// lazyAddAssign(), lazySubAssign(), lazyMultAssign(), and lazyDivAssign() functions or a
+// reduction created via the lazyReduce(), lazySum(), lazySqrNorm(), and lazyNorm() functions.
+// Instead of streaming all operands through memory once per statement, the index range is
+// split into cache-sized blocks and all statements are evaluated block by block in the given
+// order. In case the shared memory parallelization is enabled, the blocks are additionally
+// distributed among the available threads:
+
+   \code
+   blaze::DynamicVector<double> b, r, x, y;
+   blaze::DynamicMatrix<double> A;
+   double a, n;
+   // ... Resizing and initialization
+
+   // Equivalent to the three statements
+   //    y = a*x + y;
+   //    r = b - x;
+   //    n = norm( r );
+   // but evaluated in a single pass over the vectors b, r, x, and y.
+   blaze::fuse( blaze::lazyAssign( y, a*x + y )
+              , blaze::lazyAssign( r, b - x )
+              , blaze::lazyNorm( n, r ) );
+   \endcode
+
+// The result of the fused evaluation is identical to the evaluation of the statements one after
+// another, with the exception of the rounding errors of reductions, whose order of evaluation
+// is unspecified. For matrices the blocks consist of complete rows, i.e. all fused vectors must
+// have as many elements as the fused matrices have rows. In case the sizes of the statements
+// don't match, a \a std::invalid_argument exception is thrown.
+//
+// Statements whose right-hand side operand requires an intermediate evaluation (as for instance
+// a matrix/vector multiplication) can only be evaluated block by block in case they don't
+// depend on the target of any statement of the group. In the following example the second
+// statement depends on the complete vector \a y, which is updated by the first statement. In
+// this case \c fuse() detects the dependency and evaluates all statements one after another:
+
+   \code
+   blaze::fuse( blaze::lazyAssign( y, a*x + y )
+              , blaze::lazyAssign( r, b - A*y )  // Depends on y: No fusion possible
+              , blaze::lazyNorm( n, r ) );
+   \endcode
+
+// \note All other right-hand side operands must be element-wise with respect to the targets of
+// the statements, i.e. the i-th element of the operand must only depend on the i-th elements
+// of the fused vectors (or the i-th rows of the fused matrices). Shifted views on the target
+// of a statement (as for instance \c subvector(y,1UL,n) in a statement that also writes \c y)
+// lead to results different from the sequential evaluation.
+*/
+template< typename ST        // Type of the first statement
+        , typename... STs >  // Types of the remaining statements
+inline void fuse( const ST& stmt, const STs&... stmts )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   fuse_backend( std::tuple<const ST&,const STs&...>( stmt, stmts... ),
+                 make_index_sequence<1UL+sizeof...(STs)>() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
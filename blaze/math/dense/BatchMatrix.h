@@ -0,0 +1,976 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BatchMatrix.h
+//  \brief Header file for the implementation of a batch of small fixed-size dense matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BATCHMATRIX_H_
+#define _BLAZE_MATH_DENSE_BATCHMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup batch_matrix BatchMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a batch of small, fixed-size dense matrices.
+// \ingroup batch_matrix
+//
+// The BatchMatrix class template represents a dynamically sized batch of independent \a M-by-\a N
+// dense matrices. In contrast to a container of individual StaticMatrix instances, the elements
+// of the batch are stored in an interleaved structure-of-arrays layout: The matrices are grouped
+// into chunks of \a SIMDSIZE consecutive matrices, where \a SIMDSIZE corresponds to the number
+// of elements in a SIMD vector of the element type. Within each chunk the matrices are stored
+// element by element, i.e. the element \f$ (i,j) \f$ of all matrices of the chunk is stored
+// consecutively in memory. This enables the batched operations (see batchMult(), batchInvert(),
+// batchLUSolve(), batchLLHSolve(), and batchDet()) to process \a SIMDSIZE independent problems
+// at once with a single SIMD operation. The type of the elements and the dimensions of the
+// matrices can be specified via the three template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, size_t M, size_t N >
+   class BatchMatrix;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BatchMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - M   : specifies the number of rows of each matrix in the batch.
+//  - N   : specifies the number of columns of each matrix in the batch.
+//
+// The matrices of a batch can be accessed element-wise or copied from/to any other matrix of
+// matching dimensions:
+
+   \code
+   using blaze::BatchMatrix;
+   using blaze::StaticMatrix;
+
+   BatchMatrix<double,3UL,3UL> A( 10000UL );  // Batch of 10000 3x3 matrices
+
+   A(0UL,1UL,2UL) = 4.0;  // Setting the element (1,2) of the first matrix
+
+   StaticMatrix<double,3UL,3UL> B{ { 2.0, 0.0, 0.0 }, { 0.0, 3.0, 0.0 }, { 0.0, 0.0, 4.0 } };
+   A.set( 1UL, B );       // Copying the matrix B into the second matrix of the batch
+
+   StaticMatrix<double,3UL,3UL> C( A.get( 1UL ) );  // Extracting the second matrix of the batch
+   \endcode
+
+// Note that in order to provide a uniform processing of all chunks, the memory of the last
+// chunk is padded up to \a SIMDSIZE matrices. The padding matrices are default initialized and
+// are ignored by all batched operations. A batch of vectors (as for instance the right-hand side
+// vectors of a batch of linear systems) is represented by a batch of single-column matrices (see
+// the BatchVector alias template).
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+class BatchMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This        = BatchMatrix<Type,M,N>;           //!< Type of this BatchMatrix instance.
+   using ResultType  = StaticMatrix<Type,M,N,rowMajor>;  //!< Type of a single matrix of the batch.
+   using ElementType = Type;                             //!< Type of the matrix elements.
+   using SIMDType    = SIMDTrait_t<ElementType>;         //!< SIMD type of the matrix elements.
+
+   using Reference      = Type&;        //!< Reference to a matrix element.
+   using ConstReference = const Type&;  //!< Reference to a constant matrix element.
+   using Pointer        = Type*;        //!< Pointer to a non-constant matrix element.
+   using ConstPointer   = const Type*;  //!< Pointer to a constant matrix element.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether the batched operations can process
+       the matrices of a chunk by means of SIMD operations. In case the element type of the
+       batch is a vectorizable data type, the \a simdEnabled compilation flag is set to \a true,
+       otherwise it is set to \a false. */
+   static constexpr bool simdEnabled = IsVectorizable_v<Type>;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The number of matrices per chunk.
+   static constexpr size_t SIMDSIZE = SIMDTrait<Type>::size;
+
+   //! The number of elements per chunk.
+   static constexpr size_t CHUNKSIZE = M * N * SIMDSIZE;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline explicit BatchMatrix() noexcept;
+   inline explicit BatchMatrix( size_t n );
+   inline          BatchMatrix( size_t n, const Type& init );
+
+   inline BatchMatrix( const BatchMatrix& b );
+   inline BatchMatrix( BatchMatrix&& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BatchMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t b, size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t b, size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t b, size_t i, size_t j );
+   inline ConstReference at( size_t b, size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t c ) noexcept;
+   inline ConstPointer   data  ( size_t c ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BatchMatrix& operator=( const BatchMatrix& rhs );
+   inline BatchMatrix& operator=( BatchMatrix&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline constexpr size_t rows() noexcept;
+   static inline constexpr size_t columns() noexcept;
+
+   inline size_t size() const noexcept;
+   inline size_t chunks() const noexcept;
+   inline void   reset();
+   inline void   clear();
+   inline void   resize( size_t n, bool preserve=true );
+   inline void   swap( BatchMatrix& b ) noexcept;
+
+   template< typename MT, bool SO >
+   inline void set( size_t b, const Matrix<MT,SO>& A );
+
+   inline ResultType get( size_t b ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline constexpr size_t chunksFor( size_t n ) noexcept;
+   inline void resetPadding() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;             //!< The current number of matrices of the batch.
+   size_t chunks_;           //!< The current number of chunks of the batch.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated matrix elements.
+                             /*!< Access to the element \f$ (i,j) \f$ of the \a b-th matrix is
+                                  gained via the index \f$ ((c \cdot M + i) \cdot N + j) \cdot
+                                  SIMDSIZE + l \f$, where \a c is the chunk and \a l the lane
+                                  of the matrix. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batch of small, fixed-size dense column vectors.
+// \ingroup batch_matrix
+//
+// The BatchVector alias template represents a batch of independent \a N-dimensional dense column
+// vectors, which are stored as a batch of \a N-by-1 matrices.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+using BatchVector = BatchMatrix<Type,N,1UL>;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BatchMatrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline BatchMatrix<Type,M,N>::BatchMatrix() noexcept
+   : size_  ( 0UL )      // The current number of matrices of the batch
+   , chunks_( 0UL )      // The current number of chunks of the batch
+   , v_     ( nullptr )  // The matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n matrices.
+//
+// \param n The number of matrices of the batch.
+//
+// All elements of all matrices are initialized to their default value.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline BatchMatrix<Type,M,N>::BatchMatrix( size_t n )
+   : size_  ( n )                                  // The current number of matrices of the batch
+   , chunks_( chunksFor( n ) )                     // The current number of chunks of the batch
+   , v_     ( allocate<Type>( chunks_*CHUNKSIZE ) )  // The matrix elements
+{
+   std::fill( v_, v_+chunks_*CHUNKSIZE, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n matrices with homogeneous initialization.
+//
+// \param n The number of matrices of the batch.
+// \param init The initial value of the matrix elements.
+//
+// All elements of all matrices are initialized with the specified value. The padding matrices
+// of the last chunk are initialized to zero.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline BatchMatrix<Type,M,N>::BatchMatrix( size_t n, const Type& init )
+   : BatchMatrix( n )  // Initialization of the batch
+{
+   std::fill( v_, v_+chunks_*CHUNKSIZE, init );
+   resetPadding();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BatchMatrix.
+//
+// \param b Batch to be copied.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline BatchMatrix<Type,M,N>::BatchMatrix( const BatchMatrix& b )
+   : size_  ( b.size_ )                            // The current number of matrices of the batch
+   , chunks_( b.chunks_ )                          // The current number of chunks of the batch
+   , v_     ( allocate<Type>( chunks_*CHUNKSIZE ) )  // The matrix elements
+{
+   std::copy( b.v_, b.v_+chunks_*CHUNKSIZE, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for BatchMatrix.
+//
+// \param b The batch to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline BatchMatrix<Type,M,N>::BatchMatrix( BatchMatrix&& b ) noexcept
+   : size_  ( b.size_ )    // The current number of matrices of the batch
+   , chunks_( b.chunks_ )  // The current number of chunks of the batch
+   , v_     ( b.v_ )       // The matrix elements
+{
+   b.size_   = 0UL;
+   b.chunks_ = 0UL;
+   b.v_      = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BatchMatrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline BatchMatrix<Type,M,N>::~BatchMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 3D-access to the batch elements.
+//
+// \param b Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename BatchMatrix<Type,M,N>::Reference
+   BatchMatrix<Type,M,N>::operator()( size_t b, size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( b < size_, "Invalid matrix access index" );
+   BLAZE_USER_ASSERT( i < M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < N    , "Invalid column access index" );
+   return v_[( ( b / SIMDSIZE * M + i ) * N + j ) * SIMDSIZE + b % SIMDSIZE];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 3D-access to the batch elements.
+//
+// \param b Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename BatchMatrix<Type,M,N>::ConstReference
+   BatchMatrix<Type,M,N>::operator()( size_t b, size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( b < size_, "Invalid matrix access index" );
+   BLAZE_USER_ASSERT( i < M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < N    , "Invalid column access index" );
+   return v_[( ( b / SIMDSIZE * M + i ) * N + j ) * SIMDSIZE + b % SIMDSIZE];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the batch elements.
+//
+// \param b Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename BatchMatrix<Type,M,N>::Reference
+   BatchMatrix<Type,M,N>::at( size_t b, size_t i, size_t j )
+{
+   if( b >= size_ || i >= M || j >= N ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+   return (*this)(b,i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the batch elements.
+//
+// \param b Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename BatchMatrix<Type,M,N>::ConstReference
+   BatchMatrix<Type,M,N>::at( size_t b, size_t i, size_t j ) const
+{
+   if( b >= size_ || i >= M || j >= N ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+   return (*this)(b,i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the batch elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. Note that the elements
+// are stored in the interleaved layout described in the class documentation.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename BatchMatrix<Type,M,N>::Pointer BatchMatrix<Type,M,N>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the batch elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. Note that the elements
+// are stored in the interleaved layout described in the class documentation.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename BatchMatrix<Type,M,N>::ConstPointer BatchMatrix<Type,M,N>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of a specific chunk.
+//
+// \param c The chunk index.
+// \return Pointer to the internal element storage of chunk \a c.
+//
+// This function returns a pointer to the first element of the given chunk. The storage of each
+// chunk is aligned to the alignment of the SIMD vectors of the element type.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename BatchMatrix<Type,M,N>::Pointer BatchMatrix<Type,M,N>::data( size_t c ) noexcept
+{
+   BLAZE_USER_ASSERT( c < chunks_, "Invalid chunk access index" );
+   return v_ + c*CHUNKSIZE;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of a specific chunk.
+//
+// \param c The chunk index.
+// \return Pointer to the internal element storage of chunk \a c.
+//
+// This function returns a pointer to the first element of the given chunk. The storage of each
+// chunk is aligned to the alignment of the SIMD vectors of the element type.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename BatchMatrix<Type,M,N>::ConstPointer
+   BatchMatrix<Type,M,N>::data( size_t c ) const noexcept
+{
+   BLAZE_USER_ASSERT( c < chunks_, "Invalid chunk access index" );
+   return v_ + c*CHUNKSIZE;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BatchMatrix.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline BatchMatrix<Type,M,N>& BatchMatrix<Type,M,N>::operator=( const BatchMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   BatchMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for BatchMatrix.
+//
+// \param rhs The batch to be moved into this instance.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline BatchMatrix<Type,M,N>& BatchMatrix<Type,M,N>::operator=( BatchMatrix&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   size_   = rhs.size_;
+   chunks_ = rhs.chunks_;
+   v_      = rhs.v_;
+
+   rhs.size_   = 0UL;
+   rhs.chunks_ = 0UL;
+   rhs.v_      = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of each matrix of the batch.
+//
+// \return The number of rows of each matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline constexpr size_t BatchMatrix<Type,M,N>::rows() noexcept
+{
+   return M;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of each matrix of the batch.
+//
+// \return The number of columns of each matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline constexpr size_t BatchMatrix<Type,M,N>::columns() noexcept
+{
+   return N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of matrices of the batch.
+//
+// \return The number of matrices of the batch.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline size_t BatchMatrix<Type,M,N>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks of the batch.
+//
+// \return The number of chunks of \a SIMDSIZE matrices.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline size_t BatchMatrix<Type,M,N>::chunks() const noexcept
+{
+   return chunks_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all elements of all matrices to their default initial values. Note that
+// the number of matrices of the batch is not changed.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void BatchMatrix<Type,M,N>::reset()
+{
+   using blaze::reset;
+
+   for( size_t k=0UL; k<chunks_*CHUNKSIZE; ++k ) {
+      reset( v_[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the batch.
+//
+// \return void
+//
+// After the clear() function, the batch contains no matrices.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void BatchMatrix<Type,M,N>::clear()
+{
+   resize( 0UL, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of matrices of the batch.
+//
+// \param n The new number of matrices of the batch.
+// \param preserve \a true if the old values of the batch should be preserved, \a false if not.
+// \return void
+//
+// This function changes the number of matrices of the batch. In case \a preserve is \a true,
+// the first min(\a n, \a size()) matrices keep their values. All new matrices are initialized
+// to their default value.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void BatchMatrix<Type,M,N>::resize( size_t n, bool preserve )
+{
+   const size_t newChunks( chunksFor( n ) );
+
+   if( newChunks != chunks_ )
+   {
+      Type* tmp( allocate<Type>( newChunks*CHUNKSIZE ) );
+      const size_t copies( preserve ? min( chunks_, newChunks ) : 0UL );
+
+      std::copy( v_, v_+copies*CHUNKSIZE, tmp );
+      std::fill( tmp+copies*CHUNKSIZE, tmp+newChunks*CHUNKSIZE, Type() );
+
+      deallocate( v_ );
+      v_      = tmp;
+      chunks_ = newChunks;
+   }
+   else if( !preserve )
+   {
+      std::fill( v_, v_+chunks_*CHUNKSIZE, Type() );
+   }
+
+   size_ = n;
+   resetPadding();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param b The batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void BatchMatrix<Type,M,N>::swap( BatchMatrix& b ) noexcept
+{
+   using std::swap;
+
+   swap( size_  , b.size_   );
+   swap( chunks_, b.chunks_ );
+   swap( v_     , b.v_      );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copying the given matrix into a specific matrix of the batch.
+//
+// \param b The index of the matrix of the batch. The index has to be in the range \f$[0..size-1]\f$.
+// \param A The matrix to be copied.
+// \return void
+// \exception std::out_of_range Invalid matrix access index.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+template< typename MT    // Type of the matrix
+        , bool SO >      // Storage order of the matrix
+inline void BatchMatrix<Type,M,N>::set( size_t b, const Matrix<MT,SO>& A )
+{
+   if( b >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+
+   if( (*A).rows() != M || (*A).columns() != N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const ResultType tmp( *A );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         (*this)(b,i,j) = tmp(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of a specific matrix of the batch.
+//
+// \param b The index of the matrix of the batch. The index has to be in the range \f$[0..size-1]\f$.
+// \return The copy of the matrix.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename BatchMatrix<Type,M,N>::ResultType BatchMatrix<Type,M,N>::get( size_t b ) const
+{
+   if( b >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+
+   ResultType tmp;
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         tmp(i,j) = (*this)(b,i,j);
+      }
+   }
+
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the number of chunks required for the given number of matrices.
+//
+// \param n The number of matrices.
+// \return The number of required chunks.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline constexpr size_t BatchMatrix<Type,M,N>::chunksFor( size_t n ) noexcept
+{
+   return ( n + SIMDSIZE - 1UL ) / SIMDSIZE;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the padding matrices of the last chunk to their default value.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void BatchMatrix<Type,M,N>::resetPadding() noexcept
+{
+   if( chunks_ == 0UL ) return;
+
+   Type* const last( v_ + ( chunks_-1UL )*CHUNKSIZE );
+   const size_t lanes( size_ - ( chunks_-1UL )*SIMDSIZE );
+
+   for( size_t k=0UL; k<M*N; ++k ) {
+      for( size_t l=lanes; l<SIMDSIZE; ++l ) {
+         last[k*SIMDSIZE+l] = Type();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCHMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BatchMatrix operators */
+//@{
+template< typename Type, size_t M, size_t N >
+void reset( BatchMatrix<Type,M,N>& b );
+
+template< typename Type, size_t M, size_t N >
+void clear( BatchMatrix<Type,M,N>& b );
+
+template< typename Type, size_t M, size_t N >
+void swap( BatchMatrix<Type,M,N>& a, BatchMatrix<Type,M,N>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given batch.
+// \ingroup batch_matrix
+//
+// \param b The batch to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void reset( BatchMatrix<Type,M,N>& b )
+{
+   b.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given batch.
+// \ingroup batch_matrix
+//
+// \param b The batch to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void clear( BatchMatrix<Type,M,N>& b )
+{
+   b.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+// \ingroup batch_matrix
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void swap( BatchMatrix<Type,M,N>& a, BatchMatrix<Type,M,N>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
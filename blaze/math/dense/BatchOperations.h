@@ -0,0 +1,1026 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BatchOperations.h
+//  \brief Header file for the batched operations on batches of small dense matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BATCHOPERATIONS_H_
+#define _BLAZE_MATH_DENSE_BATCHOPERATIONS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/BatchMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDConj.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The (approximate) number of elements processed per parallel task of a batched operation.
+// \ingroup batch_matrix
+//
+// In case a batched operation is executed in parallel, the chunks of the batch are distributed
+// to the threads in groups of (approximately) this number of elements. The value is chosen such
+// that a group of chunks fits into the private caches of a core.
+*/
+constexpr size_t batchGranularity = 1024UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS BATCHLANES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the lane-wise access to the elements of a chunk.
+// \ingroup batch_matrix
+//
+// The BatchLanes class template provides the load, store, and broadcast operations used by
+// the batched kernels. In case the element type supports the required SIMD operations, a
+// single pack covers all matrices of a chunk. Otherwise the kernels are executed separately
+// for every matrix of a chunk by means of scalar operations.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool = IsVectorizable_v<Type> &&
+                 HasSIMDAdd_v<Type,Type> &&
+                 HasSIMDSub_v<Type,Type> &&
+                 HasSIMDMult_v<Type,Type> &&
+                 HasSIMDConj_v<Type> >
+struct BatchLanes
+{
+   using PackType = Type;  //!< Type of a pack of elements.
+
+   static constexpr size_t size = 1UL;  //!< The number of matrices processed at once.
+
+   static BLAZE_ALWAYS_INLINE PackType load( const Type* address ) noexcept {
+      return *address;
+   }
+
+   static BLAZE_ALWAYS_INLINE void store( Type* address, const PackType& value ) noexcept {
+      *address = value;
+   }
+
+   static BLAZE_ALWAYS_INLINE PackType set( const Type& value ) noexcept {
+      return value;
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BatchLanes class template for SIMD-enabled element types.
+// \ingroup batch_matrix
+*/
+template< typename Type >  // Data type of the matrix elements
+struct BatchLanes<Type,true>
+{
+   using PackType = SIMDTrait_t<Type>;  //!< Type of a pack of elements.
+
+   static constexpr size_t size = SIMDTrait<Type>::size;  //!< The number of matrices processed at once.
+
+   static BLAZE_ALWAYS_INLINE PackType load( const Type* address ) noexcept {
+      return loada( address );
+   }
+
+   static BLAZE_ALWAYS_INLINE void store( Type* address, const PackType& value ) noexcept {
+      storea( address, value );
+   }
+
+   static BLAZE_ALWAYS_INLINE PackType set( const Type& value ) noexcept {
+      return blaze::set( value );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Searches the pivot row of the given column of a single matrix of a chunk.
+// \ingroup batch_matrix
+//
+// \param A Pointer to the element (0,0) of the matrix.
+// \param k The index of the pivot column.
+// \param stride The distance between two consecutive elements of the matrix.
+// \return The index of the row containing the pivot element.
+*/
+template< size_t N         // Number of columns of the matrix
+        , typename Type >  // Data type of the matrix elements
+inline size_t batchPivot( const Type* A, size_t k, size_t stride )
+{
+   using std::abs;
+
+   size_t p( k );
+   auto pmax( abs( A[(k*N+k)*stride] ) );
+
+   for( size_t i=k+1UL; i<N; ++i ) {
+      const auto value( abs( A[(i*N+k)*stride] ) );
+      if( value > pmax ) {
+         p    = i;
+         pmax = value;
+      }
+   }
+
+   return p;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swaps two rows of a single matrix of a chunk.
+// \ingroup batch_matrix
+//
+// \param A Pointer to the element (0,0) of the matrix.
+// \param i The index of the first row.
+// \param j The index of the second row.
+// \param stride The distance between two consecutive elements of the matrix.
+// \return void
+*/
+template< size_t N         // Number of columns of the matrix
+        , typename Type >  // Data type of the matrix elements
+inline void batchSwapRows( Type* A, size_t i, size_t j, size_t stride )
+{
+   using std::swap;
+
+   for( size_t l=0UL; l<N; ++l ) {
+      swap( A[(i*N+l)*stride], A[(j*N+l)*stride] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the reciprocal of the given pivot element.
+// \ingroup batch_matrix
+//
+// \param pivot The pivot element.
+// \param rcp The resulting reciprocal (0 in case the pivot is not a valid divisor).
+// \return \a true in case the pivot is a valid divisor, \a false if not.
+*/
+template< typename Type >  // Data type of the pivot element
+inline bool batchReciprocal( const Type& pivot, Type& rcp )
+{
+   if( !isDivisor( pivot ) ) {
+      reset( rcp );
+      return false;
+   }
+
+   rcp = Type(1) / pivot;
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the multiplication of the matrices of a chunk.
+// \ingroup batch_matrix
+//
+// \param C Pointer to the target chunk.
+// \param A Pointer to the chunk of the left-hand side matrices.
+// \param B Pointer to the chunk of the right-hand side matrices.
+// \param stride The distance between two consecutive elements of a matrix.
+// \return void
+*/
+template< typename Lanes   // Type of the lane access helper
+        , size_t M         // Number of rows of the left-hand side matrices
+        , size_t K         // Number of columns of the left-hand side matrices
+        , size_t N         // Number of columns of the right-hand side matrices
+        , typename Type >  // Data type of the matrix elements
+void batchMultKernel( Type* C, const Type* A, const Type* B, size_t stride )
+{
+   using PT = typename Lanes::PackType;
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j )
+      {
+         PT value( Lanes::set( Type() ) );
+
+         for( size_t k=0UL; k<K; ++k ) {
+            value = value + Lanes::load( A+(i*K+k)*stride ) * Lanes::load( B+(k*N+j)*stride );
+         }
+
+         Lanes::store( C+(i*N+j)*stride, value );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the in-place inversion of the matrices of a chunk.
+// \ingroup batch_matrix
+//
+// \param A Pointer to the chunk of matrices to be inverted.
+// \param stride The distance between two consecutive elements of a matrix.
+// \return Bit mask of the matrices that could not be inverted.
+//
+// This kernel performs a Gauss-Jordan elimination with partial pivoting. The pivot search and
+// the row interchanges are performed separately per matrix, the elimination steps are performed
+// for all matrices of the chunk at once.
+*/
+template< typename Lanes   // Type of the lane access helper
+        , size_t N         // Number of rows and columns of the matrices
+        , typename Type >  // Data type of the matrix elements
+size_t batchInvertKernel( Type* A, size_t stride )
+{
+   using PT = typename Lanes::PackType;
+
+   AlignedArray<Type,Lanes::size> rcp;
+   size_t piv[N][Lanes::size];
+   size_t mask( 0UL );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      for( size_t l=0UL; l<Lanes::size; ++l )
+      {
+         const size_t p( batchPivot<N>( A+l, k, stride ) );
+         piv[k][l] = p;
+
+         if( p != k ) {
+            batchSwapRows<N>( A+l, k, p, stride );
+         }
+
+         if( !batchReciprocal( A[(k*N+k)*stride+l], rcp[l] ) ) {
+            mask |= ( 1UL << l );
+         }
+      }
+
+      const PT inv( Lanes::load( rcp.data() ) );
+
+      Lanes::store( A+(k*N+k)*stride, Lanes::set( Type(1) ) );
+      for( size_t j=0UL; j<N; ++j ) {
+         Lanes::store( A+(k*N+j)*stride, Lanes::load( A+(k*N+j)*stride ) * inv );
+      }
+
+      for( size_t i=0UL; i<N; ++i )
+      {
+         if( i == k ) continue;
+
+         const PT factor( Lanes::load( A+(i*N+k)*stride ) );
+         Lanes::store( A+(i*N+k)*stride, Lanes::set( Type() ) );
+
+         for( size_t j=0UL; j<N; ++j ) {
+            Lanes::store( A+(i*N+j)*stride,
+                          Lanes::load( A+(i*N+j)*stride ) - factor * Lanes::load( A+(k*N+j)*stride ) );
+         }
+      }
+   }
+
+   for( size_t k=N; k-->0UL; ) {
+      for( size_t l=0UL; l<Lanes::size; ++l ) {
+         if( piv[k][l] == k ) continue;
+         for( size_t i=0UL; i<N; ++i ) {
+            std::swap( A[(i*N+k)*stride+l], A[(i*N+piv[k][l])*stride+l] );
+         }
+      }
+   }
+
+   return mask;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the solution of the linear systems of a chunk via LU decomposition.
+// \ingroup batch_matrix
+//
+// \param A Pointer to a (modifiable) copy of the chunk of system matrices.
+// \param B Pointer to the chunk of right-hand sides, which is overwritten with the solutions.
+// \param stride The distance between two consecutive elements of a matrix.
+// \return Bit mask of the matrices that are singular.
+//
+// This kernel performs an LU decomposition with partial pivoting, followed by a forward and
+// backward substitution. The pivot search and the row interchanges are performed separately
+// per matrix, the elimination and substitution steps are performed for all matrices of the
+// chunk at once.
+*/
+template< typename Lanes   // Type of the lane access helper
+        , size_t N         // Number of rows and columns of the system matrices
+        , size_t K         // Number of right-hand sides
+        , typename Type >  // Data type of the matrix elements
+size_t batchLUSolveKernel( Type* A, Type* B, size_t stride )
+{
+   using PT = typename Lanes::PackType;
+
+   AlignedArray<Type,Lanes::size> rcp;
+   size_t mask( 0UL );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      for( size_t l=0UL; l<Lanes::size; ++l )
+      {
+         const size_t p( batchPivot<N>( A+l, k, stride ) );
+
+         if( p != k ) {
+            batchSwapRows<N>( A+l, k, p, stride );
+            batchSwapRows<K>( B+l, k, p, stride );
+         }
+
+         if( !batchReciprocal( A[(k*N+k)*stride+l], rcp[l] ) ) {
+            mask |= ( 1UL << l );
+         }
+      }
+
+      // Storing the reciprocal of the pivot for the backward substitution
+      const PT inv( Lanes::load( rcp.data() ) );
+      Lanes::store( A+(k*N+k)*stride, inv );
+
+      for( size_t i=k+1UL; i<N; ++i )
+      {
+         const PT factor( Lanes::load( A+(i*N+k)*stride ) * inv );
+
+         for( size_t j=k+1UL; j<N; ++j ) {
+            Lanes::store( A+(i*N+j)*stride,
+                          Lanes::load( A+(i*N+j)*stride ) - factor * Lanes::load( A+(k*N+j)*stride ) );
+         }
+         for( size_t j=0UL; j<K; ++j ) {
+            Lanes::store( B+(i*K+j)*stride,
+                          Lanes::load( B+(i*K+j)*stride ) - factor * Lanes::load( B+(k*K+j)*stride ) );
+         }
+      }
+   }
+
+   for( size_t k=N; k-->0UL; )
+   {
+      const PT inv( Lanes::load( A+(k*N+k)*stride ) );
+
+      for( size_t j=0UL; j<K; ++j ) {
+         Lanes::store( B+(k*K+j)*stride, Lanes::load( B+(k*K+j)*stride ) * inv );
+      }
+
+      for( size_t i=0UL; i<k; ++i )
+      {
+         const PT factor( Lanes::load( A+(i*N+k)*stride ) );
+
+         for( size_t j=0UL; j<K; ++j ) {
+            Lanes::store( B+(i*K+j)*stride,
+                          Lanes::load( B+(i*K+j)*stride ) - factor * Lanes::load( B+(k*K+j)*stride ) );
+         }
+      }
+   }
+
+   return mask;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the solution of the linear systems of a chunk via Cholesky decomposition.
+// \ingroup batch_matrix
+//
+// \param A Pointer to a (modifiable) copy of the chunk of system matrices.
+// \param B Pointer to the chunk of right-hand sides, which is overwritten with the solutions.
+// \param stride The distance between two consecutive elements of a matrix.
+// \return Bit mask of the matrices that are not positive definite.
+//
+// This kernel performs a Cholesky decomposition \f$ A = L \cdot L^H \f$, followed by a forward
+// and backward substitution. Only the lower part of the system matrices is accessed. The square
+// roots of the diagonal elements are computed separately per matrix, all other steps are
+// performed for all matrices of the chunk at once.
+*/
+template< typename Lanes   // Type of the lane access helper
+        , size_t N         // Number of rows and columns of the system matrices
+        , size_t K         // Number of right-hand sides
+        , typename Type >  // Data type of the matrix elements
+size_t batchLLHSolveKernel( Type* A, Type* B, size_t stride )
+{
+   using PT = typename Lanes::PackType;
+   using BT = UnderlyingBuiltin_t<Type>;
+
+   AlignedArray<Type,Lanes::size> rcp;
+   size_t mask( 0UL );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      for( size_t l=0UL; l<Lanes::size; ++l )
+      {
+         const BT diagonal( real( A[(k*N+k)*stride+l] ) );
+
+         if( diagonal > BT(0) ) {
+            rcp[l] = BT(1) / std::sqrt( diagonal );
+         }
+         else {
+            reset( rcp[l] );
+            mask |= ( 1UL << l );
+         }
+      }
+
+      // Storing the reciprocal of the diagonal element of L for the substitutions
+      const PT inv( Lanes::load( rcp.data() ) );
+      Lanes::store( A+(k*N+k)*stride, inv );
+
+      for( size_t i=k+1UL; i<N; ++i ) {
+         Lanes::store( A+(i*N+k)*stride, Lanes::load( A+(i*N+k)*stride ) * inv );
+      }
+
+      for( size_t j=k+1UL; j<N; ++j )
+      {
+         const PT factor( conj( Lanes::load( A+(j*N+k)*stride ) ) );
+
+         for( size_t i=j; i<N; ++i ) {
+            Lanes::store( A+(i*N+j)*stride,
+                          Lanes::load( A+(i*N+j)*stride ) - Lanes::load( A+(i*N+k)*stride ) * factor );
+         }
+      }
+   }
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      const PT inv( Lanes::load( A+(k*N+k)*stride ) );
+
+      for( size_t j=0UL; j<K; ++j ) {
+         Lanes::store( B+(k*K+j)*stride, Lanes::load( B+(k*K+j)*stride ) * inv );
+      }
+
+      for( size_t i=k+1UL; i<N; ++i )
+      {
+         const PT factor( Lanes::load( A+(i*N+k)*stride ) );
+
+         for( size_t j=0UL; j<K; ++j ) {
+            Lanes::store( B+(i*K+j)*stride,
+                          Lanes::load( B+(i*K+j)*stride ) - factor * Lanes::load( B+(k*K+j)*stride ) );
+         }
+      }
+   }
+
+   for( size_t k=N; k-->0UL; )
+   {
+      const PT inv( Lanes::load( A+(k*N+k)*stride ) );
+
+      for( size_t j=0UL; j<K; ++j ) {
+         Lanes::store( B+(k*K+j)*stride, Lanes::load( B+(k*K+j)*stride ) * inv );
+      }
+
+      for( size_t i=0UL; i<k; ++i )
+      {
+         const PT factor( conj( Lanes::load( A+(k*N+i)*stride ) ) );
+
+         for( size_t j=0UL; j<K; ++j ) {
+            Lanes::store( B+(i*K+j)*stride,
+                          Lanes::load( B+(i*K+j)*stride ) - factor * Lanes::load( B+(k*K+j)*stride ) );
+         }
+      }
+   }
+
+   return mask;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the computation of the determinants of the matrices of a chunk.
+// \ingroup batch_matrix
+//
+// \param A Pointer to a (modifiable) copy of the chunk of matrices.
+// \param det Pointer to the resulting determinants.
+// \param stride The distance between two consecutive elements of a matrix.
+// \return void
+//
+// This kernel computes the determinants via an LU decomposition with partial pivoting. In order
+// to preserve the determinant, each row interchange is combined with a negation of the row that
+// is moved out of the pivot position.
+*/
+template< typename Lanes   // Type of the lane access helper
+        , size_t N         // Number of rows and columns of the matrices
+        , typename Type >  // Data type of the matrix elements
+void batchDetKernel( Type* A, Type* det, size_t stride )
+{
+   using PT = typename Lanes::PackType;
+
+   AlignedArray<Type,Lanes::size> rcp;
+   PT value( Lanes::set( Type(1) ) );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      for( size_t l=0UL; l<Lanes::size; ++l )
+      {
+         const size_t p( batchPivot<N>( A+l, k, stride ) );
+
+         if( p != k ) {
+            batchSwapRows<N>( A+l, k, p, stride );
+            for( size_t j=k; j<N; ++j ) {
+               A[(p*N+j)*stride+l] = -A[(p*N+j)*stride+l];
+            }
+         }
+
+         batchReciprocal( A[(k*N+k)*stride+l], rcp[l] );
+      }
+
+      value = value * Lanes::load( A+(k*N+k)*stride );
+
+      const PT inv( Lanes::load( rcp.data() ) );
+
+      for( size_t i=k+1UL; i<N; ++i )
+      {
+         const PT factor( Lanes::load( A+(i*N+k)*stride ) * inv );
+
+         for( size_t j=k+1UL; j<N; ++j ) {
+            Lanes::store( A+(i*N+j)*stride,
+                          Lanes::load( A+(i*N+j)*stride ) - factor * Lanes::load( A+(k*N+j)*stride ) );
+         }
+      }
+   }
+
+   Lanes::store( det, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH DRIVERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given lane kernel for all matrices of a single chunk.
+// \ingroup batch_matrix
+//
+// \param lanes The number of valid (i.e. non-padding) matrices of the chunk.
+// \param kernel The kernel to be executed for a lane offset.
+// \return The number of valid matrices for which the kernel reported a failure.
+//
+// In case the element type supports the required SIMD operations, the kernel is executed once
+// for all matrices of the chunk. Otherwise the kernel is executed for every valid matrix of
+// the chunk separately.
+*/
+template< typename Type      // Data type of the matrix elements
+        , typename Kernel >  // Type of the lane kernel
+size_t batchChunk( size_t lanes, Kernel kernel )
+{
+   using Lanes = BatchLanes<Type>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   BLAZE_STATIC_ASSERT( SIMDSIZE <= 64UL );
+
+   size_t mask( 0UL );
+
+   if( Lanes::size == SIMDSIZE ) {
+      mask = kernel( Lanes(), 0UL );
+   }
+   else for( size_t l=0UL; l<lanes; ++l ) {
+      mask |= ( kernel( Lanes(), l ) << l );
+   }
+
+   size_t failures( 0UL );
+
+   for( size_t l=0UL; l<lanes; ++l ) {
+      if( mask & ( 1UL << l ) ) ++failures;
+   }
+
+   return failures;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given chunk kernel for all chunks of a batch.
+// \ingroup batch_matrix
+//
+// \param size The number of matrices of the batch.
+// \param elements The number of elements per matrix of the batch.
+// \param kernel The kernel to be executed for a single chunk.
+// \return The total number of failures reported by the chunk kernel.
+//
+// In case the total number of elements of the batch is larger or equal to the SMP batch
+// threshold, the chunks of the batch are processed in parallel.
+*/
+template< size_t SIMDSIZE    // Number of matrices per chunk
+        , typename Kernel >  // Type of the chunk kernel
+size_t batchRun( size_t size, size_t elements, Kernel kernel )
+{
+   const size_t chunks( ( size + SIMDSIZE - 1UL ) / SIMDSIZE );
+
+   const auto range = [size,&kernel]( size_t index, size_t n )
+   {
+      size_t failures( 0UL );
+
+      for( size_t c=index; c<index+n; ++c ) {
+         failures += kernel( c, min( SIMDSIZE, size - c*SIMDSIZE ) );
+      }
+
+      return failures;
+   };
+
+   const auto combine = []( size_t a, size_t b ) {
+      return a + b;
+   };
+
+   const size_t granularity( max( batchGranularity / ( elements*SIMDSIZE ), 1UL ) );
+
+   return ( size*elements >= SMP_BATCH_THRESHOLD )
+          ? smpReduce( chunks, granularity, range, combine )
+          : range( 0UL, chunks );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCHED OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Batched operations */
+//@{
+template< typename Type, size_t M, size_t K, size_t N >
+void batchMult( BatchMatrix<Type,M,N>& C, const BatchMatrix<Type,M,K>& A,
+                const BatchMatrix<Type,K,N>& B );
+
+template< typename Type, size_t N >
+void batchInvert( BatchMatrix<Type,N,N>& A );
+
+template< typename Type, size_t N, size_t K >
+void batchLUSolve( const BatchMatrix<Type,N,N>& A, BatchMatrix<Type,N,K>& B );
+
+template< typename Type, size_t N, size_t K >
+void batchLLHSolve( const BatchMatrix<Type,N,N>& A, BatchMatrix<Type,N,K>& B );
+
+template< typename Type, size_t N >
+DynamicVector<Type> batchDet( const BatchMatrix<Type,N,N>& A );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of small dense matrices.
+// \ingroup batch_matrix
+//
+// \param C The resulting batch of \a M-by-\a N matrices.
+// \param A The batch of left-hand side \a M-by-\a K matrices.
+// \param B The batch of right-hand side \a K-by-\a N matrices.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function computes the products \f$ C_b = A_b \cdot B_b \f$ of all matrices of the given
+// batches. The batch \a C is resized to the size of the operand batches. The products of all
+// matrices of a chunk are computed at once by means of SIMD operations, the chunks are processed
+// in parallel in case the SMP batch threshold is reached (see BLAZE_SMP_BATCH_THRESHOLD).
+
+   \code
+   blaze::BatchMatrix<double,4UL,4UL> A( 100000UL ), B( 100000UL ), C;
+   // ... Initialization of A and B
+
+   blaze::batchMult( C, A, B );  // Computing 100000 independent 4x4 matrix products
+   \endcode
+
+// Note that \a C may refer to the same batch as \a A or \a B.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+void batchMult( BatchMatrix<Type,M,N>& C, const BatchMatrix<Type,M,K>& A,
+                const BatchMatrix<Type,K,N>& B )
+{
+   constexpr size_t SIMDSIZE( BatchMatrix<Type,M,N>::SIMDSIZE );
+
+   if( A.size() != B.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   if( static_cast<const void*>( &C ) == static_cast<const void*>( &A ) ||
+       static_cast<const void*>( &C ) == static_cast<const void*>( &B ) ) {
+      BatchMatrix<Type,M,N> tmp;
+      batchMult( tmp, A, B );
+      C = std::move( tmp );
+      return;
+   }
+
+   C.resize( A.size(), false );
+
+   batchRun<SIMDSIZE>( A.size(), M*N*K, [&]( size_t c, size_t lanes ) {
+      return batchChunk<Type>( lanes, [&]( auto lane, size_t l ) {
+         batchMultKernel<decltype(lane),M,K,N>( C.data(c)+l, A.data(c)+l, B.data(c)+l, SIMDSIZE );
+         return 0UL;
+      } );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched in-place inversion of small dense matrices.
+// \ingroup batch_matrix
+//
+// \param A The batch of \a N-by-\a N matrices to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts all matrices of the given batch by means of a Gauss-Jordan elimination
+// with partial pivoting. The elimination steps of all matrices of a chunk are performed at once
+// by means of SIMD operations, the chunks are processed in parallel in case the SMP batch
+// threshold is reached (see BLAZE_SMP_BATCH_THRESHOLD). In case any of the matrices is singular,
+// a \a std::runtime_error exception is thrown.
+
+   \code
+   blaze::BatchMatrix<double,3UL,3UL> A( 100000UL );
+   // ... Initialization of A
+
+   blaze::batchInvert( A );  // Inverting 100000 independent 3x3 matrices
+   \endcode
+
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of
+// an exception \a A may already have been modified.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t N >     // Number of rows and columns of the matrices
+void batchInvert( BatchMatrix<Type,N,N>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   constexpr size_t SIMDSIZE( BatchMatrix<Type,N,N>::SIMDSIZE );
+
+   const size_t failures( batchRun<SIMDSIZE>( A.size(), N*N*N, [&]( size_t c, size_t lanes ) {
+      return batchChunk<Type>( lanes, [&]( auto lane, size_t l ) {
+         return batchInvertKernel<decltype(lane),N>( A.data(c)+l, SIMDSIZE );
+      } );
+   } ) );
+
+   if( failures > 0UL ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched solution of small dense linear systems via LU decomposition.
+// \ingroup batch_matrix
+//
+// \param A The batch of \a N-by-\a N system matrices.
+// \param B The batch of \a N-by-\a K right-hand sides, which is overwritten with the solutions.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function solves the linear systems \f$ A_b \cdot X_b = B_b \f$ of all matrices of the
+// given batches by means of an LU decomposition with partial pivoting. The system matrices are
+// not modified, the right-hand sides are overwritten with the solutions. The elimination and
+// substitution steps of all systems of a chunk are performed at once by means of SIMD operations,
+// the chunks are processed in parallel in case the SMP batch threshold is reached (see
+// BLAZE_SMP_BATCH_THRESHOLD). In case any of the system matrices is singular, a
+// \a std::runtime_error exception is thrown.
+
+   \code
+   blaze::BatchMatrix<double,6UL,6UL> A( 100000UL );
+   blaze::BatchVector<double,6UL> b( 100000UL );
+   // ... Initialization of A and b
+
+   blaze::batchLUSolve( A, b );  // Solving 100000 independent 6x6 linear systems
+   \endcode
+
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of
+// an exception \a B may already have been modified.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t N       // Number of rows and columns of the system matrices
+        , size_t K >     // Number of right-hand sides
+void batchLUSolve( const BatchMatrix<Type,N,N>& A, BatchMatrix<Type,N,K>& B )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   constexpr size_t SIMDSIZE ( BatchMatrix<Type,N,N>::SIMDSIZE  );
+   constexpr size_t CHUNKSIZE( BatchMatrix<Type,N,N>::CHUNKSIZE );
+
+   if( A.size() != B.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   const size_t failures( batchRun<SIMDSIZE>( A.size(), N*N*( N+K ), [&]( size_t c, size_t lanes ) {
+      AlignedArray<Type,CHUNKSIZE> work;
+      std::copy( A.data(c), A.data(c)+CHUNKSIZE, work.data() );
+      return batchChunk<Type>( lanes, [&]( auto lane, size_t l ) {
+         return batchLUSolveKernel<decltype(lane),N,K>( work.data()+l, B.data(c)+l, SIMDSIZE );
+      } );
+   } ) );
+
+   if( failures > 0UL ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Solving LSE with singular system matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched solution of small positive definite linear systems via Cholesky decomposition.
+// \ingroup batch_matrix
+//
+// \param A The batch of \a N-by-\a N symmetric (or Hermitian) positive definite system matrices.
+// \param B The batch of \a N-by-\a K right-hand sides, which is overwritten with the solutions.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function solves the linear systems \f$ A_b \cdot X_b = B_b \f$ of all matrices of the
+// given batches by means of a Cholesky decomposition \f$ A_b = L_b \cdot L_b^H \f$. Only the
+// lower part of the system matrices is accessed and the system matrices are not modified. The
+// right-hand sides are overwritten with the solutions. All steps except for the computation of
+// the square roots are performed for all systems of a chunk at once by means of SIMD operations,
+// the chunks are processed in parallel in case the SMP batch threshold is reached (see
+// BLAZE_SMP_BATCH_THRESHOLD). In case any of the system matrices is not positive definite, a
+// \a std::runtime_error exception is thrown.
+//
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of
+// an exception \a B may already have been modified.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t N       // Number of rows and columns of the system matrices
+        , size_t K >     // Number of right-hand sides
+void batchLLHSolve( const BatchMatrix<Type,N,N>& A, BatchMatrix<Type,N,K>& B )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   constexpr size_t SIMDSIZE ( BatchMatrix<Type,N,N>::SIMDSIZE  );
+   constexpr size_t CHUNKSIZE( BatchMatrix<Type,N,N>::CHUNKSIZE );
+
+   if( A.size() != B.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   const size_t failures( batchRun<SIMDSIZE>( A.size(), N*N*( N+K ), [&]( size_t c, size_t lanes ) {
+      AlignedArray<Type,CHUNKSIZE> work;
+      std::copy( A.data(c), A.data(c)+CHUNKSIZE, work.data() );
+      return batchChunk<Type>( lanes, [&]( auto lane, size_t l ) {
+         return batchLLHSolveKernel<decltype(lane),N,K>( work.data()+l, B.data(c)+l, SIMDSIZE );
+      } );
+   } ) );
+
+   if( failures > 0UL ) {
+      BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched computation of the determinants of small dense matrices.
+// \ingroup batch_matrix
+//
+// \param A The batch of \a N-by-\a N matrices.
+// \return The determinants of all matrices of the batch.
+//
+// This function computes the determinants of all matrices of the given batch by means of an LU
+// decomposition with partial pivoting. The elimination steps of all matrices of a chunk are
+// performed at once by means of SIMD operations, the chunks are processed in parallel in case
+// the SMP batch threshold is reached (see BLAZE_SMP_BATCH_THRESHOLD). The determinant of a
+// singular matrix is 0.
+
+   \code
+   blaze::BatchMatrix<double,5UL,5UL> A( 100000UL );
+   // ... Initialization of A
+
+   blaze::DynamicVector<double> d( blaze::batchDet( A ) );
+   \endcode
+
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t N >     // Number of rows and columns of the matrices
+DynamicVector<Type> batchDet( const BatchMatrix<Type,N,N>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   constexpr size_t SIMDSIZE ( BatchMatrix<Type,N,N>::SIMDSIZE  );
+   constexpr size_t CHUNKSIZE( BatchMatrix<Type,N,N>::CHUNKSIZE );
+
+   DynamicVector<Type> d( A.size() );
+
+   batchRun<SIMDSIZE>( A.size(), N*N*N, [&]( size_t c, size_t lanes ) {
+      AlignedArray<Type,CHUNKSIZE> work;
+      AlignedArray<Type,SIMDSIZE> det;
+      std::copy( A.data(c), A.data(c)+CHUNKSIZE, work.data() );
+      batchChunk<Type>( lanes, [&]( auto lane, size_t l ) {
+         batchDetKernel<decltype(lane),N>( work.data()+l, det.data()+l, SIMDSIZE );
+         return 0UL;
+      } );
+      for( size_t l=0UL; l<lanes; ++l ) {
+         d[c*SIMDSIZE+l] = det[l];
+      }
+      return 0UL;
+   } );
+
+   return d;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
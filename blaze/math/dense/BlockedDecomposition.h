@@ -0,0 +1,587 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BlockedDecomposition.h
+//  \brief Header file for the native blocked LU, Cholesky, and QR decompositions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BLOCKEDDECOMPOSITION_H_
+#define _BLAZE_MATH_DENSE_BLOCKEDDECOMPOSITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/Contiguous.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsZero.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BLOCKED DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Blocked decomposition functions */
+//@{
+template< typename MT, bool SO >
+void blockedGetrf( DenseMatrix<MT,SO>& A, blas_int_t* ipiv );
+
+template< typename MT, bool SO >
+void blockedPotrf( DenseMatrix<MT,SO>& A );
+
+template< typename MT, bool SO >
+void blockedGeqrf( DenseMatrix<MT,SO>& A, ElementType_t<MT>* tau );
+
+template< typename MT, bool SO >
+void blockedOrgqr( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the sum of the absolute values of the real and imaginary part of the given value.
+// \ingroup dense_matrix
+//
+// \param a The given value.
+// \return The sum of the absolute values of the real and imaginary part.
+//
+// This auxiliary function is used as the pivoting criterion of the blocked LU decomposition. It
+// corresponds to the criterion of the LAPACK \c getrf() functions.
+*/
+template< typename T >
+inline auto blockedPivotValue( const T& a )
+{
+   using std::abs;
+
+   return abs( real( a ) ) + abs( imag( a ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the blocked LU decomposition of a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The column-major matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function performs a right-looking blocked LU decomposition with partial pivoting. Each
+// panel of DECOMPOSITION_BLOCK_SIZE columns is factorized by means of rank-1 updates, the row
+// interchanges are applied to the remaining columns, the according block row of \c U is computed
+// by a forward substitution with the unit lower triangular diagonal block, and finally the
+// trailing submatrix is updated via a dense matrix/dense matrix multiplication, which is executed
+// in parallel in case the shared memory parallelization is enabled.
+*/
+template< typename MT >  // Type of the dense matrix
+void blockedGetrf_backend( MT& A, blas_int_t* ipiv )
+{
+   using std::swap;
+
+   using ET = ElementType_t<MT>;
+
+   const size_t m( A.rows() );
+   const size_t n( A.columns() );
+   const size_t mindim( min( m, n ) );
+
+   for( size_t k=0UL; k<mindim; k+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t kb  ( min( DECOMPOSITION_BLOCK_SIZE, mindim-k ) );
+      const size_t kend( k + kb );
+
+      // Factorization of the current panel
+      for( size_t j=k; j<kend; ++j )
+      {
+         size_t p( j );
+         auto pmax( blockedPivotValue( A(j,j) ) );
+
+         for( size_t i=j+1UL; i<m; ++i ) {
+            const auto value( blockedPivotValue( A(i,j) ) );
+            if( value > pmax ) {
+               p    = i;
+               pmax = value;
+            }
+         }
+
+         ipiv[j] = numeric_cast<blas_int_t>( p+1UL );
+
+         if( p != j ) {
+            for( size_t l=k; l<kend; ++l ) {
+               swap( A(j,l), A(p,l) );
+            }
+         }
+
+         if( !isDefault( A(j,j) ) ) {
+            subvector( column( A, j, unchecked ), j+1UL, m-j-1UL, unchecked ) *= ET(1) / A(j,j);
+         }
+
+         if( j+1UL < kend ) {
+            submatrix( A, j+1UL, j+1UL, m-j-1UL, kend-j-1UL, unchecked ) -=
+               subvector( column( A, j, unchecked ), j+1UL, m-j-1UL, unchecked ) *
+               subvector( row( A, j, unchecked ), j+1UL, kend-j-1UL, unchecked );
+         }
+      }
+
+      // Application of the row interchanges to the columns left and right of the panel
+      for( size_t j=k; j<kend; ++j )
+      {
+         const size_t p( ipiv[j] - 1 );
+
+         if( p == j ) continue;
+
+         for( size_t l=0UL; l<k; ++l ) {
+            swap( A(j,l), A(p,l) );
+         }
+         for( size_t l=kend; l<n; ++l ) {
+            swap( A(j,l), A(p,l) );
+         }
+      }
+
+      if( kend == n ) continue;
+
+      // Computation of the block row of U
+      auto U12( submatrix( A, k, kend, kb, n-kend, unchecked ) );
+
+      for( size_t i=0UL; i+1UL<kb; ++i ) {
+         submatrix( U12, i+1UL, 0UL, kb-i-1UL, n-kend, unchecked ) -=
+            subvector( column( A, k+i, unchecked ), k+i+1UL, kb-i-1UL, unchecked ) *
+            row( U12, i, unchecked );
+      }
+
+      // Update of the trailing submatrix
+      if( kend < m ) {
+         submatrix( A, kend, kend, m-kend, n-kend, unchecked ) -=
+            submatrix( A, kend, k, m-kend, kb, unchecked ) * U12;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked LU decomposition of the given dense general matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function performs the dense matrix LU decomposition of a general \a m-by-\a n matrix by
+// means of a right-looking blocked algorithm with partial pivoting. The resulting decomposition
+// and the (1-based) pivot indices are identical in form to the results of the LAPACK \c getrf()
+// functions (see the getrf() function for details), but the computation doesn't require a LAPACK
+// library. The update of the trailing submatrices is performed via the dense matrix/dense matrix
+// multiplication kernels of Blaze and is therefore parallelized in case the shared memory
+// parallelization is enabled.
+//
+// \note The LU decomposition will never fail, even for singular matrices. However, in case of a
+// singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
+// a linear system of equations.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void blockedGetrf( DenseMatrix<MT,SO>& A, blas_int_t* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   using ET = ElementType_t<MT>;
+
+   const size_t m( SO ? (*A).rows() : (*A).columns() );
+   const size_t n( SO ? (*A).columns() : (*A).rows() );
+
+   if( m == 0UL || n == 0UL ) {
+      return;
+   }
+
+   CustomMatrix<ET,unaligned,unpadded,columnMajor> V( (*A).data(), m, n, (*A).spacing() );
+   blockedGetrf_backend( V, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked Cholesky decomposition of the given dense positive definite matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \return void
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function performs the dense matrix Cholesky decomposition of a symmetric (or Hermitian)
+// positive definite \a n-by-\a n matrix by means of a right-looking blocked algorithm. Only the
+// lower part of the given matrix is accessed and the resulting lower triangular matrix \c L
+// (with \f$ A = L \cdot L^H \f$) is stored in the lower part of \a A. The upper part of \a A is
+// not modified. The update of the trailing submatrices is performed via the dense matrix/dense
+// matrix multiplication kernels of Blaze and is therefore parallelized in case the shared memory
+// parallelization is enabled. In case the matrix is not positive definite, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedPotrf( DenseMatrix<MT,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   BLAZE_INTERNAL_ASSERT( isSquare( *A ), "Invalid non-square matrix detected" );
+
+   using ET = ElementType_t<MT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   const size_t n( (*A).rows() );
+
+   for( size_t k=0UL; k<n; k+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t kb  ( min( DECOMPOSITION_BLOCK_SIZE, n-k ) );
+      const size_t kend( k + kb );
+
+      // Factorization of the current block column
+      for( size_t j=k; j<kend; ++j )
+      {
+         const BT ajj( real( (*A)(j,j) ) );
+
+         if( !( ajj > BT(0) ) ) {
+            BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+         }
+
+         const BT ljj( std::sqrt( ajj ) );
+         (*A)(j,j) = ljj;
+
+         auto lj( subvector( column( *A, j, unchecked ), j+1UL, n-j-1UL, unchecked ) );
+         lj *= BT(1) / ljj;
+
+         for( size_t l=j+1UL; l<kend; ++l ) {
+            subvector( column( *A, l, unchecked ), l, n-l, unchecked ) -=
+               subvector( column( *A, j, unchecked ), l, n-l, unchecked ) * conj( (*A)(l,j) );
+         }
+      }
+
+      // Update of the lower part of the trailing submatrix
+      for( size_t jj=kend; jj<n; jj+=DECOMPOSITION_BLOCK_SIZE )
+      {
+         const size_t jb  ( min( DECOMPOSITION_BLOCK_SIZE, n-jj ) );
+         const size_t jend( jj + jb );
+
+         for( size_t l=jj; l<jend; ++l ) {
+            subvector( column( *A, l, unchecked ), l, jend-l, unchecked ) -=
+               submatrix( *A, l, k, jend-l, kb, unchecked ) *
+               ctrans( subvector( row( *A, l, unchecked ), k, kb, unchecked ) );
+         }
+
+         if( jend < n ) {
+            submatrix( *A, jend, jj, n-jend, jb, unchecked ) -=
+               submatrix( *A, jend, k, n-jend, kb, unchecked ) *
+               ctrans( submatrix( *A, jj, k, jb, kb, unchecked ) );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of an elementary Householder reflector for the given column.
+// \ingroup dense_matrix
+//
+// \param A The matrix containing the column to be reduced.
+// \param j The index of the diagonal element of the column.
+// \return The scalar factor \f$ \tau \f$ of the elementary reflector.
+//
+// This auxiliary function computes the elementary reflector \f$ H = I - \tau v v^H \f$ with
+// \f$ v(0) = 1 \f$ such that \f$ H^H \f$ annihilates the elements below the diagonal element
+// of the \a j-th column of \a A. On exit, the diagonal element contains \f$ \beta \f$ and the
+// elements below the diagonal contain the remainder of the vector \c v. The computation
+// corresponds to the LAPACK \c larfg() functions.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+ElementType_t<MT> blockedHouseholder( DenseMatrix<MT,SO>& A, size_t j )
+{
+   using ET = ElementType_t<MT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   const size_t m( (*A).rows() );
+   const ET alpha( (*A)(j,j) );
+
+   auto x( subvector( column( *A, j, unchecked ), j+1UL, m-j-1UL, unchecked ) );
+   const BT xnorm( real( norm( x ) ) );
+
+   if( isZero( xnorm ) && isZero( imag( alpha ) ) ) {
+      return ET(0);
+   }
+
+   const BT beta( -std::copysign( std::hypot( std::hypot( real( alpha ), imag( alpha ) ), xnorm )
+                                , real( alpha ) ) );
+
+   x *= ET(1) / ( alpha - beta );
+   (*A)(j,j) = beta;
+
+   return ( beta - alpha ) / beta;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setup of the block reflector of the given Householder reflectors.
+// \ingroup dense_matrix
+//
+// \param A The matrix containing the Householder vectors below its diagonal.
+// \param k The index of the first Householder reflector.
+// \param kb The number of Householder reflectors.
+// \param tau The scalar factors of the Householder reflectors.
+// \param V The resulting matrix of Householder vectors (unit lower trapezoidal).
+// \param T The resulting upper triangular factor of the block reflector.
+// \return void
+//
+// This auxiliary function computes the compact WY representation \f$ I - V T V^H \f$ of the
+// product \f$ H(k) H(k+1) \cdots H(k+kb-1) \f$ of the given Householder reflectors. The
+// computation corresponds to the forward, columnwise variant of the LAPACK \c larft() functions.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename ET >  // Element type of the block reflector
+void blockedReflector( const DenseMatrix<MT,SO>& A, size_t k, size_t kb, const ET* tau,
+                       DynamicMatrix<ET,columnMajor>& V, DynamicMatrix<ET,columnMajor>& T )
+{
+   const size_t mv( (*A).rows() - k );
+
+   V = submatrix( *A, k, k, mv, kb, unchecked );
+
+   for( size_t j=0UL; j<kb; ++j ) {
+      for( size_t i=0UL; i<j; ++i ) {
+         reset( V(i,j) );
+      }
+      V(j,j) = ET(1);
+   }
+
+   T.resize( kb, kb, false );
+   reset( T );
+
+   for( size_t j=0UL; j<kb; ++j )
+   {
+      T(j,j) = tau[k+j];
+
+      if( j == 0UL ) continue;
+
+      const DynamicVector<ET,columnVector> z(
+         ctrans( submatrix( V, 0UL, 0UL, mv, j, unchecked ) ) * column( V, j, unchecked ) );
+
+      subvector( column( T, j, unchecked ), 0UL, j, unchecked ) =
+         ( -tau[k+j] ) * ( submatrix( T, 0UL, 0UL, j, j, unchecked ) * z );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked QR decomposition of the given dense general matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function performs the dense matrix QR decomposition of a general \a m-by-\a n matrix by
+// means of a blocked Householder algorithm. On exit, the elements on and above the diagonal of
+// \a A contain the upper trapezoidal matrix \c R, the elements below the diagonal, together with
+// the array \a tau, represent the orthogonal (or unitary) matrix \c Q as a product of min(\a m,
+// \a n) elementary reflectors \f$ H(i) = I - \tau_i v_i v_i^H \f$. In contrast to the LAPACK
+// wrapper functions, the representation always refers to the matrix itself, independent of
+// its storage order. Each block reflector is applied to the trailing submatrix via dense matrix/
+// dense matrix multiplications, which are parallelized in case the shared memory parallelization
+// is enabled.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedGeqrf( DenseMatrix<MT,SO>& A, ElementType_t<MT>* tau )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   using ET = ElementType_t<MT>;
+
+   const size_t m( (*A).rows() );
+   const size_t n( (*A).columns() );
+   const size_t mindim( min( m, n ) );
+
+   DynamicMatrix<ET,columnMajor> V, T, W;
+
+   for( size_t k=0UL; k<mindim; k+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t kb  ( min( DECOMPOSITION_BLOCK_SIZE, mindim-k ) );
+      const size_t kend( k + kb );
+
+      // Factorization of the current panel
+      for( size_t j=k; j<kend; ++j )
+      {
+         tau[j] = blockedHouseholder( *A, j );
+
+         if( j+1UL == kend || isDefault( tau[j] ) ) continue;
+
+         const ET beta( (*A)(j,j) );
+         (*A)(j,j) = ET(1);
+
+         auto v( subvector( column( *A, j, unchecked ), j, m-j, unchecked ) );
+         auto C( submatrix( *A, j, j+1UL, m-j, kend-j-1UL, unchecked ) );
+
+         const DynamicVector<ET,rowVector> w( ctrans( v ) * C );
+         C -= ( conj( tau[j] ) * v ) * w;
+
+         (*A)(j,j) = beta;
+      }
+
+      if( kend == n ) continue;
+
+      // Application of the block reflector to the trailing submatrix
+      blockedReflector( *A, k, kb, tau, V, T );
+
+      auto C( submatrix( *A, k, kend, m-k, n-kend, unchecked ) );
+
+      W = ctrans( V ) * C;
+      W = ctrans( T ) * W;
+      C -= V * W;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked reconstruction of the orthogonal (or unitary) matrix of a QR decomposition.
+// \ingroup dense_matrix
+//
+// \param A The decomposed matrix.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function reconstructs the first min(\a m, \a n) columns of the orthogonal (or unitary)
+// matrix \c Q from the elementary reflectors computed by the blockedGeqrf() function. The
+// reflectors are accumulated blockwise in backward order and each block reflector is applied
+// via dense matrix/dense matrix multiplications, which are parallelized in case the shared
+// memory parallelization is enabled. Any columns beyond the first min(\a m, \a n) columns
+// are not modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedOrgqr( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   using ET = ElementType_t<MT>;
+
+   const size_t m( (*A).rows() );
+   const size_t k( min( m, (*A).columns() ) );
+
+   if( k == 0UL ) {
+      return;
+   }
+
+   const DynamicMatrix<ET,columnMajor> R( submatrix( *A, 0UL, 0UL, m, k, unchecked ) );
+
+   auto Q( submatrix( *A, 0UL, 0UL, m, k, unchecked ) );
+   reset( Q );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      Q(i,i) = ET(1);
+   }
+
+   DynamicMatrix<ET,columnMajor> V, T, W;
+
+   size_t i0( ( ( k - 1UL ) / DECOMPOSITION_BLOCK_SIZE ) * DECOMPOSITION_BLOCK_SIZE );
+
+   while( true )
+   {
+      const size_t kb( min( DECOMPOSITION_BLOCK_SIZE, k-i0 ) );
+
+      blockedReflector( R, i0, kb, tau, V, T );
+
+      auto C( submatrix( *A, i0, i0, m-i0, k-i0, unchecked ) );
+
+      W = ctrans( V ) * C;
+      W = T * W;
+      C -= V * W;
+
+      if( i0 == 0UL ) break;
+      i0 -= DECOMPOSITION_BLOCK_SIZE;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
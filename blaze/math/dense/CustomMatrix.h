@@ -53,6 +53,8 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/DenseIterator.h>
 #include <blaze/math/dense/Forward.h>
+#include <blaze/math/dense/InPlaceTranspose.h>
+#include <blaze/math/dense/SIMDTranspose.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
@@ -2019,7 +2021,10 @@ inline void CustomMatrix<Type,AF,PF,SO,Tag,RT>::swap( CustomMatrix& m ) noexcept
 // \return Reference to the transposed matrix.
 // \exception std::logic_error Impossible transpose operation.
 //
-// In case the matrix is not a square matrix, a \a std::logic_error exception is thrown.
+// Non-square matrices are transposed within the given array. The spacing of the transposed
+// matrix is adapted to its new number of rows (columns in case of a column-major matrix) with
+// respect to the alignment and padding of the matrix. In case the array is too small to hold
+// the transposed matrix, a \a std::logic_error exception is thrown.
 */
 template< typename Type     // Data type of the matrix
         , AlignmentFlag AF  // Alignment flag
@@ -2031,8 +2036,24 @@ inline CustomMatrix<Type,AF,PF,SO,Tag,RT>& CustomMatrix<Type,AF,PF,SO,Tag,RT>::t
 {
    using std::swap;
 
-   if( m_ != n_ ) {
-      BLAZE_THROW_LOGIC_ERROR( "Impossible transpose operation" );
+   if( m_ != n_ )
+   {
+      const size_t nn( ( AF || ( PF && IsVectorizable_v<Type> ) )
+                       ?( nextMultiple<size_t>( m_, SIMDSIZE ) )
+                       :( m_ ) );
+
+      const size_t available( PF ? m_*nn_ : ( m_ > 0UL ? (m_-1UL)*nn_+n_ : 0UL ) );
+      const size_t required ( PF ? n_*nn  : ( n_ > 0UL ? (n_-1UL)*nn +m_ : 0UL ) );
+
+      if( required > available ) {
+         BLAZE_THROW_LOGIC_ERROR( "Impossible transpose operation" );
+      }
+
+      inplaceTranspose( v_, m_, n_, nn_, nn, PF );
+      swap( m_, n_ );
+      nn_ = nn;
+
+      return *this;
    }
 
    for( size_t i=1UL; i<m_; ++i )
@@ -2050,7 +2071,10 @@ inline CustomMatrix<Type,AF,PF,SO,Tag,RT>& CustomMatrix<Type,AF,PF,SO,Tag,RT>::t
 // \return Reference to the transposed matrix.
 // \exception std::logic_error Impossible transpose operation.
 //
-// In case the matrix is not a square matrix, a \a std::logic_error exception is thrown.
+// Non-square matrices are transposed within the given array. The spacing of the transposed
+// matrix is adapted to its new number of rows (columns in case of a column-major matrix) with
+// respect to the alignment and padding of the matrix. In case the array is too small to hold
+// the transposed matrix, a \a std::logic_error exception is thrown.
 */
 template< typename Type     // Data type of the matrix
         , AlignmentFlag AF  // Alignment flag
@@ -2060,8 +2084,15 @@ template< typename Type     // Data type of the matrix
         , typename RT >     // Result type
 inline CustomMatrix<Type,AF,PF,SO,Tag,RT>& CustomMatrix<Type,AF,PF,SO,Tag,RT>::ctranspose()
 {
-   if( m_ != n_ ) {
-      BLAZE_THROW_LOGIC_ERROR( "Impossible transpose operation" );
+   if( m_ != n_ )
+   {
+      transpose();
+
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=0UL; j<n_; ++j )
+            conjugate( v_[i*nn_+j] );
+
+      return *this;
    }
 
    for( size_t i=0UL; i<m_; ++i ) {
@@ -2700,6 +2731,9 @@ inline void CustomMatrix<Type,AF,PF,SO,Tag,RT>::assign( const DenseMatrix<MT,!SO
    BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
 
+   if( simdTranspose( *this, *rhs ) )
+      return;
+
    constexpr size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<m_; ii+=block ) {
@@ -5070,7 +5104,10 @@ inline void CustomMatrix<Type,AF,PF,true,Tag,RT>::swap( CustomMatrix& m ) noexce
 // \return Reference to the transposed matrix.
 // \exception std::logic_error Impossible transpose operation.
 //
-// In case the matrix is not a square matrix, a \a std::logic_error exception is thrown.
+// Non-square matrices are transposed within the given array. The spacing of the transposed
+// matrix is adapted to its new number of rows (columns in case of a column-major matrix) with
+// respect to the alignment and padding of the matrix. In case the array is too small to hold
+// the transposed matrix, a \a std::logic_error exception is thrown.
 */
 template< typename Type     // Data type of the matrix
         , AlignmentFlag AF  // Alignment flag
@@ -5081,8 +5118,24 @@ inline CustomMatrix<Type,AF,PF,true,Tag,RT>& CustomMatrix<Type,AF,PF,true,Tag,RT
 {
    using std::swap;
 
-   if( m_ != n_ ) {
-      BLAZE_THROW_LOGIC_ERROR( "Impossible transpose operation" );
+   if( m_ != n_ )
+   {
+      const size_t mm( ( AF || ( PF && IsVectorizable_v<Type> ) )
+                       ?( nextMultiple<size_t>( n_, SIMDSIZE ) )
+                       :( n_ ) );
+
+      const size_t available( PF ? n_*mm_ : ( n_ > 0UL ? (n_-1UL)*mm_+m_ : 0UL ) );
+      const size_t required ( PF ? m_*mm  : ( m_ > 0UL ? (m_-1UL)*mm +n_ : 0UL ) );
+
+      if( required > available ) {
+         BLAZE_THROW_LOGIC_ERROR( "Impossible transpose operation" );
+      }
+
+      inplaceTranspose( v_, n_, m_, mm_, mm, PF );
+      swap( m_, n_ );
+      mm_ = mm;
+
+      return *this;
    }
 
    for( size_t j=1UL; j<n_; ++j )
@@ -5102,7 +5155,10 @@ inline CustomMatrix<Type,AF,PF,true,Tag,RT>& CustomMatrix<Type,AF,PF,true,Tag,RT
 // \return Reference to the transposed matrix.
 // \exception std::logic_error Impossible transpose operation.
 //
-// In case the matrix is not a square matrix, a \a std::logic_error exception is thrown.
+// Non-square matrices are transposed within the given array. The spacing of the transposed
+// matrix is adapted to its new number of rows (columns in case of a column-major matrix) with
+// respect to the alignment and padding of the matrix. In case the array is too small to hold
+// the transposed matrix, a \a std::logic_error exception is thrown.
 */
 template< typename Type     // Data type of the matrix
         , AlignmentFlag AF  // Alignment flag
@@ -5111,8 +5167,15 @@ template< typename Type     // Data type of the matrix
         , typename RT >     // Result type
 inline CustomMatrix<Type,AF,PF,true,Tag,RT>& CustomMatrix<Type,AF,PF,true,Tag,RT>::ctranspose()
 {
-   if( m_ != n_ ) {
-      BLAZE_THROW_LOGIC_ERROR( "Impossible transpose operation" );
+   if( m_ != n_ )
+   {
+      transpose();
+
+      for( size_t j=0UL; j<n_; ++j )
+         for( size_t i=0UL; i<m_; ++i )
+            conjugate( v_[i+j*mm_] );
+
+      return *this;
    }
 
    for( size_t j=0UL; j<n_; ++j ) {
@@ -5761,6 +5824,9 @@ inline void CustomMatrix<Type,AF,PF,true,Tag,RT>::assign( const DenseMatrix<MT,f
    BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
 
+   if( simdTranspose( *this, *rhs ) )
+      return;
+
    constexpr size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<n_; jj+=block ) {
@@ -51,6 +51,8 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/DenseIterator.h>
 #include <blaze/math/dense/Forward.h>
+#include <blaze/math/dense/InPlaceTranspose.h>
+#include <blaze/math/dense/SIMDTranspose.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
@@ -119,6 +121,7 @@
 #include <blaze/util/Algorithms.h>
 #include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/AllocationPolicy.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/constraints/Pointer.h>
@@ -705,7 +708,9 @@ inline DynamicMatrix<Type,SO,Alloc,Tag>::DynamicMatrix( size_t m, size_t n, size
 // \param alloc Allocator for all memory allocations of this matrix.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. For
-// built-in types no initialization of the elements is performed!
+// built-in types no initialization of the elements is performed! Only in case the allocator
+// requests a partitioned placement of large memory blocks (see blaze::PlacementPolicy), the
+// elements are zero-initialized in parallel to place the memory on the according NUMA nodes.
 */
 template< typename Type   // Data type of the matrix
         , bool SO         // Storage order
@@ -719,6 +724,10 @@ inline DynamicMatrix<Type,SO,Alloc,Tag>::DynamicMatrix( size_t m, size_t n, cons
    blaze::uninitialized_default_construct_n( v_, capacity_ );
 
    if( IsVectorizable_v<Type> && IsBuiltin_v<Type> ) {
+      if( isPartitionedAllocation( alloc_, capacity_*sizeof(Type) ) ) {
+         smpAssign( *this, UniformMatrix<Type,SO,Tag>( m_, n_, Type() ) );
+      }
+
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j ) {
             clear( v_[i*nn_+j] );
@@ -748,9 +757,15 @@ template< typename Type   // Data type of the matrix
 inline DynamicMatrix<Type,SO,Alloc,Tag>::DynamicMatrix( size_t m, size_t n, const Type& init, const Alloc& alloc )
    : DynamicMatrix( m, n, alloc )
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j ) {
-         v_[i*nn_+j] = init;
+   if( IsVectorizable_v<Type> && IsBuiltin_v<Type> &&
+       isPartitionedAllocation( alloc_, capacity_*sizeof(Type) ) ) {
+      smpAssign( *this, UniformMatrix<Type,SO,Tag>( m_, n_, init ) );
+   }
+   else {
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n_; ++j ) {
+            v_[i*nn_+j] = init;
+         }
       }
    }
 
@@ -2211,6 +2226,10 @@ inline size_t DynamicMatrix<Type,SO,Alloc,Tag>::addPadding( size_t value ) const
 /*!\brief In-place transpose of the matrix.
 //
 // \return Reference to the transposed matrix.
+//
+// Non-square matrices are transposed within the allocated memory of the matrix in case the
+// current capacity suffices to store the transposed matrix including its padding elements (see
+// the reserve() function). Otherwise the transposed matrix is stored in a newly allocated array.
 */
 template< typename Type   // Data type of the matrix
         , bool SO         // Storage order
@@ -2236,6 +2255,13 @@ inline DynamicMatrix<Type,SO,Alloc,Tag>& DynamicMatrix<Type,SO,Alloc,Tag>::trans
          }
       }
    }
+   else if( n_ * addPadding( m_ ) <= capacity_ )
+   {
+      const size_t nn( addPadding( m_ ) );
+      inplaceTranspose( v_, m_, n_, nn_, nn, true );
+      std::swap( m_, n_ );
+      nn_ = nn;
+   }
    else
    {
       DynamicMatrix tmp( trans(*this) );
@@ -2251,6 +2277,10 @@ inline DynamicMatrix<Type,SO,Alloc,Tag>& DynamicMatrix<Type,SO,Alloc,Tag>::trans
 /*!\brief In-place conjugate transpose of the matrix.
 //
 // \return Reference to the transposed matrix.
+//
+// Non-square matrices are transposed within the allocated memory of the matrix in case the
+// current capacity suffices to store the transposed matrix including its padding elements (see
+// the reserve() function). Otherwise the transposed matrix is stored in a newly allocated array.
 */
 template< typename Type   // Data type of the matrix
         , bool SO         // Storage order
@@ -2280,6 +2310,16 @@ inline DynamicMatrix<Type,SO,Alloc,Tag>& DynamicMatrix<Type,SO,Alloc,Tag>::ctran
          }
       }
    }
+   else if( n_ * addPadding( m_ ) <= capacity_ )
+   {
+      transpose();
+
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=0UL; j<n_; ++j ) {
+            conjugate( v_[i*nn_+j] );
+         }
+      }
+   }
    else
    {
       DynamicMatrix tmp( ctrans(*this) );
@@ -2838,6 +2878,9 @@ inline void DynamicMatrix<Type,SO,Alloc,Tag>::assign( const DenseMatrix<MT,!SO>&
    BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
 
+   if( simdTranspose( *this, *rhs ) )
+      return;
+
    constexpr size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<m_; ii+=block ) {
@@ -4028,7 +4071,9 @@ inline DynamicMatrix<Type,true,Alloc,Tag>::DynamicMatrix( size_t m, size_t mm, s
 // \param alloc Allocator for all memory allocations of this matrix.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. For
-// built-in types no initialization of the elements is performed!
+// built-in types no initialization of the elements is performed! Only in case the allocator
+// requests a partitioned placement of large memory blocks (see blaze::PlacementPolicy), the
+// elements are zero-initialized in parallel to place the memory on the according NUMA nodes.
 */
 template< typename Type   // Data type of the matrix
         , typename Alloc  // Type of the allocator
@@ -4041,6 +4086,10 @@ inline DynamicMatrix<Type,true,Alloc,Tag>::DynamicMatrix( size_t m, size_t n, co
    blaze::uninitialized_default_construct_n( v_, capacity_ );
 
    if( IsVectorizable_v<Type> && IsBuiltin_v<Type> ) {
+      if( isPartitionedAllocation( alloc_, capacity_*sizeof(Type) ) ) {
+         smpAssign( *this, UniformMatrix<Type,true,Tag>( m_, n_, Type() ) );
+      }
+
       for( size_t j=0UL; j<n_; ++j ) {
          for( size_t i=m_; i<mm_; ++i ) {
             clear( v_[i+j*mm_] );
@@ -4071,9 +4120,15 @@ template< typename Type   // Data type of the matrix
 inline DynamicMatrix<Type,true,Alloc,Tag>::DynamicMatrix( size_t m, size_t n, const Type& init, const Alloc& alloc )
    : DynamicMatrix( m, n, alloc )
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i ) {
-         v_[i+j*mm_] = init;
+   if( IsVectorizable_v<Type> && IsBuiltin_v<Type> &&
+       isPartitionedAllocation( alloc_, capacity_*sizeof(Type) ) ) {
+      smpAssign( *this, UniformMatrix<Type,true,Tag>( m_, n_, init ) );
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            v_[i+j*mm_] = init;
+         }
       }
    }
 
@@ -5559,6 +5614,10 @@ inline size_t DynamicMatrix<Type,true,Alloc,Tag>::addPadding( size_t values ) co
 /*!\brief In-place transpose of the matrix.
 //
 // \return Reference to the transposed matrix.
+//
+// Non-square matrices are transposed within the allocated memory of the matrix in case the
+// current capacity suffices to store the transposed matrix including its padding elements (see
+// the reserve() function). Otherwise the transposed matrix is stored in a newly allocated array.
 */
 template< typename Type   // Data type of the matrix
         , typename Alloc  // Type of the allocator
@@ -5583,6 +5642,13 @@ inline DynamicMatrix<Type,true,Alloc,Tag>& DynamicMatrix<Type,true,Alloc,Tag>::t
          }
       }
    }
+   else if( m_ * addPadding( n_ ) <= capacity_ )
+   {
+      const size_t mm( addPadding( n_ ) );
+      inplaceTranspose( v_, n_, m_, mm_, mm, true );
+      std::swap( m_, n_ );
+      mm_ = mm;
+   }
    else
    {
       DynamicMatrix tmp( trans(*this) );
@@ -5600,6 +5666,10 @@ inline DynamicMatrix<Type,true,Alloc,Tag>& DynamicMatrix<Type,true,Alloc,Tag>::t
 /*!\brief In-place conjugate transpose of the matrix.
 //
 // \return Reference to the transposed matrix.
+//
+// Non-square matrices are transposed within the allocated memory of the matrix in case the
+// current capacity suffices to store the transposed matrix including its padding elements (see
+// the reserve() function). Otherwise the transposed matrix is stored in a newly allocated array.
 */
 template< typename Type   // Data type of the matrix
         , typename Alloc  // Type of the allocator
@@ -5628,6 +5698,16 @@ inline DynamicMatrix<Type,true,Alloc,Tag>& DynamicMatrix<Type,true,Alloc,Tag>::c
          }
       }
    }
+   else if( m_ * addPadding( n_ ) <= capacity_ )
+   {
+      transpose();
+
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            conjugate( v_[i+j*mm_] );
+         }
+      }
+   }
    else
    {
       DynamicMatrix tmp( ctrans(*this) );
@@ -6194,6 +6274,9 @@ inline void DynamicMatrix<Type,true,Alloc,Tag>::assign( const DenseMatrix<MT,fal
    BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
 
+   if( simdTranspose( *this, *rhs ) )
+      return;
+
    constexpr size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<n_; jj+=block ) {
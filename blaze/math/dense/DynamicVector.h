@@ -118,6 +118,7 @@
 #include <blaze/util/Algorithms.h>
 #include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/AllocationPolicy.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/constraints/Pointer.h>
@@ -639,7 +640,9 @@ inline DynamicVector<Type,TF,Alloc,Tag>::DynamicVector( size_t n, size_t capa, c
 // \param alloc Allocator for all memory allocations of this vector.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. For
-// built-in types no initialization of the elements is performed!
+// built-in types no initialization of the elements is performed! Only in case the allocator
+// requests a partitioned placement of large memory blocks (see blaze::PlacementPolicy), the
+// elements are zero-initialized in parallel to place the memory on the according NUMA nodes.
 */
 template< typename Type   // Data type of the vector
         , bool TF         // Transpose flag
@@ -653,6 +656,10 @@ inline DynamicVector<Type,TF,Alloc,Tag>::DynamicVector( size_t n, const Alloc& a
    blaze::uninitialized_default_construct_n( v_, capacity_ );
 
    if( IsVectorizable_v<Type> && IsBuiltin_v<Type> ) {
+      if( isPartitionedAllocation( alloc_, capacity_*sizeof(Type) ) ) {
+         smpAssign( *this, UniformVector<Type,TF,Tag>( size_, Type() ) );
+      }
+
       for( size_t i=size_; i<capacity_; ++i )
          clear( v_[i] );
    }
@@ -678,8 +685,14 @@ template< typename Type   // Data type of the vector
 inline DynamicVector<Type,TF,Alloc,Tag>::DynamicVector( size_t n, const Type& init, const Alloc& alloc )
    : DynamicVector( n, alloc )
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
+   if( IsVectorizable_v<Type> && IsBuiltin_v<Type> &&
+       isPartitionedAllocation( alloc_, capacity_*sizeof(Type) ) ) {
+      smpAssign( *this, UniformVector<Type,TF,Tag>( size_, init ) );
+   }
+   else {
+      for( size_t i=0UL; i<size_; ++i )
+         v_[i] = init;
+   }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
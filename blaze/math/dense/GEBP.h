@@ -0,0 +1,495 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/GEBP.h
+//  \brief Header file for the packed dense matrix multiplication kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_GEBP_H_
+#define _BLAZE_MATH_DENSE_GEBP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/shims/PrevMultiple.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegerSequence.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS GEBPBLOCKING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Register and cache blocking of the packed dense matrix multiplication kernels.
+// \ingroup dense_matrix
+//
+// The GEBPBlocking class template defines the register and cache blocking of the packed dense
+// matrix multiplication kernels for the given element type. The micro-kernel updates an
+// \a MR x \a NR tile of the target matrix, where \a NR spans \a NV SIMD vectors along the
+// contiguous dimension of the target matrix and \a MR is chosen such that all accumulators fit
+// into the SIMD registers (16 registers for SSE/AVX/AVX2, 32 registers for AVX-512). The cache
+// block sizes are derived from the cache sizes given in <tt><blaze/config/CacheSize.h></tt>:
+//
+//  - \a KC: a \a KC x \a NR micro-panel of the packed right-hand side fills half the L1 cache,
+//  - \a MC: the \a MC x \a KC block of the packed left-hand side fills half the L2 cache,
+//  - \a NC: the \a KC x \a NC block of the packed right-hand side fills half the L3 cache.
+*/
+template< typename T >  // Type of the elements
+struct GEBPBlocking
+{
+   //**********************************************************************************************
+   static constexpr size_t SIMDSIZE = SIMDTrait<T>::size;  //!< Number of elements per SIMD vector.
+   static constexpr size_t NV = 2UL;                        //!< SIMD vectors per micro-tile row.
+   static constexpr size_t NR = NV * SIMDSIZE;              //!< Columns of a micro-tile.
+
+   //! Rows of a micro-tile.
+   static constexpr size_t MR = ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE ? 12UL : 6UL );
+
+   //! Depth of the cache blocks.
+   static constexpr size_t KC =
+      ( ( l1CacheSize/2UL ) / ( NR*sizeof(T) ) < 32UL )
+      ?( 32UL )
+      :( ( ( l1CacheSize/2UL ) / ( NR*sizeof(T) ) ) & ~size_t(7) );
+
+   //! Rows of the cache blocks of the left-hand side operand.
+   static constexpr size_t MC =
+      ( ( l2CacheSize/2UL ) / ( KC*sizeof(T) ) < MR )
+      ?( MR )
+      :( ( ( l2CacheSize/2UL ) / ( KC*sizeof(T) ) ) / MR * MR );
+
+   //! Columns of the cache blocks of the right-hand side operand.
+   static constexpr size_t NC =
+      ( ( cacheSize/2UL ) / ( KC*sizeof(T) ) < NR )
+      ?( NR )
+      :( ( ( cacheSize/2UL ) / ( KC*sizeof(T) ) ) / NR * NR );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY VARIABLE TEMPLATE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the packed multiplication kernels.
+// \ingroup dense_matrix
+//
+// This variable template evaluates to \a true in case the packed dense matrix multiplication
+// kernels can be applied for the given target matrix and operands, i.e. in case the packed
+// kernels are enabled and all three matrices have the same floating point element type.
+*/
+template< typename MT1    // Type of the target matrix
+        , typename MT2    // Type of the left-hand side operand
+        , typename MT3 >  // Type of the right-hand side operand
+constexpr bool UsePackedMMMKernel_v =
+   ( usePackedMMMKernels &&
+     IsFloatingPoint_v< ElementType_t<MT1> > &&
+     IsSame_v< ElementType_t<MT1>, ElementType_t<MT2> > &&
+     IsSame_v< ElementType_t<MT1>, ElementType_t<MT3> > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a block of an operand into micro-panels of the given width.
+// \ingroup dense_matrix
+//
+// \param buffer The aligned target buffer.
+// \param access Access function for the elements of the block (index, depth).
+// \param size The number of indices of the block.
+// \param depth The depth of the block.
+// \return void
+//
+// This function packs the given block into consecutive micro-panels of \a W indices each.
+// Within each micro-panel the elements are stored depth-major, i.e. the \a W elements of one
+// depth are contiguous. Incomplete micro-panels are padded with zeros. In case \a DI is set
+// to \a true, the depth is traversed in the inner loop (the contiguous dimension of the
+// operand), otherwise the index is traversed in the inner loop.
+*/
+template< size_t W       // Width of the micro-panels
+        , bool DI        // Flag for depth-wise inner traversal
+        , typename T     // Type of the elements
+        , typename AT >  // Type of the access function
+void gebpPack( T* buffer, AT access, size_t size, size_t depth )
+{
+   for( size_t i=0UL; i<size; i+=W )
+   {
+      const size_t w( min( W, size - i ) );
+
+      if( DI ) {
+         for( size_t l=0UL; l<w; ++l ) {
+            for( size_t k=0UL; k<depth; ++k ) {
+               buffer[k*W+l] = access( i+l, k );
+            }
+         }
+      }
+      else {
+         for( size_t k=0UL; k<depth; ++k ) {
+            for( size_t l=0UL; l<w; ++l ) {
+               buffer[k*W+l] = access( i+l, k );
+            }
+         }
+      }
+
+      for( size_t k=0UL; k<depth; ++k ) {
+         for( size_t l=w; l<W; ++l ) {
+            reset( buffer[k*W+l] );
+         }
+      }
+
+      buffer += W*depth;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MICRO-KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Register-blocked micro-kernel of the packed dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param a The packed micro-panel of the broadcast operand (\a MR elements per depth).
+// \param b The packed micro-panel of the vector operand (two SIMD vectors per depth).
+// \param depth The depth of both micro-panels.
+// \param c The aligned \a MR x \a NR target tile.
+// \return void
+//
+// This function computes the outer products of the given micro-panels and stores the result
+// into the given aligned tile. Each element of the broadcast operand is broadcast into a SIMD
+// vector and multiplied with both SIMD vectors of the vector operand. The rows of the tile are
+// unrolled at compile time such that all accumulators are kept in SIMD registers.
+*/
+template< typename T         // Type of the elements
+        , size_t... Rs >     // Row indices of the micro-tile
+BLAZE_ALWAYS_INLINE void
+   gebpMicroKernel( const T* a, const T* b, size_t depth, T* c, index_sequence<Rs...> ) noexcept
+{
+   using SIMDType = SIMDTrait_t<T>;
+   using Expand   = int[];
+
+   constexpr size_t SIMDSIZE( SIMDTrait<T>::size );
+   constexpr size_t MR( sizeof...( Rs ) );
+   constexpr size_t NR( 2UL*SIMDSIZE );
+
+   SIMDType xmm1[MR], xmm2[MR];
+
+   (void)Expand{ 0, ( xmm1[Rs] = SIMDType(), xmm2[Rs] = SIMDType(), 0 )... };
+
+   for( size_t k=0UL; k<depth; ++k )
+   {
+      const SIMDType b1( loada( b            ) );
+      const SIMDType b2( loada( b + SIMDSIZE ) );
+
+      (void)Expand{ 0, ( xmm1[Rs] += set( a[Rs] ) * b1, xmm2[Rs] += set( a[Rs] ) * b2, 0 )... };
+
+      a += MR;
+      b += NR;
+   }
+
+   (void)Expand{ 0, ( storea( c+Rs*NR, xmm1[Rs] ), storea( c+Rs*NR+SIMDSIZE, xmm2[Rs] ), 0 )... };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED DENSE MATRIX MULTIPLICATION KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed compute kernel for a dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return \a true in case the packed kernel has been applied, \a false if not.
+//
+// This function implements a GotoBLAS-style compute kernel for a dense matrix/dense matrix
+// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Cache blocks of both operands are
+// packed into aligned buffers, which are traversed by a register-blocked SIMD micro-kernel
+// (see the GEBPBlocking class template). The SIMD vectors run along the contiguous dimension
+// of \a C, which is why row-major and column-major target matrices are handled alike. Blocks
+// of lower or upper operands that are known to be zero are skipped. In case \a LOW (or \a UPP)
+// is set to \a true, only the lower (or upper) part of \a C is computed.
+//
+// The kernel is only applied in case all three matrices have the same floating point element
+// type and the packed kernels are enabled via the \c BLAZE_USE_PACKED_MMM_KERNELS switch. In
+// all other cases the function returns \a false and \a C is not modified.
+*/
+template< bool LOW       // Flag for the computation of the lower part only
+        , bool UPP       // Flag for the computation of the upper part only
+        , typename MT1   // Type of the target matrix
+        , typename MT2   // Type of the left-hand side operand
+        , typename MT3   // Type of the right-hand side operand
+        , typename ST >  // Type of the scaling factors
+auto gebp( MT1& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+   -> EnableIf_t< UsePackedMMMKernel_v<MT1,MT2,MT3>, bool >
+{
+   using ET       = ElementType_t<MT1>;
+   using SIMDType = SIMDTrait_t<ET>;
+   using Blocking = GEBPBlocking<ET>;
+
+   constexpr bool SO( IsColumnMajorMatrix_v<MT1> );
+
+   // Flags for the depth-wise inner traversal of the operands during the packing
+   constexpr bool vectorDI   ( SO ? IsRowMajorMatrix_v<MT2> : IsColumnMajorMatrix_v<MT3> );
+   constexpr bool broadcastDI( SO ? IsColumnMajorMatrix_v<MT3> : IsRowMajorMatrix_v<MT2> );
+
+   constexpr size_t SIMDSIZE( Blocking::SIMDSIZE );
+   constexpr size_t NR( Blocking::NR );
+   constexpr size_t MR( Blocking::MR );
+   constexpr size_t KC( Blocking::KC );
+   constexpr size_t MC( Blocking::MC );
+   constexpr size_t NC( Blocking::NC );
+
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+   const size_t K( A.columns() );
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
+   BLAZE_INTERNAL_ASSERT( C.rows() == M && C.columns() == N, "Invalid matrix sizes detected" );
+
+   if( isDefault( beta ) ) {
+      reset( C );
+   }
+   else if( !isOne( beta ) ) {
+      C *= beta;
+   }
+
+   // The vector dimension is the contiguous dimension of C, the broadcast dimension the other one
+   const size_t VD( SO ? M : N );
+   const size_t BD( SO ? N : M );
+
+   const auto vectorAccess = [&A,&B]( size_t v, size_t k ) -> ET {
+      return SO ? A(v,k) : B(k,v);
+   };
+
+   const auto broadcastAccess = [&A,&B]( size_t b, size_t k ) -> ET {
+      return SO ? B(k,b) : A(b,k);
+   };
+
+   const auto isZeroA = []( size_t i, size_t m, size_t k, size_t depth ) {
+      return ( IsLower_v<MT2> && i+m <= k ) || ( IsUpper_v<MT2> && k+depth <= i );
+   };
+
+   const auto isZeroB = []( size_t k, size_t depth, size_t j, size_t n ) {
+      return ( IsLower_v<MT3> && k+depth <= j ) || ( IsUpper_v<MT3> && j+n <= k );
+   };
+
+   std::unique_ptr<ET[],Deallocate> vbuffer( allocate<ET>( KC*NC ) );
+   std::unique_ptr<ET[],Deallocate> bbuffer( allocate<ET>( KC*MC ) );
+
+   const SIMDType factor( set( ET( alpha ) ) );
+
+   AlignedArray<ET,MR*NR> tmp;
+
+   for( size_t jc=0UL; jc<VD; jc+=NC )
+   {
+      const size_t nc( min( NC, VD - jc ) );
+
+      for( size_t pc=0UL; pc<K; pc+=KC )
+      {
+         const size_t kc( min( KC, K - pc ) );
+
+         if( SO ? isZeroA( jc, nc, pc, kc ) : isZeroB( pc, kc, jc, nc ) )
+            continue;
+
+         gebpPack<NR,vectorDI>( vbuffer.get(),
+            [&]( size_t v, size_t k ) { return vectorAccess( jc+v, pc+k ); }, nc, kc );
+
+         for( size_t ic=0UL; ic<BD; ic+=MC )
+         {
+            const size_t mc( min( MC, BD - ic ) );
+
+            if( SO ? isZeroB( pc, kc, ic, mc ) : isZeroA( ic, mc, pc, kc ) )
+               continue;
+
+            if( ( LOW && ( SO ? ( jc+nc <= ic ) : ( ic+mc <= jc ) ) ) ||
+                ( UPP && ( SO ? ( ic+mc <= jc ) : ( jc+nc <= ic ) ) ) )
+               continue;
+
+            gebpPack<MR,broadcastDI>( bbuffer.get(),
+               [&]( size_t b, size_t k ) { return broadcastAccess( ic+b, pc+k ); }, mc, kc );
+
+            for( size_t jr=0UL; jr<nc; jr+=NR )
+            {
+               const size_t nr( min( NR, nc - jr ) );
+
+               for( size_t ir=0UL; ir<mc; ir+=MR )
+               {
+                  const size_t mr( min( MR, mc - ir ) );
+
+                  const size_t row    ( SO ? jc+jr : ic+ir );
+                  const size_t column ( SO ? ic+ir : jc+jr );
+                  const size_t rows   ( SO ? nr : mr );
+                  const size_t columns( SO ? mr : nr );
+
+                  if( ( LOW && row+rows <= column ) || ( UPP && column+columns <= row ) )
+                     continue;
+
+                  const bool masked( ( LOW && row < column+columns-1UL ) ||
+                                     ( UPP && column < row+rows-1UL ) );
+
+                  gebpMicroKernel( bbuffer.get()+ir*kc, vbuffer.get()+jr*kc, kc, tmp.data(),
+                                   make_index_sequence<MR>() );
+
+                  if( mr == MR && nr == NR && !masked )
+                  {
+                     for( size_t r=0UL; r<MR; ++r ) {
+                        for( size_t l=0UL; l<NR; l+=SIMDSIZE ) {
+                           const size_t i( SO ? row+l : row+r );
+                           const size_t j( SO ? column+r : column+l );
+                           C.storeu( i, j, C.loadu( i, j ) + loada( tmp.data()+r*NR+l ) * factor );
+                        }
+                     }
+                  }
+                  else
+                  {
+                     for( size_t r=0UL; r<mr; ++r ) {
+                        for( size_t l=0UL; l<nr; ++l ) {
+                           const size_t i( SO ? row+l : row+r );
+                           const size_t j( SO ? column+r : column+l );
+                           if( ( LOW && i < j ) || ( UPP && i > j ) )
+                              continue;
+                           C(i,j) += tmp[r*NR+l] * ET( alpha );
+                        }
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the packed dense matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return \a false.
+//
+// This function is selected in case the packed dense matrix multiplication kernel cannot be
+// applied for the given matrices. It does not modify \a C.
+*/
+template< bool LOW       // Flag for the computation of the lower part only
+        , bool UPP       // Flag for the computation of the upper part only
+        , typename MT1   // Type of the target matrix
+        , typename MT2   // Type of the left-hand side operand
+        , typename MT3   // Type of the right-hand side operand
+        , typename ST >  // Type of the scaling factors
+auto gebp( MT1& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+   -> DisableIf_t< UsePackedMMMKernel_v<MT1,MT2,MT3>, bool >
+{
+   MAYBE_UNUSED( C, A, B, alpha, beta );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,296 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/InPlaceTranspose.h
+//  \brief Header file for the in-place transposition of rectangular dense matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_INPLACETRANSPOSE_H_
+#define _BLAZE_MATH_DENSE_INPLACETRANSPOSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/smp/Reduction.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluates the given kernel on the index range \f$[0..size)\f$, in parallel if requested.
+// \ingroup dense_matrix
+//
+// \param size The total number of indices.
+// \param parallel \a true for an SMP-parallel evaluation, \a false for a serial evaluation.
+// \param kernel The kernel processing the subrange \f$[index..index+n)\f$.
+// \return void
+//
+// The parallel evaluation distributes contiguous subranges to the threads of the active SMP
+// backend (see smpReduce()).
+*/
+template< typename Kernel >  // Type of the kernel
+void inplaceTransposeLoop( size_t size, bool parallel, Kernel kernel )
+{
+   if( parallel && size > 1UL )
+   {
+      const auto range = [&kernel]( size_t index, size_t n ) {
+         kernel( index, n );
+         return 0UL;
+      };
+
+      const auto combine = []( size_t a, size_t b ) {
+         return a + b;
+      };
+
+      smpReduce( size, 1UL, range, combine );
+   }
+   else
+   {
+      kernel( 0UL, size );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a contiguous square matrix.
+// \ingroup dense_matrix
+//
+// \param v Pointer to the first element of the \a n x \a n matrix.
+// \param n The number of rows and columns of the matrix.
+// \return void
+*/
+template< typename Type >  // Data type of the elements
+void inplaceTransposeSquare( Type* v, size_t n )
+{
+   using std::swap;
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t ii=0UL; ii<n; ii+=block ) {
+      const size_t iend( min( ii+block, n ) );
+      for( size_t jj=0UL; jj<=ii; jj+=block ) {
+         for( size_t i=ii; i<iend; ++i ) {
+            const size_t jend( min( jj+block, i ) );
+            for( size_t j=jj; j<jend; ++j ) {
+               swap( v[i*n+j], v[j*n+i] );
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a contiguous matrix of contiguous chunks.
+// \ingroup dense_matrix
+//
+// \param v Pointer to the first element of the matrix.
+// \param m The number of rows of the matrix (in chunks).
+// \param n The number of columns of the matrix (in chunks).
+// \param chunk The number of elements per chunk.
+// \return void
+//
+// This function transposes the \a m x \a n matrix whose elements are contiguous chunks of
+// \a chunk elements each by following the cycles of the transposition permutation. A bitset
+// marks the chunks that are already in place, a single chunk is buffered.
+*/
+template< typename Type >  // Data type of the elements
+void inplaceTransposeChunks( Type* v, size_t m, size_t n, size_t chunk )
+{
+   if( m < 2UL || n < 2UL )
+      return;
+
+   const size_t total( m*n );
+
+   std::vector<bool> done( total, false );
+   std::unique_ptr<Type[]> buffer( new Type[chunk] );
+
+   for( size_t k=1UL; k<total-1UL; ++k )
+   {
+      if( done[k] )
+         continue;
+
+      std::move( v+k*chunk, v+(k+1UL)*chunk, buffer.get() );
+
+      // Position p of the n x m result holds the chunk (p%m,p/m) of the m x n matrix
+      size_t p( k );
+      for( size_t s=(k%m)*n+k/m; s!=k; s=(p%m)*n+p/m ) {
+         done[p] = true;
+         std::move( v+s*chunk, v+(s+1UL)*chunk, v+p*chunk );
+         p = s;
+      }
+
+      done[p] = true;
+      std::move( buffer.get(), buffer.get()+chunk, v+p*chunk );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  IN-PLACE TRANSPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a rectangular dense matrix.
+// \ingroup dense_matrix
+//
+// \param v Pointer to the first element of the matrix.
+// \param m The number of rows of the matrix (columns in case of a column-major matrix).
+// \param n The number of columns of the matrix (rows in case of a column-major matrix).
+// \param nn The spacing between two rows (columns) of the matrix.
+// \param ns The spacing between two rows (columns) of the transposed matrix.
+// \param padded \a true in case the padding of the last row (column) is part of the memory.
+// \return void
+//
+// This function transposes the given \a m x \a n matrix into an \a n x \a m matrix with spacing
+// \a ns within the same memory, which must hold at least \f$ (n-1) \cdot ns + m \f$ elements
+// (\f$ n \cdot ns \f$ elements in case \a padded is \a true). The only additional memory is a
+// bitset and a buffer for a single chunk of elements. Using
+// \f$ g = \gcd(m,n) \f$, \f$ m = a \cdot g \f$ and \f$ n = b \cdot g \f$, the transposition is
+// decomposed into two steps:
+//
+//  -# the \a m x \a b matrix of chunks of \a g elements is transposed, which makes every group
+//     of \a g columns of the original matrix a contiguous \a m x \a g matrix;
+//  -# every \a m x \a g matrix is transposed by transposing its \a a contiguous \a g x \a g
+//     blocks and the resulting \a a x \a g matrix of chunks of \a g elements.
+//
+// The chunks are permuted by cycle-following (see inplaceTransposeChunks()). The independent
+// \a m x \a g matrices of the second step and the \a g x \a g blocks are processed in parallel
+// by the active SMP backend in case the matrix size exceeds the SMP dense matrix assignment
+// threshold. All padding elements of the transposed matrix within the memory are reset to their
+// default.
+*/
+template< typename Type >  // Data type of the elements
+void inplaceTranspose( Type* v, size_t m, size_t n, size_t nn, size_t ns, bool padded )
+{
+   using blaze::clear;
+
+   BLAZE_INTERNAL_ASSERT( nn >= n, "Invalid spacing detected" );
+   BLAZE_INTERNAL_ASSERT( ns >= m, "Invalid spacing detected" );
+
+   if( m == 0UL || n == 0UL )
+      return;
+
+   // Removing the padding of the rows
+   if( nn != n ) {
+      for( size_t i=1UL; i<m; ++i ) {
+         std::move( v+i*nn, v+i*nn+n, v+i*n );
+      }
+   }
+
+   if( m > 1UL && n > 1UL )
+   {
+      size_t g( m ), r( n );
+      while( r != 0UL ) {
+         const size_t tmp( g % r );
+         g = r;
+         r = tmp;
+      }
+
+      const size_t a( m / g );
+      const size_t b( n / g );
+
+      const bool parallel( m*n >= SMP_DMATASSIGN_THRESHOLD );
+
+      inplaceTransposeChunks( v, m, b, g );
+
+      const auto transposeBlocks = [v,g,a]( size_t offset, size_t index, size_t count ) {
+         for( size_t s=index; s<index+count; ++s ) {
+            inplaceTransposeSquare( v+offset+s*g*g, g );
+         }
+      };
+
+      if( b > 1UL ) {
+         inplaceTransposeLoop( b, parallel, [&]( size_t index, size_t count ) {
+            for( size_t k=index; k<index+count; ++k ) {
+               transposeBlocks( k*m*g, 0UL, a );
+               inplaceTransposeChunks( v+k*m*g, a, g, g );
+            }
+         } );
+      }
+      else {
+         inplaceTransposeLoop( a, parallel, [&]( size_t index, size_t count ) {
+            transposeBlocks( 0UL, index, count );
+         } );
+         inplaceTransposeChunks( v, a, g, g );
+      }
+   }
+
+   // Restoring the padding of the rows of the transposed matrix
+   if( ns != m ) {
+      for( size_t j=n-1UL; j>0UL; --j ) {
+         std::move_backward( v+j*m, v+j*m+m, v+j*ns+m );
+      }
+      const size_t jend( padded ? n : n-1UL );
+      for( size_t j=0UL; j<jend; ++j ) {
+         for( size_t i=m; i<ns; ++i ) {
+            clear( v[j*ns+i] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
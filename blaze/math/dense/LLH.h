@@ -47,11 +47,13 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
 #include <blaze/math/constraints/Upper.h>
+#include <blaze/math/dense/BlockedDecomposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/potrf.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/BLAS.h>
 
 
 namespace blaze {
@@ -114,8 +116,11 @@ void llh( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L );
 // \c complex<double> element type. The attempt to call the function with matrices of any other
 // element type results in a compile time error!
 //
-// \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// \note In case the LAPACK mode is enabled (see the BLAZE_LAPACK_MODE switch), this function can
+// only be used if a fitting LAPACK library is available and linked to the executable. Otherwise
+// a call to this function will result in a linker error. In case the LAPACK mode is disabled,
+// the Cholesky decomposition is computed by the native blocked implementation of the Blaze library
+// (see the blockedPotrf() function), which doesn't require a LAPACK library.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a L may already have been modified.
@@ -165,7 +170,11 @@ void llh( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L )
       }
    }
 
+#if BLAZE_LAPACK_MODE
    potrf( l, 'L' );
+#else
+   blockedPotrf( l );
+#endif
 }
 //*************************************************************************************************
 
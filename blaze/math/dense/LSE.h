@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -49,11 +51,21 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
 #include <blaze/math/lapack/gesv.h>
+#include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/getrs.h>
 #include <blaze/math/lapack/hesv.h>
+#include <blaze/math/lapack/potrf.h>
+#include <blaze/math/lapack/potrs.h>
 #include <blaze/math/lapack/sysv.h>
+#include <blaze/math/ReductionFlag.h>
 #include <blaze/math/shims/IsDivisor.h>
 #include <blaze/math/shims/Invert.h>
+#include <blaze/math/TransposeFlag.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsGeneral.h>
 #include <blaze/math/typetraits/IsHermitian.h>
@@ -64,13 +76,18 @@
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
 #include <blaze/system/MacroDisable.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/Complex.h>
 #include <blaze/util/constraints/SameType.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/mpl/If.h>
+#include <blaze/util/NumericCast.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsDouble.h>
 
 
 namespace blaze {
@@ -6483,6 +6500,263 @@ void solve( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X, const DenseM
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the mixed precision solution of a linear system of equations for single
+//        precision element types (\f$ A*x=b \f$).
+// \ingroup dense_matrix
+//
+// \param A The NxN dense system matrix.
+// \param x The dense solution vector.
+// \param b The N-dimensional dense right-hand side vector.
+// \return \a false since no mixed precision computation is performed.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function is selected for system matrices with \c float or \c complex<float> element
+// type, for which no lower precision is available. It solves the LSE via the regular \c solve()
+// function.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , EnableIf_t< !IsDouble_v< UnderlyingBuiltin_t< ElementType_t<MT> > > >* = nullptr >
+bool mixedSolveBackend( const DenseMatrix<MT,SO>& A, DenseVector<VT1,columnVector>& x,
+                        const DenseVector<VT2,columnVector>& b )
+{
+   solve( *A, *x, *b );
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the mixed precision solution of a linear system of equations for double
+//        precision element types (\f$ A*x=b \f$).
+// \ingroup dense_matrix
+//
+// \param A The NxN dense system matrix.
+// \param x The dense solution vector.
+// \param b The N-dimensional dense right-hand side vector.
+// \return \a true if the single precision refinement converged, \a false if not.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function factorizes a single precision copy of the given system matrix (via a Cholesky
+// decomposition in case of a symmetric or Hermitian matrix type, via an LU decomposition in all
+// other cases) and refines the solution in double precision. In case the system matrix or the
+// right-hand side vector cannot be represented in single precision, in case the single precision
+// factorization is singular, or in case the refinement doesn't converge within 30 iterations,
+// the LSE is solved via the regular \c solve() function.
+*/
+template< typename MT   // Type of the system matrix
+        , bool SO       // Storage order of the system matrix
+        , typename VT1  // Type of the solution vector
+        , typename VT2  // Type of the right-hand side vector
+        , EnableIf_t< IsDouble_v< UnderlyingBuiltin_t< ElementType_t<MT> > > >* = nullptr >
+bool mixedSolveBackend( const DenseMatrix<MT,SO>& A, DenseVector<VT1,columnVector>& x,
+                        const DenseVector<VT2,columnVector>& b )
+{
+   using ET = ElementType_t<MT>;
+   using LT = If_t< IsComplex_v<ET>, complex<float>, float >;
+   using RT = ResultType_t<MT>;
+   using OT = OppositeType_t<MT>;
+
+   using LowMatrix = Rebind_t< RemoveAdaptor_t< If_t<SO,RT,OT> >, LT >;
+   using LowVector = Rebind_t< ResultType_t<VT1>, LT >;
+
+   constexpr size_t maxIterations( 30UL );
+
+   const size_t N( (*b).size() );
+
+   resize( *x, N );
+
+   if( N == 0UL ) {
+      return true;
+   }
+
+   const double limit( std::numeric_limits<float>::max() );
+   const double anorm( max( sum<rowwise>( abs( *A ) ) ) );
+
+   if( !( anorm <= limit ) || !( max( abs( *b ) ) <= limit ) ) {
+      solve( *A, *x, *b );
+      return false;
+   }
+
+   // Single precision factorization of the system matrix
+   LowMatrix Alow( *A );
+
+   const std::unique_ptr<blas_int_t[]> ipiv( new blas_int_t[N] );
+
+   bool llh( false );
+
+   if( IsHermitian_v<MT> || ( IsSymmetric_v<MT> && !IsComplex_v<ET> ) )
+   {
+      blas_int_t n   ( numeric_cast<blas_int_t>( N ) );
+      blas_int_t lda ( numeric_cast<blas_int_t>( Alow.spacing() ) );
+      blas_int_t info( 0 );
+
+      potrf( 'L', n, Alow.data(), lda, &info );
+
+      if( info == 0 ) {
+         llh = true;
+      }
+      else {
+         Alow = *A;
+      }
+   }
+
+   if( !llh )
+   {
+      getrf( Alow, ipiv.get() );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         if( isDefault( Alow(i,i) ) ) {
+            solve( *A, *x, *b );
+            return false;
+         }
+      }
+   }
+
+   // Single precision solution and double precision refinement
+   LowVector xlow( *b );
+   ResultType_t<VT1> r( N );
+
+   if( llh ) {
+      potrs( Alow, xlow, 'L' );
+   }
+   else {
+      getrs( Alow, xlow, 'N', ipiv.get() );
+   }
+
+   *x = xlow;
+
+   const double eps( anorm * std::numeric_limits<double>::epsilon() * std::sqrt( double( N ) ) );
+
+   for( size_t iteration=0UL; iteration<=maxIterations; ++iteration )
+   {
+      r = *b - (*A) * (*x);
+
+      const double rnorm( max( abs( r ) ) );
+
+      if( rnorm <= eps * max( abs( *x ) ) ) {
+         return true;
+      }
+
+      if( iteration == maxIterations || !( rnorm <= limit ) ) {
+         break;
+      }
+
+      xlow = r;
+
+      if( llh ) {
+         potrs( Alow, xlow, 'L' );
+      }
+      else {
+         getrs( Alow, xlow, 'N', ipiv.get() );
+      }
+
+      *x += xlow;
+   }
+
+   // Fallback to the double precision solution
+   solve( *A, *x, *b );
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given \f$ N \times N \f$ linear system of equations (\f$ A*x=b \f$) by means
+//        of mixed precision iterative refinement.
+// \ingroup dense_matrix
+//
+// \param A The NxN dense system matrix.
+// \param x The dense solution vector.
+// \param b The N-dimensional dense right-hand side vector.
+// \return \a true if the solution has been computed in mixed precision, \a false if not.
+// \exception std::invalid_argument Invalid non-square system matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Solving LSE with singular system matrix failed.
+//
+// This function computes a solution for the given linear system of equations \f$ A*x=b \f$ with
+// \c double or \c complex<double> element type by means of mixed precision iterative refinement.
+// The system matrix is factorized in single precision (via a Cholesky decomposition in case the
+// type of the matrix is symmetric or Hermitian and via an LU decomposition otherwise), which
+// is considerably faster and requires only half the memory bandwidth of a double precision
+// factorization. Subsequently, the solution is refined in double precision until the residual
+// satisfies the same stopping criterion as the LAPACK \c dsgesv() function:
+
+      \f[ \|b - A x\|_{\infty} \le \sqrt{N} \cdot \epsilon \cdot \|A\|_{\infty} \|x\|_{\infty} \f]
+
+// In case the refinement doesn't converge within 30 iterations (for instance due to an
+// ill-conditioned system matrix), in case the system matrix or the right-hand side vector cannot
+// be represented in single precision or in case the single precision factorization is singular,
+// the function automatically falls back to the double precision \c solve() function. The return
+// value indicates whether the solution was computed in mixed precision:
+
+   \code
+   blaze::DynamicMatrix<double> A;  // The square general system matrix
+   blaze::DynamicVector<double> b;  // The right-hand side vector
+   // ... Resizing and initialization
+
+   blaze::DynamicVector<double> x;  // The solution vector
+
+   if( !mixedSolve( A, x, b ) ) {
+      // The solution has been computed via a double precision factorization
+   }
+   \endcode
+
+// For system matrices with \c float or \c complex<float> element type the function is identical
+// to the \c solve() function and always returns \a false. The function fails if ...
+//
+//  - ... the given system matrix is not a square matrix;
+//  - ... the size of the right-hand side vector doesn't match the dimensions of the system matrix;
+//  - ... the given system matrix is singular.
+//
+// In all failure cases an exception is thrown.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a x may already have been modified.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+bool mixedSolve( const DenseMatrix<MT,SO>& A, DenseVector<VT1,columnVector>& x,
+                 const DenseVector<VT2,columnVector>& b )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_UNIFORM_TYPE( MT );
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT>  );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<VT1> );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<VT2> );
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT>, ElementType_t<VT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_t<MT>, ElementType_t<VT2> );
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square system matrix provided" );
+   }
+   else if( (*A).rows() != (*b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   const bool mixed( mixedSolveBackend( *A, *x, *b ) );
+
+   BLAZE_INTERNAL_ASSERT( isIntact( *x ), "Broken invariant detected" );
+
+   return mixed;
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -51,11 +51,13 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
 #include <blaze/math/constraints/Upper.h>
+#include <blaze/math/dense/BlockedDecomposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/getrf.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/NumericCast.h>
 
@@ -114,7 +116,11 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
    blas_int_t* ipiv  ( helper.get() );
    blas_int_t* permut( ipiv + mindim );
 
+#if BLAZE_LAPACK_MODE
    getrf( *A, ipiv );
+#else
+   blockedGetrf( *A, ipiv );
+#endif
 
    for( int i=0; i<size; ++i ) {
       permut[i] = i;
@@ -206,8 +212,11 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
 // \c complex<double> element type. The attempt to call the function with matrices of any other
 // element type results in a compile time error!
 //
-// \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// \note In case the LAPACK mode is enabled (see the BLAZE_LAPACK_MODE switch), this function can
+// only be used if a fitting LAPACK library is available and linked to the executable. Otherwise
+// a call to this function will result in a linker error. In case the LAPACK mode is disabled,
+// the LU decomposition is computed by the native blocked implementation of the Blaze library
+// (see the blockedGetrf() function), which doesn't require a LAPACK library.
 //
 // \note The LU decomposition will never fail, even for singular matrices. However, in case of a
 // singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
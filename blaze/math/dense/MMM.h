@@ -56,6 +56,7 @@
 #include <blaze/math/constraints/Lower.h>
 #include <blaze/math/constraints/Upper.h>
 #include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/GEBP.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsOne.h>
@@ -140,6 +141,9 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
+   if( gebp<false,false>( *C, A, B, alpha, beta ) )
+      return;
+
    DynamicMatrix<ET2,false> A2( M, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
 
@@ -640,6 +644,9 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
+   if( gebp<false,false>( *C, A, B, alpha, beta ) )
+      return;
+
    DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, N );
 
@@ -1168,11 +1175,14 @@ void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
+   decltype(auto) c( derestrict( *C ) );
+
+   if( gebp<true,false>( c, A, B, alpha, beta ) )
+      return;
+
    DynamicMatrix<ET2,false> A2( M, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
 
-   decltype(auto) c( derestrict( *C ) );
-
    if( isDefault( beta ) ) {
       reset( c );
    }
@@ -1694,11 +1704,14 @@ void lmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
+   decltype(auto) c( derestrict( *C ) );
+
+   if( gebp<true,false>( c, A, B, alpha, beta ) )
+      return;
+
    DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, N );
 
-   decltype(auto) c( derestrict( *C ) );
-
    if( isDefault( beta ) ) {
       reset( c );
    }
@@ -2238,11 +2251,14 @@ void ummm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
+   decltype(auto) c( derestrict( *C ) );
+
+   if( gebp<false,true>( c, A, B, alpha, beta ) )
+      return;
+
    DynamicMatrix<ET2,false> A2( M, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
 
-   decltype(auto) c( derestrict( *C ) );
-
    if( isDefault( beta ) ) {
       reset( c );
    }
@@ -2756,11 +2772,14 @@ void ummm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
+   decltype(auto) c( derestrict( *C ) );
+
+   if( gebp<false,true>( c, A, B, alpha, beta ) )
+      return;
+
    DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, N );
 
-   decltype(auto) c( derestrict( *C ) );
-
    if( isDefault( beta ) ) {
       reset( c );
    }
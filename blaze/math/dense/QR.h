@@ -49,6 +49,7 @@
 #include <blaze/math/constraints/StrictlyTriangular.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
+#include <blaze/math/dense/BlockedDecomposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/geqrf.h>
@@ -57,6 +58,7 @@
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/views/Submatrix.h>
+#include <blaze/system/BLAS.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/EnableIf.h>
 
@@ -94,7 +96,11 @@ template< typename MT1 >  // Type of matrix A
 inline auto qr_backend( MT1& A, const ElementType_t<MT1>* tau )
    -> EnableIf_t<IsBuiltin_v< ElementType_t<MT1> > >
 {
+#if BLAZE_LAPACK_MODE
    orgqr( A, tau );
+#else
+   blockedOrgqr( A, tau );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -116,7 +122,11 @@ template< typename MT1 >  // Type of matrix A
 inline auto qr_backend( MT1& A, const ElementType_t<MT1>* tau )
    -> EnableIf_t<IsComplex_v< ElementType_t<MT1> > >
 {
+#if BLAZE_LAPACK_MODE
    ungqr( A, tau );
+#else
+   blockedOrgqr( A, tau );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -167,8 +177,11 @@ inline auto qr_backend( MT1& A, const ElementType_t<MT1>* tau )
 // \c complex<double> element type. The attempt to call the function with matrices of any other
 // element type results in a compile time error!
 //
-// \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// \note In case the LAPACK mode is enabled (see the BLAZE_LAPACK_MODE switch), this function can
+// only be used if a fitting LAPACK library is available and linked to the executable. Otherwise
+// a call to this function will result in a linker error. In case the LAPACK mode is disabled,
+// the QR decomposition is computed by the native blocked implementation of the Blaze library
+// (see the blockedGeqrf() function), which doesn't require a LAPACK library.
 */
 template< typename MT1  // Type of matrix A
         , bool SO1      // Storage order of matrix A
@@ -211,7 +224,11 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
    if( m < n )
    {
       r = A;
+#if BLAZE_LAPACK_MODE
       geqrf( r, tau.get() );
+#else
+      blockedGeqrf( r, tau.get() );
+#endif
       (*Q) = submatrix( r, 0UL, 0UL, m, m );
       qr_backend( *Q, tau.get() );
 
@@ -224,7 +241,11 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
    else
    {
       (*Q) = A;
+#if BLAZE_LAPACK_MODE
       geqrf( *Q, tau.get() );
+#else
+      blockedGeqrf( *Q, tau.get() );
+#endif
 
       resize( *R, n, n, false );
       reset( r );
@@ -0,0 +1,344 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/ReproducibleReduction.h
+//  \brief Header file for the reproducible reduction kernels of dense vectors and matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_REPRODUCIBLEREDUCTION_H_
+#define _BLAZE_MATH_DENSE_REPRODUCIBLEREDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/shims/PrevMultiple.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The number of virtual lanes of the reproducible reduction kernels.
+// \ingroup math
+//
+// The reproducible reduction kernels distribute the elements of every block cyclically among
+// a fixed number of virtual lanes, which depends only on the size of the reduced values, but
+// not on the SIMD width of the target architecture. The lanes occupy 256 bytes, i.e. four SIMD
+// vectors for AVX-512 and more for narrower instruction sets. Thus for all floating point types
+// the number of lanes is a multiple of the number of values per SIMD vector for all supported
+// instruction sets.
+*/
+template< typename T >
+constexpr size_t reproducibleLanes = ( sizeof(T) < 256UL ? 256UL / sizeof(T) : 1UL );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The number of elements per block of the reproducible reduction kernels.
+// \ingroup math
+//
+// The reproducible reduction kernels split a range into blocks of this fixed size, which are
+// reduced individually and combined in the order of the blocks. Since the blocks are also the
+// unit of work of the parallel reductions, the result does not depend on the number of threads.
+*/
+constexpr size_t reproducibleBlockSize = 4096UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Tag type for the selection of the reproducible reduction kernels.
+// \ingroup math
+*/
+struct ReproducibleTag {};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the reproducible reduction kernels.
+// \ingroup math
+//
+// This helper evaluates to \a true in case reproducible reductions are enabled (see the
+// BLAZE_USE_REPRODUCIBLE_REDUCTIONS switch) and the result of a reduction of values of type
+// \a T by means of the operation \a OP depends on the order of evaluation. This is the case
+// for all floating point and complex types, except for the order-independent minimum and
+// maximum operations. Reductions of integral values are exact and are therefore not affected.
+*/
+template< typename T     // Type of the reduced values
+        , typename OP >  // Type of the reduction operation
+struct ReproducibleReductionHelper
+{
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( useReproducibleReductions &&
+        IsNumeric_v<T> && !IsIntegral_v<T> &&
+        !IsSame_v<OP,Min> && !IsSame_v<OP,Max> );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Combines the virtual lanes of a reproducible reduction kernel.
+// \ingroup math
+//
+// \param lanes The array of virtual lanes.
+// \param count The number of used virtual lanes \f$[1..reproducibleLanes]\f$.
+// \param op The reduction operation.
+// \return The combination of all used lanes.
+//
+// This function combines the given lanes by means of a binary tree, whose shape depends only on
+// \a count. For instance, for 16 lanes, lane \a k is combined with lane \a k+8, \a k+4, \a k+2,
+// and \a k+1 in this order.
+*/
+template< typename T     // Type of the reduced values
+        , typename OP >  // Type of the reduction operation
+inline T reproducibleCombine( T* lanes, size_t count, OP& op )
+{
+   BLAZE_INTERNAL_ASSERT( count > 0UL && count <= reproducibleLanes<T>, "Invalid lane count" );
+
+   size_t width( 1UL );
+
+   while( width < count ) {
+      width *= 2UL;
+   }
+
+   for( width/=2UL; width>0UL; width/=2UL ) {
+      for( size_t k=0UL; k<width && k+width<count; ++k ) {
+         lanes[k] = op( lanes[k], lanes[k+width] );
+      }
+   }
+
+   return lanes[0UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default reproducible reduction kernel for a single block of a dense vector.
+// \ingroup math
+//
+// \param v The given dense vector.
+// \param begin The index of the first element of the block.
+// \param end The index one past the last element of the block.
+// \param map The operation applied to every element before the reduction.
+// \param op The reduction operation.
+// \return The result of the reduction of the block.
+//
+// This function reduces the mapped elements \f$[begin..end)\f$ of the given vector by
+// distributing them cyclically among the virtual lanes. Every lane combines its elements in
+// ascending order. The lanes are finally combined by means of reproducibleCombine().
+*/
+template< typename T      // Type of the reduced values
+        , typename VT     // Type of the dense vector
+        , typename Map    // Type of the map operation
+        , typename OP >   // Type of the reduction operation
+inline T reproducibleReduceBlock( const VT& v, size_t begin, size_t end,
+                                  Map& map, OP& op, FalseType )
+{
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= v.size(), "Invalid block" );
+
+   T lanes[reproducibleLanes<T>];
+
+   const size_t count( min( end - begin, reproducibleLanes<T> ) );
+
+   for( size_t l=0UL; l<count; ++l ) {
+      lanes[l] = map( v[begin+l] );
+   }
+
+   for( size_t i=begin+count, l=0UL; i<end; ++i ) {
+      lanes[l] = op( lanes[l], map( v[i] ) );
+      l = ( l+1UL == reproducibleLanes<T> )?( 0UL ):( l+1UL );
+   }
+
+   return reproducibleCombine( lanes, count, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized reproducible reduction kernel for a single block of a dense vector.
+// \ingroup math
+//
+// \param v The given dense vector.
+// \param begin The index of the first element of the block.
+// \param end The index one past the last element of the block.
+// \param map The operation applied to every element before the reduction.
+// \param op The reduction operation.
+// \return The result of the reduction of the block.
+//
+// This function computes the same result as the default kernel by mapping the virtual lanes
+// to \f$ reproducibleLanes / SIMDSIZE \f$ SIMD vectors. The given \a begin index is expected
+// to be a multiple of the SIMD size.
+*/
+template< typename T      // Type of the reduced values
+        , typename VT     // Type of the dense vector
+        , typename Map    // Type of the map operation
+        , typename OP >   // Type of the reduction operation
+inline T reproducibleReduceBlock( const VT& v, size_t begin, size_t end,
+                                  Map& map, OP& op, TrueType )
+{
+   using SIMDType = SIMDTrait_t<T>;
+
+   constexpr size_t SIMDSIZE = SIMDTrait<T>::size;
+   constexpr size_t LANES    = reproducibleLanes<T>;
+   constexpr size_t SIMDREGS = LANES / SIMDSIZE;
+
+   BLAZE_STATIC_ASSERT( LANES % SIMDSIZE == 0UL );
+   BLAZE_INTERNAL_ASSERT( begin < end && end <= v.size(), "Invalid block" );
+   BLAZE_INTERNAL_ASSERT( begin % SIMDSIZE == 0UL, "Invalid block alignment" );
+
+   if( end - begin < LANES ) {
+      return reproducibleReduceBlock<T>( v, begin, end, map, op, FalseType() );
+   }
+
+   const size_t ipos( begin + prevMultiple( end - begin, LANES ) );
+   BLAZE_INTERNAL_ASSERT( ipos <= end, "Invalid end calculation" );
+
+   SIMDType xmm[SIMDREGS];
+
+   for( size_t r=0UL; r<SIMDREGS; ++r ) {
+      xmm[r] = map( v.load( begin + r*SIMDSIZE ) );
+   }
+
+   for( size_t i=begin+LANES; i<ipos; i+=LANES ) {
+      for( size_t r=0UL; r<SIMDREGS; ++r ) {
+         const SIMDType value( map( v.load( i + r*SIMDSIZE ) ) );
+         xmm[r] = op( xmm[r], value );
+      }
+   }
+
+   alignas( AlignmentOf_v<T> ) T lanes[reproducibleLanes<T>];
+
+   for( size_t r=0UL; r<SIMDREGS; ++r ) {
+      storeu( lanes + r*SIMDSIZE, xmm[r] );
+   }
+
+   for( size_t i=ipos; i<end; ++i ) {
+      lanes[i-ipos] = op( lanes[i-ipos], map( v[i] ) );
+   }
+
+   return reproducibleCombine( lanes, LANES, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reproducible reduction of a dense vector.
+// \ingroup math
+//
+// \param v The given non-empty dense vector.
+// \param map The operation applied to every element before the reduction.
+// \param op The reduction operation.
+// \return The result of the reduction.
+//
+// This function splits the given vector into blocks of reproducibleBlockSize elements, reduces
+// every block by means of reproducibleReduceBlock(), and combines the partial results in the
+// order of the blocks. Thus the order of evaluation depends only on the size of the vector. The
+// \a Tag selects either the default (FalseType) or the SIMD optimized (TrueType) block kernel,
+// which both yield the same result.
+*/
+template< typename T      // Type of the reduced values
+        , typename VT     // Type of the dense vector
+        , typename Map    // Type of the map operation
+        , typename OP     // Type of the reduction operation
+        , typename Tag >  // Type of the kernel selection tag
+inline T reproducibleReduce( const VT& v, Map map, OP op, Tag tag )
+{
+   const size_t N( v.size() );
+
+   BLAZE_INTERNAL_ASSERT( N > 0UL, "Invalid vector size" );
+
+   T redux( reproducibleReduceBlock<T>( v, 0UL, min( N, reproducibleBlockSize ), map, op, tag ) );
+
+   for( size_t i=reproducibleBlockSize; i<N; i+=reproducibleBlockSize ) {
+      redux = op( redux, reproducibleReduceBlock<T>(
+                            v, i, min( i+reproducibleBlockSize, N ), map, op, tag ) );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,494 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/SIMDTranspose.h
+//  \brief Header file for the SIMD transpose kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_SIMDTRANSPOSE_H_
+#define _BLAZE_MATH_DENSE_SIMDTRANSPOSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/shims/PrevMultiple.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SIMDTRANSPOSEKERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Register-level transpose kernels for elements of the given size (in bytes).
+// \ingroup dense_matrix
+//
+// The SIMDTransposeKernel class template provides the transposition of a square micro-tile of
+// \a size x \a size elements in SIMD registers. Since the kernels only move bit patterns, they
+// apply to all element types of the given size. The kernels use 8x8 (4-byte elements) and 4x4
+// (8-byte elements) shuffles for AVX, AVX2, and AVX-512, and 4x4 and 2x2 shuffles for SSE/SSE2.
+// In case no suitable instruction set is available, \a size is 1.
+*/
+template< size_t Bytes >  // Size of the elements
+struct SIMDTransposeKernel
+{
+   static constexpr size_t size = 1UL;  //!< Number of rows and columns of a micro-tile.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDTransposeKernel class template for 4-byte elements.
+// \ingroup dense_matrix
+*/
+template<>
+struct SIMDTransposeKernel<4UL>
+{
+#if BLAZE_AVX_MODE
+   //**********************************************************************************************
+   static constexpr size_t size = 8UL;  //!< Number of rows and columns of a micro-tile.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Transposes an 8x8 micro-tile.
+   //
+   // \param src Pointer to the first element of the source tile.
+   // \param ss The spacing between two lines of the source tile.
+   // \param dst Pointer to the first element of the target tile.
+   // \param ds The spacing between two lines of the target tile.
+   // \return void
+   */
+   static BLAZE_ALWAYS_INLINE void
+      transpose( const void* src, size_t ss, void* dst, size_t ds ) noexcept
+   {
+      const float* s( static_cast<const float*>( src ) );
+      float* d( static_cast<float*>( dst ) );
+
+      const __m256 r0( _mm256_loadu_ps( s      ) );
+      const __m256 r1( _mm256_loadu_ps( s+  ss ) );
+      const __m256 r2( _mm256_loadu_ps( s+2*ss ) );
+      const __m256 r3( _mm256_loadu_ps( s+3*ss ) );
+      const __m256 r4( _mm256_loadu_ps( s+4*ss ) );
+      const __m256 r5( _mm256_loadu_ps( s+5*ss ) );
+      const __m256 r6( _mm256_loadu_ps( s+6*ss ) );
+      const __m256 r7( _mm256_loadu_ps( s+7*ss ) );
+
+      const __m256 t0( _mm256_unpacklo_ps( r0, r1 ) );
+      const __m256 t1( _mm256_unpackhi_ps( r0, r1 ) );
+      const __m256 t2( _mm256_unpacklo_ps( r2, r3 ) );
+      const __m256 t3( _mm256_unpackhi_ps( r2, r3 ) );
+      const __m256 t4( _mm256_unpacklo_ps( r4, r5 ) );
+      const __m256 t5( _mm256_unpackhi_ps( r4, r5 ) );
+      const __m256 t6( _mm256_unpacklo_ps( r6, r7 ) );
+      const __m256 t7( _mm256_unpackhi_ps( r6, r7 ) );
+
+      const __m256 u0( _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+      const __m256 u1( _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+      const __m256 u2( _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+      const __m256 u3( _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+      const __m256 u4( _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+      const __m256 u5( _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+      const __m256 u6( _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 1, 0, 1, 0 ) ) );
+      const __m256 u7( _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+
+      _mm256_storeu_ps( d     , _mm256_permute2f128_ps( u0, u4, 0x20 ) );
+      _mm256_storeu_ps( d+  ds, _mm256_permute2f128_ps( u1, u5, 0x20 ) );
+      _mm256_storeu_ps( d+2*ds, _mm256_permute2f128_ps( u2, u6, 0x20 ) );
+      _mm256_storeu_ps( d+3*ds, _mm256_permute2f128_ps( u3, u7, 0x20 ) );
+      _mm256_storeu_ps( d+4*ds, _mm256_permute2f128_ps( u0, u4, 0x31 ) );
+      _mm256_storeu_ps( d+5*ds, _mm256_permute2f128_ps( u1, u5, 0x31 ) );
+      _mm256_storeu_ps( d+6*ds, _mm256_permute2f128_ps( u2, u6, 0x31 ) );
+      _mm256_storeu_ps( d+7*ds, _mm256_permute2f128_ps( u3, u7, 0x31 ) );
+   }
+   //**********************************************************************************************
+#elif BLAZE_SSE_MODE
+   //**********************************************************************************************
+   static constexpr size_t size = 4UL;  //!< Number of rows and columns of a micro-tile.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Transposes a 4x4 micro-tile.
+   //
+   // \param src Pointer to the first element of the source tile.
+   // \param ss The spacing between two lines of the source tile.
+   // \param dst Pointer to the first element of the target tile.
+   // \param ds The spacing between two lines of the target tile.
+   // \return void
+   */
+   static BLAZE_ALWAYS_INLINE void
+      transpose( const void* src, size_t ss, void* dst, size_t ds ) noexcept
+   {
+      const float* s( static_cast<const float*>( src ) );
+      float* d( static_cast<float*>( dst ) );
+
+      __m128 r0( _mm_loadu_ps( s      ) );
+      __m128 r1( _mm_loadu_ps( s+  ss ) );
+      __m128 r2( _mm_loadu_ps( s+2*ss ) );
+      __m128 r3( _mm_loadu_ps( s+3*ss ) );
+
+      _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+      _mm_storeu_ps( d     , r0 );
+      _mm_storeu_ps( d+  ds, r1 );
+      _mm_storeu_ps( d+2*ds, r2 );
+      _mm_storeu_ps( d+3*ds, r3 );
+   }
+   //**********************************************************************************************
+#else
+   //**********************************************************************************************
+   static constexpr size_t size = 1UL;  //!< Number of rows and columns of a micro-tile.
+   //**********************************************************************************************
+#endif
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDTransposeKernel class template for 8-byte elements.
+// \ingroup dense_matrix
+*/
+template<>
+struct SIMDTransposeKernel<8UL>
+{
+#if BLAZE_AVX_MODE
+   //**********************************************************************************************
+   static constexpr size_t size = 4UL;  //!< Number of rows and columns of a micro-tile.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Transposes a 4x4 micro-tile.
+   //
+   // \param src Pointer to the first element of the source tile.
+   // \param ss The spacing between two lines of the source tile.
+   // \param dst Pointer to the first element of the target tile.
+   // \param ds The spacing between two lines of the target tile.
+   // \return void
+   */
+   static BLAZE_ALWAYS_INLINE void
+      transpose( const void* src, size_t ss, void* dst, size_t ds ) noexcept
+   {
+      const double* s( static_cast<const double*>( src ) );
+      double* d( static_cast<double*>( dst ) );
+
+      const __m256d r0( _mm256_loadu_pd( s      ) );
+      const __m256d r1( _mm256_loadu_pd( s+  ss ) );
+      const __m256d r2( _mm256_loadu_pd( s+2*ss ) );
+      const __m256d r3( _mm256_loadu_pd( s+3*ss ) );
+
+      const __m256d t0( _mm256_unpacklo_pd( r0, r1 ) );
+      const __m256d t1( _mm256_unpackhi_pd( r0, r1 ) );
+      const __m256d t2( _mm256_unpacklo_pd( r2, r3 ) );
+      const __m256d t3( _mm256_unpackhi_pd( r2, r3 ) );
+
+      _mm256_storeu_pd( d     , _mm256_permute2f128_pd( t0, t2, 0x20 ) );
+      _mm256_storeu_pd( d+  ds, _mm256_permute2f128_pd( t1, t3, 0x20 ) );
+      _mm256_storeu_pd( d+2*ds, _mm256_permute2f128_pd( t0, t2, 0x31 ) );
+      _mm256_storeu_pd( d+3*ds, _mm256_permute2f128_pd( t1, t3, 0x31 ) );
+   }
+   //**********************************************************************************************
+#elif BLAZE_SSE2_MODE
+   //**********************************************************************************************
+   static constexpr size_t size = 2UL;  //!< Number of rows and columns of a micro-tile.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Transposes a 2x2 micro-tile.
+   //
+   // \param src Pointer to the first element of the source tile.
+   // \param ss The spacing between two lines of the source tile.
+   // \param dst Pointer to the first element of the target tile.
+   // \param ds The spacing between two lines of the target tile.
+   // \return void
+   */
+   static BLAZE_ALWAYS_INLINE void
+      transpose( const void* src, size_t ss, void* dst, size_t ds ) noexcept
+   {
+      const double* s( static_cast<const double*>( src ) );
+      double* d( static_cast<double*>( dst ) );
+
+      const __m128d r0( _mm_loadu_pd( s    ) );
+      const __m128d r1( _mm_loadu_pd( s+ss ) );
+
+      _mm_storeu_pd( d   , _mm_unpacklo_pd( r0, r1 ) );
+      _mm_storeu_pd( d+ds, _mm_unpackhi_pd( r0, r1 ) );
+   }
+   //**********************************************************************************************
+#else
+   //**********************************************************************************************
+   static constexpr size_t size = 1UL;  //!< Number of rows and columns of a micro-tile.
+   //**********************************************************************************************
+#endif
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY VARIABLE TEMPLATE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary variable template for the selection of the SIMD transpose kernels.
+// \ingroup dense_matrix
+//
+// This variable template evaluates to \a true in case the SIMD transpose kernels can be applied
+// for the assignment of the given dense matrices, i.e. in case the SIMD transpose kernels are
+// enabled, both matrices have opposite storage order and provide direct access to their data,
+// and both matrices have the same numeric element type of size 4 or 8 bytes, for which a SIMD
+// micro-kernel is available.
+*/
+template< typename MT1    // Type of the target matrix
+        , typename MT2 >  // Type of the source matrix
+constexpr bool UseSIMDTransposeKernel_v =
+   ( useSIMDTransposeKernels &&
+     IsColumnMajorMatrix_v<MT1> != IsColumnMajorMatrix_v<MT2> &&
+     HasMutableDataAccess_v<MT1> &&
+     HasConstDataAccess_v<MT2> &&
+     IsNumeric_v< ElementType_t<MT1> > &&
+     IsSame_v< RemoveCV_t< ElementType_t<MT1> >, RemoveCV_t< ElementType_t<MT2> > > &&
+     SIMDTransposeKernel< sizeof( ElementType_t<MT1> ) >::size > 1UL );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRANSPOSE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposes a cache-resident block by means of SIMD micro-tiles.
+// \ingroup dense_matrix
+//
+// \param src Pointer to the first element of the source block.
+// \param ss The spacing between two lines of the source block.
+// \param dst Pointer to the first element of the target block.
+// \param ds The spacing between two lines of the target block.
+// \param m The number of lines of the source block.
+// \param n The number of elements per line of the source block.
+// \return void
+//
+// This function computes \c dst[j*ds+i] = \c src[i*ss+j] for all \f$ i < m \f$ and \f$ j < n \f$.
+// Complete micro-tiles are transposed in SIMD registers, the remaining elements are copied one
+// by one. Vertically adjacent micro-tiles are transposed in groups that fill complete 64-byte
+// cache lines of the target block.
+*/
+template< typename T >  // Type of the elements
+void simdTransposeBlock( const T* src, size_t ss, T* dst, size_t ds, size_t m, size_t n )
+{
+   using Kernel = SIMDTransposeKernel< sizeof(T) >;
+
+   constexpr size_t MS( Kernel::size );
+
+   // Number of micro-tiles per cache line of the target block
+   constexpr size_t TR( MS*sizeof(T) < 64UL ? 64UL / ( MS*sizeof(T) ) : 1UL );
+
+   const size_t mpos( prevMultiple( m, MS ) );
+   const size_t npos( prevMultiple( n, MS ) );
+
+   for( size_t i=0UL; i<mpos; i+=TR*MS )
+   {
+      const size_t iend( min( mpos, i+TR*MS ) );
+
+      for( size_t j=0UL; j<npos; j+=MS ) {
+         for( size_t k=i; k<iend; k+=MS ) {
+            Kernel::transpose( src+k*ss+j, ss, dst+j*ds+k, ds );
+         }
+      }
+
+      for( size_t j=npos; j<n; ++j ) {
+         for( size_t k=i; k<iend; ++k ) {
+            dst[j*ds+k] = src[k*ss+j];
+         }
+      }
+   }
+
+   for( size_t i=mpos; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         dst[j*ds+i] = src[i*ss+j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache-oblivious transposition of a block.
+// \ingroup dense_matrix
+//
+// \param src Pointer to the first element of the source block.
+// \param ss The spacing between two lines of the source block.
+// \param dst Pointer to the first element of the target block.
+// \param ds The spacing between two lines of the target block.
+// \param m The number of lines of the source block.
+// \param n The number of elements per line of the source block.
+// \return void
+//
+// This function recursively halves the larger dimension of the given block (at a multiple of
+// the micro-tile size) until the source block fits into a quarter of the L1 cache (see the
+// \c BLAZE_L1_CACHE_SIZE setting in <tt><blaze/config/CacheSize.h></tt>). The resulting blocks
+// are transposed by simdTransposeBlock().
+*/
+template< typename T >  // Type of the elements
+void simdTransposeRecursive( const T* src, size_t ss, T* dst, size_t ds, size_t m, size_t n )
+{
+   constexpr size_t MS( SIMDTransposeKernel< sizeof(T) >::size );
+
+   if( m*n*sizeof(T) > l1CacheSize/4UL )
+   {
+      if( m >= n && m > MS ) {
+         const size_t m1( nextMultiple( m/2UL, MS ) );
+         simdTransposeRecursive( src, ss, dst, ds, m1, n );
+         simdTransposeRecursive( src+m1*ss, ss, dst+m1, ds, m-m1, n );
+         return;
+      }
+      else if( n > MS ) {
+         const size_t n1( nextMultiple( n/2UL, MS ) );
+         simdTransposeRecursive( src, ss, dst, ds, m, n1 );
+         simdTransposeRecursive( src+n1, ss, dst+n1*ds, ds, m, n-n1 );
+         return;
+      }
+   }
+
+   simdTransposeBlock( src, ss, dst, ds, m, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD transpose kernel for the assignment of a dense matrix with opposite storage order.
+// \ingroup dense_matrix
+//
+// \param lhs The target dense matrix.
+// \param rhs The source dense matrix with opposite storage order.
+// \return \a true in case the SIMD transpose kernel has been applied, \a false if not.
+//
+// This function assigns the given source matrix to the given target matrix of opposite storage
+// order. The matrices are traversed in cache-oblivious order and the elements are transposed in
+// square SIMD micro-tiles (see the SIMDTransposeKernel class template). The kernel is applied
+// to dense matrices and submatrices with direct data access, including transposed matrices,
+// which is why it is used for both the conversion between row-major and column-major storage
+// and the evaluation of \c trans(A). In case of an SMP assignment every thread applies the
+// kernel to its own tiles.
+//
+// The kernel is only applied in case the SIMD transpose kernels are enabled via the
+// \c BLAZE_USE_SIMD_TRANSPOSE_KERNELS switch and both matrices have the same numeric element
+// type of size 4 or 8 bytes. In all other cases the function returns \a false and \a lhs is
+// not modified.
+*/
+template< typename MT1    // Type of the target matrix
+        , typename MT2 >  // Type of the source matrix
+auto simdTranspose( MT1& lhs, const MT2& rhs )
+   -> EnableIf_t< UseSIMDTransposeKernel_v<MT1,MT2>, bool >
+{
+   using ET = RemoveCV_t< ElementType_t<MT1> >;
+
+   constexpr bool SO( IsColumnMajorMatrix_v<MT2> );
+
+   BLAZE_INTERNAL_ASSERT( lhs.rows()    == rhs.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( lhs.columns() == rhs.columns(), "Invalid number of columns" );
+
+   simdTransposeRecursive<ET>( rhs.data(), rhs.spacing(), lhs.data(), lhs.spacing(),
+                               SO ? rhs.columns() : rhs.rows(),
+                               SO ? rhs.rows() : rhs.columns() );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the SIMD transpose kernel.
+// \ingroup dense_matrix
+//
+// \param lhs The target dense matrix.
+// \param rhs The source dense matrix with opposite storage order.
+// \return \a false.
+//
+// This function is selected in case the SIMD transpose kernel cannot be applied for the given
+// matrices. It does not modify \a lhs.
+*/
+template< typename MT1    // Type of the target matrix
+        , typename MT2 >  // Type of the source matrix
+auto simdTranspose( MT1& lhs, const MT2& rhs )
+   -> DisableIf_t< UseSIMDTransposeKernel_v<MT1,MT2>, bool >
+{
+   MAYBE_UNUSED( lhs, rhs );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
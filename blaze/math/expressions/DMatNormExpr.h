@@ -42,8 +42,10 @@
 
 #include <utility>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/ReproducibleReduction.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -63,13 +65,18 @@
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Check.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
@@ -519,6 +526,58 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,true>& dm, Abs abs, Pow
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reproducible backend implementation of the norm of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the norm computation.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param root The functor for the root operation.
+// \return The norm of the given matrix.
+//
+// This function implements the reproducible norm of a dense matrix. The sums of powers of the
+// rows (for row-major matrices) or columns (for column-major matrices) are computed by means of
+// the reproducible dense vector norm and are combined in the order of the rows or columns. This
+// function can only be selected in case reproducible reductions are enabled.
+*/
+template< typename MT      // Type of the dense matrix
+        , bool SO          // Storage order
+        , typename Abs     // Type of the abs operation
+        , typename Power   // Type of the power operation
+        , typename Root >  // Type of the root operation
+inline decltype(auto)
+   norm_backend( const DenseMatrix<MT,SO>& dm, Abs abs, Power power, Root root, ReproducibleTag )
+{
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+   using PT = RemoveCVRef_t< decltype( power( abs( std::declval<ET>() ) ) ) >;
+   using RT = RemoveCVRef_t< decltype( evaluate( root( std::declval<PT>() ) ) ) >;
+
+   if( (*dm).rows() == 0UL || (*dm).columns() == 0UL ) return RT{};
+
+   CT tmp( *dm );
+
+   const size_t M( SO ? tmp.columns() : tmp.rows() );
+
+   const auto partial = [&]( size_t i ) -> PT {
+      return SO ? norm_backend( column( tmp, i, unchecked ), abs, power, Noop(), ReproducibleTag() )
+                : norm_backend( row( tmp, i, unchecked ), abs, power, Noop(), ReproducibleTag() );
+   };
+
+   PT norm( partial( 0UL ) );
+
+   for( size_t i=1UL; i<M; ++i ) {
+      norm += partial( i );
+   }
+
+   return evaluate( root( norm ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Computes a custom norm for the given dense matrix.
@@ -539,6 +598,14 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,true>& dm, Abs abs, Pow
    // ... Resizing and initialization
    const double l2 = norm( A, blaze::Pow2(), blaze::Sqrt() );
    \endcode
+
+// In case the shared memory parallelization is enabled and the total number of elements of the
+// given dense matrix is larger or equal to the BLAZE_SMP_DMATFULLREDUCE_THRESHOLD, the sums of
+// powers of the elements of one block of rows (for row-major matrices) or columns (for
+// column-major matrices) per thread are computed in parallel. The root operation is applied
+// to the combination of these partial sums. In case reproducible reductions are enabled (see
+// BLAZE_USE_REPRODUCIBLE_REDUCTIONS), floating point norms are evaluated in a fixed order, which
+// yields bitwise identical results for any SIMD width and any number of threads.
 */
 template< typename MT      // Type of the dense matrix
         , bool SO          // Storage order
@@ -547,7 +614,31 @@ template< typename MT      // Type of the dense matrix
         , typename Root >  // Type of the root operation
 decltype(auto) norm_backend( const DenseMatrix<MT,SO>& dm, Abs abs, Power power, Root root )
 {
-   return norm_backend( *dm, abs, power, root, Bool_t< DMatNormHelper<MT,Abs,Power>::value >() );
+   using CT  = CompositeType_t<MT>;
+   using ET  = ElementType_t<MT>;
+   using VPT = RemoveCVRef_t< decltype( power( abs( std::declval<ET>() ) ) ) >;
+   using Tag = If_t< ReproducibleReductionHelper<VPT,Add>::value
+                   , ReproducibleTag
+                   , Bool_t< DMatNormHelper<MT,Abs,Power>::value > >;
+   using PT  = RemoveCVRef_t< decltype( norm_backend( *dm, abs, power, Noop(), Tag() ) ) >;
+   using RT  = decltype( norm_backend( *dm, abs, power, root, Tag() ) );
+
+   if( IsSMPAssignable_v<ET> || getNumThreads() == 1UL ||
+       (*dm).rows() * (*dm).columns() < SMP_DMATFULLREDUCE_THRESHOLD ) {
+      return norm_backend( *dm, abs, power, root, Tag() );
+   }
+
+   CT tmp( *dm );
+
+   const size_t M( SO ? tmp.columns() : tmp.rows() );
+
+   const PT norm( smpReduce( M, 1UL, [&]( size_t index, size_t size ) -> PT {
+      return norm_backend( SO ? submatrix( tmp, 0UL, index, tmp.rows(), size, unchecked )
+                              : submatrix( tmp, index, 0UL, size, tmp.columns(), unchecked ),
+                           abs, power, Noop(), Tag() );
+   }, Add() ) );
+
+   return RT( evaluate( root( norm ) ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -49,6 +49,7 @@
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/RowVector.h>
+#include <blaze/math/dense/ReproducibleReduction.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -63,11 +64,14 @@
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/ReduceTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsUniform.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
@@ -1564,7 +1568,9 @@ struct DMatReduceExprHelper
 template< typename MT    // Type of the dense matrix
         , typename OP >  // Type of the reduction operation
 inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
-   -> DisableIf_t< DMatReduceExprHelper<MT,OP>::value, RemoveCV_t< ReduceTrait_t<MT,OP> > >
+   -> DisableIf_t< DMatReduceExprHelper<MT,OP>::value ||
+                   ReproducibleReductionHelper< ElementType_t<MT>, OP >::value
+                 , RemoveCV_t< ReduceTrait_t<MT,OP> > >
 {
    using CT = CompositeType_t<MT>;
    using RT = RemoveCV_t< ReduceTrait_t<MT,OP> >;
@@ -1639,7 +1645,9 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
 template< typename MT    // Type of the dense matrix
         , typename OP >  // Type of the reduction operation
 inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
-   -> EnableIf_t< DMatReduceExprHelper<MT,OP>::value, RemoveCV_t< ElementType_t<MT> > >
+   -> EnableIf_t< DMatReduceExprHelper<MT,OP>::value &&
+                  !ReproducibleReductionHelper< ElementType_t<MT>, OP >::value
+                , RemoveCV_t< ElementType_t<MT> > >
 {
    using CT = CompositeType_t<MT>;
    using ET = RemoveCV_t< ElementType_t<MT> >;
@@ -1820,7 +1828,9 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
 */
 template< typename MT >  // Type of the dense matrix
 inline auto dmatreduce( const DenseMatrix<MT,false>& dm, Add /*op*/ )
-   -> EnableIf_t< DMatReduceExprHelper<MT,Add>::value, RemoveCV_t< ElementType_t<MT> > >
+   -> EnableIf_t< DMatReduceExprHelper<MT,Add>::value &&
+                  !ReproducibleReductionHelper< ElementType_t<MT>, Add >::value
+                , RemoveCV_t< ElementType_t<MT> > >
 {
    using CT = CompositeType_t<MT>;
    using ET = RemoveCV_t< ElementType_t<MT> >;
@@ -1925,6 +1935,52 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, Add /*op*/ )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reproducible backend implementation of the reduction of a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given row-major dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the reproducible reduction operation for a row-major dense matrix.
+// The rows are reduced individually by means of the reproducible dense vector reduction and the
+// partial results are combined in the order of the rows. Due to the explicit application of the
+// SFINAE principle, this function can only be selected by the compiler in case reproducible
+// reductions are enabled.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline auto dmatreduce( const DenseMatrix<MT,false>& dm, OP op )
+   -> EnableIf_t< ReproducibleReductionHelper< ElementType_t<MT>, OP >::value
+                , RemoveCV_t< ReduceTrait_t<MT,OP> > >
+{
+   using CT = CompositeType_t<MT>;
+   using RT = RemoveCV_t< ReduceTrait_t<MT,OP> >;
+
+   const size_t M( (*dm).rows()    );
+   const size_t N( (*dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return RT{};
+
+   CT tmp( *dm );
+
+   BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
+
+   RT redux( reduce( row( tmp, 0UL, unchecked ), op ) );
+
+   for( size_t i=1UL; i<M; ++i ) {
+      redux = op( redux, reduce( row( tmp, i, unchecked ), op ) );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Optimized backend implementation of the minimum evaluation of a uniform dense matrix.
@@ -2015,6 +2071,14 @@ inline RemoveCV_t< ElementType_t<MT> > dmatreduce( const DenseMatrix<MT,true>& d
 // possible to create vectorized custom operations. See \ref custom_operations for a detailed
 // overview of the possibilities of custom operations.
 //
+// In case the shared memory parallelization is enabled and the total number of elements of the
+// given dense matrix is larger or equal to the BLAZE_SMP_DMATFULLREDUCE_THRESHOLD, the matrix is
+// split into one block of rows (for row-major matrices) or columns (for column-major matrices)
+// per thread. The blocks are reduced in parallel and the resulting partial results are combined
+// in the order of the blocks. In case reproducible reductions are enabled (see
+// BLAZE_USE_REPRODUCIBLE_REDUCTIONS), floating point reductions are evaluated in a fixed order,
+// which yields bitwise identical results for any SIMD width and any number of threads.
+//
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
 // operation is undefined if the given reduction operation modifies the values.
@@ -2026,7 +2090,23 @@ inline decltype(auto) reduce( const DenseMatrix<MT,SO>& dm, OP op )
 {
    BLAZE_FUNCTION_TRACE;
 
-   return dmatreduce( *dm, std::move(op) );
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+   using RT = decltype( dmatreduce( *dm, op ) );
+
+   if( IsUniform_v<MT> || IsSMPAssignable_v<ET> || getNumThreads() == 1UL ||
+       (*dm).rows() * (*dm).columns() < SMP_DMATFULLREDUCE_THRESHOLD ) {
+      return dmatreduce( *dm, std::move(op) );
+   }
+
+   CT tmp( *dm );
+
+   const size_t M( SO ? tmp.columns() : tmp.rows() );
+
+   return smpReduce( M, 1UL, [&tmp,&op]( size_t index, size_t size ) -> RT {
+      return dmatreduce( SO ? submatrix( tmp, 0UL, index, tmp.rows(), size, unchecked )
+                            : submatrix( tmp, index, 0UL, size, tmp.columns(), unchecked ), op );
+   }, op );
 }
 //*************************************************************************************************
 
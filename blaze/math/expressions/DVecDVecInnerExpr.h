@@ -41,17 +41,25 @@
 //*************************************************************************************************
 
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/ReproducibleReduction.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/views/Check.h>
 #include <blaze/system/MacroDisable.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
@@ -123,7 +131,9 @@ struct DVecDVecInnerExprHelper
 template< typename VT1    // Type of the left-hand side dense vector
         , typename VT2 >  // Type of the right-hand side dense vector
 inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
-   -> DisableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
+   -> DisableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value ||
+                   ReproducibleReductionHelper< MultTrait_t< ElementType_t<VT1>
+                                                           , ElementType_t<VT2> >, Add >::value
                  , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
 {
    using CT1      = CompositeType_t<VT1>;
@@ -179,7 +189,9 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 template< typename VT1    // Type of the left-hand side dense vector
         , typename VT2 >  // Type of the right-hand side dense vector
 inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
-   -> EnableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
+   -> EnableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value &&
+                  !ReproducibleReductionHelper< MultTrait_t< ElementType_t<VT1>
+                                                           , ElementType_t<VT2> >, Add >::value
                 , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
 {
    using CT1      = CompositeType_t<VT1>;
@@ -234,6 +246,48 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reproducible backend implementation of the scalar product (inner product) of two
+//        dense vectors (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+//
+// This function implements the reproducible scalar product of two dense vectors by means of the
+// reproducible reduction of the componentwise product, whose result is independent of the SIMD
+// width of the target architecture and of the number of threads.
+// Due to the explicit application of the SFINAE principle, this function can only be selected
+// by the compiler in case reproducible reductions are enabled.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+   -> EnableIf_t< ReproducibleReductionHelper< MultTrait_t< ElementType_t<VT1>
+                                                          , ElementType_t<VT2> >, Add >::value
+                , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
+{
+   using CT1      = CompositeType_t<VT1>;
+   using CT2      = CompositeType_t<VT2>;
+   using ET1      = ElementType_t<VT1>;
+   using ET2      = ElementType_t<VT2>;
+   using MultType = MultTrait_t<ET1,ET2>;
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).size() == (*rhs).size(), "Invalid vector sizes" );
+
+   if( (*lhs).size() == 0UL ) return MultType();
+
+   CT1 left ( *lhs );
+   CT2 right( *rhs );
+
+   return dvecreduce( trans( left ) * right, Add() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the scalar product (inner product) of two dense vectors
 //        (\f$ s=\vec{a}*\vec{b} \f$).
@@ -258,7 +312,13 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 // and \a VT2 as well as the two element types \a VT1::ElementType and \a VT2::ElementType
 // have to be supported by the MultTrait class template.\n
 // In case the current sizes of the two given vectors don't match, a \a std::invalid_argument
-// is thrown.
+// is thrown.\n
+// In case the shared memory parallelization is enabled and the size of the two vectors is larger
+// or equal to the BLAZE_SMP_DVECREDUCE_THRESHOLD, the scalar products of one pair of subvectors
+// per thread are computed in parallel and subsequently summed up in the order of the subvectors.
+// In case reproducible reductions are enabled (see BLAZE_USE_REPRODUCIBLE_REDUCTIONS), floating
+// point scalar products are evaluated in a fixed order, which yields bitwise identical results
+// for any SIMD width and any number of threads.
 */
 template< typename VT1    // Type of the left-hand side dense vector
         , typename VT2 >  // Type of the right-hand side dense vector
@@ -267,11 +327,33 @@ inline decltype(auto)
 {
    BLAZE_FUNCTION_TRACE;
 
+   using CT1      = CompositeType_t<VT1>;
+   using CT2      = CompositeType_t<VT2>;
+   using ET1      = ElementType_t<VT1>;
+   using ET2      = ElementType_t<VT2>;
+   using MultType = MultTrait_t<ET1,ET2>;
+
    if( (*lhs).size() != (*rhs).size() ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
 
-   return dvecdvecinner( *lhs, *rhs );
+   if( IsSMPAssignable_v<ET1> || IsSMPAssignable_v<ET2> || getNumThreads() == 1UL ||
+       (*lhs).size() < SMP_DVECREDUCE_THRESHOLD ) {
+      return MultType( dvecdvecinner( *lhs, *rhs ) );
+   }
+
+   CT1 left ( *lhs );
+   CT2 right( *rhs );
+
+   constexpr size_t granularity( ReproducibleReductionHelper<MultType,Add>::value
+                                 ? reproducibleBlockSize
+                                 : SIMDTrait<MultType>::size );
+
+   return smpReduce( left.size(), granularity,
+                     [&left,&right]( size_t index, size_t size ) -> MultType {
+      return dvecdvecinner( subvector( left , index, size, unchecked ),
+                            subvector( right, index, size, unchecked ) );
+   }, Add() );
 }
 //*************************************************************************************************
 
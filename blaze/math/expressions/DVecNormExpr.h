@@ -42,8 +42,10 @@
 
 #include <utility>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/ReproducibleReduction.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Bind2nd.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
@@ -63,13 +65,18 @@
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Check.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
@@ -80,6 +87,8 @@
 #include <blaze/util/TypeList.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveCVRef.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
@@ -282,6 +291,50 @@ inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reproducible backend implementation of the norm of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \param root The functor for the root operation.
+// \return The norm of the given vector.
+//
+// This function implements the reproducible norm of a dense vector, whose result is independent
+// of the SIMD width of the target architecture and of the number of threads. This function can
+// only be selected in case reproducible reductions are enabled.
+*/
+template< typename VT      // Type of the dense vector
+        , bool TF          // Transpose flag
+        , typename Abs     // Type of the abs operation
+        , typename Power   // Type of the power operation
+        , typename Root >  // Type of the root operation
+inline decltype(auto)
+   norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power power, Root root, ReproducibleTag )
+{
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+   using PT = RemoveCVRef_t< decltype( power( abs( std::declval<ET>() ) ) ) >;
+   using RT = RemoveCVRef_t< decltype( evaluate( root( std::declval<PT>() ) ) ) >;
+
+   using Tag = Bool_t< DVecNormHelper<VT,Abs,Power>::value &&
+                       IsFloatingPoint_v<PT> && IsSame_v<PT,ET> >;
+
+   if( (*dv).size() == 0UL ) return RT{};
+
+   CT tmp( *dv );
+
+   const PT norm( reproducibleReduce<PT>( tmp, [&]( const auto& a ) { return power( abs( a ) ); }
+                                        , Add(), Tag() ) );
+
+   return evaluate( root( norm ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Computes a custom norm for the given dense vector.
@@ -302,6 +355,13 @@ inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power
    // ... Resizing and initialization
    const double l2 = norm( a, blaze::Noop(), blaze::Pow2(), blaze::Sqrt() );
    \endcode
+
+// In case the shared memory parallelization is enabled and the size of the given dense vector
+// is larger or equal to the BLAZE_SMP_DVECREDUCE_THRESHOLD, the sums of powers of the elements
+// of one subvector per thread are computed in parallel. The root operation is applied to the
+// combination of these partial sums. In case reproducible reductions are enabled (see
+// BLAZE_USE_REPRODUCIBLE_REDUCTIONS), floating point norms are evaluated in a fixed order, which
+// yields bitwise identical results for any SIMD width and any number of threads.
 */
 template< typename VT      // Type of the dense vector
         , bool TF          // Transpose flag
@@ -310,7 +370,32 @@ template< typename VT      // Type of the dense vector
         , typename Root >  // Type of the root operation
 inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power power, Root root )
 {
-   return norm_backend( *dv, abs, power, root, Bool_t< DVecNormHelper<VT,Abs,Power>::value >() );
+   using CT  = CompositeType_t<VT>;
+   using ET  = ElementType_t<VT>;
+   using VPT = RemoveCVRef_t< decltype( power( abs( std::declval<ET>() ) ) ) >;
+   using Tag = If_t< ReproducibleReductionHelper<VPT,Add>::value
+                   , ReproducibleTag
+                   , Bool_t< DVecNormHelper<VT,Abs,Power>::value > >;
+   using PT  = RemoveCVRef_t< decltype( norm_backend( *dv, abs, power, Noop(), Tag() ) ) >;
+   using RT  = decltype( norm_backend( *dv, abs, power, root, Tag() ) );
+
+   constexpr size_t granularity( IsSame_v<Tag,ReproducibleTag>
+                                 ? reproducibleBlockSize
+                                 : SIMDTrait<ET>::size );
+
+   if( IsSMPAssignable_v<ET> || getNumThreads() == 1UL ||
+       (*dv).size() < SMP_DVECREDUCE_THRESHOLD ) {
+      return norm_backend( *dv, abs, power, root, Tag() );
+   }
+
+   CT tmp( *dv );
+
+   const PT norm( smpReduce( tmp.size(), granularity,
+                             [&]( size_t index, size_t size ) -> PT {
+      return norm_backend( subvector( tmp, index, size, unchecked ), abs, power, Noop(), Tag() );
+   }, Add() ) );
+
+   return RT( evaluate( root( norm ) ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -40,23 +40,34 @@
 // Includes
 //*************************************************************************************************
 
+#include <utility>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/ReproducibleReduction.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Max.h>
 #include <blaze/math/functors/Min.h>
 #include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/Noop.h>
 #include <blaze/math/shims/PrevMultiple.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsUniform.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveCV.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
@@ -121,7 +132,9 @@ template< typename VT    // Type of the dense vector
         , bool TF        // Transpose flag
         , typename OP >  // Type of the reduction operation
 inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
-   -> DisableIf_t< DVecReduceExprHelper<VT,OP>::value, RemoveCV_t< ReduceTrait_t<VT,OP> > >
+   -> DisableIf_t< DVecReduceExprHelper<VT,OP>::value ||
+                   ReproducibleReductionHelper< ElementType_t<VT>, OP >::value
+                 , RemoveCV_t< ReduceTrait_t<VT,OP> > >
 {
    using CT = CompositeType_t<VT>;
    using RT = RemoveCV_t< ReduceTrait_t<VT,OP> >;
@@ -174,7 +187,9 @@ template< typename VT    // Type of the dense vector
         , bool TF        // Transpose flag
         , typename OP >  // Type of the reduction operation
 inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
-   -> EnableIf_t< DVecReduceExprHelper<VT,OP>::value, RemoveCV_t< ElementType_t<VT> > >
+   -> EnableIf_t< DVecReduceExprHelper<VT,OP>::value &&
+                  !ReproducibleReductionHelper< ElementType_t<VT>, OP >::value
+                , RemoveCV_t< ElementType_t<VT> > >
 {
    using CT = CompositeType_t<VT>;
    using ET = RemoveCV_t< ElementType_t<VT> >;
@@ -248,7 +263,9 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
 template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
 inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
-   -> EnableIf_t< DVecReduceExprHelper<VT,Add>::value, RemoveCV_t< ElementType_t<VT> > >
+   -> EnableIf_t< DVecReduceExprHelper<VT,Add>::value &&
+                  !ReproducibleReductionHelper< ElementType_t<VT>, Add >::value
+                , RemoveCV_t< ElementType_t<VT> > >
 {
    using CT = CompositeType_t<VT>;
    using ET = RemoveCV_t< ElementType_t<VT> >;
@@ -325,6 +342,48 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reproducible backend implementation of the reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the reproducible reduction operation for a dense vector, whose
+// result is independent of the SIMD width of the target architecture and of the number of
+// threads. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case reproducible reductions are enabled.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+   -> EnableIf_t< ReproducibleReductionHelper< ElementType_t<VT>, OP >::value
+                , RemoveCV_t< ReduceTrait_t<VT,OP> > >
+{
+   using CT = CompositeType_t<VT>;
+   using ET = RemoveCV_t< ElementType_t<VT> >;
+   using RT = RemoveCV_t< ReduceTrait_t<VT,OP> >;
+
+   using Tag = Bool_t< DVecReduceExprHelper<VT,OP>::value &&
+                       IsFloatingPoint_v<ET> && IsSame_v<RT,ET> >;
+
+   const size_t N( (*dv).size() );
+
+   if( N == 0UL ) return RT{};
+
+   CT tmp( *dv );
+
+   BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
+
+   return reproducibleReduce<RT>( tmp, Noop(), std::move(op), Tag() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Optimized backend implementation of the minimum evaluation of a uniform dense vector.
@@ -394,6 +453,13 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Max /*op*/ )
 // possible to create vectorized custom operations. See \ref custom_operations for a detailed
 // overview of the possibilities of custom operations.
 //
+// In case the shared memory parallelization is enabled and the size of the given dense vector
+// is larger or equal to the BLAZE_SMP_DVECREDUCE_THRESHOLD, the vector is split into one
+// subvector per thread. The subvectors are reduced in parallel and the resulting partial results
+// are combined in the order of the subvectors. In case reproducible reductions are enabled (see
+// BLAZE_USE_REPRODUCIBLE_REDUCTIONS), floating point reductions are evaluated in a fixed order,
+// which yields bitwise identical results for any SIMD width and any number of threads.
+//
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
 // operation is undefined if the given reduction operation modifies the values.
@@ -405,7 +471,25 @@ inline decltype(auto) reduce( const DenseVector<VT,TF>& dv, OP op )
 {
    BLAZE_FUNCTION_TRACE;
 
-   return dvecreduce( *dv, std::move(op) );
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+   using RT = decltype( dvecreduce( *dv, op ) );
+
+   if( IsUniform_v<VT> || IsSMPAssignable_v<ET> || getNumThreads() == 1UL ||
+       (*dv).size() < SMP_DVECREDUCE_THRESHOLD ) {
+      return dvecreduce( *dv, std::move(op) );
+   }
+
+   CT tmp( *dv );
+
+   constexpr size_t granularity( ReproducibleReductionHelper<ET,OP>::value
+                                 ? reproducibleBlockSize
+                                 : SIMDTrait<ET>::size );
+
+   return smpReduce( tmp.size(), granularity,
+                     [&tmp,&op]( size_t index, size_t size ) -> RT {
+      return dvecreduce( subvector( tmp, index, size, unchecked ), op );
+   }, op );
 }
 //*************************************************************************************************
 
@@ -181,6 +181,7 @@ template< typename > struct NoSIMDExpr;
 template< typename > struct ReduceExpr;
 template< typename > struct RepeatExpr;
 template< typename > struct SchurExpr;
+template< typename, typename > class SEllMatDVecMultExpr;
 template< typename > struct SerialExpr;
 template< typename, bool > class SMatDeclDiagExpr;
 template< typename, bool > class SMatDeclHermExpr;
@@ -0,0 +1,976 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/SEllMatDVecMultExpr.h
+//  \brief Header file for the SELL-C-sigma sparse matrix/dense vector multiplication expression
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_SELLMATDVECMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_SELLMATDVECMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/ColumnVector.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/MatVecMultExpr.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatVecMultExpr.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/sparse/SlicedEllMatrix.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SELLMATDVECMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for SELL-C-sigma sparse matrix-dense vector multiplications.
+// \ingroup dense_vector_expression
+//
+// The SEllMatDVecMultExpr class represents the compile time expression for multiplications
+// between a SlicedEllMatrix and a dense vector. In contrast to the general SMatDVecMultExpr,
+// the multiplication is always evaluated via the slice-wise kernels, which process all rows of
+// a slice at once by means of SIMD loads of the matrix values and SIMD gathers of the vector
+// elements. For the SMP evaluation the rows are split at the boundaries of the sorting windows
+// such that all threads are assigned approximately the same number of stored elements.
+*/
+template< typename MT    // Type of the left-hand side SELL-C-sigma matrix
+        , typename VT >  // Type of the right-hand side dense vector
+class SEllMatDVecMultExpr
+   : public MatVecMultExpr< DenseVector< SEllMatDVecMultExpr<MT,VT>, false > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using MRT = ResultType_t<MT>;     //!< Result type of the left-hand side sparse matrix.
+   using VRT = ResultType_t<VT>;     //!< Result type of the right-hand side dense vector expression.
+   using MET = ElementType_t<MT>;    //!< Element type of the left-hand side sparse matrix.
+   using VCT = CompositeType_t<VT>;  //!< Composite type of the right-hand side dense vector expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the right-hand side dense vector expression.
+   /*! The kernels require direct access to the elements of the vector operand. Therefore the
+       vector is evaluated in case it is a computation or doesn't provide low-level data access. */
+   static constexpr bool evaluateVector =
+      ( IsComputation_v<VT> || RequiresEvaluation_v<VT> || !HasConstDataAccess_v<VT> );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the parallel evaluation strategy.
+       In case the vector operand requires an intermediate evaluation, the variable will be set
+       to 1, otherwise it will be 0. */
+   template< typename T1 >
+   static constexpr bool UseSMPAssign_v = evaluateVector;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the selection of the vectorized kernel.
+   /*! In case the element types of the matrix and the vector are identical 'float' or 'double'
+       types that support SIMD additions and multiplications, the variable will be set to 1,
+       otherwise it will be 0. */
+   template< typename T1 >
+   static constexpr bool UseVectorizedKernel_v =
+      ( useOptimizedKernels &&
+        IsSame_v< MET, ElementType_t<T1> > &&
+        ( IsFloat_v<MET> || IsDouble_v<MET> ) &&
+        HasSIMDAdd_v<MET,MET> &&
+        HasSIMDMult_v<MET,MET> );
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   //! Type of this SEllMatDVecMultExpr instance.
+   using This = SEllMatDVecMultExpr<MT,VT>;
+
+   //! Base type of this SEllMatDVecMultExpr instance.
+   using BaseType = MatVecMultExpr< DenseVector<This,false> >;
+
+   using ResultType    = MultTrait_t<MRT,VRT>;         //!< Result type for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_t<ResultType>;    //!< Resulting element type.
+   using ReturnType    = const ElementType;            //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;             //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side sparse matrix.
+   using LeftOperand = const MT&;
+
+   //! Composite type of the right-hand side dense vector expression.
+   using RightOperand = If_t< IsExpression_v<VT>, const VT, const VT& >;
+
+   //! Type for the assignment of the right-hand side dense vector operand.
+   using RT = If_t< evaluateVector, const VRT, VCT >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable =
+      ( MT::smpAssignable && !evaluateVector && VT::smpAssignable );
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SEllMatDVecMultExpr class.
+   //
+   // \param mat The left-hand side sparse matrix operand of the multiplication expression.
+   // \param vec The right-hand side dense vector operand of the multiplication expression.
+   */
+   inline SEllMatDVecMultExpr( const MT& mat, const VT& vec ) noexcept
+      : mat_( mat )         // Left-hand side sparse matrix of the multiplication expression
+      , vec_( vec )         // Right-hand side dense vector of the multiplication expression
+      , row_( 0UL )         // The first row of the multiplication expression
+      , m_  ( mat.rows() )  // The number of rows of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( mat_.columns() == vec_.size(), "Invalid matrix and vector sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for a row range of the multiplication.
+   //
+   // \param mat The left-hand side sparse matrix operand of the multiplication expression.
+   // \param vec The right-hand side dense vector operand of the multiplication expression.
+   // \param row The first row of the row range.
+   // \param m The number of rows of the row range.
+   //
+   // The boundaries of the row range must coincide with the boundaries of the sorting windows
+   // of the matrix (see the SlicedEllMatrix::partition() function).
+   */
+   inline SEllMatDVecMultExpr( const MT& mat, const VT& vec, size_t row, size_t m ) noexcept
+      : mat_( mat )  // Left-hand side sparse matrix of the multiplication expression
+      , vec_( vec )  // Right-hand side dense vector of the multiplication expression
+      , row_( row )  // The first row of the multiplication expression
+      , m_  ( m   )  // The number of rows of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( mat_.columns() == vec_.size(), "Invalid matrix and vector sizes" );
+      BLAZE_INTERNAL_ASSERT( row_ + m_ <= mat_.rows(), "Invalid row range" );
+      BLAZE_INTERNAL_ASSERT( row_ % mat_.sigma() == 0UL, "Unaligned row range" );
+      BLAZE_INTERNAL_ASSERT( row_ + m_ == mat_.rows() || m_ % mat_.sigma() == 0UL,
+                             "Unaligned row range" );
+   }
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < m_, "Invalid vector access index" );
+
+      const size_t i( row_ + index );
+
+      ElementType res{};
+      for( auto element=mat_.begin(i); element!=mat_.end(i); ++element ) {
+         res += element->value() * vec_[element->index()];
+      }
+      return res;
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid vector access index.
+   */
+   inline ReturnType at( size_t index ) const {
+      if( index >= m_ ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+      }
+      return (*this)[index];
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const noexcept {
+      return m_;
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side sparse matrix operand.
+   //
+   // \return The left-hand side sparse matrix operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return mat_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side dense vector operand.
+   //
+   // \return The right-hand side dense vector operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return vec_;
+   }
+   //**********************************************************************************************
+
+   //**Block function******************************************************************************
+   /*!\brief Returns the multiplication expression for a range of rows.
+   //
+   // \param row The first row of the range (relative to this expression).
+   // \param m The number of rows of the range.
+   // \return The multiplication expression restricted to the given rows.
+   //
+   // The boundaries of the row range must coincide with the boundaries of the sorting windows
+   // of the matrix, as for instance computed by the SlicedEllMatrix::partition() function.
+   */
+   inline SEllMatDVecMultExpr block( size_t row, size_t m ) const noexcept {
+      return SEllMatDVecMultExpr( mat_, vec_, row_+row, m );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( mat_.isAliased( alias ) || vec_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( mat_.isAliased( alias ) || vec_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return vec_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return ( size() > SMP_SMATDVECMULT_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  mat_;  //!< Left-hand side sparse matrix of the multiplication expression.
+   RightOperand vec_;  //!< Right-hand side dense vector of the multiplication expression.
+   size_t       row_;  //!< The first row of the multiplication expression.
+   size_t       m_;    //!< The number of rows of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Default kernel******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default kernel for the SELL-C-sigma sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param row The first row of the row range.
+   // \param m The number of rows of the row range.
+   // \param op The (compound) assignment of a single element.
+   // \return void
+   //
+   // This function implements the default kernel for the multiplication of a row range of a
+   // SlicedEllMatrix with a dense vector. The element \a i of the row range is stored in the
+   // element \a i - \a row of the target vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the element-wise assignment operation
+   static inline auto selectAssignKernel( VT1& y, const MT& A, const VT2& x,
+                                          size_t row, size_t m, OP op )
+      -> DisableIf_t< UseVectorizedKernel_v<VT2> >
+   {
+      constexpr size_t SIMDSIZE( SIMDTrait<MET>::size );
+
+      const size_t sbegin( row / SIMDSIZE );
+      const size_t send  ( ( row + m + SIMDSIZE - 1UL ) / SIMDSIZE );
+
+      for( size_t s=sbegin; s<send; ++s )
+      {
+         const MET*    const v  ( A.values_.data()  + A.start_[s] );
+         const size_t* const idx( A.indices_.data() + A.start_[s] );
+
+         for( size_t r=0UL; r<SIMDSIZE; ++r )
+         {
+            const size_t p( s*SIMDSIZE + r );
+            const size_t i( A.perm_[p] );
+
+            if( i >= A.rows() )
+               break;
+
+            ElementType tmp{};
+            for( size_t k=0UL; k<A.length_[p]; ++k ) {
+               tmp += v[k*SIMDSIZE+r] * x[idx[k*SIMDSIZE+r]];
+            }
+            op( y[i-row], tmp );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized kernel***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized kernel for the SELL-C-sigma sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param row The first row of the row range.
+   // \param m The number of rows of the row range.
+   // \param op The (compound) assignment of a single element.
+   // \return void
+   //
+   // This function implements the vectorized kernel for the multiplication of a row range of
+   // a SlicedEllMatrix with a dense vector. All rows of a slice are processed at once up to the
+   // length of the shortest row of the slice by means of SIMD loads of the matrix values and
+   // SIMD gathers of the vector elements. The remaining elements of the longer rows, which are
+   // stored as padded elements in the SIMD-wide columns of the slice, are added element-wise.
+   // Therefore the padding does not affect the result, even in case the vector contains
+   // non-finite values.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the element-wise assignment operation
+   static inline auto selectAssignKernel( VT1& y, const MT& A, const VT2& x,
+                                          size_t row, size_t m, OP op )
+      -> EnableIf_t< UseVectorizedKernel_v<VT2> >
+   {
+      constexpr size_t SIMDSIZE( SIMDTrait<MET>::size );
+
+      const size_t sbegin( row / SIMDSIZE );
+      const size_t send  ( ( row + m + SIMDSIZE - 1UL ) / SIMDSIZE );
+
+      const MET* const data( x.data() );
+
+      AlignedArray<MET,SIMDSIZE> tmp;
+
+      for( size_t s=sbegin; s<send; ++s )
+      {
+         const MET*    const v  ( A.values_.data()  + A.start_[s] );
+         const size_t* const idx( A.indices_.data() + A.start_[s] );
+
+         const size_t p   ( s*SIMDSIZE );
+         const size_t kmin( A.length_[p+SIMDSIZE-1UL] );
+
+         SIMDTrait_t<MET> xmm1, xmm2;
+         size_t k( 0UL );
+
+         for( ; (k+2UL) <= kmin; k+=2UL ) {
+            xmm1 += loada( v+k*SIMDSIZE ) * gather( data, idx+k*SIMDSIZE );
+            xmm2 += loada( v+(k+1UL)*SIMDSIZE ) * gather( data, idx+(k+1UL)*SIMDSIZE );
+         }
+
+         if( k < kmin ) {
+            xmm1 += loada( v+k*SIMDSIZE ) * gather( data, idx+k*SIMDSIZE );
+         }
+
+         storea( tmp.data(), xmm1 + xmm2 );
+
+         for( size_t r=0UL; r<SIMDSIZE; ++r )
+         {
+            const size_t i( A.perm_[p+r] );
+
+            if( i >= A.rows() )
+               break;
+
+            for( size_t l=kmin; l<A.length_[p+r]; ++l ) {
+               tmp[r] += v[l*SIMDSIZE+r] * data[idx[l*SIMDSIZE+r]];
+            }
+            op( y[i-row], tmp[r] );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a SELL-C-sigma sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a SELL-C-sigma sparse
+   // matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void assign( DenseVector<VT1,false>& lhs, const SEllMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      selectAssignKernel( *lhs, rhs.mat_, x, rhs.row_, rhs.m_,
+                          []( auto& a, const auto& b ){ a = b; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a SELL-C-sigma sparse matrix-dense vector multiplication to a sparse
+   //        vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a SELL-C-sigma sparse
+   // matrix-dense vector multiplication expression to a sparse vector.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline void assign( SparseVector<VT1,false>& lhs, const SEllMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a SELL-C-sigma sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a SELL-C-sigma
+   // sparse matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void addAssign( DenseVector<VT1,false>& lhs, const SEllMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      selectAssignKernel( *lhs, rhs.mat_, x, rhs.row_, rhs.m_,
+                          []( auto& a, const auto& b ){ a += b; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a SELL-C-sigma sparse matrix-dense vector multiplication to
+   //        a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a SELL-C-sigma
+   // sparse matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void subAssign( DenseVector<VT1,false>& lhs, const SEllMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      RT x( serial( rhs.vec_ ) );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      selectAssignKernel( *lhs, rhs.mat_, x, rhs.row_, rhs.m_,
+                          []( auto& a, const auto& b ){ a -= b; } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse vectors****************************************************
+   // No special implementation for the subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a SELL-C-sigma sparse matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}*=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a
+   // SELL-C-sigma sparse matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void multAssign( DenseVector<VT1,false>& lhs, const SEllMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse vectors*************************************************
+   // No special implementation for the multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Division assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Division assignment of a SELL-C-sigma sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}/=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized division assignment of a SELL-C-sigma
+   // sparse matrix-dense vector multiplication expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void divAssign( DenseVector<VT1,false>& lhs, const SEllMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      divAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Division assignment to sparse vectors*******************************************************
+   // No special implementation for the division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a SELL-C-sigma sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a SELL-C-sigma sparse
+   // matrix-dense vector multiplication expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the right-hand side vector operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpAssign( DenseVector<VT1,false>& lhs, const SEllMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const VRT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      smpAssign( *lhs, SEllMatDVecMultExpr<MT,VRT>( rhs.mat_, x, rhs.row_, rhs.m_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse vectors************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a SELL-C-sigma sparse matrix-dense vector multiplication to a sparse
+   //        vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a SELL-C-sigma sparse
+   // matrix-dense vector multiplication expression to a sparse vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the right-hand side vector operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline auto smpAssign( SparseVector<VT1,false>& lhs, const SEllMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a SELL-C-sigma sparse matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a
+   // SELL-C-sigma sparse matrix-dense vector multiplication expression to a dense vector. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected
+   // by the compiler in case the right-hand side vector operand requires an intermediate
+   // evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpAddAssign( DenseVector<VT1,false>& lhs, const SEllMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const VRT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      smpAddAssign( *lhs, SEllMatDVecMultExpr<MT,VRT>( rhs.mat_, x, rhs.row_, rhs.m_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse vectors***************************************************
+   // No special implementation for the SMP addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a SELL-C-sigma sparse matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a
+   // SELL-C-sigma sparse matrix-dense vector multiplication expression to a dense vector. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected
+   // by the compiler in case the right-hand side vector operand requires an intermediate
+   // evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpSubAssign( DenseVector<VT1,false>& lhs, const SEllMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const VRT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( x.size() == rhs.vec_.size(), "Invalid vector size" );
+
+      smpSubAssign( *lhs, SEllMatDVecMultExpr<MT,VRT>( rhs.mat_, x, rhs.row_, rhs.m_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse vectors************************************************
+   // No special implementation for the SMP subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP multiplication assignment of a SELL-C-sigma sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}*=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP multiplication assignment of a
+   // SELL-C-sigma sparse matrix-dense vector multiplication expression to a dense vector. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected
+   // by the compiler in case the right-hand side vector operand requires an intermediate
+   // evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpMultAssign( DenseVector<VT1,false>& lhs, const SEllMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpMultAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse vectors*********************************************
+   // No special implementation for the SMP multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP division assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP division assignment of a SELL-C-sigma sparse matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}/=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized SMP division assignment of a
+   // SELL-C-sigma sparse matrix-dense vector multiplication expression to a dense vector. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected
+   // by the compiler in case the right-hand side vector operand requires an intermediate
+   // evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpDivAssign( DenseVector<VT1,false>& lhs, const SEllMatDVecMultExpr& rhs )
+      -> EnableIf_t< UseSMPAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpDivAssign( *lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP division assignment to sparse vectors***************************************************
+   // No special implementation for the SMP division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_FORM_VALID_MATVECMULTEXPR( MT, VT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a SlicedEllMatrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup dense_vector
+//
+// \param mat The left-hand side SELL-C-sigma sparse matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator represents the multiplication between a SlicedEllMatrix and a dense vector:
+
+   \code
+   using blaze::columnVector;
+
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double,columnVector> x, y;
+   // ... Resizing and initialization
+   blaze::SlicedEllMatrix<double> B( A );
+   y = B * x;
+   \endcode
+
+// The operator returns an expression representing a dense vector of the higher-order element
+// type of the two involved element types. In case the current size of the vector \a vec doesn't
+// match the current number of columns of the matrix \a mat, a \a std::invalid_argument is thrown.
+*/
+template< typename Type   // Data type of the left-hand side sparse matrix
+        , typename Tag    // Type tag of the left-hand side sparse matrix
+        , typename VT >   // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const SlicedEllMatrix<Type,Tag>& mat, const DenseVector<VT,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( mat.columns() != (*vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   using ReturnType = const SEllMatDVecMultExpr< SlicedEllMatrix<Type,Tag>, VT >;
+   return ReturnType( mat, *vec );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename VT >
+struct IsAligned< SEllMatDVecMultExpr<MT,VT> >
+   : public IsAligned<VT>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
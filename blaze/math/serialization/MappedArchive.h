@@ -0,0 +1,765 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MappedArchive.h
+//  \brief Memory-mapped archives for the zero-copy reconstitution of vectors and matrices
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MAPPEDARCHIVE_H_
+#define _BLAZE_MATH_SERIALIZATION_MAPPEDARCHIVE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/shims/NextMultiple.h>
+#include <blaze/math/sparse/CustomCompressedMatrix.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/serialization/Archive.h>
+#include <blaze/util/serialization/MappedFile.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Archive for the zero-copy reconstitution of vectors and matrices from a mapped file.
+// \ingroup math_serialization
+//
+// The MappedArchive class maps a file written by the serializeMapped() functions into memory
+// and binds custom vectors and matrices directly to the mapped data. In contrast to the regular
+// (de-)serialization via the Archive class, no element is copied or converted, i.e. opening
+// and binding is a constant time operation independent of the size of the data. Since the file
+// is mapped read-only and shared, the pages are loaded lazily on first access and are shared
+// between all processes that map the same file:
+
+   \code
+   using blaze::aligned;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+
+   // Serialization of a dense matrix, a dense vector and a sparse matrix
+   {
+      blaze::DynamicMatrix<double,rowMajor> A;
+      blaze::DynamicVector<double> x;
+      blaze::CompressedMatrix<double,rowMajor> S;
+
+      // ... Resizing and initialization
+
+      blaze::Archive<std::ofstream> archive( "data.blaze", std::ofstream::trunc );
+      serializeMapped( archive, A );
+      serializeMapped( archive, x );
+      blaze::serializeMapped<uint32_t>( archive, S );  // Sparse indices stored as 32-bit integers
+   }
+
+   // Zero-copy reconstitution
+   {
+      blaze::MappedArchive archive( "data.blaze" );
+
+      blaze::CustomMatrix<const double,aligned,unpadded,rowMajor> A;
+      blaze::CustomVector<const double,aligned,unpadded> x;
+      blaze::CustomCompressedMatrix<double,rowMajor,blaze::Group0,uint32_t> S;
+
+      archive >> A >> x >> S;
+
+      blaze::DynamicVector<double> y( S * x );
+   }
+   \endcode
+
+// Each record consists of a 64-byte header followed by the element data. Every section of a
+// record starts at a multiple of 64 bytes relative to the beginning of the file and dense rows
+// or columns are padded with zeros to a multiple of 64 bytes. Thus the mapped data satisfies
+// the alignment requirements of aligned custom vectors and matrices, provided that the file
+// exclusively consists of records written by serializeMapped(). The data is stored in the
+// native byte order of the writing platform.
+//
+// Records have to be bound to unpadded custom vectors and matrices in the same order as they
+// were written and with the same element type, index type and storage order. Otherwise a
+// \a std::runtime_error exception is thrown. Note that the bound vectors and matrices refer to
+// the mapped memory and therefore must not be used after the MappedArchive has been destroyed.
+*/
+class MappedArchive
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedArchive( const std::string& filename );
+
+   MappedArchive( const MappedArchive& ) = delete;
+   MappedArchive( MappedArchive&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~MappedArchive() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   MappedArchive& operator=( const MappedArchive& ) = delete;
+   MappedArchive& operator=( MappedArchive&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Deserialization operators*******************************************************************
+   /*!\name Deserialization operators */
+   //@{
+   template< typename Type, AlignmentFlag AF, bool TF, typename Tag, typename RT >
+   MappedArchive& operator>>( CustomVector<const Type,AF,unpadded,TF,Tag,RT>& vec );
+
+   template< typename Type, AlignmentFlag AF, bool SO, typename Tag, typename RT >
+   MappedArchive& operator>>( CustomMatrix<const Type,AF,unpadded,SO,Tag,RT>& mat );
+
+   template< typename Type, bool SO, typename Tag, typename IT >
+   MappedArchive& operator>>( CustomCompressedMatrix<Type,SO,Tag,IT>& mat );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool   eof () const noexcept;
+   inline size_t size() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Record layout*******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   static constexpr size_t  alignment = 64UL;  //!< Alignment of all sections of a record.
+   static constexpr uint8_t version   = 1U;    //!< The current version of the record layout.
+
+   //! Meta information of a single record.
+   struct Header {
+      uint8_t  type;         //!< The type of the vector/matrix (see MatrixSerializer).
+      uint8_t  elementType;  //!< The type of an element.
+      uint8_t  elementSize;  //!< The size in bytes of a single element.
+      uint8_t  indexSize;    //!< The size in bytes of a single sparse index.
+      uint64_t rows;         //!< The number of rows (or the size of a vector).
+      uint64_t columns;      //!< The number of columns (1 for vectors).
+      uint64_t spacing;      //!< The number of elements between two dense rows/columns.
+      uint64_t nonZeros;     //!< The number of non-zero elements of a sparse matrix.
+      uint64_t payload;      //!< The total number of bytes following the header.
+   };
+
+   static inline void writeHeader( char* buffer, const Header& header ) noexcept;
+   static inline bool readHeader ( const char* buffer, Header& header ) noexcept;
+   /*! \endcond */
+   //**********************************************************************************************
+
+ private:
+   //**Deserialization functions*******************************************************************
+   /*!\name Deserialization functions */
+   //@{
+   template< typename Type > Header nextHeader( uint8_t type, size_t indexSize );
+   template< typename Type > const Type* nextSection( size_t count );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile file_;  //!< The mapped file.
+   size_t     pos_;   //!< The current read position within the mapped file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a memory-mapped archive for the given file.
+//
+// \param filename The name of the file to be mapped.
+// \exception std::runtime_error File could not be opened or mapped.
+*/
+inline MappedArchive::MappedArchive( const std::string& filename )
+   : file_( filename )  // The mapped file
+   , pos_ ( 0UL )       // The current read position within the mapped file
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESERIALIZATION OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Binds the given custom vector to the next record of the archive.
+//
+// \param vec The custom vector to be bound.
+// \return Reference to the archive.
+// \exception std::runtime_error Invalid or mismatching record.
+// \exception std::invalid_argument Record does not meet the alignment requirements.
+*/
+template< typename Type     // Data type of the vector
+        , AlignmentFlag AF  // Alignment flag
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+MappedArchive& MappedArchive::operator>>( CustomVector<const Type,AF,unpadded,TF,Tag,RT>& vec )
+{
+   const Header header( nextHeader<Type>( 0x00, 0UL ) );
+   const Type* const values( nextSection<Type>( header.spacing ) );
+
+   vec.reset( values, header.rows );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binds the given custom matrix to the next record of the archive.
+//
+// \param mat The custom matrix to be bound.
+// \return Reference to the archive.
+// \exception std::runtime_error Invalid or mismatching record.
+// \exception std::invalid_argument Record does not meet the alignment requirements.
+*/
+template< typename Type     // Data type of the matrix
+        , AlignmentFlag AF  // Alignment flag
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename RT >     // Result type
+MappedArchive& MappedArchive::operator>>( CustomMatrix<const Type,AF,unpadded,SO,Tag,RT>& mat )
+{
+   const Header header( nextHeader<Type>( SO ? 0x05 : 0x01, 0UL ) );
+   const size_t outer( SO ? header.columns : header.rows );
+   const Type* const values( nextSection<Type>( outer*header.spacing ) );
+
+   mat.reset( values, header.rows, header.columns, header.spacing );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binds the given custom compressed matrix to the next record of the archive.
+//
+// \param mat The custom compressed matrix to be bound.
+// \return Reference to the archive.
+// \exception std::runtime_error Invalid or mismatching record.
+//
+// Note that in order to keep the binding a constant time operation, only the total number of
+// non-zero elements is validated. The isIntact() function can be used to check the complete
+// sparsity pattern of untrusted files.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+MappedArchive& MappedArchive::operator>>( CustomCompressedMatrix<Type,SO,Tag,IT>& mat )
+{
+   if( sizeof( size_t ) != sizeof( uint64_t ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse records require a 64-bit platform" );
+   }
+
+   const Header header( nextHeader<Type>( SO ? 0x07 : 0x03, sizeof( IT ) ) );
+   const size_t outer( SO ? header.columns : header.rows );
+
+   const size_t* const offsets( reinterpret_cast<const size_t*>( nextSection<uint64_t>( outer+1UL ) ) );
+   const IT*     const indices( nextSection<IT>( header.nonZeros ) );
+   const Type*   const values ( nextSection<Type>( header.nonZeros ) );
+
+   if( offsets[0UL] != 0UL || offsets[outer] != header.nonZeros ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid sparse matrix record" );
+   }
+
+   mat.reset( values, indices, offsets, header.rows, header.columns );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether all records of the archive have been read.
+//
+// \return \a true in case the end of the archive has been reached, \a false if not.
+*/
+inline bool MappedArchive::eof() const noexcept
+{
+   return pos_ >= file_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total size of the mapped file.
+//
+// \return The size of the mapped file in bytes.
+*/
+inline size_t MappedArchive::size() const noexcept
+{
+   return file_.size();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RECORD LAYOUT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the given record header into the given 64-byte buffer.
+//
+// \param buffer The zero-initialized target buffer.
+// \param header The header to be written.
+// \return void
+*/
+inline void MappedArchive::writeHeader( char* buffer, const Header& header ) noexcept
+{
+   std::memcpy( buffer, "BLZM", 4UL );
+   buffer[4] = static_cast<char>( version );
+   std::memcpy( buffer+ 5UL, &header.type       , 1UL );
+   std::memcpy( buffer+ 6UL, &header.elementType, 1UL );
+   std::memcpy( buffer+ 7UL, &header.elementSize, 1UL );
+   std::memcpy( buffer+ 8UL, &header.indexSize  , 1UL );
+   std::memcpy( buffer+16UL, &header.rows       , 8UL );
+   std::memcpy( buffer+24UL, &header.columns    , 8UL );
+   std::memcpy( buffer+32UL, &header.spacing    , 8UL );
+   std::memcpy( buffer+40UL, &header.nonZeros   , 8UL );
+   std::memcpy( buffer+48UL, &header.payload    , 8UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads a record header from the given 64-byte buffer.
+//
+// \param buffer The source buffer.
+// \param header The header to be read.
+// \return \a true in case a valid header has been read, \a false if not.
+*/
+inline bool MappedArchive::readHeader( const char* buffer, Header& header ) noexcept
+{
+   if( std::memcmp( buffer, "BLZM", 4UL ) != 0 || buffer[4] != static_cast<char>( version ) )
+      return false;
+
+   std::memcpy( &header.type       , buffer+ 5UL, 1UL );
+   std::memcpy( &header.elementType, buffer+ 6UL, 1UL );
+   std::memcpy( &header.elementSize, buffer+ 7UL, 1UL );
+   std::memcpy( &header.indexSize  , buffer+ 8UL, 1UL );
+   std::memcpy( &header.rows       , buffer+16UL, 8UL );
+   std::memcpy( &header.columns    , buffer+24UL, 8UL );
+   std::memcpy( &header.spacing    , buffer+32UL, 8UL );
+   std::memcpy( &header.nonZeros   , buffer+40UL, 8UL );
+   std::memcpy( &header.payload    , buffer+48UL, 8UL );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reads and validates the header of the next record.
+//
+// \param type The expected vector/matrix type.
+// \param indexSize The expected size of a sparse index (0 for dense records).
+// \return The header of the next record.
+// \exception std::runtime_error Invalid or mismatching record.
+*/
+template< typename Type >  // Data type of the elements
+MappedArchive::Header MappedArchive::nextHeader( uint8_t type, size_t indexSize )
+{
+   Header header;
+
+   if( file_.size() - pos_ < alignment || !readHeader( file_.data()+pos_, header ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid record header detected" );
+   }
+
+   if( header.type != type ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid vector/matrix type detected" );
+   }
+
+   if( header.elementType != TypeValueMapping<Type>::value || header.elementSize != sizeof( Type ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+
+   if( header.indexSize != indexSize ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid index type detected" );
+   }
+
+   pos_ += alignment;
+
+   if( header.payload > file_.size() - pos_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Incomplete record detected" );
+   }
+
+   return header;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the next section of the current record.
+//
+// \param count The number of elements of the section.
+// \return Pointer to the first element of the section.
+// \exception std::runtime_error Incomplete record detected.
+*/
+template< typename Type >  // Data type of the elements
+const Type* MappedArchive::nextSection( size_t count )
+{
+   const size_t available( file_.size() - pos_ );
+
+   if( count > available / sizeof( Type ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Incomplete record detected" );
+   }
+
+   const Type* const section( reinterpret_cast<const Type*>( file_.data()+pos_ ) );
+   pos_ += std::min( nextMultiple( count*sizeof( Type ), alignment ), available );
+
+   return section;
+}
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  MAPPED SERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes a single section of a mapped record, followed by zero padding to a multiple of
+//        64 bytes.
+// \ingroup math_serialization
+//
+// \param archive The archive to be written.
+// \param data The elements of the section.
+// \param count The number of elements.
+// \return void
+*/
+template< typename Stream  // Type of the bound stream
+        , typename Type >  // Data type of the elements
+void serializeMappedSection( Archive<Stream>& archive, const Type* data, size_t count )
+{
+   static const char zeros[MappedArchive::alignment] = {};
+
+   const size_t bytes( count*sizeof( Type ) );
+
+   if( count > 0UL )
+      archive.write( data, count );
+   if( bytes % MappedArchive::alignment != 0UL )
+      archive.write( zeros, MappedArchive::alignment - bytes % MappedArchive::alignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the header of a mapped record.
+// \ingroup math_serialization
+//
+// \param archive The archive to be written.
+// \param header The header to be written.
+// \return void
+*/
+template< typename Stream >  // Type of the bound stream
+void serializeMappedHeader( Archive<Stream>& archive, const MappedArchive::Header& header )
+{
+   char buffer[MappedArchive::alignment] = {};
+   MappedArchive::writeHeader( buffer, header );
+   archive.write( buffer, MappedArchive::alignment );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense vector as a mapped record to the archive.
+// \ingroup math_serialization
+//
+// \param archive The archive to be written.
+// \param vec The dense vector to be serialized.
+// \return void
+// \exception std::runtime_error Dense vector could not be serialized.
+//
+// This function writes the given dense vector such that it can be reconstituted as a custom
+// vector via a MappedArchive. The elements are padded with zeros to a multiple of 64 bytes.
+*/
+template< typename Stream  // Type of the bound stream
+        , typename VT      // Type of the dense vector
+        , bool TF >        // Transpose flag
+void serializeMapped( Archive<Stream>& archive, const DenseVector<VT,TF>& vec )
+{
+   using ET = ElementType_t<VT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+   BLAZE_STATIC_ASSERT( MappedArchive::alignment % sizeof( ET ) == 0UL );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+
+   const size_t n( (*vec).size() );
+   const size_t spacing( nextMultiple( n, MappedArchive::alignment / sizeof( ET ) ) );
+
+   MappedArchive::Header header{};
+   header.type        = 0x00;
+   header.elementType = TypeValueMapping<ET>::value;
+   header.elementSize = sizeof( ET );
+   header.rows        = n;
+   header.columns     = 1UL;
+   header.spacing     = spacing;
+   header.payload     = spacing*sizeof( ET );
+   serializeMappedHeader( archive, header );
+
+   std::vector<ET> values( spacing, ET() );
+   for( size_t i=0UL; i<n; ++i ) {
+      values[i] = (*vec)[i];
+   }
+   serializeMappedSection( archive, values.data(), spacing );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense matrix as a mapped record to the archive.
+// \ingroup math_serialization
+//
+// \param archive The archive to be written.
+// \param mat The dense matrix to be serialized.
+// \return void
+// \exception std::runtime_error Dense matrix could not be serialized.
+//
+// This function writes the given dense matrix in its storage order such that it can be
+// reconstituted as a custom matrix of the same storage order via a MappedArchive. Each row
+// (row-major) or column (column-major) is padded with zeros to a multiple of 64 bytes.
+*/
+template< typename Stream  // Type of the bound stream
+        , typename MT      // Type of the dense matrix
+        , bool SO >        // Storage order
+void serializeMapped( Archive<Stream>& archive, const DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+   BLAZE_STATIC_ASSERT( MappedArchive::alignment % sizeof( ET ) == 0UL );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+
+   const size_t outer( SO ? (*mat).columns() : (*mat).rows() );
+   const size_t inner( SO ? (*mat).rows() : (*mat).columns() );
+   const size_t spacing( nextMultiple( inner, MappedArchive::alignment / sizeof( ET ) ) );
+
+   MappedArchive::Header header{};
+   header.type        = ( SO ? 0x05 : 0x01 );
+   header.elementType = TypeValueMapping<ET>::value;
+   header.elementSize = sizeof( ET );
+   header.rows        = (*mat).rows();
+   header.columns     = (*mat).columns();
+   header.spacing     = spacing;
+   header.payload     = outer*spacing*sizeof( ET );
+   serializeMappedHeader( archive, header );
+
+   std::vector<ET> values( spacing, ET() );
+   for( size_t i=0UL; i<outer; ++i ) {
+      for( size_t j=0UL; j<inner; ++j ) {
+         values[j] = ( SO ? (*mat)(j,i) : (*mat)(i,j) );
+      }
+      archive.write( values.data(), spacing );
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given sparse matrix as a mapped record to the archive.
+// \ingroup math_serialization
+//
+// \param archive The archive to be written.
+// \param mat The sparse matrix to be serialized.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be serialized.
+//
+// This function writes the given sparse matrix in compressed row (row-major) or compressed
+// column (column-major) format such that it can be reconstituted as a CustomCompressedMatrix
+// of the same storage order and index type \a IT via a MappedArchive. The index type can be
+// specified explicitly in order to reduce the size of the file:
+
+   \code
+   blaze::CompressedMatrix<double> S;
+   // ... Resizing and initialization
+
+   blaze::Archive<std::ofstream> archive( "matrix.blaze", std::ofstream::trunc );
+   blaze::serializeMapped<uint32_t>( archive, S );
+   \endcode
+
+// In case the inner dimension of the matrix exceeds the range of \a IT, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename IT = size_t  // Type of the stored indices
+        , typename Stream       // Type of the bound stream
+        , typename MT           // Type of the sparse matrix
+        , bool SO >             // Storage order
+void serializeMapped( Archive<Stream>& archive, const SparseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE( IT );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+
+   const size_t outer( SO ? (*mat).columns() : (*mat).rows() );
+   const size_t inner( SO ? (*mat).rows() : (*mat).columns() );
+
+   if( inner > size_t( std::numeric_limits<IT>::max() ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Matrix size exceeds the range of the index type" );
+   }
+
+   std::vector<uint64_t> offsets( outer+1UL, 0UL );
+   std::vector<IT> indices;
+   std::vector<ET> values;
+
+   indices.reserve( (*mat).nonZeros() );
+   values.reserve( (*mat).nonZeros() );
+
+   for( size_t i=0UL; i<outer; ++i ) {
+      for( auto element=(*mat).begin(i); element!=(*mat).end(i); ++element ) {
+         indices.push_back( static_cast<IT>( element->index() ) );
+         values.push_back( element->value() );
+      }
+      offsets[i+1UL] = values.size();
+   }
+
+   const size_t nonzeros( values.size() );
+
+   MappedArchive::Header header{};
+   header.type        = ( SO ? 0x07 : 0x03 );
+   header.elementType = TypeValueMapping<ET>::value;
+   header.elementSize = sizeof( ET );
+   header.indexSize   = sizeof( IT );
+   header.rows        = (*mat).rows();
+   header.columns     = (*mat).columns();
+   header.nonZeros    = nonzeros;
+   header.payload     = nextMultiple( ( outer+1UL )*sizeof( uint64_t ), MappedArchive::alignment ) +
+                        nextMultiple( nonzeros*sizeof( IT ), MappedArchive::alignment ) +
+                        nextMultiple( nonzeros*sizeof( ET ), MappedArchive::alignment );
+   serializeMappedHeader( archive, header );
+
+   serializeMappedSection( archive, offsets.data(), outer+1UL );
+   serializeMappedSection( archive, indices.data(), nonzeros );
+   serializeMappedSection( archive, values.data(), nonzeros );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
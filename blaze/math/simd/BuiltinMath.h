@@ -0,0 +1,1165 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/BuiltinMath.h
+//  \brief Header file for the built-in SIMD kernels of transcendental functions
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_BUILTINMATH_H_
+#define _BLAZE_MATH_SIMD_BUILTINMATH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Thin abstraction of the native SIMD operations used by the built-in SIMD math kernels.
+// \ingroup simd
+//
+// The BuiltinSIMD class template provides the handful of native SIMD operations (arithmetic,
+// comparisons, blending, and exponent manipulation) required by the built-in SIMD kernels of
+// the transcendental functions. It is specialized for \c float and \c double for the widest
+// available instruction set (SSE2, AVX2, or AVX-512). The built-in kernels are only available
+// in case the BLAZE_BUILTIN_SIMD_MATH_MODE is active.
+*/
+template< typename T >  // Type of the scalar elements
+struct BuiltinSIMD;
+/*! \endcond */
+//*************************************************************************************************
+
+
+#if BLAZE_BUILTIN_SIMD_MATH_MODE && BLAZE_AVX512F_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BuiltinSIMD class template for single precision AVX-512 vectors.
+// \ingroup simd
+*/
+template<>
+struct BuiltinSIMD<float>
+{
+   using Type = __m512;     //!< Type of the SIMD vector.
+   using Mask = __mmask16;  //!< Type of the comparison masks.
+   using Int  = __m512i;    //!< Type of the packed exponents.
+
+   static constexpr size_t size = 16UL;  //!< Number of elements of a SIMD vector.
+
+   static BLAZE_ALWAYS_INLINE Type set( float v ) noexcept { return _mm512_set1_ps( v ); }
+   static BLAZE_ALWAYS_INLINE Type load( const float* p ) noexcept { return _mm512_loadu_ps( p ); }
+   static BLAZE_ALWAYS_INLINE void store( float* p, Type a ) noexcept { _mm512_storeu_ps( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm512_add_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sub( Type a, Type b ) noexcept { return _mm512_sub_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type mul( Type a, Type b ) noexcept { return _mm512_mul_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type div( Type a, Type b ) noexcept { return _mm512_div_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type min( Type a, Type b ) noexcept { return _mm512_min_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type max( Type a, Type b ) noexcept { return _mm512_max_ps( a, b ); }
+
+   static BLAZE_ALWAYS_INLINE Type fmadd ( Type a, Type b, Type c ) noexcept {
+      return _mm512_fmadd_ps( a, b, c );
+   }
+   static BLAZE_ALWAYS_INLINE Type fnmadd( Type a, Type b, Type c ) noexcept {
+      return _mm512_fnmadd_ps( a, b, c );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type bitxor( Type a, Type b ) noexcept {
+      return _mm512_castsi512_ps( _mm512_xor_si512( _mm512_castps_si512( a ), _mm512_castps_si512( b ) ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type abs( Type a ) noexcept {
+      return _mm512_castsi512_ps( _mm512_and_si512( _mm512_castps_si512( a ), _mm512_set1_epi32( 0x7FFFFFFF ) ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type sign( Type a ) noexcept {
+      return _mm512_castsi512_ps( _mm512_and_si512( _mm512_castps_si512( a ), _mm512_set1_epi32( 0x80000000 ) ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask lt( Type a, Type b ) noexcept {
+      return _mm512_cmp_ps_mask( a, b, _CMP_LT_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask ge( Type a, Type b ) noexcept {
+      return _mm512_cmp_ps_mask( a, b, _CMP_GE_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask gt( Type a, Type b ) noexcept {
+      return _mm512_cmp_ps_mask( a, b, _CMP_GT_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask eq( Type a, Type b ) noexcept {
+      return _mm512_cmp_ps_mask( a, b, _CMP_EQ_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask neq( Type a, Type b ) noexcept {
+      return _mm512_cmp_ps_mask( a, b, _CMP_NEQ_UQ );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept {
+      return _mm512_mask_blend_ps( m, b, a );
+   }
+   static BLAZE_ALWAYS_INLINE bool any( Mask m ) noexcept { return m != 0; }
+
+   static BLAZE_ALWAYS_INLINE Type round( Type a ) noexcept {
+      return _mm512_roundscale_ps( a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+   }
+   static BLAZE_ALWAYS_INLINE Int toInt( Type a ) noexcept { return _mm512_cvtps_epi32( a ); }
+
+   static BLAZE_ALWAYS_INLINE Type ldexp( Type a, Int n ) noexcept {
+      const __m512i n1( _mm512_srai_epi32( n, 1 ) );
+      const __m512i n2( _mm512_sub_epi32( n, n1 ) );
+      const __m512i bias( _mm512_set1_epi32( 127 ) );
+      const __m512 p1( _mm512_castsi512_ps( _mm512_slli_epi32( _mm512_add_epi32( n1, bias ), 23 ) ) );
+      const __m512 p2( _mm512_castsi512_ps( _mm512_slli_epi32( _mm512_add_epi32( n2, bias ), 23 ) ) );
+      return _mm512_mul_ps( _mm512_mul_ps( a, p1 ), p2 );
+   }
+   static BLAZE_ALWAYS_INLINE Type exponent( Type a ) noexcept {
+      return _mm512_cvtepi32_ps( _mm512_srli_epi32( _mm512_castps_si512( a ), 23 ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type mantissa( Type a ) noexcept {
+      const __m512i bits( _mm512_and_si512( _mm512_castps_si512( a ), _mm512_set1_epi32( 0x807FFFFF ) ) );
+      return _mm512_castsi512_ps( _mm512_or_si512( bits, _mm512_set1_epi32( 0x3F000000 ) ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BuiltinSIMD class template for double precision AVX-512 vectors.
+// \ingroup simd
+*/
+template<>
+struct BuiltinSIMD<double>
+{
+   using Type = __m512d;   //!< Type of the SIMD vector.
+   using Mask = __mmask8;  //!< Type of the comparison masks.
+   using Int  = __m256i;   //!< Type of the packed exponents.
+
+   static constexpr size_t size = 8UL;  //!< Number of elements of a SIMD vector.
+
+   static BLAZE_ALWAYS_INLINE Type set( double v ) noexcept { return _mm512_set1_pd( v ); }
+   static BLAZE_ALWAYS_INLINE Type load( const double* p ) noexcept { return _mm512_loadu_pd( p ); }
+   static BLAZE_ALWAYS_INLINE void store( double* p, Type a ) noexcept { _mm512_storeu_pd( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm512_add_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sub( Type a, Type b ) noexcept { return _mm512_sub_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type mul( Type a, Type b ) noexcept { return _mm512_mul_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type div( Type a, Type b ) noexcept { return _mm512_div_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type min( Type a, Type b ) noexcept { return _mm512_min_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type max( Type a, Type b ) noexcept { return _mm512_max_pd( a, b ); }
+
+   static BLAZE_ALWAYS_INLINE Type fmadd ( Type a, Type b, Type c ) noexcept {
+      return _mm512_fmadd_pd( a, b, c );
+   }
+   static BLAZE_ALWAYS_INLINE Type fnmadd( Type a, Type b, Type c ) noexcept {
+      return _mm512_fnmadd_pd( a, b, c );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type bitxor( Type a, Type b ) noexcept {
+      return _mm512_castsi512_pd( _mm512_xor_si512( _mm512_castpd_si512( a ), _mm512_castpd_si512( b ) ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type abs( Type a ) noexcept {
+      const __m512i mask( _mm512_set1_epi64( 0x7FFFFFFFFFFFFFFFLL ) );
+      return _mm512_castsi512_pd( _mm512_and_si512( _mm512_castpd_si512( a ), mask ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type sign( Type a ) noexcept {
+      return _mm512_castsi512_pd( _mm512_and_si512( _mm512_castpd_si512( a ), _mm512_set1_epi64( 1LL << 63 ) ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask lt( Type a, Type b ) noexcept {
+      return _mm512_cmp_pd_mask( a, b, _CMP_LT_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask ge( Type a, Type b ) noexcept {
+      return _mm512_cmp_pd_mask( a, b, _CMP_GE_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask gt( Type a, Type b ) noexcept {
+      return _mm512_cmp_pd_mask( a, b, _CMP_GT_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask eq( Type a, Type b ) noexcept {
+      return _mm512_cmp_pd_mask( a, b, _CMP_EQ_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask neq( Type a, Type b ) noexcept {
+      return _mm512_cmp_pd_mask( a, b, _CMP_NEQ_UQ );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept {
+      return _mm512_mask_blend_pd( m, b, a );
+   }
+   static BLAZE_ALWAYS_INLINE bool any( Mask m ) noexcept { return m != 0; }
+
+   static BLAZE_ALWAYS_INLINE Type round( Type a ) noexcept {
+      return _mm512_roundscale_pd( a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+   }
+   static BLAZE_ALWAYS_INLINE Int toInt( Type a ) noexcept { return _mm512_cvtpd_epi32( a ); }
+
+   static BLAZE_ALWAYS_INLINE Type ldexp( Type a, Int n ) noexcept {
+      const __m256i n1( _mm256_srai_epi32( n, 1 ) );
+      const __m256i n2( _mm256_sub_epi32( n, n1 ) );
+      const __m512i bias( _mm512_set1_epi64( 1023 ) );
+      const __m512i e1( _mm512_add_epi64( _mm512_cvtepi32_epi64( n1 ), bias ) );
+      const __m512i e2( _mm512_add_epi64( _mm512_cvtepi32_epi64( n2 ), bias ) );
+      const __m512d p1( _mm512_castsi512_pd( _mm512_slli_epi64( e1, 52 ) ) );
+      const __m512d p2( _mm512_castsi512_pd( _mm512_slli_epi64( e2, 52 ) ) );
+      return _mm512_mul_pd( _mm512_mul_pd( a, p1 ), p2 );
+   }
+   static BLAZE_ALWAYS_INLINE Type exponent( Type a ) noexcept {
+      const __m512i magic( _mm512_set1_epi64( 0x4330000000000000LL ) );
+      const __m512i bits( _mm512_or_si512( _mm512_srli_epi64( _mm512_castpd_si512( a ), 52 ), magic ) );
+      return _mm512_sub_pd( _mm512_castsi512_pd( bits ), _mm512_castsi512_pd( magic ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type mantissa( Type a ) noexcept {
+      const __m512i bits( _mm512_and_si512( _mm512_castpd_si512( a ), _mm512_set1_epi64( 0x800FFFFFFFFFFFFFLL ) ) );
+      return _mm512_castsi512_pd( _mm512_or_si512( bits, _mm512_set1_epi64( 0x3FE0000000000000LL ) ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+#elif BLAZE_BUILTIN_SIMD_MATH_MODE && BLAZE_AVX2_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BuiltinSIMD class template for single precision AVX2 vectors.
+// \ingroup simd
+*/
+template<>
+struct BuiltinSIMD<float>
+{
+   using Type = __m256;   //!< Type of the SIMD vector.
+   using Mask = __m256;   //!< Type of the comparison masks.
+   using Int  = __m256i;  //!< Type of the packed exponents.
+
+   static constexpr size_t size = 8UL;  //!< Number of elements of a SIMD vector.
+
+   static BLAZE_ALWAYS_INLINE Type set( float v ) noexcept { return _mm256_set1_ps( v ); }
+   static BLAZE_ALWAYS_INLINE Type load( const float* p ) noexcept { return _mm256_loadu_ps( p ); }
+   static BLAZE_ALWAYS_INLINE void store( float* p, Type a ) noexcept { _mm256_storeu_ps( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm256_add_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sub( Type a, Type b ) noexcept { return _mm256_sub_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type mul( Type a, Type b ) noexcept { return _mm256_mul_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type div( Type a, Type b ) noexcept { return _mm256_div_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type min( Type a, Type b ) noexcept { return _mm256_min_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type max( Type a, Type b ) noexcept { return _mm256_max_ps( a, b ); }
+
+#if BLAZE_FMA_MODE
+   static BLAZE_ALWAYS_INLINE Type fmadd ( Type a, Type b, Type c ) noexcept {
+      return _mm256_fmadd_ps( a, b, c );
+   }
+   static BLAZE_ALWAYS_INLINE Type fnmadd( Type a, Type b, Type c ) noexcept {
+      return _mm256_fnmadd_ps( a, b, c );
+   }
+#else
+   static BLAZE_ALWAYS_INLINE Type fmadd ( Type a, Type b, Type c ) noexcept {
+      return add( mul( a, b ), c );
+   }
+   static BLAZE_ALWAYS_INLINE Type fnmadd( Type a, Type b, Type c ) noexcept {
+      return sub( c, mul( a, b ) );
+   }
+#endif
+
+   static BLAZE_ALWAYS_INLINE Type bitxor( Type a, Type b ) noexcept {
+      return _mm256_xor_ps( a, b );
+   }
+   static BLAZE_ALWAYS_INLINE Type abs ( Type a ) noexcept {
+      return _mm256_andnot_ps( set( -0.0F ), a );
+   }
+   static BLAZE_ALWAYS_INLINE Type sign( Type a ) noexcept {
+      return _mm256_and_ps( set( -0.0F ), a );
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask lt( Type a, Type b ) noexcept {
+      return _mm256_cmp_ps( a, b, _CMP_LT_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask ge( Type a, Type b ) noexcept {
+      return _mm256_cmp_ps( a, b, _CMP_GE_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask gt( Type a, Type b ) noexcept {
+      return _mm256_cmp_ps( a, b, _CMP_GT_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask eq( Type a, Type b ) noexcept {
+      return _mm256_cmp_ps( a, b, _CMP_EQ_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask neq( Type a, Type b ) noexcept {
+      return _mm256_cmp_ps( a, b, _CMP_NEQ_UQ );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept {
+      return _mm256_blendv_ps( b, a, m );
+   }
+   static BLAZE_ALWAYS_INLINE bool any( Mask m ) noexcept { return _mm256_movemask_ps( m ) != 0; }
+
+   static BLAZE_ALWAYS_INLINE Type round( Type a ) noexcept {
+      return _mm256_round_ps( a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+   }
+   static BLAZE_ALWAYS_INLINE Int toInt( Type a ) noexcept { return _mm256_cvtps_epi32( a ); }
+
+   static BLAZE_ALWAYS_INLINE Type ldexp( Type a, Int n ) noexcept {
+      const __m256i n1( _mm256_srai_epi32( n, 1 ) );
+      const __m256i n2( _mm256_sub_epi32( n, n1 ) );
+      const __m256i bias( _mm256_set1_epi32( 127 ) );
+      const __m256 p1( _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_add_epi32( n1, bias ), 23 ) ) );
+      const __m256 p2( _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_add_epi32( n2, bias ), 23 ) ) );
+      return _mm256_mul_ps( _mm256_mul_ps( a, p1 ), p2 );
+   }
+   static BLAZE_ALWAYS_INLINE Type exponent( Type a ) noexcept {
+      return _mm256_cvtepi32_ps( _mm256_srli_epi32( _mm256_castps_si256( a ), 23 ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type mantissa( Type a ) noexcept {
+      const __m256i bits( _mm256_and_si256( _mm256_castps_si256( a ), _mm256_set1_epi32( 0x807FFFFF ) ) );
+      return _mm256_castsi256_ps( _mm256_or_si256( bits, _mm256_set1_epi32( 0x3F000000 ) ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BuiltinSIMD class template for double precision AVX2 vectors.
+// \ingroup simd
+*/
+template<>
+struct BuiltinSIMD<double>
+{
+   using Type = __m256d;  //!< Type of the SIMD vector.
+   using Mask = __m256d;  //!< Type of the comparison masks.
+   using Int  = __m128i;  //!< Type of the packed exponents.
+
+   static constexpr size_t size = 4UL;  //!< Number of elements of a SIMD vector.
+
+   static BLAZE_ALWAYS_INLINE Type set( double v ) noexcept { return _mm256_set1_pd( v ); }
+   static BLAZE_ALWAYS_INLINE Type load( const double* p ) noexcept { return _mm256_loadu_pd( p ); }
+   static BLAZE_ALWAYS_INLINE void store( double* p, Type a ) noexcept { _mm256_storeu_pd( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm256_add_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sub( Type a, Type b ) noexcept { return _mm256_sub_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type mul( Type a, Type b ) noexcept { return _mm256_mul_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type div( Type a, Type b ) noexcept { return _mm256_div_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type min( Type a, Type b ) noexcept { return _mm256_min_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type max( Type a, Type b ) noexcept { return _mm256_max_pd( a, b ); }
+
+#if BLAZE_FMA_MODE
+   static BLAZE_ALWAYS_INLINE Type fmadd ( Type a, Type b, Type c ) noexcept {
+      return _mm256_fmadd_pd( a, b, c );
+   }
+   static BLAZE_ALWAYS_INLINE Type fnmadd( Type a, Type b, Type c ) noexcept {
+      return _mm256_fnmadd_pd( a, b, c );
+   }
+#else
+   static BLAZE_ALWAYS_INLINE Type fmadd ( Type a, Type b, Type c ) noexcept {
+      return add( mul( a, b ), c );
+   }
+   static BLAZE_ALWAYS_INLINE Type fnmadd( Type a, Type b, Type c ) noexcept {
+      return sub( c, mul( a, b ) );
+   }
+#endif
+
+   static BLAZE_ALWAYS_INLINE Type bitxor( Type a, Type b ) noexcept {
+      return _mm256_xor_pd( a, b );
+   }
+   static BLAZE_ALWAYS_INLINE Type abs ( Type a ) noexcept {
+      return _mm256_andnot_pd( set( -0.0 ), a );
+   }
+   static BLAZE_ALWAYS_INLINE Type sign( Type a ) noexcept {
+      return _mm256_and_pd( set( -0.0 ), a );
+   }
+
+   static BLAZE_ALWAYS_INLINE Mask lt( Type a, Type b ) noexcept {
+      return _mm256_cmp_pd( a, b, _CMP_LT_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask ge( Type a, Type b ) noexcept {
+      return _mm256_cmp_pd( a, b, _CMP_GE_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask gt( Type a, Type b ) noexcept {
+      return _mm256_cmp_pd( a, b, _CMP_GT_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask eq( Type a, Type b ) noexcept {
+      return _mm256_cmp_pd( a, b, _CMP_EQ_OQ );
+   }
+   static BLAZE_ALWAYS_INLINE Mask neq( Type a, Type b ) noexcept {
+      return _mm256_cmp_pd( a, b, _CMP_NEQ_UQ );
+   }
+
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept {
+      return _mm256_blendv_pd( b, a, m );
+   }
+   static BLAZE_ALWAYS_INLINE bool any( Mask m ) noexcept { return _mm256_movemask_pd( m ) != 0; }
+
+   static BLAZE_ALWAYS_INLINE Type round( Type a ) noexcept {
+      return _mm256_round_pd( a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+   }
+   static BLAZE_ALWAYS_INLINE Int toInt( Type a ) noexcept { return _mm256_cvtpd_epi32( a ); }
+
+   static BLAZE_ALWAYS_INLINE Type ldexp( Type a, Int n ) noexcept {
+      const __m128i n1( _mm_srai_epi32( n, 1 ) );
+      const __m128i n2( _mm_sub_epi32( n, n1 ) );
+      const __m256i bias( _mm256_set1_epi64x( 1023 ) );
+      const __m256i e1( _mm256_add_epi64( _mm256_cvtepi32_epi64( n1 ), bias ) );
+      const __m256i e2( _mm256_add_epi64( _mm256_cvtepi32_epi64( n2 ), bias ) );
+      const __m256d p1( _mm256_castsi256_pd( _mm256_slli_epi64( e1, 52 ) ) );
+      const __m256d p2( _mm256_castsi256_pd( _mm256_slli_epi64( e2, 52 ) ) );
+      return _mm256_mul_pd( _mm256_mul_pd( a, p1 ), p2 );
+   }
+   static BLAZE_ALWAYS_INLINE Type exponent( Type a ) noexcept {
+      const __m256i magic( _mm256_set1_epi64x( 0x4330000000000000LL ) );
+      const __m256i bits( _mm256_or_si256( _mm256_srli_epi64( _mm256_castpd_si256( a ), 52 ), magic ) );
+      return _mm256_sub_pd( _mm256_castsi256_pd( bits ), _mm256_castsi256_pd( magic ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type mantissa( Type a ) noexcept {
+      const __m256i bits( _mm256_and_si256( _mm256_castpd_si256( a ), _mm256_set1_epi64x( 0x800FFFFFFFFFFFFFLL ) ) );
+      return _mm256_castsi256_pd( _mm256_or_si256( bits, _mm256_set1_epi64x( 0x3FE0000000000000LL ) ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+#elif BLAZE_BUILTIN_SIMD_MATH_MODE && BLAZE_SSE2_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BuiltinSIMD class template for single precision SSE2 vectors.
+// \ingroup simd
+*/
+template<>
+struct BuiltinSIMD<float>
+{
+   using Type = __m128;   //!< Type of the SIMD vector.
+   using Mask = __m128;   //!< Type of the comparison masks.
+   using Int  = __m128i;  //!< Type of the packed exponents.
+
+   static constexpr size_t size = 4UL;  //!< Number of elements of a SIMD vector.
+
+   static BLAZE_ALWAYS_INLINE Type set( float v ) noexcept { return _mm_set1_ps( v ); }
+   static BLAZE_ALWAYS_INLINE Type load( const float* p ) noexcept { return _mm_loadu_ps( p ); }
+   static BLAZE_ALWAYS_INLINE void store( float* p, Type a ) noexcept { _mm_storeu_ps( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm_add_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sub( Type a, Type b ) noexcept { return _mm_sub_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type mul( Type a, Type b ) noexcept { return _mm_mul_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type div( Type a, Type b ) noexcept { return _mm_div_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type min( Type a, Type b ) noexcept { return _mm_min_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type max( Type a, Type b ) noexcept { return _mm_max_ps( a, b ); }
+
+#if BLAZE_FMA_MODE
+   static BLAZE_ALWAYS_INLINE Type fmadd ( Type a, Type b, Type c ) noexcept {
+      return _mm_fmadd_ps( a, b, c );
+   }
+   static BLAZE_ALWAYS_INLINE Type fnmadd( Type a, Type b, Type c ) noexcept {
+      return _mm_fnmadd_ps( a, b, c );
+   }
+#else
+   static BLAZE_ALWAYS_INLINE Type fmadd ( Type a, Type b, Type c ) noexcept {
+      return add( mul( a, b ), c );
+   }
+   static BLAZE_ALWAYS_INLINE Type fnmadd( Type a, Type b, Type c ) noexcept {
+      return sub( c, mul( a, b ) );
+   }
+#endif
+
+   static BLAZE_ALWAYS_INLINE Type bitxor( Type a, Type b ) noexcept { return _mm_xor_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type abs ( Type a ) noexcept {
+      return _mm_andnot_ps( set( -0.0F ), a );
+   }
+   static BLAZE_ALWAYS_INLINE Type sign( Type a ) noexcept { return _mm_and_ps( set( -0.0F ), a ); }
+
+   static BLAZE_ALWAYS_INLINE Mask lt( Type a, Type b ) noexcept { return _mm_cmplt_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask ge( Type a, Type b ) noexcept { return _mm_cmpge_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask gt( Type a, Type b ) noexcept { return _mm_cmpgt_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask eq( Type a, Type b ) noexcept { return _mm_cmpeq_ps( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask neq( Type a, Type b ) noexcept { return _mm_cmpneq_ps( a, b ); }
+
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept {
+      return _mm_or_ps( _mm_and_ps( m, a ), _mm_andnot_ps( m, b ) );
+   }
+   static BLAZE_ALWAYS_INLINE bool any( Mask m ) noexcept { return _mm_movemask_ps( m ) != 0; }
+
+   static BLAZE_ALWAYS_INLINE Type round( Type a ) noexcept {
+      return _mm_cvtepi32_ps( _mm_cvtps_epi32( a ) );
+   }
+   static BLAZE_ALWAYS_INLINE Int toInt( Type a ) noexcept { return _mm_cvtps_epi32( a ); }
+
+   static BLAZE_ALWAYS_INLINE Type ldexp( Type a, Int n ) noexcept {
+      const __m128i n1( _mm_srai_epi32( n, 1 ) );
+      const __m128i n2( _mm_sub_epi32( n, n1 ) );
+      const __m128i bias( _mm_set1_epi32( 127 ) );
+      const __m128 p1( _mm_castsi128_ps( _mm_slli_epi32( _mm_add_epi32( n1, bias ), 23 ) ) );
+      const __m128 p2( _mm_castsi128_ps( _mm_slli_epi32( _mm_add_epi32( n2, bias ), 23 ) ) );
+      return _mm_mul_ps( _mm_mul_ps( a, p1 ), p2 );
+   }
+   static BLAZE_ALWAYS_INLINE Type exponent( Type a ) noexcept {
+      return _mm_cvtepi32_ps( _mm_srli_epi32( _mm_castps_si128( a ), 23 ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type mantissa( Type a ) noexcept {
+      const __m128i bits( _mm_and_si128( _mm_castps_si128( a ), _mm_set1_epi32( 0x807FFFFF ) ) );
+      return _mm_castsi128_ps( _mm_or_si128( bits, _mm_set1_epi32( 0x3F000000 ) ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BuiltinSIMD class template for double precision SSE2 vectors.
+// \ingroup simd
+*/
+template<>
+struct BuiltinSIMD<double>
+{
+   using Type = __m128d;  //!< Type of the SIMD vector.
+   using Mask = __m128d;  //!< Type of the comparison masks.
+   using Int  = __m128i;  //!< Type of the packed exponents.
+
+   static constexpr size_t size = 2UL;  //!< Number of elements of a SIMD vector.
+
+   static BLAZE_ALWAYS_INLINE Type set( double v ) noexcept { return _mm_set1_pd( v ); }
+   static BLAZE_ALWAYS_INLINE Type load( const double* p ) noexcept { return _mm_loadu_pd( p ); }
+   static BLAZE_ALWAYS_INLINE void store( double* p, Type a ) noexcept { _mm_storeu_pd( p, a ); }
+
+   static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm_add_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type sub( Type a, Type b ) noexcept { return _mm_sub_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type mul( Type a, Type b ) noexcept { return _mm_mul_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type div( Type a, Type b ) noexcept { return _mm_div_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type min( Type a, Type b ) noexcept { return _mm_min_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type max( Type a, Type b ) noexcept { return _mm_max_pd( a, b ); }
+
+#if BLAZE_FMA_MODE
+   static BLAZE_ALWAYS_INLINE Type fmadd ( Type a, Type b, Type c ) noexcept {
+      return _mm_fmadd_pd( a, b, c );
+   }
+   static BLAZE_ALWAYS_INLINE Type fnmadd( Type a, Type b, Type c ) noexcept {
+      return _mm_fnmadd_pd( a, b, c );
+   }
+#else
+   static BLAZE_ALWAYS_INLINE Type fmadd ( Type a, Type b, Type c ) noexcept {
+      return add( mul( a, b ), c );
+   }
+   static BLAZE_ALWAYS_INLINE Type fnmadd( Type a, Type b, Type c ) noexcept {
+      return sub( c, mul( a, b ) );
+   }
+#endif
+
+   static BLAZE_ALWAYS_INLINE Type bitxor( Type a, Type b ) noexcept { return _mm_xor_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Type abs ( Type a ) noexcept {
+      return _mm_andnot_pd( set( -0.0 ), a );
+   }
+   static BLAZE_ALWAYS_INLINE Type sign( Type a ) noexcept { return _mm_and_pd( set( -0.0 ), a ); }
+
+   static BLAZE_ALWAYS_INLINE Mask lt( Type a, Type b ) noexcept { return _mm_cmplt_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask ge( Type a, Type b ) noexcept { return _mm_cmpge_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask gt( Type a, Type b ) noexcept { return _mm_cmpgt_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask eq( Type a, Type b ) noexcept { return _mm_cmpeq_pd( a, b ); }
+   static BLAZE_ALWAYS_INLINE Mask neq( Type a, Type b ) noexcept { return _mm_cmpneq_pd( a, b ); }
+
+   static BLAZE_ALWAYS_INLINE Type select( Mask m, Type a, Type b ) noexcept {
+      return _mm_or_pd( _mm_and_pd( m, a ), _mm_andnot_pd( m, b ) );
+   }
+   static BLAZE_ALWAYS_INLINE bool any( Mask m ) noexcept { return _mm_movemask_pd( m ) != 0; }
+
+   static BLAZE_ALWAYS_INLINE Type round( Type a ) noexcept {
+      return _mm_cvtepi32_pd( _mm_cvtpd_epi32( a ) );
+   }
+   static BLAZE_ALWAYS_INLINE Int toInt( Type a ) noexcept { return _mm_cvtpd_epi32( a ); }
+
+   static BLAZE_ALWAYS_INLINE Type ldexp( Type a, Int n ) noexcept {
+      const __m128i n1( _mm_srai_epi32( n, 1 ) );
+      const __m128i n2( _mm_sub_epi32( n, n1 ) );
+      const __m128i bias( _mm_set1_epi32( 1023 ) );
+      const __m128i e1( _mm_shuffle_epi32( _mm_add_epi32( n1, bias ), _MM_SHUFFLE( 1, 1, 0, 0 ) ) );
+      const __m128i e2( _mm_shuffle_epi32( _mm_add_epi32( n2, bias ), _MM_SHUFFLE( 1, 1, 0, 0 ) ) );
+      const __m128d p1( _mm_castsi128_pd( _mm_slli_epi64( e1, 52 ) ) );
+      const __m128d p2( _mm_castsi128_pd( _mm_slli_epi64( e2, 52 ) ) );
+      return _mm_mul_pd( _mm_mul_pd( a, p1 ), p2 );
+   }
+   static BLAZE_ALWAYS_INLINE Type exponent( Type a ) noexcept {
+      const __m128i magic( _mm_set1_epi64x( 0x4330000000000000LL ) );
+      const __m128i bits( _mm_or_si128( _mm_srli_epi64( _mm_castpd_si128( a ), 52 ), magic ) );
+      return _mm_sub_pd( _mm_castsi128_pd( bits ), _mm_castsi128_pd( magic ) );
+   }
+   static BLAZE_ALWAYS_INLINE Type mantissa( Type a ) noexcept {
+      const __m128i bits( _mm_and_si128( _mm_castpd_si128( a ), _mm_set1_epi64x( 0x800FFFFFFFFFFFFFLL ) ) );
+      return _mm_castsi128_pd( _mm_or_si128( bits, _mm_set1_epi64x( 0x3FE0000000000000LL ) ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+
+
+
+#if BLAZE_BUILTIN_SIMD_MATH_MODE
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Polynomial evaluation by means of the Horner scheme (\f$ c_0 \f$).
+// \ingroup simd
+*/
+template< typename T >  // Type of the scalar elements
+BLAZE_ALWAYS_INLINE typename BuiltinSIMD<T>::Type
+   builtinPolynomial( typename BuiltinSIMD<T>::Type /*x*/, T c0 ) noexcept
+{
+   return BuiltinSIMD<T>::set( c0 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Polynomial evaluation by means of the Horner scheme (\f$ c_0 + c_1 x + c_2 x^2 + ... \f$).
+// \ingroup simd
+*/
+template< typename T         // Type of the scalar elements
+        , typename... Ts >   // Types of the remaining coefficients
+BLAZE_ALWAYS_INLINE typename BuiltinSIMD<T>::Type
+   builtinPolynomial( typename BuiltinSIMD<T>::Type x, T c0, T c1, Ts... cs ) noexcept
+{
+   using S = BuiltinSIMD<T>;
+   return S::fmadd( builtinPolynomial<T>( x, c1, cs... ), x, S::set( c0 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Elementwise evaluation of a scalar function for a SIMD vector.
+// \ingroup simd
+//
+// This function is used as fallback for arguments outside the range of the SIMD kernels.
+*/
+template< typename T    // Type of the scalar elements
+        , typename OP > // Type of the scalar operation
+inline typename BuiltinSIMD<T>::Type
+   builtinScalar( typename BuiltinSIMD<T>::Type x, OP op ) noexcept
+{
+   using S = BuiltinSIMD<T>;
+
+   T tmp[S::size];
+   S::store( tmp, x );
+   for( size_t i=0UL; i<S::size; ++i ) {
+      tmp[i] = op( tmp[i] );
+   }
+   return S::load( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPONENTIAL FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in SIMD kernel for \f$ e^x \f$ (single precision).
+// \ingroup simd
+//
+// Cody-Waite range reduction \f$ x = n \ln 2 + r \f$ followed by a degree 7 polynomial (Cephes).
+// Maximum error: 1 ULP. Overflow, underflow (including denormal results), infinities, and NaN
+// are handled as by \c std::exp().
+*/
+BLAZE_ALWAYS_INLINE BuiltinSIMD<float>::Type builtinExp( BuiltinSIMD<float>::Type x ) noexcept
+{
+   using S = BuiltinSIMD<float>;
+
+   x = S::max( S::set( -104.0F ), S::min( S::set( 89.0F ), x ) );
+
+   const S::Type n( S::round( S::mul( x, S::set( 1.44269504088896341F ) ) ) );
+   S::Type r( S::fnmadd( n, S::set( 0.693359375F ), x ) );
+   r = S::fnmadd( n, S::set( -2.12194440e-4F ), r );
+
+   const S::Type p( builtinPolynomial<float>( r, 5.0000001201E-1F, 1.6666665459E-1F, 4.1665795894E-2F
+                                               , 8.3334519073E-3F, 1.3981999507E-3F, 1.9875691500E-4F ) );
+   const S::Type y( S::add( S::fmadd( S::mul( p, r ), r, r ), S::set( 1.0F ) ) );
+
+   return S::ldexp( y, S::toInt( n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in SIMD kernel for \f$ e^x \f$ (double precision).
+// \ingroup simd
+//
+// Cody-Waite range reduction \f$ x = n \ln 2 + r \f$ followed by a (2,3) Pade approximation
+// (Cephes). Maximum error: 2 ULP. Overflow, underflow (including denormal results), infinities,
+// and NaN are handled as by \c std::exp().
+*/
+BLAZE_ALWAYS_INLINE BuiltinSIMD<double>::Type builtinExp( BuiltinSIMD<double>::Type x ) noexcept
+{
+   using S = BuiltinSIMD<double>;
+
+   x = S::max( S::set( -746.0 ), S::min( S::set( 710.0 ), x ) );
+
+   const S::Type n( S::round( S::mul( x, S::set( 1.4426950408889634073599 ) ) ) );
+   S::Type r( S::fnmadd( n, S::set( 6.93145751953125E-1 ), x ) );
+   r = S::fnmadd( n, S::set( 1.42860682030941723212E-6 ), r );
+
+   const S::Type rr( S::mul( r, r ) );
+   const S::Type px( S::mul( r, builtinPolynomial<double>( rr, 9.99999999999999999910E-1
+                                                             , 3.02994407707441961300E-2
+                                                             , 1.26177193074810590878E-4 ) ) );
+   const S::Type qx( builtinPolynomial<double>( rr, 2.00000000000000000009E0, 2.27265548208155028766E-1
+                                                  , 2.52448340349684104192E-3, 3.00198505138664455042E-6 ) );
+   const S::Type y( S::fmadd( S::set( 2.0 ), S::div( px, S::sub( qx, px ) ), S::set( 1.0 ) ) );
+
+   return S::ldexp( y, S::toInt( n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOGARITHM
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in SIMD kernel for \f$ \ln(x) \f$ (single precision).
+// \ingroup simd
+//
+// Decomposition \f$ x = 2^e m \f$ with \f$ m \in [\sqrt{1/2},\sqrt{2}) \f$ followed by a degree 9
+// polynomial in \f$ m-1 \f$ (Cephes). Maximum error: 1 ULP. Denormal arguments, zero, negative
+// arguments, infinities, and NaN are handled as by \c std::log().
+*/
+BLAZE_ALWAYS_INLINE BuiltinSIMD<float>::Type builtinLog( BuiltinSIMD<float>::Type x ) noexcept
+{
+   using S = BuiltinSIMD<float>;
+
+   const S::Mask denormal( S::lt( x, S::set( std::numeric_limits<float>::min() ) ) );
+   const S::Type a( S::select( denormal, S::mul( x, S::set( 33554432.0F ) ), x ) );
+
+   S::Type e( S::sub( S::exponent( a ), S::select( denormal, S::set( 151.0F ), S::set( 126.0F ) ) ) );
+   S::Type m( S::mantissa( a ) );
+
+   const S::Mask small( S::lt( m, S::set( 0.707106781186547524F ) ) );
+   e = S::sub( e, S::select( small, S::set( 1.0F ), S::set( 0.0F ) ) );
+   m = S::sub( S::add( m, S::select( small, m, S::set( 0.0F ) ) ), S::set( 1.0F ) );
+
+   const S::Type z( S::mul( m, m ) );
+   S::Type y( builtinPolynomial<float>( m, 3.3333331174E-1F, -2.4999993993E-1F, 2.0000714765E-1F
+                                         , -1.6668057665E-1F, 1.4249322787E-1F, -1.2420140846E-1F
+                                         , 1.1676998740E-1F, -1.1514610310E-1F, 7.0376836292E-2F ) );
+   y = S::mul( S::mul( y, m ), z );
+   y = S::fmadd( e, S::set( -2.12194440e-4F ), y );
+   y = S::fnmadd( z, S::set( 0.5F ), y );
+   y = S::fmadd( e, S::set( 0.693359375F ), S::add( m, y ) );
+
+   y = S::select( S::eq( x, S::set( std::numeric_limits<float>::infinity() ) ), x, y );
+   y = S::select( S::eq( x, S::set( 0.0F ) ), S::set( -std::numeric_limits<float>::infinity() ), y );
+   return S::select( S::ge( x, S::set( 0.0F ) ), y, S::set( std::numeric_limits<float>::quiet_NaN() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in SIMD kernel for \f$ \ln(x) \f$ (double precision).
+// \ingroup simd
+//
+// Decomposition \f$ x = 2^e m \f$ with \f$ m \in [\sqrt{1/2},\sqrt{2}) \f$ followed by a (5,5)
+// rational approximation in \f$ m-1 \f$ (Cephes). Maximum error: 1 ULP. Denormal arguments,
+// zero, negative arguments, infinities, and NaN are handled as by \c std::log().
+*/
+BLAZE_ALWAYS_INLINE BuiltinSIMD<double>::Type builtinLog( BuiltinSIMD<double>::Type x ) noexcept
+{
+   using S = BuiltinSIMD<double>;
+
+   const S::Mask denormal( S::lt( x, S::set( std::numeric_limits<double>::min() ) ) );
+   const S::Type a( S::select( denormal, S::mul( x, S::set( 18014398509481984.0 ) ), x ) );
+
+   S::Type e( S::sub( S::exponent( a ), S::select( denormal, S::set( 1076.0 ), S::set( 1022.0 ) ) ) );
+   S::Type m( S::mantissa( a ) );
+
+   const S::Mask small( S::lt( m, S::set( 0.70710678118654752440 ) ) );
+   e = S::sub( e, S::select( small, S::set( 1.0 ), S::set( 0.0 ) ) );
+   m = S::sub( S::add( m, S::select( small, m, S::set( 0.0 ) ) ), S::set( 1.0 ) );
+
+   const S::Type z( S::mul( m, m ) );
+   const S::Type p( builtinPolynomial<double>( m, 7.70838733755885391666E0, 1.79368678507819816313E1
+                                                , 1.44989225341610930846E1, 4.70579119878881725854E0
+                                                , 4.97494994976747001425E-1, 1.01875663804580931796E-4 ) );
+   const S::Type q( builtinPolynomial<double>( m, 2.31251620126765340583E1, 7.11544750618563894466E1
+                                                , 8.29875266912776603211E1, 4.52279145837532221105E1
+                                                , 1.12873587189167450590E1, 1.0 ) );
+   S::Type y( S::mul( m, S::mul( z, S::div( p, q ) ) ) );
+   y = S::fmadd( e, S::set( -2.121944400546905827679E-4 ), y );
+   y = S::fnmadd( z, S::set( 0.5 ), y );
+   y = S::fmadd( e, S::set( 0.693359375 ), S::add( m, y ) );
+
+   y = S::select( S::eq( x, S::set( std::numeric_limits<double>::infinity() ) ), x, y );
+   y = S::select( S::eq( x, S::set( 0.0 ) ), S::set( -std::numeric_limits<double>::infinity() ), y );
+   return S::select( S::ge( x, S::set( 0.0 ) ), y, S::set( std::numeric_limits<double>::quiet_NaN() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRIGONOMETRIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in SIMD kernel for \f$ \sin(x) \f$ and \f$ \cos(x) \f$ (single precision).
+// \ingroup simd
+//
+// \param x The vector of arguments.
+// \param cosine \a true for \f$ \cos(x) \f$, \a false for \f$ \sin(x) \f$.
+// \return The resulting vector.
+//
+// Four-part Cody-Waite reduction modulo \f$ \pi/2 \f$ followed by the Cephes minimax polynomials
+// on \f$ [-\pi/4,\pi/4] \f$. Maximum error: 3 ULP for \f$ |x| \le 8192 \f$. Vectors containing
+// larger arguments (including infinities) are evaluated elementwise by \c std::sin() and
+// \c std::cos(), respectively.
+*/
+BLAZE_ALWAYS_INLINE BuiltinSIMD<float>::Type
+   builtinSinCos( BuiltinSIMD<float>::Type x, bool cosine ) noexcept
+{
+   using S = BuiltinSIMD<float>;
+
+   if( S::any( S::gt( S::abs( x ), S::set( 8192.0F ) ) ) ) {
+      return cosine ? builtinScalar<float>( x, []( float v ){ return std::cos( v ); } )
+                    : builtinScalar<float>( x, []( float v ){ return std::sin( v ); } );
+   }
+
+   const S::Type q( S::round( S::mul( x, S::set( 0.636619772367581343F ) ) ) );
+   S::Type r( S::fnmadd( q, S::set( 1.5703125F ), x ) );
+   r = S::fnmadd( q, S::set( 4.837512969970703125E-4F ), r );
+   r = S::fnmadd( q, S::set( 7.54953362047672271728515625E-8F ), r );
+   r = S::fnmadd( q, S::set( 2.5633440682570896E-12F ), r );
+
+   const S::Type z( S::mul( r, r ) );
+   const S::Type ps( S::fmadd( S::mul( builtinPolynomial<float>( z, -1.6666654611E-1F, 8.3321608736E-3F
+                                                                  , -1.9515295891E-4F ), z ), r, r ) );
+   const S::Type pc( S::add( S::fnmadd( z, S::set( 0.5F ), S::set( 1.0F ) )
+                           , S::mul( S::mul( builtinPolynomial<float>( z, 4.166664568298827E-2F
+                                                                        , -1.388731625493765E-3F
+                                                                        , 2.443315711809948E-5F ), z ), z ) ) );
+
+   // Quadrant q mod 4: bit 0 swaps sine and cosine, bit 1 flips the sign of the sine
+   const S::Type h( S::mul( q, S::set( 0.5F ) ) );
+   const S::Type q2( S::round( S::sub( h, S::set( 0.25F ) ) ) );
+   const S::Mask odd( S::neq( h, q2 ) );
+   const S::Type h2( S::mul( q2, S::set( 0.5F ) ) );
+   const S::Mask neg( S::neq( h2, S::round( S::sub( h2, S::set( 0.25F ) ) ) ) );
+   const S::Type flip( S::select( neg, S::set( -0.0F ), S::set( 0.0F ) ) );
+
+   if( cosine ) {
+      const S::Type sign( S::bitxor( flip, S::select( odd, S::set( -0.0F ), S::set( 0.0F ) ) ) );
+      return S::bitxor( S::select( odd, ps, pc ), sign );
+   }
+   else {
+      return S::bitxor( S::select( odd, pc, ps ), flip );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in SIMD kernel for \f$ \sin(x) \f$ and \f$ \cos(x) \f$ (double precision).
+// \ingroup simd
+//
+// \param x The vector of arguments.
+// \param cosine \a true for \f$ \cos(x) \f$, \a false for \f$ \sin(x) \f$.
+// \return The resulting vector.
+//
+// Three-part Cody-Waite reduction modulo \f$ \pi/2 \f$ followed by the Cephes minimax polynomials
+// on \f$ [-\pi/4,\pi/4] \f$. Maximum error: 2 ULP for \f$ |x| \le 2^{20} \f$. Vectors containing
+// larger arguments (including infinities) are evaluated elementwise by \c std::sin() and
+// \c std::cos(), respectively.
+*/
+BLAZE_ALWAYS_INLINE BuiltinSIMD<double>::Type
+   builtinSinCos( BuiltinSIMD<double>::Type x, bool cosine ) noexcept
+{
+   using S = BuiltinSIMD<double>;
+
+   if( S::any( S::gt( S::abs( x ), S::set( 1048576.0 ) ) ) ) {
+      return cosine ? builtinScalar<double>( x, []( double v ){ return std::cos( v ); } )
+                    : builtinScalar<double>( x, []( double v ){ return std::sin( v ); } );
+   }
+
+   const S::Type q( S::round( S::mul( x, S::set( 0.63661977236758134308 ) ) ) );
+   S::Type r( S::fnmadd( q, S::set( 1.57079625129699707031E0 ), x ) );
+   r = S::fnmadd( q, S::set( 7.54978941586159635335E-8 ), r );
+   r = S::fnmadd( q, S::set( 5.39030285815811905290E-15 ), r );
+
+   const S::Type z( S::mul( r, r ) );
+   const S::Type ps( S::fmadd( S::mul( builtinPolynomial<double>( z, -1.66666666666666307295E-1
+                                                                   , 8.33333333332211858878E-3
+                                                                   , -1.98412698295895385996E-4
+                                                                   , 2.75573136213857245213E-6
+                                                                   , -2.50507477628578072866E-8
+                                                                   , 1.58962301576546568060E-10 ), z ), r, r ) );
+   const S::Type pc( S::add( S::fnmadd( z, S::set( 0.5 ), S::set( 1.0 ) )
+                           , S::mul( S::mul( builtinPolynomial<double>( z, 4.16666666666665929218E-2
+                                                                         , -1.38888888888730564116E-3
+                                                                         , 2.48015872888517045348E-5
+                                                                         , -2.75573141792967388112E-7
+                                                                         , 2.08757008419747316778E-9
+                                                                         , -1.13585365213876817300E-11 ), z ), z ) ) );
+
+   // Quadrant q mod 4: bit 0 swaps sine and cosine, bit 1 flips the sign of the sine
+   const S::Type h( S::mul( q, S::set( 0.5 ) ) );
+   const S::Type q2( S::round( S::sub( h, S::set( 0.25 ) ) ) );
+   const S::Mask odd( S::neq( h, q2 ) );
+   const S::Type h2( S::mul( q2, S::set( 0.5 ) ) );
+   const S::Mask neg( S::neq( h2, S::round( S::sub( h2, S::set( 0.25 ) ) ) ) );
+   const S::Type flip( S::select( neg, S::set( -0.0 ), S::set( 0.0 ) ) );
+
+   if( cosine ) {
+      const S::Type sign( S::bitxor( flip, S::select( odd, S::set( -0.0 ), S::set( 0.0 ) ) ) );
+      return S::bitxor( S::select( odd, ps, pc ), sign );
+   }
+   else {
+      return S::bitxor( S::select( odd, pc, ps ), flip );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HYPERBOLIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in SIMD kernel for \f$ \tanh(x) \f$ (single precision).
+// \ingroup simd
+//
+// Odd degree 11 polynomial for \f$ |x| < 0.625 \f$ (Cephes) and \f$ 1 - 2/(e^{2|x|}+1) \f$
+// otherwise. Maximum error: 2 ULP.
+*/
+BLAZE_ALWAYS_INLINE BuiltinSIMD<float>::Type builtinTanh( BuiltinSIMD<float>::Type x ) noexcept
+{
+   using S = BuiltinSIMD<float>;
+
+   const S::Type a( S::abs( x ) );
+
+   const S::Type z( S::mul( x, x ) );
+   S::Type y( builtinPolynomial<float>( z, -3.33332819422E-1F, 1.33314422036E-1F, -5.37397155531E-2F
+                                         , 2.06390887954E-2F, -5.70498872745E-3F ) );
+   y = S::fmadd( S::mul( y, z ), x, x );
+
+   if( S::any( S::ge( a, S::set( 0.625F ) ) ) ) {
+      const S::Type e( builtinExp( S::add( a, a ) ) );
+      const S::Type t( S::sub( S::set( 1.0F ), S::div( S::set( 2.0F ), S::add( e, S::set( 1.0F ) ) ) ) );
+      y = S::select( S::lt( a, S::set( 0.625F ) ), y, S::bitxor( t, S::sign( x ) ) );
+   }
+
+   return y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in SIMD kernel for \f$ \tanh(x) \f$ (double precision).
+// \ingroup simd
+//
+// (3,3) rational approximation in \f$ x^2 \f$ for \f$ |x| < 0.625 \f$ (Cephes) and
+// \f$ 1 - 2/(e^{2|x|}+1) \f$ otherwise. Maximum error: 2 ULP.
+*/
+BLAZE_ALWAYS_INLINE BuiltinSIMD<double>::Type builtinTanh( BuiltinSIMD<double>::Type x ) noexcept
+{
+   using S = BuiltinSIMD<double>;
+
+   const S::Type a( S::abs( x ) );
+
+   const S::Type z( S::mul( x, x ) );
+   const S::Type p( builtinPolynomial<double>( z, -1.61468768441708447952E3, -9.92877231001918586564E1
+                                                , -9.64399179425052238628E-1 ) );
+   const S::Type q( builtinPolynomial<double>( z, 4.84406305325125486048E3, 2.23548839060100448583E3
+                                                , 1.12811678491632931402E2, 1.0 ) );
+   S::Type y( S::fmadd( S::mul( z, S::div( p, q ) ), x, x ) );
+
+   if( S::any( S::ge( a, S::set( 0.625 ) ) ) ) {
+      const S::Type e( builtinExp( S::add( a, a ) ) );
+      const S::Type t( S::sub( S::set( 1.0 ), S::div( S::set( 2.0 ), S::add( e, S::set( 1.0 ) ) ) ) );
+      y = S::select( S::lt( a, S::set( 0.625 ) ), y, S::bitxor( t, S::sign( x ) ) );
+   }
+
+   return y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in SIMD kernel for \f$ \mathrm{erf}(x) \f$ (single precision).
+// \ingroup simd
+//
+// Degree 11 odd polynomial for \f$ |x| < 0.875 \f$ and \f$ 1 - e^{-x^2} g(|x|) \f$ with a degree
+// 12 polynomial approximation of \f$ g(x) = e^{x^2} \mathrm{erfc}(x) \f$ on \f$ [0.875,4] \f$
+// otherwise (Chebyshev fits). Maximum error: 3 ULP.
+*/
+BLAZE_ALWAYS_INLINE BuiltinSIMD<float>::Type builtinErf( BuiltinSIMD<float>::Type x ) noexcept
+{
+   using S = BuiltinSIMD<float>;
+
+   const S::Type a( S::abs( x ) );
+
+   const S::Type z( S::mul( x, x ) );
+   const S::Type p( builtinPolynomial<float>( z, -3.76125545065844336E-01F, 1.12824965995863155E-01F
+                                               , -2.67929477778373094E-02F, 5.03437066320409563E-03F
+                                               , -6.21458536197713697E-04F ) );
+   S::Type y( S::fmadd( x, S::set( 1.12837915813321277E+00F ), S::mul( x, S::mul( z, p ) ) ) );
+
+   if( S::any( S::ge( a, S::set( 0.875F ) ) ) ) {
+      const S::Type b( S::min( S::set( 4.0F ), a ) );
+      const S::Type g( builtinPolynomial<float>( S::sub( b, S::set( 2.4375F ) )
+                                               , 2.15552479151177478E-01F, -7.75608101060554639E-02F
+                                               , 2.64979480658670830E-02F, -8.64828833185088582E-03F
+                                               , 2.70922558029112462E-03F, -8.16998098243960262E-04F
+                                               , 2.38427637667564272E-04F, -6.85485747655452388E-05F
+                                               , 1.87865584264043774E-05F, -4.25186276846331722E-06F
+                                               , 1.12605914399097034E-06F, -5.39859212578597266E-07F
+                                               , 1.31564568469326366E-07F ) );
+      const S::Type e( builtinExp( S::mul( b, S::sub( S::set( 0.0F ), b ) ) ) );
+      const S::Type t( S::fnmadd( e, g, S::set( 1.0F ) ) );
+      y = S::select( S::lt( a, S::set( 0.875F ) ), y, S::bitxor( t, S::sign( x ) ) );
+   }
+
+   return y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Built-in SIMD kernel for \f$ \mathrm{erf}(x) \f$ (double precision).
+// \ingroup simd
+//
+// Degree 21 odd polynomial for \f$ |x| < 0.875 \f$ and \f$ 1 - e^{-x^2} g(|x|) \f$ with a degree
+// 28 polynomial approximation of \f$ g(x) = e^{x^2} \mathrm{erfc}(x) \f$ on \f$ [0.875,6] \f$
+// otherwise (Chebyshev fits). Maximum error: 2 ULP.
+*/
+BLAZE_ALWAYS_INLINE BuiltinSIMD<double>::Type builtinErf( BuiltinSIMD<double>::Type x ) noexcept
+{
+   using S = BuiltinSIMD<double>;
+
+   const S::Type a( S::abs( x ) );
+
+   const S::Type z( S::mul( x, x ) );
+   const S::Type p( builtinPolynomial<double>( z, -3.76126389031830377E-01, 1.12837916709178296E-01
+                                                , -2.68661706375141335E-02, 5.22397754555943387E-03
+                                                , -8.54832212819232862E-04, 1.20551455236329066E-04
+                                                , -1.49210231542616704E-05, 1.63882703781068953E-06
+                                                , -1.56247358382071268E-07, 1.04710345569350361E-08 ) );
+   S::Type y( S::fmadd( x, S::set( 1.12837916709551256E+00 ), S::mul( x, S::mul( z, p ) ) ) );
+
+   if( S::any( S::ge( a, S::set( 0.875 ) ) ) ) {
+      const S::Type b( S::min( S::set( 6.0 ), a ) );
+      const S::Type g( builtinPolynomial<double>( S::sub( b, S::set( 3.4375 ) )
+                                                , 1.57918686990727614E-01, -4.26881940342600866E-02
+                                                , 1.11780199979579307E-02, -2.84250019419031484E-03
+                                                , 7.03462790221521649E-04, -1.69738741096869345E-04
+                                                , 3.99952892020809630E-05, -9.21569563503195100E-06
+                                                , 2.07908393734218881E-06, -4.59743120037807423E-07
+                                                , 9.97432902122625804E-08, -2.12502338125317765E-08
+                                                , 4.44936190990749232E-09, -9.16145379448256243E-10
+                                                , 1.85671834983980791E-10, -3.70989418008037381E-11
+                                                , 7.29392852109614872E-12, -1.39893938408407642E-12
+                                                , 2.67880499375544171E-13, -5.42528093011481191E-14
+                                                , 1.00277218273403437E-14, -1.19740454132898989E-15
+                                                , 2.27950749048522913E-16, -1.19010492990315751E-16
+                                                , 2.02290211737475509E-17, 2.64362890188434219E-18
+                                                , -4.13212432682791839E-19, -2.19886122446410272E-19
+                                                , 3.63598131902609992E-20 ) );
+      const S::Type e( builtinExp( S::mul( b, S::sub( S::set( 0.0 ), b ) ) ) );
+      const S::Type t( S::fnmadd( e, g, S::set( 1.0 ) ) );
+      y = S::select( S::lt( a, S::set( 0.875 ) ), y, S::bitxor( t, S::sign( x ) ) );
+   }
+
+   return y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
@@ -44,6 +44,7 @@
 #  include <sleef.h>
 #endif
 #include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/BuiltinMath.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
 
@@ -64,6 +65,7 @@ namespace blaze {
 // \return The resulting vector.
 //
 // This operation is only available via the SVML or SLEEF for SSE, AVX, MIC, and AVX-512.
+// Without these libraries the built-in kernels are used for SSE2, AVX2, and AVX-512.
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDfloat cos( const SIMDf32<T>& a ) noexcept
@@ -99,6 +101,10 @@ BLAZE_ALWAYS_INLINE const SIMDfloat cos( const SIMDf32<T>& a ) noexcept
 {
   return SIMDfloat{ xsimd::cos( xsimd::batch<float>{ (*a).eval().value } ).data };
 }
+#elif BLAZE_BUILTIN_SIMD_MATH_MODE
+{
+   return builtinSinCos( (*a).eval().value, true );
+}
 #else
 = delete;
 #endif
@@ -121,6 +127,7 @@ BLAZE_ALWAYS_INLINE const SIMDfloat cos( const SIMDf32<T>& a ) noexcept
 // \return The resulting vector.
 //
 // This operation is only available via the SVML or SLEEF for SSE, AVX, MIC, and AVX-512.
+// Without these libraries the built-in kernels are used for SSE2, AVX2, and AVX-512.
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDdouble cos( const SIMDf64<T>& a ) noexcept
@@ -156,6 +163,10 @@ BLAZE_ALWAYS_INLINE const SIMDdouble cos( const SIMDf64<T>& a ) noexcept
 {
   return SIMDdouble{ xsimd::cos( xsimd::batch<double>{ (*a).eval().value } ).data };
 }
+#elif BLAZE_BUILTIN_SIMD_MATH_MODE
+{
+   return builtinSinCos( (*a).eval().value, true );
+}
 #else
 = delete;
 #endif
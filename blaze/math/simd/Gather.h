@@ -0,0 +1,166 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Gather.h
+//  \brief Header file for the SIMD gather functionality
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SIMD_GATHER_H_
+#define _BLAZE_MATH_SIMD_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values from arbitrary positions.
+// \ingroup simd
+//
+// \param address The base address of the 'float' values to be gathered.
+// \param indices The aligned array of offsets relative to the base address.
+// \return The gathered vector of 'float' values.
+//
+// This function loads the 'float' values at the positions \a address[indices[0]],
+// \a address[indices[1]], ... into a single SIMD vector. The given array of indices must contain
+// one index per SIMD element and must be aligned according to the enabled instruction set. In
+// case AVX2 or AVX-512 is available the values are loaded by means of hardware gather
+// instructions, else the vector is assembled from scalar loads. The AVX-512 gathers use a zeroed
+// source vector instead of an undefined one, which avoids false positive warnings about
+// uninitialized values.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat gather( const float* address, const size_t* indices ) noexcept
+{
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == sizeof( long long ) );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( indices ), "Invalid alignment detected" );
+
+#if BLAZE_AVX512F_MODE
+   const __m512i idx1( _mm512_load_si512( indices     ) );
+   const __m512i idx2( _mm512_load_si512( indices+8UL ) );
+   const __m256 lo( _mm512_mask_i64gather_ps( _mm256_setzero_ps(), 0xFF, idx1, address, 4 ) );
+   const __m256 hi( _mm512_mask_i64gather_ps( _mm256_setzero_ps(), 0xFF, idx2, address, 4 ) );
+   const __m512d tmp( _mm512_castpd256_pd512( _mm256_castps_pd( lo ) ) );
+   return _mm512_castpd_ps( _mm512_maskz_insertf64x4( 0xFF, tmp, _mm256_castps_pd( hi ), 1 ) );
+#elif BLAZE_MIC_MODE
+   return _mm512_set_ps( address[indices[15]], address[indices[14]], address[indices[13]],
+                         address[indices[12]], address[indices[11]], address[indices[10]],
+                         address[indices[ 9]], address[indices[ 8]], address[indices[ 7]],
+                         address[indices[ 6]], address[indices[ 5]], address[indices[ 4]],
+                         address[indices[ 3]], address[indices[ 2]], address[indices[ 1]],
+                         address[indices[ 0]] );
+#elif BLAZE_AVX2_MODE
+   const __m256i idx1( _mm256_load_si256( reinterpret_cast<const __m256i*>( indices     ) ) );
+   const __m256i idx2( _mm256_load_si256( reinterpret_cast<const __m256i*>( indices+4UL ) ) );
+   const __m128 lo( _mm256_i64gather_ps( address, idx1, 4 ) );
+   const __m128 hi( _mm256_i64gather_ps( address, idx2, 4 ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( lo ), hi, 1 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_ps( address[indices[7]], address[indices[6]], address[indices[5]],
+                         address[indices[4]], address[indices[3]], address[indices[2]],
+                         address[indices[1]], address[indices[0]] );
+#elif BLAZE_SSE_MODE
+   return _mm_set_ps( address[indices[3]], address[indices[2]],
+                      address[indices[1]], address[indices[0]] );
+#else
+   return address[indices[0]];
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values from arbitrary positions.
+// \ingroup simd
+//
+// \param address The base address of the 'double' values to be gathered.
+// \param indices The aligned array of offsets relative to the base address.
+// \return The gathered vector of 'double' values.
+//
+// This function loads the 'double' values at the positions \a address[indices[0]],
+// \a address[indices[1]], ... into a single SIMD vector. The given array of indices must contain
+// one index per SIMD element and must be aligned according to the enabled instruction set. In
+// case AVX2 or AVX-512 is available the values are loaded by means of hardware gather
+// instructions, else the vector is assembled from scalar loads.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble
+   gather( const double* address, const size_t* indices ) noexcept
+{
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == sizeof( long long ) );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( indices ), "Invalid alignment detected" );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_mask_i64gather_pd( _mm512_setzero_pd(), 0xFF, _mm512_load_si512( indices ), address, 8 );
+#elif BLAZE_MIC_MODE
+   return _mm512_set_pd( address[indices[7]], address[indices[6]], address[indices[5]],
+                         address[indices[4]], address[indices[3]], address[indices[2]],
+                         address[indices[1]], address[indices[0]] );
+#elif BLAZE_AVX2_MODE
+   const __m256i idx( _mm256_load_si256( reinterpret_cast<const __m256i*>( indices ) ) );
+   return _mm256_i64gather_pd( address, idx, 8 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_pd( address[indices[3]], address[indices[2]],
+                         address[indices[1]], address[indices[0]] );
+#elif BLAZE_SSE2_MODE
+   return _mm_set_pd( address[indices[1]], address[indices[0]] );
+#else
+   return address[indices[0]];
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
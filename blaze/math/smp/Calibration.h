@@ -0,0 +1,414 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Calibration.h
+//  \brief Header file for the calibration of the SMP thresholds
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_CALIBRATION_H_
+#define _BLAZE_MATH_SMP_CALIBRATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Thresholds.h>
+
+#if BLAZE_USE_RUNTIME_SMP_THRESHOLDS
+
+#include <algorithm>
+#include <string>
+#include <blaze/math/BatchMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Div.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/Schur.h>
+#include <blaze/math/functors/Sub.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/util/timing/WcTimer.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY CALIBRATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Measures the runtime of a single execution of the given kernel.
+// \ingroup smp
+//
+// \param kernel The kernel to be measured.
+// \return The minimum runtime of a single execution of the kernel (in seconds).
+//
+// The number of repetitions per measurement is chosen such that a single measurement takes at
+// least one millisecond. The result is the minimum of three such measurements.
+*/
+template< typename Kernel >  // Type of the kernel
+double measureSMPKernel( Kernel& kernel )
+{
+   timing::WcTimer timer;
+   size_t reps( 1UL );
+
+   while( true ) {
+      timer.start();
+      for( size_t rep=0UL; rep<reps; ++rep ) {
+         kernel();
+      }
+      timer.end();
+      if( timer.last() >= 1E-3 || reps >= 1000000UL )
+         break;
+      reps *= 2UL;
+   }
+
+   double time( timer.last() );
+
+   for( size_t trial=1UL; trial<3UL; ++trial ) {
+      timer.start();
+      for( size_t rep=0UL; rep<reps; ++rep ) {
+         kernel();
+      }
+      timer.end();
+      time = std::min( time, timer.last() );
+   }
+
+   return time / reps;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calibrates a single SMP threshold.
+// \ingroup smp
+//
+// \param name The name of the SMP threshold (as for instance "BLAZE_SMP_DVECASSIGN_THRESHOLD").
+// \param first The smallest problem size to be tested.
+// \param last The largest problem size to be tested.
+// \param factory Factory function creating the kernel for a given problem size.
+// \param metric Function mapping a problem size to the quantity compared with the threshold.
+// \return void
+//
+// This function compares the serial and the parallel execution of the kernel created by the
+// given factory for the problem sizes \a first, 2*first, 4*first, ..., \a last. The threshold
+// is set between the largest problem size for which the parallel execution does not pay off
+// and the smallest problem size for which it is at least 10% faster than the serial execution.
+// In case the parallel execution does not pay off for any of the tested problem sizes, the
+// threshold keeps its previous value.
+*/
+template< typename Factory   // Type of the kernel factory
+        , typename Metric >  // Type of the threshold metric
+void calibrateSMPThreshold( const std::string& name, size_t first, size_t last,
+                            Factory factory, Metric metric )
+{
+   const size_t previous( getSMPThreshold( name ) );
+   size_t losing( 0UL );
+
+   for( size_t n=first; n<=last; n*=2UL )
+   {
+      auto kernel( factory( n ) );
+
+      double serialTime( 0.0 );
+      BLAZE_SERIAL_SECTION {
+         serialTime = measureSMPKernel( kernel );
+      }
+
+      setSMPThreshold( name, 0UL );
+      const double parallelTime( measureSMPKernel( kernel ) );
+
+      if( parallelTime < 0.9*serialTime ) {
+         const size_t winning( metric( n ) );
+         setSMPThreshold( name, ( losing == 0UL )?( winning ):( ( losing + winning ) / 2UL ) );
+         return;
+      }
+
+      losing = metric( n );
+   }
+
+   setSMPThreshold( name, previous );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calibrates the SMP threshold of an element-wise dense vector/dense vector operation.
+// \ingroup smp
+//
+// \param name The name of the SMP threshold.
+// \param op The element-wise operation.
+// \return void
+*/
+template< typename OP >  // Type of the element-wise operation
+void calibrateDVecDVecThreshold( const std::string& name, OP op )
+{
+   calibrateSMPThreshold( name, 1024UL, 4194304UL,
+      [op]( size_t n ) {
+         return [op,a=DynamicVector<double>( n, 1.0 ),b=DynamicVector<double>( n, 2.0 ),
+                 c=DynamicVector<double>( n )]() mutable { c = op( a, b ); };
+      },
+      []( size_t n ) { return n; } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calibrates the SMP threshold of an element-wise dense matrix/dense matrix operation.
+// \ingroup smp
+//
+// \param name The name of the SMP threshold.
+// \param op The element-wise operation.
+// \return void
+*/
+template< bool SO        // Storage order of the right-hand side matrix
+        , typename OP >  // Type of the element-wise operation
+void calibrateDMatDMatThreshold( const std::string& name, OP op )
+{
+   calibrateSMPThreshold( name, 16UL, 2048UL,
+      [op]( size_t n ) {
+         return [op,A=DynamicMatrix<double,rowMajor>( n, n, 1.0 ),
+                 B=DynamicMatrix<double,SO>( n, n, 2.0 ),
+                 C=DynamicMatrix<double,rowMajor>( n, n )]() mutable { C = op( A, B ); };
+      },
+      []( size_t n ) { return n*n; } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calibrates the SMP threshold of a dense matrix/dense matrix multiplication.
+// \ingroup smp
+//
+// \param name The name of the SMP threshold.
+// \return void
+*/
+template< bool SO1     // Storage order of the left-hand side matrix
+        , bool SO2 >  // Storage order of the right-hand side matrix
+void calibrateDMatDMatMultThreshold( const std::string& name )
+{
+   calibrateSMPThreshold( name, 8UL, 512UL,
+      []( size_t n ) {
+         return [A=DynamicMatrix<double,SO1>( n, n, 1.0 ),
+                 B=DynamicMatrix<double,SO2>( n, n, 2.0 ),
+                 C=DynamicMatrix<double,SO1>( n, n )]() mutable { C = A * B; };
+      },
+      []( size_t n ) { return n*n; } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calibrates the SMP threshold of a dense matrix/dense vector multiplication.
+// \ingroup smp
+//
+// \param name The name of the SMP threshold.
+// \return void
+*/
+template< bool SO >  // Storage order of the matrix
+void calibrateDMatDVecMultThreshold( const std::string& name )
+{
+   calibrateSMPThreshold( name, 16UL, 2048UL,
+      []( size_t n ) {
+         return [A=DynamicMatrix<double,SO>( n, n, 1.0 ),
+                 x=DynamicVector<double,columnVector>( n, 2.0 ),
+                 y=DynamicVector<double,columnVector>( n )]() mutable { y = A * x; };
+      },
+      []( size_t n ) { return n; } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calibrates the SMP threshold of a transpose dense vector/dense matrix multiplication.
+// \ingroup smp
+//
+// \param name The name of the SMP threshold.
+// \return void
+*/
+template< bool SO >  // Storage order of the matrix
+void calibrateTDVecDMatMultThreshold( const std::string& name )
+{
+   calibrateSMPThreshold( name, 16UL, 2048UL,
+      []( size_t n ) {
+         return [A=DynamicMatrix<double,SO>( n, n, 1.0 ),
+                 x=DynamicVector<double,rowVector>( n, 2.0 ),
+                 y=DynamicVector<double,rowVector>( n )]() mutable { y = x * A; };
+      },
+      []( size_t n ) { return n; } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SMP THRESHOLD CALIBRATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Calibrates the SMP thresholds for the current machine and number of threads.
+// \ingroup smp
+//
+// \return void
+// \exception std::runtime_error Invalid nested serial section.
+//
+// This function determines the break-even points between the serial and the parallel execution
+// of the most important dense vector and dense matrix operations by timing both executions for
+// a geometrically growing sequence of problem sizes. The according SMP thresholds are set to
+// the measured break-even points. In case a parallel execution does not pay off for any of the
+// tested problem sizes, the according threshold keeps its current value. The thresholds of all
+// sparse operations and of the row-wise and column-wise reductions are not calibrated and also
+// keep their current values. The resulting thresholds can be stored in a tuning file via the
+// saveSMPThresholds() function:
+
+   \code
+   blaze::calibrateSMPThresholds();
+   blaze::saveSMPThresholds( "thresholds.txt" );
+   \endcode
+
+// In case only a single thread is available, all thresholds keep their current values. Note
+// that the calibration takes several seconds and must not be called within a serial section
+// or while any parallel operation is executed. Also note that this function is only available
+// in case the \c BLAZE_USE_RUNTIME_SMP_THRESHOLDS compilation switch is set to 1.
+*/
+inline void calibrateSMPThresholds()
+{
+   if( getNumThreads() <= 1UL )
+      return;
+
+   calibrateSMPThreshold( "BLAZE_SMP_DVECASSIGN_THRESHOLD", 1024UL, 4194304UL,
+      []( size_t n ) {
+         return [a=DynamicVector<double>( n, 1.0 ),
+                 c=DynamicVector<double>( n )]() mutable { c = a; };
+      },
+      []( size_t n ) { return n; } );
+
+   calibrateSMPThreshold( "BLAZE_SMP_DVECSCALARMULT_THRESHOLD", 1024UL, 4194304UL,
+      []( size_t n ) {
+         return [a=DynamicVector<double>( n, 1.0 ),
+                 c=DynamicVector<double>( n )]() mutable { c = a * 2.0; };
+      },
+      []( size_t n ) { return n; } );
+
+   calibrateDVecDVecThreshold( "BLAZE_SMP_DVECDVECADD_THRESHOLD" , Add () );
+   calibrateDVecDVecThreshold( "BLAZE_SMP_DVECDVECSUB_THRESHOLD" , Sub () );
+   calibrateDVecDVecThreshold( "BLAZE_SMP_DVECDVECMULT_THRESHOLD", Mult() );
+   calibrateDVecDVecThreshold( "BLAZE_SMP_DVECDVECDIV_THRESHOLD" , Div () );
+
+   calibrateSMPThreshold( "BLAZE_SMP_DVECDVECOUTER_THRESHOLD", 16UL, 2048UL,
+      []( size_t n ) {
+         return [a=DynamicVector<double,columnVector>( n, 1.0 ),
+                 b=DynamicVector<double,rowVector>( n, 2.0 ),
+                 C=DynamicMatrix<double,rowMajor>( n, n )]() mutable { C = a * b; };
+      },
+      []( size_t n ) { return n*n; } );
+
+   calibrateDMatDVecMultThreshold<rowMajor>   ( "BLAZE_SMP_DMATDVECMULT_THRESHOLD"   );
+   calibrateDMatDVecMultThreshold<columnMajor>( "BLAZE_SMP_TDMATDVECMULT_THRESHOLD"  );
+   calibrateTDVecDMatMultThreshold<rowMajor>   ( "BLAZE_SMP_TDVECDMATMULT_THRESHOLD"  );
+   calibrateTDVecDMatMultThreshold<columnMajor>( "BLAZE_SMP_TDVECTDMATMULT_THRESHOLD" );
+
+   calibrateSMPThreshold( "BLAZE_SMP_DMATASSIGN_THRESHOLD", 16UL, 2048UL,
+      []( size_t n ) {
+         return [A=DynamicMatrix<double>( n, n, 1.0 ),
+                 C=DynamicMatrix<double>( n, n )]() mutable { C = A; };
+      },
+      []( size_t n ) { return n*n; } );
+
+   calibrateSMPThreshold( "BLAZE_SMP_DMATSCALARMULT_THRESHOLD", 16UL, 2048UL,
+      []( size_t n ) {
+         return [A=DynamicMatrix<double>( n, n, 1.0 ),
+                 C=DynamicMatrix<double>( n, n )]() mutable { C = A * 2.0; };
+      },
+      []( size_t n ) { return n*n; } );
+
+   calibrateDMatDMatThreshold<rowMajor>   ( "BLAZE_SMP_DMATDMATADD_THRESHOLD"   , Add  () );
+   calibrateDMatDMatThreshold<columnMajor>( "BLAZE_SMP_DMATTDMATADD_THRESHOLD"  , Add  () );
+   calibrateDMatDMatThreshold<rowMajor>   ( "BLAZE_SMP_DMATDMATSUB_THRESHOLD"   , Sub  () );
+   calibrateDMatDMatThreshold<columnMajor>( "BLAZE_SMP_DMATTDMATSUB_THRESHOLD"  , Sub  () );
+   calibrateDMatDMatThreshold<rowMajor>   ( "BLAZE_SMP_DMATDMATSCHUR_THRESHOLD" , Schur() );
+   calibrateDMatDMatThreshold<columnMajor>( "BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD", Schur() );
+
+   calibrateDMatDMatMultThreshold<rowMajor   ,rowMajor>   ( "BLAZE_SMP_DMATDMATMULT_THRESHOLD"   );
+   calibrateDMatDMatMultThreshold<rowMajor   ,columnMajor>( "BLAZE_SMP_DMATTDMATMULT_THRESHOLD"  );
+   calibrateDMatDMatMultThreshold<columnMajor,rowMajor>   ( "BLAZE_SMP_TDMATDMATMULT_THRESHOLD"  );
+   calibrateDMatDMatMultThreshold<columnMajor,columnMajor>( "BLAZE_SMP_TDMATTDMATMULT_THRESHOLD" );
+
+   calibrateSMPThreshold( "BLAZE_SMP_DVECREDUCE_THRESHOLD", 1024UL, 4194304UL,
+      []( size_t n ) {
+         return [a=DynamicVector<double>( n, 1.0 ),s=0.0]() mutable { s += sum( a ); };
+      },
+      []( size_t n ) { return n; } );
+
+   calibrateSMPThreshold( "BLAZE_SMP_DMATFULLREDUCE_THRESHOLD", 16UL, 2048UL,
+      []( size_t n ) {
+         return [A=DynamicMatrix<double>( n, n, 1.0 ),s=0.0]() mutable { s += sum( A ); };
+      },
+      []( size_t n ) { return n*n; } );
+
+   calibrateSMPThreshold( "BLAZE_SMP_BATCH_THRESHOLD", 16UL, 262144UL,
+      []( size_t n ) {
+         return [A=BatchMatrix<double,4UL,4UL>( n, 1.0 ),C=BatchMatrix<double,4UL,4UL>()]() mutable {
+            batchMult( C, A, A );
+         };
+      },
+      []( size_t n ) { return n*64UL; } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
+
+#endif
@@ -0,0 +1,468 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/SpGEMM.h
+//  \brief Header file for the SMP sparse matrix/sparse matrix multiplication kernels
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_SPGEMM_H_
+#define _BLAZE_MATH_SMP_SPGEMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SPGEMMACCUMULATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row accumulator of the SMP sparse matrix/sparse matrix multiplication.
+// \ingroup smp
+//
+// The SpGEMMAccumulator class template accumulates the contributions to a single row (or column)
+// of a sparse matrix/sparse matrix multiplication \f$ C=X*Y \f$, i.e. the sum of the rows of
+// \a Y selected by the non-zero elements of the corresponding row of \a X. For every row the
+// accumulator chooses between two strategies based on the upper bound of the number of
+// non-zero elements of the resulting row:
+//
+//  - dense rows are accumulated in a dense sparse accumulator (SPA), which provides constant
+//    time access to every index at the cost of an array spanning the entire row,
+//  - sparse rows are accumulated in an open-addressing hash table sized according to the upper
+//    bound, which keeps the working set of the row small and cache-resident.
+//
+// In case the dense accumulator fits into the L2 cache (see <tt><blaze/config/CacheSize.h></tt>)
+// it is used for all rows.
+//
+// Every thread of the SMP multiplication uses its own accumulator, which is reused for all rows
+// of the thread. The accumulator is used in two passes: the symbolic pass (count()) determines
+// the number of non-zero elements of every row, which allows to allocate the result in a single
+// step, and the numeric pass (compute()) appends the elements of every row directly into the
+// preallocated result.
+*/
+template< typename Type >  // Data type of the accumulated elements
+class SpGEMMAccumulator
+{
+ public:
+   //**Constructor*********************************************************************************
+   explicit inline SpGEMMAccumulator( size_t n );
+   //**********************************************************************************************
+
+   //**Accumulation functions**********************************************************************
+   template< typename MT1, typename MT2 >
+   inline size_t count( const MT1& X, const MT2& Y, size_t i );
+
+   template< bool SO, typename MT, typename MT1, typename MT2 >
+   inline void compute( MT& C, const MT1& X, const MT2& Y, size_t i );
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   template< typename MT1, typename MT2 >
+   inline bool prepare( const MT1& X, const MT2& Y, size_t i );
+
+   inline size_t lookup( size_t j ) const noexcept;
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   static constexpr size_t unused     = ~size_t(0);  //!< Marker for unused hash table entries.
+   static constexpr size_t denseRatio = 16UL;        //!< Minimum density of dense rows (1/ratio).
+
+   size_t n_;                     //!< The number of indices of a row.
+   size_t stamp_;                 //!< The stamp of the current dense row.
+   size_t mask_;                  //!< The mask of the current hash table.
+   std::vector<size_t> marker_;   //!< The stamps of the dense accumulator.
+   std::vector<Type>   values_;   //!< The values of the dense accumulator.
+   std::vector<size_t> keys_;     //!< The keys of the hash table.
+   std::vector<Type>   entries_;  //!< The values of the hash table.
+   std::vector<size_t> indices_;  //!< The touched indices or hash table slots.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the SpGEMMAccumulator class template.
+//
+// \param n The number of indices of a row of the result.
+//
+// The dense accumulator and the hash table are allocated on demand.
+*/
+template< typename Type >  // Data type of the accumulated elements
+inline SpGEMMAccumulator<Type>::SpGEMMAccumulator( size_t n )
+   : n_      ( n   )  // The number of indices of a row
+   , stamp_  ( 0UL )  // The stamp of the current dense row
+   , mask_   ( 0UL )  // The mask of the current hash table
+   , marker_ ()       // The stamps of the dense accumulator
+   , values_ ()       // The values of the dense accumulator
+   , keys_   ()       // The keys of the hash table
+   , entries_()       // The values of the hash table
+   , indices_()       // The touched indices or hash table slots
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Prepares the accumulator for the given row.
+//
+// \param X The left-hand side operand of the multiplication.
+// \param Y The right-hand side operand of the multiplication.
+// \param i The index of the row.
+// \return \a true in case the dense accumulator is used, \a false if the hash table is used.
+*/
+template< typename Type >  // Data type of the accumulated elements
+template< typename MT1     // Type of the left-hand side operand
+        , typename MT2 >   // Type of the right-hand side operand
+inline bool SpGEMMAccumulator<Type>::prepare( const MT1& X, const MT2& Y, size_t i )
+{
+   size_t bound( 0UL );
+
+   const auto xend( X.end(i) );
+   for( auto x=X.begin(i); x!=xend; ++x ) {
+      bound += Y.nonZeros( x->index() );
+   }
+
+   indices_.clear();
+
+   if( n_*( sizeof(Type) + sizeof(size_t) ) <= l2CacheSize || bound*denseRatio >= n_ )
+   {
+      if( marker_.size() < n_ ) {
+         marker_.resize( n_, 0UL );
+      }
+      ++stamp_;
+      return true;
+   }
+
+   size_t capacity( 16UL );
+   while( capacity < 2UL*bound ) {
+      capacity *= 2UL;
+   }
+
+   if( keys_.size() < capacity ) {
+      keys_.resize( capacity, size_t( unused ) );
+   }
+
+   mask_ = capacity - 1UL;
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the hash table slot of the given index.
+//
+// \param j The index to be looked up.
+// \return The slot holding the index or the first unused slot of its probe sequence.
+*/
+template< typename Type >  // Data type of the accumulated elements
+inline size_t SpGEMMAccumulator<Type>::lookup( size_t j ) const noexcept
+{
+   size_t h( ( j * 107UL ) & mask_ );
+   while( keys_[h] != j && keys_[h] != unused ) {
+      h = ( h + 1UL ) & mask_;
+   }
+   return h;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symbolic pass: Counts the non-zero elements of a row of the multiplication.
+//
+// \param X The left-hand side operand of the multiplication.
+// \param Y The right-hand side operand of the multiplication.
+// \param i The index of the row.
+// \return The number of non-zero elements of the \a i-th row of \f$ X*Y \f$.
+*/
+template< typename Type >  // Data type of the accumulated elements
+template< typename MT1     // Type of the left-hand side operand
+        , typename MT2 >   // Type of the right-hand side operand
+inline size_t SpGEMMAccumulator<Type>::count( const MT1& X, const MT2& Y, size_t i )
+{
+   const bool dense( prepare( X, Y, i ) );
+   size_t nonzeros( 0UL );
+
+   const auto xend( X.end(i) );
+
+   if( dense )
+   {
+      for( auto x=X.begin(i); x!=xend; ++x ) {
+         const auto yend( Y.end( x->index() ) );
+         for( auto y=Y.begin( x->index() ); y!=yend; ++y ) {
+            if( marker_[y->index()] != stamp_ ) {
+               marker_[y->index()] = stamp_;
+               ++nonzeros;
+            }
+         }
+      }
+   }
+   else
+   {
+      for( auto x=X.begin(i); x!=xend; ++x ) {
+         const auto yend( Y.end( x->index() ) );
+         for( auto y=Y.begin( x->index() ); y!=yend; ++y ) {
+            const size_t h( lookup( y->index() ) );
+            if( keys_[h] == unused ) {
+               keys_[h] = y->index();
+               indices_.push_back( h );
+            }
+         }
+      }
+
+      nonzeros = indices_.size();
+
+      for( size_t h : indices_ ) {
+         keys_[h] = unused;
+      }
+   }
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric pass: Computes a row of the multiplication and appends it to the result.
+//
+// \param C The target compressed matrix with sufficient capacity for the row.
+// \param X The left-hand side operand of the multiplication.
+// \param Y The right-hand side operand of the multiplication.
+// \param i The index of the row.
+// \return void
+//
+// This function computes the \a i-th row of \f$ X*Y \f$ and appends all non-default elements
+// to the \a i-th row of \a C. In case \a SO is set to \a true, the row represents a column of
+// a column-major result \f$ C=A*B \f$ with \f$ X=B \f$ and \f$ Y=A \f$, i.e. the products are
+// formed in reversed order and the elements are appended to the \a i-th column of \a C.
+*/
+template< typename Type >  // Data type of the accumulated elements
+template< bool SO          // Storage order of the target matrix
+        , typename MT      // Type of the target matrix
+        , typename MT1     // Type of the left-hand side operand
+        , typename MT2 >   // Type of the right-hand side operand
+inline void SpGEMMAccumulator<Type>::compute( MT& C, const MT1& X, const MT2& Y, size_t i )
+{
+   const bool dense( prepare( X, Y, i ) );
+
+   const auto xend( X.end(i) );
+
+   if( dense )
+   {
+      if( values_.size() < n_ ) {
+         values_.resize( n_ );
+      }
+
+      for( auto x=X.begin(i); x!=xend; ++x ) {
+         const auto yend( Y.end( x->index() ) );
+         for( auto y=Y.begin( x->index() ); y!=yend; ++y ) {
+            const size_t j( y->index() );
+            if( marker_[j] != stamp_ ) {
+               marker_[j] = stamp_;
+               values_[j] = ( SO )?( y->value() * x->value() ):( x->value() * y->value() );
+               indices_.push_back( j );
+            }
+            else {
+               values_[j] += ( SO )?( y->value() * x->value() ):( x->value() * y->value() );
+            }
+         }
+      }
+
+      if( 4UL*indices_.size() < n_ ) {
+         std::sort( indices_.begin(), indices_.end() );
+         for( size_t j : indices_ ) {
+            if( !isDefault( values_[j] ) )
+               C.append( ( SO ? j : i ), ( SO ? i : j ), values_[j] );
+         }
+      }
+      else {
+         for( size_t j=0UL; j<n_; ++j ) {
+            if( marker_[j] == stamp_ && !isDefault( values_[j] ) )
+               C.append( ( SO ? j : i ), ( SO ? i : j ), values_[j] );
+         }
+      }
+   }
+   else
+   {
+      if( entries_.size() < keys_.size() ) {
+         entries_.resize( keys_.size() );
+      }
+
+      for( auto x=X.begin(i); x!=xend; ++x ) {
+         const auto yend( Y.end( x->index() ) );
+         for( auto y=Y.begin( x->index() ); y!=yend; ++y ) {
+            const size_t h( lookup( y->index() ) );
+            if( keys_[h] == unused ) {
+               keys_[h] = y->index();
+               entries_[h] = ( SO )?( y->value() * x->value() ):( x->value() * y->value() );
+               indices_.push_back( y->index() );
+            }
+            else {
+               entries_[h] += ( SO )?( y->value() * x->value() ):( x->value() * y->value() );
+            }
+         }
+      }
+
+      std::sort( indices_.begin(), indices_.end() );
+
+      for( size_t& j : indices_ ) {
+         const size_t h( lookup( j ) );
+         if( !isDefault( entries_[h] ) )
+            C.append( ( SO ? j : i ), ( SO ? i : j ), entries_[h] );
+         j = h;
+      }
+
+      for( size_t h : indices_ ) {
+         keys_[h] = unused;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPGEMM BLOCK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symbolic pass of the SMP sparse matrix/sparse matrix multiplication for a block of rows.
+// \ingroup smp
+//
+// \param nonzeros The number of non-zero elements per row of the result.
+// \param X The left-hand side operand of the multiplication.
+// \param Y The right-hand side operand of the multiplication.
+// \param n The number of indices of a row of the result.
+// \param index The index of the first row of the block.
+// \param size The number of rows of the block.
+// \return void
+//
+// This function determines the number of non-zero elements of the rows \f$[index..index+size-1]\f$
+// of the multiplication \f$ X*Y \f$. Since every block writes to its own range of \a nonzeros,
+// several disjoint blocks can be processed concurrently.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the result
+        , typename MT1    // Type of the left-hand side operand
+        , typename MT2 >  // Type of the right-hand side operand
+void countSpGEMMBlock( std::vector<size_t>& nonzeros, const MT1& X, const MT2& Y,
+                       size_t n, size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( index + size <= nonzeros.size(), "Invalid block specification" );
+
+   SpGEMMAccumulator<Type> accumulator( n );
+
+   for( size_t i=index; i<index+size; ++i ) {
+      nonzeros[i] = accumulator.count( X, Y, i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric pass of the SMP sparse matrix/sparse matrix multiplication for a block of rows.
+// \ingroup smp
+//
+// \param C The preallocated compressed matrix holding the result.
+// \param X The left-hand side operand of the multiplication.
+// \param Y The right-hand side operand of the multiplication.
+// \param index The index of the first row (column) of the block.
+// \param size The number of rows (columns) of the block.
+// \return void
+//
+// This function computes the rows (in case of a row-major result) or columns (in case of a
+// column-major result) \f$[index..index+size-1]\f$ of the multiplication and appends them
+// directly to the given compressed matrix. It requires the capacity of each row (column) of
+// \a C to be set up according to the results of the symbolic pass (see countSpGEMMBlock()).
+// Since every row (column) is written via its own begin/end pointers, several disjoint blocks
+// can be computed concurrently.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the compressed matrix
+        , bool SO         // Storage order of the compressed matrix
+        , typename Tag    // Type tag of the compressed matrix
+        , typename MT1    // Type of the left-hand side operand
+        , typename MT2 >  // Type of the right-hand side operand
+void computeSpGEMMBlock( CompressedMatrix<Type,SO,Tag>& C, const MT1& X, const MT2& Y,
+                         size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   SpGEMMAccumulator<Type> accumulator( SO ? C.rows() : C.columns() );
+
+   for( size_t i=index; i<index+size; ++i ) {
+      accumulator.template compute<SO>( C, X, Y, i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,513 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/SparseBlocks.h
+//  \brief Header file for the block-wise evaluation of sparse SMP assignments
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_SPARSEBLOCKS_H_
+#define _BLAZE_MATH_SMP_SPARSEBLOCKS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial capacity of a sparse block for the given dense matrix.
+// \ingroup smp
+//
+// \return 0.
+//
+// The number of non-zero elements of a dense matrix can only be determined by evaluating the
+// matrix. Therefore no capacity is reserved in advance and the sparse block grows on demand.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline size_t blockCapacity( const DenseMatrix<MT,SO>& )
+{
+   return 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial capacity of a sparse block for the given sparse matrix.
+// \ingroup smp
+//
+// \param sm The given sparse matrix.
+// \return The (estimated) number of non-zero elements of the sparse matrix.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline size_t blockCapacity( const SparseMatrix<MT,SO>& sm )
+{
+   return (*sm).nonZeros();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial capacity of a sparse block for the given dense vector.
+// \ingroup smp
+//
+// \return 0.
+//
+// The number of non-zero elements of a dense vector can only be determined by evaluating the
+// vector. Therefore no capacity is reserved in advance and the sparse block grows on demand.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+inline size_t blockCapacity( const DenseVector<VT,TF>& )
+{
+   return 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial capacity of a sparse block for the given sparse vector.
+// \ingroup smp
+//
+// \param sv The given sparse vector.
+// \return The (estimated) number of non-zero elements of the sparse vector.
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag of the sparse vector
+inline size_t blockCapacity( const SparseVector<VT,TF>& sv )
+{
+   return (*sv).nonZeros();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a block of rows of a matrix into a row-major sparse block.
+// \ingroup smp
+//
+// \param block The row-major compressed matrix to hold the evaluated rows.
+// \param rhs The right-hand side matrix to be evaluated.
+// \param index The index of the first row of the block.
+// \param size The number of rows of the block.
+// \return void
+//
+// This function evaluates the rows \f$[index..index+size-1]\f$ of the given matrix \a rhs into
+// the given row-major compressed matrix. It represents the counting step of the two-step
+// (count-then-fill) SMP assignment to sparse matrices: after the evaluation the number of
+// non-zero elements of every row of the final result is known.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the sparse block
+        , typename Tag    // Type tag of the sparse block
+        , typename MT     // Type of the right-hand side matrix
+        , bool SO >       // Storage order of the right-hand side matrix
+void evaluateSparseBlock( CompressedMatrix<Type,false,Tag>& block, const Matrix<MT,SO>& rhs,
+                          size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( index + size <= (*rhs).rows(), "Invalid block specification" );
+
+   const auto source( submatrix<unaligned>( *rhs, index, 0UL, size, (*rhs).columns(), unchecked ) );
+
+   block.resize( size, (*rhs).columns(), false );
+   block.reserve( blockCapacity( source ) );
+   assign( block, source );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a block of columns of a matrix into a column-major sparse block.
+// \ingroup smp
+//
+// \param block The column-major compressed matrix to hold the evaluated columns.
+// \param rhs The right-hand side matrix to be evaluated.
+// \param index The index of the first column of the block.
+// \param size The number of columns of the block.
+// \return void
+//
+// This function evaluates the columns \f$[index..index+size-1]\f$ of the given matrix \a rhs
+// into the given column-major compressed matrix. It represents the counting step of the two-step
+// (count-then-fill) SMP assignment to sparse matrices: after the evaluation the number of
+// non-zero elements of every column of the final result is known.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the sparse block
+        , typename Tag    // Type tag of the sparse block
+        , typename MT     // Type of the right-hand side matrix
+        , bool SO >       // Storage order of the right-hand side matrix
+void evaluateSparseBlock( CompressedMatrix<Type,true,Tag>& block, const Matrix<MT,SO>& rhs,
+                          size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( index + size <= (*rhs).columns(), "Invalid block specification" );
+
+   const auto source( submatrix<unaligned>( *rhs, 0UL, index, (*rhs).rows(), size, unchecked ) );
+
+   block.resize( (*rhs).rows(), size, false );
+   block.reserve( blockCapacity( source ) );
+   assign( block, source );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a range of elements of a vector into a sparse block.
+// \ingroup smp
+//
+// \param block The compressed vector to hold the evaluated elements.
+// \param rhs The right-hand side vector to be evaluated.
+// \param index The index of the first element of the block.
+// \param size The number of elements of the block.
+// \return void
+//
+// This function evaluates the elements \f$[index..index+size-1]\f$ of the given vector \a rhs
+// into the given compressed vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the sparse block
+        , bool TF         // Transpose flag of the sparse block
+        , typename Tag    // Type tag of the sparse block
+        , typename VT >   // Type of the right-hand side vector
+void evaluateSparseBlock( CompressedVector<Type,TF,Tag>& block, const Vector<VT,TF>& rhs,
+                          size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( index + size <= (*rhs).size(), "Invalid block specification" );
+
+   const auto source( subvector<unaligned>( *rhs, index, size, unchecked ) );
+
+   block.resize( size, false );
+   block.reserve( blockCapacity( source ) );
+   assign( block, source );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK FILL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies an evaluated row-major sparse block into the final result.
+// \ingroup smp
+//
+// \param lhs The row-major compressed matrix holding the final result.
+// \param block The evaluated block of rows.
+// \param index The index of the first row of the block within the final result.
+// \return void
+//
+// This function represents the fill step of the two-step SMP assignment to sparse matrices.
+// It requires the capacity of each row of \a lhs to be already set up according to the number
+// of non-zero elements of the corresponding row of the block. Since every row is written via
+// its own begin/end pointers, several disjoint blocks can be filled concurrently.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the compressed matrices
+        , typename Tag >  // Type tag of the compressed matrices
+void fillSparseBlock( CompressedMatrix<Type,false,Tag>& lhs,
+                      const CompressedMatrix<Type,false,Tag>& block, size_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( index + block.rows() <= lhs.rows(), "Invalid block specification" );
+   BLAZE_INTERNAL_ASSERT( block.columns() == lhs.columns(), "Invalid number of columns" );
+
+   for( size_t i=0UL; i<block.rows(); ++i )
+   {
+      BLAZE_INTERNAL_ASSERT( lhs.capacity( index+i ) == block.nonZeros( i ), "Invalid row capacity" );
+
+      for( auto element=block.begin(i); element!=block.end(i); ++element ) {
+         lhs.append( index+i, element->index(), element->value() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies an evaluated column-major sparse block into the final result.
+// \ingroup smp
+//
+// \param lhs The column-major compressed matrix holding the final result.
+// \param block The evaluated block of columns.
+// \param index The index of the first column of the block within the final result.
+// \return void
+//
+// This function represents the fill step of the two-step SMP assignment to sparse matrices.
+// It requires the capacity of each column of \a lhs to be already set up according to the
+// number of non-zero elements of the corresponding column of the block. Since every column
+// is written via its own begin/end pointers, several disjoint blocks can be filled
+// concurrently.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the compressed matrices
+        , typename Tag >  // Type tag of the compressed matrices
+void fillSparseBlock( CompressedMatrix<Type,true,Tag>& lhs,
+                      const CompressedMatrix<Type,true,Tag>& block, size_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( index + block.columns() <= lhs.columns(), "Invalid block specification" );
+   BLAZE_INTERNAL_ASSERT( block.rows() == lhs.rows(), "Invalid number of rows" );
+
+   for( size_t j=0UL; j<block.columns(); ++j )
+   {
+      BLAZE_INTERNAL_ASSERT( lhs.capacity( index+j ) == block.nonZeros( j ), "Invalid column capacity" );
+
+      for( auto element=block.begin(j); element!=block.end(j); ++element ) {
+         lhs.append( element->index(), index+j, element->value() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies an evaluated sparse vector block into the final result.
+// \ingroup smp
+//
+// \param lhs The compressed vector holding the final result.
+// \param block The evaluated range of elements.
+// \param index The index of the first element of the block within the final result.
+// \return void
+//
+// This function appends the elements of the given block to the given compressed vector. Since
+// the elements of a compressed vector are stored in a single contiguous array, the blocks have
+// to be appended in ascending order.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the compressed vectors
+        , bool TF         // Transpose flag of the compressed vectors
+        , typename Tag >  // Type tag of the compressed vectors
+void fillSparseBlock( CompressedVector<Type,TF,Tag>& lhs,
+                      const CompressedVector<Type,TF,Tag>& block, size_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( index + block.size() <= lhs.size(), "Invalid block specification" );
+   BLAZE_INTERNAL_ASSERT( lhs.nonZeros() + block.nonZeros() <= lhs.capacity(), "Invalid capacity" );
+
+   for( auto element=block.begin(); element!=block.end(); ++element ) {
+      lhs.append( index+element->index(), element->value() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RESULT TRANSFER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transfers the result of a sparse SMP assignment to a compressed matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param result The evaluated result of the SMP assignment.
+// \return void
+//
+// In case the target of the SMP assignment is a compressed matrix of the same type as the
+// evaluated result, the result is not copied but swapped into place.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the compressed matrices
+        , bool SO         // Storage order of the compressed matrices
+        , typename Tag >  // Type tag of the compressed matrices
+void transferSparseResult( CompressedMatrix<Type,SO,Tag>& lhs, CompressedMatrix<Type,SO,Tag>& result )
+{
+   lhs.swap( result );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transfers the result of a sparse SMP assignment to an arbitrary sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param result The evaluated result of the SMP assignment.
+// \return void
+//
+// Since the assignment kernels expect sufficient capacity, capacity for all non-zero elements
+// of the result is reserved in the target matrix before the assignment.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT     // Type of the left-hand side sparse matrix
+        , bool SO         // Storage order of the left-hand side sparse matrix
+        , typename Type   // Data type of the evaluated result
+        , typename Tag >  // Type tag of the evaluated result
+void transferSparseResult( SparseMatrix<MT,SO>& lhs, const CompressedMatrix<Type,SO,Tag>& result )
+{
+   (*lhs).reserve( result.nonZeros() );
+   assign( *lhs, result );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transfers the result of a sparse SMP assignment to a compressed vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side compressed vector.
+// \param result The evaluated result of the SMP assignment.
+// \return void
+//
+// In case the target of the SMP assignment is a compressed vector of the same type as the
+// evaluated result, the result is not copied but swapped into place.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type   // Data type of the compressed vectors
+        , bool TF         // Transpose flag of the compressed vectors
+        , typename Tag >  // Type tag of the compressed vectors
+void transferSparseResult( CompressedVector<Type,TF,Tag>& lhs, CompressedVector<Type,TF,Tag>& result )
+{
+   lhs.swap( result );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transfers the result of a sparse SMP assignment to an arbitrary sparse vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse vector.
+// \param result The evaluated result of the SMP assignment.
+// \return void
+//
+// Since the assignment kernels expect sufficient capacity, capacity for all non-zero elements
+// of the result is reserved in the target vector before the assignment.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename VT     // Type of the left-hand side sparse vector
+        , bool TF         // Transpose flag of the left-hand side sparse vector
+        , typename Type   // Data type of the evaluated result
+        , typename Tag >  // Type tag of the evaluated result
+void transferSparseResult( SparseVector<VT,TF>& lhs, const CompressedVector<Type,TF,Tag>& result )
+{
+   (*lhs).reserve( result.nonZeros() );
+   assign( *lhs, result );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
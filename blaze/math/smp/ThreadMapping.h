@@ -44,8 +44,10 @@
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/shims/Round.h>
 #include <blaze/math/shims/Sqrt.h>
+#include <blaze/system/Blocking.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
 #include <blaze/util/Types.h>
 
 
@@ -114,6 +116,85 @@ ThreadMapping createThreadMapping( size_t threads, const Matrix<MT,SO>& A )
 /*! \endcond */
 //*************************************************************************************************
 
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+using ThreadTiling = std::pair<size_t,size_t>;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a cache-aware 2D tiling of a matrix for the given number of threads.
+// \ingroup smp
+//
+// \param threads The total number of threads the tiles are distributed to.
+// \param A The matrix the tiling is created for.
+// \param granularity The granularity of the tile sizes (as for instance the SIMD size).
+// \return The number of rows and columns per tile.
+//
+// This function cuts the given matrix \a A into tiles, which are handed out dynamically to the
+// given number of threads. In contrast to createThreadMapping() the number of tiles does not
+// have to match the number of threads. Therefore all threads can be used efficiently even if
+// the number of threads has only few factors (as for instance 6, 14, or 28 threads), which
+// would result in degenerated 1xN or Nx1 stripes. The tiles are based on the cache blocks of
+// the dense matrix multiplication (\a MMM_OUTER_BLOCK_SIZE in the contiguous dimension of the
+// matrix and \a MMM_INNER_BLOCK_SIZE in the other dimension). For small matrices the tiles are
+// shrunk until there are at least four tiles per thread, which bounds the load imbalance at the
+// end of the computation. For large matrices the tiles are enlarged to limit the scheduling
+// overhead to at most 16 tiles per thread (the serial kernels apply their own cache blocking
+// within each tile). Both tile dimensions are multiples of the given granularity.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+ThreadTiling createThreadTiling( size_t threads, const Matrix<MT,SO>& A, size_t granularity = 1UL )
+{
+   BLAZE_INTERNAL_ASSERT( threads     > 0UL, "Invalid number of threads" );
+   BLAZE_INTERNAL_ASSERT( granularity > 0UL, "Invalid granularity"       );
+
+   constexpr size_t minTilesPerThread(  4UL );
+   constexpr size_t maxTilesPerThread( 16UL );
+
+   const size_t M( (*A).rows()    );
+   const size_t N( (*A).columns() );
+
+   const auto roundUp = [granularity]( size_t size ) {
+      return ( ( size + granularity - 1UL ) / granularity ) * granularity;
+   };
+
+   const auto tiles = [M,N]( size_t m, size_t n ) {
+      return ( ( M + m - 1UL ) / m ) * ( ( N + n - 1UL ) / n );
+   };
+
+   const size_t outer( roundUp( MMM_OUTER_BLOCK_SIZE ) );
+   const size_t inner( roundUp( MMM_INNER_BLOCK_SIZE ) );
+
+   size_t m( min( SO ? outer : inner, max( roundUp( M ), granularity ) ) );
+   size_t n( min( SO ? inner : outer, max( roundUp( N ), granularity ) ) );
+
+   while( tiles( m, n ) < minTilesPerThread*threads && max( m, n ) > granularity )
+   {
+      if( m >= n )
+         m = roundUp( m / 2UL );
+      else
+         n = roundUp( n / 2UL );
+   }
+
+   while( tiles( m, n ) > maxTilesPerThread*threads )
+   {
+      if( ( m <= n && m < M ) || n >= N )
+         m *= 2UL;
+      else
+         n *= 2UL;
+   }
+
+   return ThreadTiling( m, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
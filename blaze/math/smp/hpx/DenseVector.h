@@ -44,6 +44,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/SerialSection.h>
@@ -209,6 +210,64 @@ void hpxAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs, OP
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the HPX-based SMP (compound) assignment of a SELL-C-sigma sparse
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \param op The (compound) assignment operation.
+// \return void
+//
+// This function is the backend implementation of the HPX-based SMP assignment of a
+// SELL-C-sigma sparse matrix/dense vector multiplication to a dense vector. In contrast to the
+// equal split of the general dense vector kernel, the rows are split at the boundaries of the
+// sorting windows of the matrix such that every thread processes approximately the same number
+// of stored matrix elements.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the left-hand side dense vector
+        , typename MT2   // Type of the left-hand side SELL-C-sigma matrix operand
+        , typename VT2   // Type of the right-hand side dense vector operand
+        , typename OP >  // Type of the assignment operation
+void hpxAssign( DenseVector<VT1,false>& lhs, const SEllMatDVecMultExpr<MT2,VT2>& rhs, OP op )
+{
+#if HPX_VERSION_FULL < 0x010800
+   using hpx::for_loop;
+   using hpx::execution::par;
+#else
+   using hpx::experimental::for_loop;
+   using hpx::execution::par;
+#endif
+
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.leftOperand().rows(), "Invalid vector sizes" );
+
+   const size_t threads( getNumThreads() );
+
+   for_loop( par, size_t(0), threads, [&](int i)
+   {
+      const size_t begin( rhs.leftOperand().partition( threads, i     ) );
+      const size_t end  ( rhs.leftOperand().partition( threads, i+1UL ) );
+
+      if( begin == end )
+         return;
+
+      auto       target( subvector<unaligned>( *lhs, begin, end - begin, unchecked ) );
+      const auto source( rhs.block( begin, end - begin ) );
+      op( target, source );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
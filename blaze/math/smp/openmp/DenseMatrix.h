@@ -109,30 +109,24 @@ void openmpAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
    const bool lhsAligned( (*lhs).isAligned() );
    const bool rhsAligned( (*rhs).isAligned() );
 
-   const int threads( omp_get_num_threads() );
-   const ThreadMapping threadmap( createThreadMapping( threads, *rhs ) );
+   const size_t threads( omp_get_num_threads() );
+   const ThreadTiling tiling( createThreadTiling( threads, *rhs, simdEnabled ? SIMDSIZE : 1UL ) );
 
-   const size_t addon1     ( ( ( (*rhs).rows() % threadmap.first ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (*rhs).rows() / threadmap.first + addon1 );
-   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
-   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+   const size_t rowsPerTile( tiling.first  );
+   const size_t colsPerTile( tiling.second );
 
-   const size_t addon2     ( ( ( (*rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare2( (*rhs).columns() / threadmap.second + addon2 );
-   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
-   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+   const size_t tileRows( ( (*rhs).rows()    + rowsPerTile - 1UL ) / rowsPerTile );
+   const size_t tileCols( ( (*rhs).columns() + colsPerTile - 1UL ) / colsPerTile );
+   const int    tiles   ( tileRows * tileCols );
 
 #pragma omp for schedule(dynamic,1) nowait
-   for( int i=0; i<threads; ++i )
+   for( int i=0; i<tiles; ++i )
    {
-      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
-      const size_t column( ( i % threadmap.second ) * colsPerThread );
-
-      if( row >= (*rhs).rows() || column >= (*rhs).columns() )
-         continue;
+      const size_t row   ( ( SO2 ? i % tileRows : i / tileCols ) * rowsPerTile );
+      const size_t column( ( SO2 ? i / tileRows : i % tileCols ) * colsPerTile );
 
-      const size_t m( min( rowsPerThread, (*rhs).rows()    - row    ) );
-      const size_t n( min( colsPerThread, (*rhs).columns() - column ) );
+      const size_t m( min( rowsPerTile, (*rhs).rows()    - row    ) );
+      const size_t n( min( colsPerTile, (*rhs).columns() - column ) );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto       target( submatrix<aligned>( *lhs, row, column, m, n ) );
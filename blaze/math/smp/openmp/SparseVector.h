@@ -0,0 +1,516 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/SparseVector.h  \brief Header file for the OpenMP-based sparse
+// vector SMP implementation
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under  the
+// terms of the New (Revised) BSD License. Redistribution and use in source and binary  forms, with
+// or without modification, are permitted provided that the following conditions  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+// conditions and the following disclaimer.  2. Redistributions in binary form must reproduce the
+// above copyright notice, this list     of conditions and the following disclaimer in the
+// documentation and/or other materials     provided with the distribution.  3. Neither the names
+// of the Blaze development group nor the names of its contributors     may be used to endorse or
+// promote products derived from this software without specific     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY  EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES  OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT  SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,  INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_SPARSEVECTOR_H_
+#define _BLAZE_MATH_SMP_OPENMP_SPARSEVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <omp.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/openmp/DenseVector.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/SparseBlocks.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseVector.h>
+#include <blaze/system/MacroDisable.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  OPENMP-BASED ASSIGNMENT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a vector to a sparse vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment of a vector to a
+// sparse vector. The elements of the right-hand side vector are split into blocks, which are
+// evaluated in parallel into separate compressed vectors. Afterwards the result is allocated in a
+// single step based on the total number of non-zero elements and the blocks are appended to the
+// result.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side sparse vector
+        , bool TF1      // Transpose flag of the left-hand side sparse vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+void openmpAssign( SparseVector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   using ResultType = CompressedVector< ElementType_t<VT1>, TF1, TagType_t<VT1> >;
+
+   const size_t N( (*rhs).size() );
+
+   const int    threads      ( omp_get_max_threads() );
+   const size_t addon        ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerThread( N / threads + addon );
+
+   std::vector<ResultType> blocks( threads );
+
+#pragma omp parallel for schedule(dynamic,1) shared( blocks, rhs )
+   for( int i=0; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= N )
+         continue;
+
+      const size_t size( min( sizePerThread, N - index ) );
+
+      evaluateSparseBlock( blocks[i], *rhs, index, size );
+   }
+
+   size_t nonzeros( 0UL );
+   for( const ResultType& block : blocks )
+      nonzeros += block.nonZeros();
+
+   ResultType result( N, nonzeros );
+
+   for( int i=0; i<threads && i*sizePerThread<N; ++i ) {
+      fillSparseBlock( result, blocks[i], i*sizePerThread );
+   }
+
+   transferSparseResult( *lhs, result );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP assignment to a sparse vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return void
+//
+// This function implements the default OpenMP-based SMP assignment to a sparse vector. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the compiler
+// in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side sparse vector
+        , bool TF1      // Transpose flag of the left-hand side sparse vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline auto smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+   -> EnableIf_t< IsSparseVector_v<VT1> && ( !IsSMPAssignable_v<VT1> || !IsSMPAssignable_v<VT2> ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).size() == (*rhs).size(), "Invalid vector sizes" );
+
+   assign( *lhs, *rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP assignment to a sparse vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return void
+//
+// This function implements the OpenMP-based SMP assignment to a sparse vector. Due to the explicit
+// application of the SFINAE principle, this function can only be selected by the compiler in case
+// both operands are SMP-assignable and the element types of both operands are not
+// SMP-assignable.\n
+// Note that the blocks of the right-hand side vector are evaluated into temporary compressed
+// vectors before they are appended to the result by a single thread. Therefore the peak memory
+// consumption of the assignment is about twice the memory required by the non-zero elements of
+// the result. Also, in case the target is not a compressed vector of the same type, the result
+// is assigned to the target by means of an additional copy.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side sparse vector
+        , bool TF1      // Transpose flag of the left-hand side sparse vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline auto smpAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+   -> EnableIf_t< IsSparseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssignable_v<VT2> >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).size() == (*rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         assign( *lhs, *rhs );
+      }
+      else {
+         openmpAssign( *lhs, *rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP addition assignment to a sparse vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse vector.
+// \param rhs The right-hand side vector to be added.
+// \return void
+//
+// This function implements the default OpenMP-based SMP addition assignment to a sparse vector.
+// Due to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side sparse vector
+        , bool TF1      // Transpose flag of the left-hand side sparse vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline auto smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+   -> EnableIf_t< IsSparseVector_v<VT1> && ( !IsSMPAssignable_v<VT1> || !IsSMPAssignable_v<VT2> ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).size() == (*rhs).size(), "Invalid vector sizes" );
+
+   addAssign( *lhs, *rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP addition assignment to a sparse vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse vector.
+// \param rhs The right-hand side vector to be added.
+// \return void
+//
+// This function implements the OpenMP-based SMP addition assignment to a sparse vector. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the compiler
+// in case both operands are SMP-assignable and the element types of both operands are not
+// SMP-assignable.\n
+// The right-hand side vector is evaluated in parallel into a temporary sparse vector, which is
+// subsequently added to the target vector by a single thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side sparse vector
+        , bool TF1      // Transpose flag of the left-hand side sparse vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline auto smpAddAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+   -> EnableIf_t< IsSparseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssignable_v<VT2> >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).size() == (*rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         addAssign( *lhs, *rhs );
+      }
+      else {
+         using TmpType = CompressedVector< ElementType_t<VT2>, TF1, TagType_t<VT2> >;
+         TmpType tmp( (*rhs).size() );
+         openmpAssign( tmp, *rhs );
+         addAssign( *lhs, tmp );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP subtraction assignment to a sparse vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse vector.
+// \param rhs The right-hand side vector to be subtracted.
+// \return void
+//
+// This function implements the default OpenMP-based SMP subtraction assignment to a sparse vector.
+// Due to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side sparse vector
+        , bool TF1      // Transpose flag of the left-hand side sparse vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline auto smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+   -> EnableIf_t< IsSparseVector_v<VT1> && ( !IsSMPAssignable_v<VT1> || !IsSMPAssignable_v<VT2> ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).size() == (*rhs).size(), "Invalid vector sizes" );
+
+   subAssign( *lhs, *rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP subtraction assignment to a sparse vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse vector.
+// \param rhs The right-hand side vector to be subtracted.
+// \return void
+//
+// This function implements the OpenMP-based SMP subtraction assignment to a sparse vector. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case both operands are SMP-assignable and the element types of both operands are not
+// SMP-assignable.\n
+// The right-hand side vector is evaluated in parallel into a temporary sparse vector, which is
+// subsequently subtracted to the target vector by a single thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side sparse vector
+        , bool TF1      // Transpose flag of the left-hand side sparse vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline auto smpSubAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+   -> EnableIf_t< IsSparseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssignable_v<VT2> >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).size() == (*rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         subAssign( *lhs, *rhs );
+      }
+      else {
+         using TmpType = CompressedVector< ElementType_t<VT2>, TF1, TagType_t<VT2> >;
+         TmpType tmp( (*rhs).size() );
+         openmpAssign( tmp, *rhs );
+         subAssign( *lhs, tmp );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTIPLICATION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP multiplication assignment to a sparse
+//        vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse vector.
+// \param rhs The right-hand side vector to be multiplied.
+// \return void
+//
+// This function implements the default OpenMP-based SMP multiplication assignment to a sparse
+// vector. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side sparse vector
+        , bool TF1      // Transpose flag of the left-hand side sparse vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline auto smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+   -> EnableIf_t< IsSparseVector_v<VT1> && ( !IsSMPAssignable_v<VT1> || !IsSMPAssignable_v<VT2> ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).size() == (*rhs).size(), "Invalid vector sizes" );
+
+   multAssign( *lhs, *rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP multiplication assignment to a sparse vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse vector.
+// \param rhs The right-hand side vector to be multiplied.
+// \return void
+//
+// This function implements the OpenMP-based SMP multiplication assignment to a sparse vector. Due
+// to the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case both operands are SMP-assignable and the element types of both operands are not
+// SMP-assignable.\n
+// The right-hand side dense vector is evaluated in parallel into a temporary dense vector, which
+// is subsequently multiplied to the target vector by a single thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1  // Type of the left-hand side sparse vector
+        , bool TF1      // Transpose flag of the left-hand side sparse vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline auto smpMultAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+   -> EnableIf_t< IsSparseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssignable_v<VT2> >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<VT2> );
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).size() == (*rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         multAssign( *lhs, *rhs );
+      }
+      else {
+         using ET2     = ElementType_t<VT2>;
+         using TmpType = DynamicVector< ET2, TF1, AlignedAllocator<ET2>, TagType_t<VT2> >;
+         TmpType tmp( (*rhs).size() );
+#pragma omp parallel shared( tmp, rhs )
+         openmpAssign( tmp, *rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
+         multAssign( *lhs, tmp );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -82,7 +82,9 @@ namespace blaze {
 // \return void
 //
 // This function is the backend implementation of the C++11/Boost thread-based SMP assignment
-// of a dense matrix to a dense matrix.\n
+// of a dense matrix to a dense matrix. Every thread is assigned a contiguous range of tiles,
+// i.e. the same block of rows (or columns for column-major matrices) in successive assignments,
+// which keeps the data local to the thread.\n
 // This function must \b NOT be called explicitly! It is used internally for the performance
 // optimized evaluation of expression templates. Calling this function explicitly might result
 // in erroneous results and/or in compilation errors. Instead of using this function use the
@@ -108,55 +110,47 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
    const bool lhsAligned( (*lhs).isAligned() );
    const bool rhsAligned( (*rhs).isAligned() );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), *rhs ) );
+   const ThreadTiling tiling( createThreadTiling( TheThreadBackend::size(), *rhs,
+                                                  simdEnabled ? SIMDSIZE : 1UL ) );
 
-   const size_t addon1     ( ( ( (*rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (*rhs).rows() / threads.first + addon1 );
-   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
-   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+   const size_t rowsPerTile( tiling.first  );
+   const size_t colsPerTile( tiling.second );
 
-   const size_t addon2     ( ( ( (*rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare2( (*rhs).columns() / threads.second + addon2 );
-   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
-   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+   const size_t tileRows( ( (*rhs).rows()    + rowsPerTile - 1UL ) / rowsPerTile );
+   const size_t tileCols( ( (*rhs).columns() + colsPerTile - 1UL ) / colsPerTile );
+   const size_t tiles   ( tileRows * tileCols );
+   const size_t threads ( TheThreadBackend::size() );
 
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t i=0UL; i<tiles; ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (*lhs).rows() )
-         continue;
+      const size_t row   ( ( SO2 ? i % tileRows : i / tileCols ) * rowsPerTile );
+      const size_t column( ( SO2 ? i / tileRows : i % tileCols ) * colsPerTile );
 
-      for( size_t j=0UL; j<threads.second; ++j )
-      {
-         const size_t column( j*colsPerThread );
+      // Assigning a contiguous range of tiles to every thread
+      const size_t thread( ( i * threads ) / tiles );
 
-         if( column >= (*rhs).columns() )
-            continue;
+      const size_t m( min( rowsPerTile, (*rhs).rows()    - row    ) );
+      const size_t n( min( colsPerTile, (*rhs).columns() - column ) );
 
-         const size_t m( min( rowsPerThread, (*lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (*rhs).columns() - column ) );
-
-         if( simdEnabled && lhsAligned && rhsAligned ) {
-            auto       target( submatrix<aligned>( *lhs, row, column, m, n, unchecked ) );
-            const auto source( submatrix<aligned>( *rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
-         }
-         else if( simdEnabled && lhsAligned ) {
-            auto       target( submatrix<aligned>( *lhs, row, column, m, n, unchecked ) );
-            const auto source( submatrix<unaligned>( *rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
-         }
-         else if( simdEnabled && rhsAligned ) {
-            auto       target( submatrix<unaligned>( *lhs, row, column, m, n, unchecked ) );
-            const auto source( submatrix<aligned>( *rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
-         }
-         else {
-            auto       target( submatrix<unaligned>( *lhs, row, column, m, n, unchecked ) );
-            const auto source( submatrix<unaligned>( *rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
-         }
+      if( simdEnabled && lhsAligned && rhsAligned ) {
+         auto       target( submatrix<aligned>( *lhs, row, column, m, n, unchecked ) );
+         const auto source( submatrix<aligned>( *rhs, row, column, m, n, unchecked ) );
+         TheThreadBackend::scheduleOn( thread, target, source, op );
+      }
+      else if( simdEnabled && lhsAligned ) {
+         auto       target( submatrix<aligned>( *lhs, row, column, m, n, unchecked ) );
+         const auto source( submatrix<unaligned>( *rhs, row, column, m, n, unchecked ) );
+         TheThreadBackend::scheduleOn( thread, target, source, op );
+      }
+      else if( simdEnabled && rhsAligned ) {
+         auto       target( submatrix<unaligned>( *lhs, row, column, m, n, unchecked ) );
+         const auto source( submatrix<aligned>( *rhs, row, column, m, n, unchecked ) );
+         TheThreadBackend::scheduleOn( thread, target, source, op );
+      }
+      else {
+         auto       target( submatrix<unaligned>( *lhs, row, column, m, n, unchecked ) );
+         const auto source( submatrix<unaligned>( *rhs, row, column, m, n, unchecked ) );
+         TheThreadBackend::scheduleOn( thread, target, source, op );
       }
    }
 
@@ -222,7 +216,7 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
 
          auto       target( submatrix<unaligned>( *lhs, row, column, m, n, unchecked ) );
          const auto source( submatrix<unaligned>( *rhs, row, column, m, n, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::scheduleOn( i*threads.second+j, target, source, op );
       }
    }
 
@@ -43,6 +43,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
@@ -126,22 +127,22 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, O
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto       target( subvector<aligned>( *lhs, index, size, unchecked ) );
          const auto source( subvector<aligned>( *rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::scheduleOn( i, target, source, op );
       }
       else if( simdEnabled && lhsAligned ) {
          auto       target( subvector<aligned>( *lhs, index, size, unchecked ) );
          const auto source( subvector<unaligned>( *rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::scheduleOn( i, target, source, op );
       }
       else if( simdEnabled && rhsAligned ) {
          auto       target( subvector<unaligned>( *lhs, index, size, unchecked ) );
          const auto source( subvector<aligned>( *rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::scheduleOn( i, target, source, op );
       }
       else {
          auto       target( subvector<unaligned>( *lhs, index, size, unchecked ) );
          const auto source( subvector<unaligned>( *rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         TheThreadBackend::scheduleOn( i, target, source, op );
       }
    }
 
@@ -194,7 +195,60 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs,
       const size_t size( min( sizePerThread, (*lhs).size() - index ) );
       auto       target( subvector<unaligned>( *lhs, index, size, unchecked ) );
       const auto source( subvector<unaligned>( *rhs, index, size, unchecked ) );
-      TheThreadBackend::schedule( target, source, op );
+      TheThreadBackend::scheduleOn( i, target, source, op );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP (compound) assignment of a SELL-C-sigma sparse
+//        matrix/dense vector multiplication to a dense vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \param op The (compound) assignment operation.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a
+// SELL-C-sigma sparse matrix/dense vector multiplication to a dense vector. In contrast to the
+// equal split of the general dense vector kernel, the rows are split at the boundaries of the
+// sorting windows of the matrix such that every thread processes approximately the same number
+// of stored matrix elements.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT1   // Type of the left-hand side dense vector
+        , typename MT2   // Type of the left-hand side SELL-C-sigma matrix operand
+        , typename VT2   // Type of the right-hand side dense vector operand
+        , typename OP >  // Type of the assignment operation
+void threadAssign( DenseVector<VT1,false>& lhs, const SEllMatDVecMultExpr<MT2,VT2>& rhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( (*lhs).size() == rhs.leftOperand().rows(), "Invalid vector sizes" );
+
+   const size_t threads( TheThreadBackend::size() );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t begin( rhs.leftOperand().partition( threads, i     ) );
+      const size_t end  ( rhs.leftOperand().partition( threads, i+1UL ) );
+
+      if( begin == end )
+         continue;
+
+      auto       target( subvector<unaligned>( *lhs, begin, end - begin, unchecked ) );
+      const auto source( rhs.block( begin, end - begin ) );
+      TheThreadBackend::scheduleOn( i, target, source, op );
    }
 
    TheThreadBackend::wait();
@@ -0,0 +1,174 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Reduction.h
+//  \brief Header file for the C++11/Boost thread-based SMP reduction functionality
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_REDUCTION_H_
+#define _BLAZE_MATH_SMP_THREADS_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <vector>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveCVRef.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of an index range.
+// \ingroup smp
+//
+// \param size The total number of elements of the index range \f$[0..size)\f$.
+// \param granularity The granularity of the subranges (e.g. the size of a SIMD vector).
+// \param kernel The kernel computing the partial result of the subrange \f$[index..index+size)\f$.
+// \param combine The binary operation for the combination of two partial results.
+// \return The result of the reduction.
+//
+// This function implements the C++11/Boost thread-based SMP reduction of the index range
+// \f$[0..size)\f$. The range is split into one contiguous subrange per thread, whose size is a
+// multiple of the given \a granularity. The partial results of all subranges are computed in
+// parallel by means of the given \a kernel and are subsequently combined by the calling thread
+// in the order of the subranges. Thus for a fixed number of threads the result is independent
+// of the scheduling of the threads. In case reproducible reductions are enabled (see the
+// BLAZE_USE_REPRODUCIBLE_REDUCTIONS switch), the range is instead split into subranges of exactly
+// \a granularity elements, which are distributed among the threads. In this case the result is
+// additionally independent of the number of threads. In case a serial section or another
+// parallel section is active, the \a kernel is evaluated single-threaded on the complete range.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Kernel     // Type of the reduction kernel
+        , typename Combine >  // Type of the combine operation
+auto smpReduce( size_t size, size_t granularity, Kernel kernel, Combine combine )
+   -> RemoveCVRef_t< decltype( kernel( size, size ) ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using RT = RemoveCVRef_t< decltype( kernel( size, size ) ) >;
+
+   BLAZE_INTERNAL_ASSERT( granularity > 0UL, "Invalid granularity" );
+
+   if( size == 0UL || isSerialSectionActive() || isParallelSectionActive() ) {
+      return kernel( 0UL, size );
+   }
+
+   const size_t threads      ( TheThreadBackend::size() );
+   const size_t addon        ( ( ( size % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( size / threads + addon );
+   const size_t rest         ( equalShare % granularity );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + granularity ):( equalShare ) );
+   const size_t blockSize    ( useReproducibleReductions ? granularity : sizePerThread );
+   const size_t blocks       ( ( size - 1UL ) / blockSize + 1UL );
+
+   if( blocks == 1UL ) {
+      return kernel( 0UL, size );
+   }
+
+   const size_t blocksPerThread( ( blocks - 1UL ) / threads + 1UL );
+
+   std::vector<RT> partials( blocks );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      for( size_t first=0UL; first<blocks; first+=blocksPerThread )
+      {
+         const size_t last  ( min( first+blocksPerThread, blocks ) );
+         const size_t thread( first / blocksPerThread );
+
+         TheThreadBackend::scheduleOn( thread, [&partials,&kernel,size,blockSize,first,last]()
+         {
+            for( size_t i=first; i<last; ++i ) {
+               const size_t index( i*blockSize );
+               partials[i] = kernel( index, min( blockSize, size - index ) );
+            }
+         } );
+      }
+
+      TheThreadBackend::wait();
+   }
+
+   RT result( std::move( partials[0UL] ) );
+
+   for( size_t i=1UL; i<blocks; ++i ) {
+      result = combine( result, partials[i] );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
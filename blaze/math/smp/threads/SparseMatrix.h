@@ -0,0 +1,708 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/SparseMatrix.h  \brief Header file for the C++11/Boost
+// thread-based sparse matrix SMP implementation
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under  the
+// terms of the New (Revised) BSD License. Redistribution and use in source and binary  forms, with
+// or without modification, are permitted provided that the following conditions  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+// conditions and the following disclaimer.  2. Redistributions in binary form must reproduce the
+// above copyright notice, this list     of conditions and the following disclaimer in the
+// documentation and/or other materials     provided with the distribution.  3. Neither the names
+// of the Blaze development group nor the names of its contributors     may be used to endorse or
+// promote products derived from this software without specific     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY  EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES  OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT  SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,  INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED  TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_SPARSEMATRIX_H_
+#define _BLAZE_MATH_SMP_THREADS_SPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/SparseBlocks.h>
+#include <blaze/math/smp/SpGEMM.h>
+#include <blaze/math/smp/threads/DenseMatrix.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  THREAD-BASED ASSIGNMENT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a matrix to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP assignment of a
+// matrix to a sparse matrix. The assignment is performed in two steps: In the first step the rows
+// (in case of a row-major target) or columns (in case of a column-major target) of the right-hand
+// side matrix are split into blocks, which are evaluated in parallel into separate compressed
+// matrices. This step determines the number of non-zero elements of every row/column of the
+// result. In the second step the result is allocated in a single step based on these counts and
+// the blocks are copied into their final position in parallel.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void threadAssign( SparseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   using ResultType = CompressedMatrix< ElementType_t<MT1>, SO1, TagType_t<MT1> >;
+
+   const size_t M( ( SO1 )?( (*rhs).columns() ):( (*rhs).rows() ) );
+
+   const size_t threads      ( TheThreadBackend::size() );
+   const size_t addon        ( ( ( M % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerThread( M / threads + addon );
+
+   std::vector<ResultType> blocks( threads );
+   std::vector<size_t> nonzeros( M, 0UL );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= M )
+         break;
+
+      const size_t size( min( sizePerThread, M - index ) );
+
+      TheThreadBackend::scheduleOn( i, [&blocks,&nonzeros,&rhs,i,index,size]()
+      {
+         evaluateSparseBlock( blocks[i], *rhs, index, size );
+         for( size_t k=0UL; k<size; ++k )
+            nonzeros[index+k] = blocks[i].nonZeros( k );
+      } );
+   }
+
+   TheThreadBackend::wait();
+
+   ResultType result( (*rhs).rows(), (*rhs).columns(), nonzeros );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= M )
+         break;
+
+      TheThreadBackend::scheduleOn( i, [&result,&blocks,i,index]()
+      {
+         fillSparseBlock( result, blocks[i], index );
+      } );
+   }
+
+   TheThreadBackend::wait();
+
+   transferSparseResult( *lhs, result );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP sparse matrix/sparse matrix multiplication.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param X The operand providing the sparsity pattern of each row (column) of the result.
+// \param Y The operand whose rows (columns) are accumulated.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP sparse
+// matrix/sparse matrix multiplication (SpGEMM). In case of a row-major target \a X and \a Y are the
+// left-hand side and right-hand side operand of the multiplication, in case of a column-major
+// target they are the right-hand side and left-hand side operand, respectively. The multiplication
+// is performed in two passes over blocks of rows (columns): The symbolic pass determines the exact
+// number of non-zero elements of every row (column) of the result in parallel, which allows to
+// allocate the result in a single step. The numeric pass computes the rows (columns) in parallel
+// and appends them directly to the preallocated result. Each block uses its own accumulator, which
+// chooses between a dense accumulator and a hash table per row (column) (see SpGEMMAccumulator).\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , bool SO1        // Storage order of the left-hand side sparse matrix
+        , typename MT2    // Type of the first operand
+        , typename MT3 >  // Type of the second operand
+void threadSpGEMM( SparseMatrix<MT1,SO1>& lhs, const MT2& X, const MT3& Y )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   using ET         = ElementType_t<MT1>;
+   using ResultType = CompressedMatrix< ET, SO1, TagType_t<MT1> >;
+
+   const size_t M( ( SO1 )?( (*lhs).columns() ):( (*lhs).rows() ) );
+   const size_t N( ( SO1 )?( (*lhs).rows() ):( (*lhs).columns() ) );
+
+   const size_t blocks      ( 4UL*TheThreadBackend::size() );
+   const size_t addon       ( ( ( M % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerBlock( M / blocks + addon );
+
+   std::vector<size_t> nonzeros( M, 0UL );
+
+   for( size_t i=0UL; i<blocks; ++i )
+   {
+      const size_t index( i*sizePerBlock );
+
+      if( index >= M )
+         break;
+
+      const size_t size( min( sizePerBlock, M - index ) );
+
+      TheThreadBackend::schedule( [&nonzeros,&X,&Y,N,index,size]()
+      {
+         countSpGEMMBlock<ET>( nonzeros, X, Y, N, index, size );
+      } );
+   }
+
+   TheThreadBackend::wait();
+
+   ResultType result( (*lhs).rows(), (*lhs).columns(), nonzeros );
+
+   for( size_t i=0UL; i<blocks; ++i )
+   {
+      const size_t index( i*sizePerBlock );
+
+      if( index >= M )
+         break;
+
+      const size_t size( min( sizePerBlock, M - index ) );
+
+      TheThreadBackend::schedule( [&result,&X,&Y,index,size]()
+      {
+         computeSpGEMMBlock( result, X, Y, index, size );
+      } );
+   }
+
+   TheThreadBackend::wait();
+
+   transferSparseResult( *lhs, result );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a sparse matrix/sparse
+//        matrix multiplication to a row-major sparse matrix (\f$ C=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3 >  // Type of the right-hand side matrix operand
+void threadAssign( SparseMatrix<MT1,false>& lhs, const SMatSMatMultExpr<MT2,MT3>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   threadSpGEMM( lhs, rhs.leftOperand(), rhs.rightOperand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP assignment of a transpose sparse
+//        matrix/transpose sparse matrix multiplication to a column-major sparse matrix
+//        (\f$ C=A*B \f$).
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side multiplication expression to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3 >  // Type of the right-hand side matrix operand
+void threadAssign( SparseMatrix<MT1,true>& lhs, const TSMatTSMatMultExpr<MT2,MT3>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   threadSpGEMM( lhs, rhs.rightOperand(), rhs.leftOperand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP assignment to a sparse matrix.
+// Due to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+   -> EnableIf_t< IsSparseMatrix_v<MT1> && ( !IsSMPAssignable_v<MT1> || !IsSMPAssignable_v<MT2> ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (*lhs).columns() == (*rhs).columns(), "Invalid number of columns" );
+
+   assign( *lhs, *rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP assignment to a sparse matrix. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case both operands are SMP-assignable and the element types of both operands are not
+// SMP-assignable.\n
+// Note that the blocks of the right-hand side matrix are evaluated into temporary compressed
+// matrices before they are copied into the result. Therefore the peak memory consumption of the
+// assignment is about twice the memory required by the non-zero elements of the result. Also,
+// in case the target is not a compressed matrix of the same type, the result is assigned to the
+// target by means of an additional copy.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline auto smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+   -> EnableIf_t< IsSparseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssignable_v<MT2> >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (*lhs).columns() == (*rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         assign( *lhs, *rhs );
+      }
+      else {
+         threadAssign( *lhs, *rhs );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP addition assignment to a
+//        sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP addition assignment to a
+// sparse matrix. Due to the explicit application of the SFINAE principle, this function can only
+// be selected by the compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+   -> EnableIf_t< IsSparseMatrix_v<MT1> && ( !IsSMPAssignable_v<MT1> || !IsSMPAssignable_v<MT2> ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (*lhs).columns() == (*rhs).columns(), "Invalid number of columns" );
+
+   addAssign( *lhs, *rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP addition assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP addition assignment to a sparse
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case both operands are SMP-assignable and the element types of both
+// operands are not SMP-assignable.\n
+// The right-hand side matrix is evaluated in parallel into a temporary sparse matrix, which is
+// subsequently added to the target matrix by a single thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline auto smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+   -> EnableIf_t< IsSparseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssignable_v<MT2> >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (*lhs).columns() == (*rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         addAssign( *lhs, *rhs );
+      }
+      else {
+         using TmpType = CompressedMatrix< ElementType_t<MT2>, SO1, TagType_t<MT2> >;
+         TmpType tmp( (*rhs).rows(), (*rhs).columns() );
+         threadAssign( tmp, *rhs );
+         addAssign( *lhs, tmp );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP subtraction assignment to a
+//        sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP subtraction assignment to a
+// sparse matrix. Due to the explicit application of the SFINAE principle, this function can only
+// be selected by the compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+   -> EnableIf_t< IsSparseMatrix_v<MT1> && ( !IsSMPAssignable_v<MT1> || !IsSMPAssignable_v<MT2> ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (*lhs).columns() == (*rhs).columns(), "Invalid number of columns" );
+
+   subAssign( *lhs, *rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP subtraction assignment to a sparse
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP subtraction assignment to a sparse
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case both operands are SMP-assignable and the element types of both
+// operands are not SMP-assignable.\n
+// The right-hand side matrix is evaluated in parallel into a temporary sparse matrix, which is
+// subsequently subtracted to the target matrix by a single thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline auto smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+   -> EnableIf_t< IsSparseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssignable_v<MT2> >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (*lhs).columns() == (*rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         subAssign( *lhs, *rhs );
+      }
+      else {
+         using TmpType = CompressedMatrix< ElementType_t<MT2>, SO1, TagType_t<MT2> >;
+         TmpType tmp( (*rhs).rows(), (*rhs).columns() );
+         threadAssign( tmp, *rhs );
+         subAssign( *lhs, tmp );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHUR PRODUCT ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP Schur product assignment to a
+//        sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be multiplied.
+// \return void
+//
+// This function implements the default C++11/Boost thread-based SMP Schur product assignment to a
+// sparse matrix. Due to the explicit application of the SFINAE principle, this function can only
+// be selected by the compiler in case either of the two operands is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+   -> EnableIf_t< IsSparseMatrix_v<MT1> && ( !IsSMPAssignable_v<MT1> || !IsSMPAssignable_v<MT2> ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (*lhs).columns() == (*rhs).columns(), "Invalid number of columns" );
+
+   schurAssign( *lhs, *rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP Schur product assignment to a sparse
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be multiplied.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP Schur product assignment to a sparse
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case both operands are SMP-assignable and the element types of both
+// operands are not SMP-assignable.\n
+// The right-hand side dense matrix is evaluated in parallel into a temporary dense matrix, which
+// is subsequently multiplied to the target matrix by a single thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline auto smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+   -> EnableIf_t< IsSparseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssignable_v<MT2> >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_t<MT2> );
+
+   BLAZE_INTERNAL_ASSERT( (*lhs).rows()    == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (*lhs).columns() == (*rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(*rhs).canSMPAssign() ) {
+         schurAssign( *lhs, *rhs );
+      }
+      else {
+         using ET2     = ElementType_t<MT2>;
+         using TmpType = DynamicMatrix< ET2, SO1, AlignedAllocator<ET2>, TagType_t<MT2> >;
+         TmpType tmp( (*rhs).rows(), (*rhs).columns() );
+         threadAssign( tmp, *rhs, []( auto& a, const auto& b ){ assign( a, b ); } );
+         schurAssign( *lhs, tmp );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
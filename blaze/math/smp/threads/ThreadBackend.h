@@ -55,8 +55,10 @@
 #include <blaze/system/SMP.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/constraints/Const.h>
+#include <blaze/util/mpl/If.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/ThreadPool.h>
+#include <blaze/util/WorkStealingThreadPool.h>
 #include <blaze/util/Types.h>
 
 
@@ -85,6 +87,14 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 class ThreadBackend
 {
+ private:
+   //**Type definitions****************************************************************************
+   //! Type of the pool of active threads.
+   using ThreadPoolType = If_t< BLAZE_USE_WORK_STEALING_THREAD_POOL
+                              , WorkStealingThreadPool<TT,MT,LT,CT>
+                              , ThreadPool<TT,MT,LT,CT> >;
+   //**********************************************************************************************
+
  public:
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
@@ -100,6 +110,15 @@ class ThreadBackend
    //@{
    template< typename Target, typename Source, typename OP >
    static inline void schedule( Target& target, const Source& source, OP op );
+
+   template< typename OP >
+   static inline void schedule( OP op );
+
+   template< typename Target, typename Source, typename OP >
+   static inline void scheduleOn( size_t thread, Target& target, const Source& source, OP op );
+
+   template< typename OP >
+   static inline void scheduleOn( size_t thread, OP op );
    //@}
    //**********************************************************************************************
 
@@ -159,12 +178,15 @@ class ThreadBackend
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
-                                                /*!< It is initialized with the number of threads
-                                                     specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+   static ThreadPoolType threadpool_;  //!< The pool of active threads of the backend system.
+                                       /*!< It is initialized with the number of threads
+                                            specified via the environment variable
+                                            \c BLAZE_NUM_THREADS. However, it can be
+                                            explicitly resized to arbitrary numbers of
+                                            threads. Depending on the
+                                            \c BLAZE_USE_WORK_STEALING_THREAD_POOL switch
+                                            this is either a ThreadPool or a
+                                            WorkStealingThreadPool. */
    //@}
    //**********************************************************************************************
 };
@@ -183,7 +205,8 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+typename ThreadBackend<TT,MT,LT,CT>::ThreadPoolType
+   ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -297,6 +320,87 @@ inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given operation for execution.
+//
+// In contrast to the scheduling of an assignment, the given operation is not restricted to
+// expression operands and is executed as is. All operands referenced by the operation have to
+// remain valid until the completion of the operation (see the wait() function).
+*/
+template< typename TT      // Type of the encapsulated thread
+        , typename MT      // Type of the synchronization mutex
+        , typename LT      // Type of the mutex lock
+        , typename CT >    // Type of the condition variable
+template< typename OP >    // Type of the operation
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( OP op )
+{
+   threadpool_.schedule( op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling an assignment of the given operands for execution by a specific thread.
+//
+// \param thread The index of the preferred thread.
+// \param target The target operand to be assigned to.
+// \param source The source operand to be assigned to the target.
+// \param op The (compound) assignment operation.
+// \return void
+//
+// This function schedules a (compound) assignment of the two given operands for execution by
+// the thread with the given index. Scheduling the same part of an operand to the same thread
+// in successive assignments keeps the data in the caches of the thread and, in combination with
+// pinned threads (see the setThreadAffinity() function), in the memory of its NUMA node. Note
+// that the preferred thread is only respected by the work-stealing thread pool (see the
+// \c BLAZE_USE_WORK_STEALING_THREAD_POOL switch), the default thread pool executes the task
+// by the next available thread.
+*/
+template< typename TT      // Type of the encapsulated thread
+        , typename MT      // Type of the synchronization mutex
+        , typename LT      // Type of the mutex lock
+        , typename CT >    // Type of the condition variable
+template< typename Target  // Type of the target operand
+        , typename Source  // Type of the source operand
+        , typename OP >    // Type of the assignment operation
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleOn( size_t thread, Target& target,
+                                                    const Source& source, OP op )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+   threadpool_.scheduleOn( thread, Assigner<Target,Source,OP>( target, source, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given operation for execution by a specific thread.
+//
+// \param thread The index of the preferred thread.
+// \param op The operation to be executed.
+// \return void
+//
+// This function schedules the given operation for execution by the thread with the given index
+// (see the scheduleOn() function for assignments). All operands referenced by the operation
+// have to remain valid until the completion of the operation (see the wait() function).
+*/
+template< typename TT      // Type of the encapsulated thread
+        , typename MT      // Type of the synchronization mutex
+        , typename LT      // Type of the mutex lock
+        , typename CT >    // Type of the condition variable
+template< typename OP >    // Type of the operation
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleOn( size_t thread, OP op )
+{
+   threadpool_.scheduleOn( thread, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,327 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BiCGStabSolver.h
+//  \brief Header file for the biconjugate gradient stabilized (BiCGStab) solver
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BICGSTABSOLVER_H_
+#define _BLAZE_MATH_SOLVERS_BICGSTABSOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Fuse.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/IterativeSolver.h>
+#include <blaze/math/solvers/LinearOperator.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Preconditioned biconjugate gradient stabilized (BiCGStab) solver.
+// \ingroup math
+//
+// The BiCGStabSolver class template solves a linear system of equations \f$ A x = b \f$ with
+// general square system matrix \a A by means of the right preconditioned biconjugate gradient
+// stabilized method. The system matrix can be any square dense or sparse matrix or a matrix-free
+// LinearOperator, the preconditioner can be any preconditioner (as for instance the
+// JacobiPreconditioner or the ILU0Preconditioner):
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::ILU0Preconditioner<double> ilu( A );
+   blaze::BiCGStabSolver<double> bicgstab;
+
+   const blaze::IterativeSolverInfo info( bicgstab.solve( A, x, b, ilu ) );
+
+   if( !info.converged ) { ... }
+   \endcode
+
+// The given vector \a x is used as initial guess. The internal work vectors are kept between
+// two calls to \c solve(), i.e. repeated solutions of systems of the same size don't require
+// any memory allocation. The vector updates and reductions of an iteration are evaluated in
+// three passes via the fuse() function, the matrix/vector multiplications are parallelized by
+// the active SMP backend. In case of a breakdown of the method the solver returns early and
+// reports the current residual as not converged.
+*/
+template< typename Type >  // Data type of the elements
+class BiCGStabSolver
+   : public IterativeSolver
+{
+ public:
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename OP, typename VT1, typename VT2 >
+   IterativeSolverInfo solve( const OP& A, DenseVector<VT1,false>& x,
+                              const DenseVector<VT2,false>& b );
+
+   template< typename OP, typename VT1, typename VT2, typename PC >
+   IterativeSolverInfo solve( const OP& A, DenseVector<VT1,false>& x,
+                              const DenseVector<VT2,false>& b, const PC& M );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using RealType = UnderlyingBuiltin_t<Type>;  //!< Real type of the scalar values.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DynamicVector<Type> r_;     //!< The residual vector.
+   DynamicVector<Type> rhat_;  //!< The shadow residual vector.
+   DynamicVector<Type> p_;     //!< The search direction.
+   DynamicVector<Type> phat_;  //!< The preconditioned search direction.
+   DynamicVector<Type> shat_;  //!< The preconditioned intermediate residual.
+   DynamicVector<Type> v_;     //!< The product of the system matrix and \a phat_.
+   DynamicVector<Type> t_;     //!< The product of the system matrix and \a shat_.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations without preconditioning.
+//
+// \param A The square system matrix or linear operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \return The information about the convergence of the solver.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+*/
+template< typename Type >  // Data type of the elements
+template< typename OP      // Type of the system matrix or operator
+        , typename VT1     // Type of the solution vector
+        , typename VT2 >   // Type of the right-hand side vector
+IterativeSolverInfo BiCGStabSolver<Type>::solve( const OP& A, DenseVector<VT1,false>& x,
+                                                 const DenseVector<VT2,false>& b )
+{
+   return solve( A, x, b, IdentityPreconditioner() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations.
+//
+// \param A The square system matrix or linear operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param M The preconditioner.
+// \return The information about the convergence of the solver.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// In case the size of the solution vector \a x doesn't match the size of the system, \a x is
+// resized and the zero vector is used as initial guess.
+*/
+template< typename Type >  // Data type of the elements
+template< typename OP      // Type of the system matrix or operator
+        , typename VT1     // Type of the solution vector
+        , typename VT2     // Type of the right-hand side vector
+        , typename PC >    // Type of the preconditioner
+IterativeSolverInfo BiCGStabSolver<Type>::solve( const OP& A, DenseVector<VT1,false>& x,
+                                                 const DenseVector<VT2,false>& b, const PC& M )
+{
+   using std::sqrt;
+
+   constexpr bool identity( IsSame_v<PC,IdentityPreconditioner> );
+
+   const size_t n( operatorSize( A ) );
+
+   if( (*b).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( (*x).size() != n ) {
+      resize( *x, n, false );
+      reset( *x );
+   }
+
+   r_.resize   ( n, false );
+   rhat_.resize( n, false );
+   p_.resize   ( n, false );
+   phat_.resize( n, false );
+   shat_.resize( n, false );
+   v_.resize   ( n, false );
+   t_.resize   ( n, false );
+
+   const RealType bnorm( real( norm( *b ) ) );
+
+   if( bnorm == RealType(0) ) {
+      reset( *x );
+      return IterativeSolverInfo{ true, 0UL, 0.0 };
+   }
+
+   const RealType threshold( RealType( tolerance() ) * bnorm );
+
+   // Computing the initial residual
+   Type rr{};
+
+   p_ = *x;
+   applyOperator( A, v_, p_ );
+   fuse( lazyAssign( r_, *b - v_ ), lazySqrNorm( rr, r_ ) );
+
+   RealType rnorm( sqrt( real( rr ) ) );
+
+   if( rnorm <= threshold ) {
+      return IterativeSolverInfo{ true, 0UL, double( rnorm / bnorm ) };
+   }
+
+   // Without preconditioning the preconditioned vectors are the vectors themselves
+   const DynamicVector<Type>& phat( identity ? p_ : phat_ );
+   const DynamicVector<Type>& shat( identity ? r_ : shat_ );
+
+   rhat_ = r_;
+
+   Type rho   ( rr );
+   Type rhoOld( 1 );
+   Type alpha ( 1 );
+   Type omega ( 1 );
+
+   const size_t limit( iterationLimit( n ) );
+
+   for( size_t iteration=1UL; iteration<=limit; ++iteration )
+   {
+      if( rho == Type(0) || omega == Type(0) ) {
+         return IterativeSolverInfo{ false, iteration-1UL, double( rnorm / bnorm ) };
+      }
+
+      if( iteration == 1UL ) {
+         p_ = r_;
+      }
+      else {
+         const Type beta( ( rho / rhoOld ) * ( alpha / omega ) );
+         p_ = r_ + beta * ( p_ - omega * v_ );
+      }
+
+      if( !identity ) {
+         M.apply( phat_, p_ );
+      }
+
+      applyOperator( A, v_, phat );
+
+      const Type rv( dot( conj( rhat_ ), v_ ) );
+
+      if( rv == Type(0) ) {
+         return IterativeSolverInfo{ false, iteration, double( rnorm / bnorm ) };
+      }
+
+      alpha = rho / rv;
+
+      // Computing the intermediate residual s (stored in r_)
+      fuse( lazySubAssign( r_, alpha * v_ ), lazySqrNorm( rr, r_ ) );
+
+      rnorm = sqrt( real( rr ) );
+
+      if( rnorm <= threshold ) {
+         (*x) += alpha * phat;
+         return IterativeSolverInfo{ true, iteration, double( rnorm / bnorm ) };
+      }
+
+      if( !identity ) {
+         M.apply( shat_, r_ );
+      }
+
+      applyOperator( A, t_, shat );
+
+      Type tt{};
+      Type ts{};
+      fuse( lazySqrNorm( tt, t_ ), lazySum( ts, conj( t_ ) * r_ ) );
+
+      if( tt == Type(0) ) {
+         (*x) += alpha * phat;
+         return IterativeSolverInfo{ false, iteration, double( rnorm / bnorm ) };
+      }
+
+      omega  = ts / tt;
+      rhoOld = rho;
+
+      fuse( lazyAddAssign( *x, alpha * phat + omega * shat )
+          , lazySubAssign( r_, omega * t_ )
+          , lazySqrNorm( rr, r_ )
+          , lazySum( rho, conj( rhat_ ) * r_ ) );
+
+      rnorm = sqrt( real( rr ) );
+
+      if( rnorm <= threshold ) {
+         return IterativeSolverInfo{ true, iteration, double( rnorm / bnorm ) };
+      }
+   }
+
+   return IterativeSolverInfo{ false, limit, double( rnorm / bnorm ) };
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,286 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/CGSolver.h
+//  \brief Header file for the conjugate gradient (CG) solver
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_CGSOLVER_H_
+#define _BLAZE_MATH_SOLVERS_CGSOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Fuse.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/IterativeSolver.h>
+#include <blaze/math/solvers/LinearOperator.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Preconditioned conjugate gradient (CG) solver.
+// \ingroup math
+//
+// The CGSolver class template solves a linear system of equations \f$ A x = b \f$ with symmetric
+// (or Hermitian) positive definite system matrix \a A by means of the preconditioned conjugate
+// gradient method. The system matrix can be any square dense or sparse matrix or a matrix-free
+// LinearOperator, the preconditioner has to be symmetric (or Hermitian) positive definite as
+// well (as for instance the JacobiPreconditioner or the IC0Preconditioner):
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::IC0Preconditioner<double> ic( A );
+   blaze::CGSolver<double> cg;
+   cg.setTolerance( 1E-10 );
+
+   const blaze::IterativeSolverInfo info( cg.solve( A, x, b, ic ) );
+
+   if( !info.converged ) { ... }
+   \endcode
+
+// The given vector \a x is used as initial guess. The internal work vectors are kept between
+// two calls to \c solve(), i.e. repeated solutions of systems of the same size don't require
+// any memory allocation. All vector updates of an iteration are evaluated in a single pass via
+// the fuse() function, the matrix/vector multiplication is parallelized by the active SMP
+// backend.
+*/
+template< typename Type >  // Data type of the elements
+class CGSolver
+   : public IterativeSolver
+{
+ public:
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename OP, typename VT1, typename VT2 >
+   IterativeSolverInfo solve( const OP& A, DenseVector<VT1,false>& x,
+                              const DenseVector<VT2,false>& b );
+
+   template< typename OP, typename VT1, typename VT2, typename PC >
+   IterativeSolverInfo solve( const OP& A, DenseVector<VT1,false>& x,
+                              const DenseVector<VT2,false>& b, const PC& M );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using RealType = UnderlyingBuiltin_t<Type>;  //!< Real type of the scalar values.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DynamicVector<Type> r_;  //!< The residual vector.
+   DynamicVector<Type> z_;  //!< The preconditioned residual vector.
+   DynamicVector<Type> p_;  //!< The search direction.
+   DynamicVector<Type> q_;  //!< The product of the system matrix and the search direction.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations without preconditioning.
+//
+// \param A The symmetric (or Hermitian) positive definite system matrix or linear operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \return The information about the convergence of the solver.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+*/
+template< typename Type >  // Data type of the elements
+template< typename OP      // Type of the system matrix or operator
+        , typename VT1     // Type of the solution vector
+        , typename VT2 >   // Type of the right-hand side vector
+IterativeSolverInfo CGSolver<Type>::solve( const OP& A, DenseVector<VT1,false>& x,
+                                           const DenseVector<VT2,false>& b )
+{
+   return solve( A, x, b, IdentityPreconditioner() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations.
+//
+// \param A The symmetric (or Hermitian) positive definite system matrix or linear operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param M The symmetric (or Hermitian) positive definite preconditioner.
+// \return The information about the convergence of the solver.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// In case the size of the solution vector \a x doesn't match the size of the system, \a x is
+// resized and the zero vector is used as initial guess.
+*/
+template< typename Type >  // Data type of the elements
+template< typename OP      // Type of the system matrix or operator
+        , typename VT1     // Type of the solution vector
+        , typename VT2     // Type of the right-hand side vector
+        , typename PC >    // Type of the preconditioner
+IterativeSolverInfo CGSolver<Type>::solve( const OP& A, DenseVector<VT1,false>& x,
+                                           const DenseVector<VT2,false>& b, const PC& M )
+{
+   using std::sqrt;
+
+   constexpr bool identity( IsSame_v<PC,IdentityPreconditioner> );
+
+   const size_t n( operatorSize( A ) );
+
+   if( (*b).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( (*x).size() != n ) {
+      resize( *x, n, false );
+      reset( *x );
+   }
+
+   r_.resize( n, false );
+   z_.resize( n, false );
+   p_.resize( n, false );
+   q_.resize( n, false );
+
+   const RealType bnorm( real( norm( *b ) ) );
+
+   if( bnorm == RealType(0) ) {
+      reset( *x );
+      return IterativeSolverInfo{ true, 0UL, 0.0 };
+   }
+
+   const RealType threshold( RealType( tolerance() ) * bnorm );
+
+   // Computing the initial residual
+   Type rr{};
+
+   p_ = *x;
+   applyOperator( A, q_, p_ );
+   fuse( lazyAssign( r_, *b - q_ ), lazySqrNorm( rr, r_ ) );
+
+   RealType rnorm( sqrt( real( rr ) ) );
+
+   if( rnorm <= threshold ) {
+      return IterativeSolverInfo{ true, 0UL, double( rnorm / bnorm ) };
+   }
+
+   // Without preconditioning the preconditioned residual is the residual itself
+   const DynamicVector<Type>& z( identity ? r_ : z_ );
+
+   if( !identity ) {
+      M.apply( z_, r_ );
+   }
+
+   p_ = z;
+
+   Type rho( identity ? rr : dot( conj( r_ ), z_ ) );
+
+   const size_t limit( iterationLimit( n ) );
+
+   for( size_t iteration=1UL; iteration<=limit; ++iteration )
+   {
+      applyOperator( A, q_, p_ );
+
+      const Type pq( dot( conj( p_ ), q_ ) );
+
+      if( pq == Type(0) ) {
+         return IterativeSolverInfo{ false, iteration, double( rnorm / bnorm ) };
+      }
+
+      const Type alpha( rho / pq );
+
+      fuse( lazyAddAssign( *x, alpha * p_ )
+          , lazySubAssign( r_, alpha * q_ )
+          , lazySqrNorm( rr, r_ ) );
+
+      rnorm = sqrt( real( rr ) );
+
+      if( rnorm <= threshold ) {
+         return IterativeSolverInfo{ true, iteration, double( rnorm / bnorm ) };
+      }
+
+      if( !identity ) {
+         M.apply( z_, r_ );
+      }
+
+      const Type rhoNew( identity ? rr : dot( conj( r_ ), z_ ) );
+      const Type beta( rhoNew / rho );
+
+      p_  = z + beta * p_;
+      rho = rhoNew;
+   }
+
+   return IterativeSolverInfo{ false, limit, double( rnorm / bnorm ) };
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
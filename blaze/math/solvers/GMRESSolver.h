@@ -0,0 +1,432 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/GMRESSolver.h
+//  \brief Header file for the restarted generalized minimal residual (GMRES) solver
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_GMRESSOLVER_H_
+#define _BLAZE_MATH_SOLVERS_GMRESSOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Fuse.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/IterativeSolver.h>
+#include <blaze/math/solvers/LinearOperator.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Preconditioned restarted generalized minimal residual (GMRES) solver.
+// \ingroup math
+//
+// The GMRESSolver class template solves a linear system of equations \f$ A x = b \f$ with
+// general square system matrix \a A by means of the right preconditioned, restarted generalized
+// minimal residual method GMRES(m). The system matrix can be any square dense or sparse matrix
+// or a matrix-free LinearOperator, the preconditioner can be any preconditioner (as for instance
+// the JacobiPreconditioner or the ILU0Preconditioner):
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::ILU0Preconditioner<double> ilu( A );
+   blaze::GMRESSolver<double> gmres;
+   gmres.setRestart( 50UL );
+
+   const blaze::IterativeSolverInfo info( gmres.solve( A, x, b, ilu ) );
+
+   if( !info.converged ) { ... }
+   \endcode
+
+// The Krylov basis is orthogonalized by means of the classical Gram-Schmidt method with
+// reorthogonalization, which is evaluated via (parallelized) dense matrix/vector products.
+// After \a m iterations (30 by default) the method is restarted with the current solution as
+// new initial guess. The Krylov basis and all internal work vectors are kept between two calls
+// to \c solve(), i.e. repeated solutions of systems of the same size don't require any memory
+// allocation.
+*/
+template< typename Type >  // Data type of the elements
+class GMRESSolver
+   : public IterativeSolver
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline GMRESSolver();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t restart() const noexcept;
+   inline void   setRestart( size_t restart );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename OP, typename VT1, typename VT2 >
+   IterativeSolverInfo solve( const OP& A, DenseVector<VT1,false>& x,
+                              const DenseVector<VT2,false>& b );
+
+   template< typename OP, typename VT1, typename VT2, typename PC >
+   IterativeSolverInfo solve( const OP& A, DenseVector<VT1,false>& x,
+                              const DenseVector<VT2,false>& b, const PC& M );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using RealType = UnderlyingBuiltin_t<Type>;  //!< Real type of the scalar values.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t restart_;  //!< The number of iterations between two restarts.
+
+   DynamicMatrix<Type,columnMajor> V_;   //!< The orthonormal basis of the Krylov subspace.
+   DynamicMatrix<Type,columnMajor> H_;   //!< The upper Hessenberg matrix.
+   DynamicVector<Type>             g_;   //!< The rotated right-hand side vector.
+   DynamicVector<Type>             h_;   //!< The coefficients of the reorthogonalization.
+   DynamicVector<Type>             y_;   //!< The solution of the least squares system.
+   DynamicVector<RealType>         cs_;  //!< The cosines of the Givens rotations.
+   DynamicVector<Type>             sn_;  //!< The sines of the Givens rotations.
+   DynamicVector<Type>             w_;   //!< The new Krylov vector.
+   DynamicVector<Type>             z_;   //!< The preconditioned basis vector.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for GMRESSolver.
+*/
+template< typename Type >  // Data type of the elements
+inline GMRESSolver<Type>::GMRESSolver()
+   : IterativeSolver()  // Initialization of the base class
+   , restart_( 30UL )   // The number of iterations between two restarts
+   , V_ ()              // The orthonormal basis of the Krylov subspace
+   , H_ ()              // The upper Hessenberg matrix
+   , g_ ()              // The rotated right-hand side vector
+   , h_ ()              // The coefficients of the reorthogonalization
+   , y_ ()              // The solution of the least squares system
+   , cs_()              // The cosines of the Givens rotations
+   , sn_()              // The sines of the Givens rotations
+   , w_ ()              // The new Krylov vector
+   , z_ ()              // The preconditioned basis vector
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of iterations between two restarts.
+//
+// \return The number of iterations between two restarts.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t GMRESSolver<Type>::restart() const noexcept
+{
+   return restart_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the number of iterations between two restarts.
+//
+// \param restart The new number of iterations between two restarts.
+// \return void
+// \exception std::invalid_argument Invalid restart specified.
+//
+// The restart determines the size of the Krylov basis, i.e. the solver requires memory for
+// \a restart+1 vectors of the size of the system.
+*/
+template< typename Type >  // Data type of the elements
+inline void GMRESSolver<Type>::setRestart( size_t restart )
+{
+   if( restart == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid restart specified" );
+   }
+
+   restart_ = restart;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations without preconditioning.
+//
+// \param A The square system matrix or linear operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \return The information about the convergence of the solver.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+*/
+template< typename Type >  // Data type of the elements
+template< typename OP      // Type of the system matrix or operator
+        , typename VT1     // Type of the solution vector
+        , typename VT2 >   // Type of the right-hand side vector
+IterativeSolverInfo GMRESSolver<Type>::solve( const OP& A, DenseVector<VT1,false>& x,
+                                              const DenseVector<VT2,false>& b )
+{
+   return solve( A, x, b, IdentityPreconditioner() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations.
+//
+// \param A The square system matrix or linear operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param M The preconditioner.
+// \return The information about the convergence of the solver.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// In case the size of the solution vector \a x doesn't match the size of the system, \a x is
+// resized and the zero vector is used as initial guess. The residual is recomputed explicitly
+// at every restart, the reported residual is the true residual of the final solution.
+*/
+template< typename Type >  // Data type of the elements
+template< typename OP      // Type of the system matrix or operator
+        , typename VT1     // Type of the solution vector
+        , typename VT2     // Type of the right-hand side vector
+        , typename PC >    // Type of the preconditioner
+IterativeSolverInfo GMRESSolver<Type>::solve( const OP& A, DenseVector<VT1,false>& x,
+                                              const DenseVector<VT2,false>& b, const PC& M )
+{
+   using std::abs;
+   using std::sqrt;
+
+   const size_t n( operatorSize( A ) );
+   const size_t m( restart_ );
+
+   if( (*b).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( (*x).size() != n ) {
+      resize( *x, n, false );
+      reset( *x );
+   }
+
+   V_.resize ( n, m+1UL, false );
+   H_.resize ( m+1UL, m, false );
+   g_.resize ( m+1UL, false );
+   h_.resize ( m+1UL, false );
+   y_.resize ( m, false );
+   cs_.resize( m, false );
+   sn_.resize( m, false );
+   w_.resize ( n, false );
+   z_.resize ( n, false );
+
+   const RealType bnorm( real( norm( *b ) ) );
+
+   if( bnorm == RealType(0) ) {
+      reset( *x );
+      return IterativeSolverInfo{ true, 0UL, 0.0 };
+   }
+
+   const RealType threshold( RealType( tolerance() ) * bnorm );
+   const size_t limit( iterationLimit( n ) );
+
+   size_t iteration( 0UL );
+
+   while( true )
+   {
+      // Computing the residual of the current solution
+      auto v0( column( V_, 0UL ) );
+      Type rr{};
+
+      z_ = *x;
+      applyOperator( A, w_, z_ );
+      fuse( lazyAssign( v0, *b - w_ ), lazySqrNorm( rr, v0 ) );
+
+      const RealType beta( sqrt( real( rr ) ) );
+
+      if( beta <= threshold || iteration >= limit ) {
+         return IterativeSolverInfo{ beta <= threshold, iteration, double( beta / bnorm ) };
+      }
+
+      v0 *= RealType(1) / beta;
+
+      reset( g_ );
+      g_[0UL] = beta;
+
+      // Arnoldi iteration
+      size_t j( 0UL );
+
+      while( j < m && iteration < limit )
+      {
+         ++iteration;
+
+         M.apply( z_, column( V_, j ) );
+         applyOperator( A, w_, z_ );
+
+         // Orthogonalization via classical Gram-Schmidt with reorthogonalization
+         const auto Vj( submatrix( V_, 0UL, 0UL, n, j+1UL ) );
+         auto hj( subvector( column( H_, j ), 0UL, j+1UL ) );
+         auto hc( subvector( h_, 0UL, j+1UL ) );
+
+         hj = ctrans( Vj ) * w_;
+         w_ -= Vj * hj;
+         hc = ctrans( Vj ) * w_;
+         hj += hc;
+
+         Type ww{};
+         fuse( lazySubAssign( w_, Vj * hc ), lazySqrNorm( ww, w_ ) );
+
+         const RealType wnorm( sqrt( real( ww ) ) );
+
+         H_(j+1UL,j) = wnorm;
+
+         // Application of the previous Givens rotations to the new column
+         for( size_t i=0UL; i<j; ++i ) {
+            const Type tmp( cs_[i] * H_(i,j) + sn_[i] * H_(i+1UL,j) );
+            H_(i+1UL,j) = cs_[i] * H_(i+1UL,j) - conj( sn_[i] ) * H_(i,j);
+            H_(i,j) = tmp;
+         }
+
+         // Computation and application of the new Givens rotation
+         const Type hjj( H_(j,j) );
+         const RealType habs( abs( hjj ) );
+
+         if( habs == RealType(0) ) {
+            cs_[j] = RealType(0);
+            sn_[j] = Type(1);
+         }
+         else {
+            const RealType t( sqrt( habs*habs + wnorm*wnorm ) );
+            cs_[j] = habs / t;
+            sn_[j] = ( hjj / habs ) * wnorm / t;
+         }
+
+         H_(j,j) = cs_[j] * hjj + sn_[j] * wnorm;
+         H_(j+1UL,j) = Type(0);
+
+         g_[j+1UL] = -conj( sn_[j] ) * g_[j];
+         g_[j] *= cs_[j];
+
+         ++j;
+
+         if( abs( g_[j] ) <= threshold || wnorm == RealType(0) ) {
+            break;
+         }
+
+         column( V_, j ) = w_ * ( RealType(1) / wnorm );
+      }
+
+      // Solution of the upper triangular least squares problem
+      for( size_t i=j; i-->0UL; ) {
+         Type sum( g_[i] );
+         for( size_t k=i+1UL; k<j; ++k ) {
+            sum -= H_(i,k) * y_[k];
+         }
+         y_[i] = sum / H_(i,i);
+      }
+
+      // Update of the solution
+      w_ = submatrix( V_, 0UL, 0UL, n, j ) * subvector( y_, 0UL, j );
+      M.apply( z_, w_ );
+      (*x) += z_;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,340 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/IC0Preconditioner.h
+//  \brief Header file for the IC(0) preconditioner of the iterative solvers
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_IC0PRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_IC0PRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <vector>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete Cholesky preconditioner without fill-in (IC(0)) for the iterative solvers.
+// \ingroup math
+//
+// The IC0Preconditioner class template represents the preconditioning matrix \f$ M = L L^H \f$,
+// where the lower triangular matrix \a L has the same sparsity pattern as the lower part of the
+// symmetric (or Hermitian) positive definite system matrix \a A. Only the lower part of \a A is
+// accessed. The factor \a L is stored as a row-major compressed matrix:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::IC0Preconditioner<double> ic( A );
+   blaze::CGSolver<double> cg;
+   cg.solve( A, x, b, ic );
+   \endcode
+
+// Note that the incomplete factorization of a positive definite matrix may break down due to a
+// non-positive pivot, in which case a \a std::runtime_error exception is thrown. The application
+// of the preconditioner consists of a forward and a backward substitution, which are performed
+// sequentially.
+*/
+template< typename Type >  // Data type of the elements
+class IC0Preconditioner
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline IC0Preconditioner();
+
+   template< typename MT, bool SO >
+   explicit inline IC0Preconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Setup functions*****************************************************************************
+   /*!\name Setup functions */
+   //@{
+   template< typename MT, bool SO > void compute( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+
+   template< typename VT1, typename VT2 >
+   void apply( VT1& z, const VT2& r ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   CompressedMatrix<Type,rowMajor> l_;    //!< The incomplete factor L.
+   DynamicVector<Type>             inv_;  //!< The inverse diagonal of L.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for IC0Preconditioner.
+*/
+template< typename Type >  // Data type of the elements
+inline IC0Preconditioner<Type>::IC0Preconditioner()
+   : l_  ()  // The incomplete factor L
+   , inv_()  // The inverse diagonal of L
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the IC(0) preconditioner of the given matrix.
+//
+// \param A The symmetric (or Hermitian) positive definite system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Incomplete decomposition of indefinite matrix failed.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+inline IC0Preconditioner<Type>::IC0Preconditioner( const Matrix<MT,SO>& A )
+   : IC0Preconditioner()
+{
+   compute( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SETUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the IC(0) preconditioner of the given matrix.
+//
+// \param A The symmetric (or Hermitian) positive definite system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Incomplete decomposition of indefinite matrix failed.
+//
+// This function computes the incomplete Cholesky decomposition of the given matrix row by row,
+// restricted to the sparsity pattern of the lower part of \a A. Dense matrices are treated as
+// sparse matrices with their nonzero elements as pattern.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+void IC0Preconditioner<Type>::compute( const Matrix<MT,SO>& A )
+{
+   using std::sqrt;
+
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const CompressedMatrix<Type,rowMajor> tmp( *A );
+
+   const size_t n( tmp.rows() );
+
+   // Extraction of the lower part of the system matrix
+   CompressedMatrix<Type,rowMajor> l( n, n );
+   l.reserve( ( tmp.nonZeros() + n ) / 2UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=tmp.begin(i); element!=tmp.end(i) && element->index()<=i; ++element ) {
+         l.append( i, element->index(), element->value() );
+      }
+      l.finalize( i );
+   }
+
+   // Row-wise incomplete factorization
+   DynamicVector<Type> inv( n );
+   std::vector<Type*> pos( n, nullptr );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const auto begin( l.begin(i) );
+      const auto end  ( l.end(i) );
+
+      if( begin == end || (end-1)->index() != i ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Incomplete decomposition of indefinite matrix failed" );
+      }
+
+      const auto d( end-1 );
+
+      for( auto element=begin; element!=d; ++element ) {
+         pos[element->index()] = &element->value();
+      }
+
+      Type diagonal( d->value() );
+
+      for( auto element=begin; element!=d; ++element )
+      {
+         const size_t k( element->index() );
+
+         Type sum( element->value() );
+         for( auto other=l.begin(k); other->index()<k; ++other ) {
+            if( pos[other->index()] != nullptr ) {
+               sum -= *pos[other->index()] * conj( other->value() );
+            }
+         }
+
+         element->value() = sum * inv[k];
+         diagonal -= element->value() * conj( element->value() );
+      }
+
+      if( !( real( diagonal ) > 0 ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Incomplete decomposition of indefinite matrix failed" );
+      }
+
+      d->value() = Type( sqrt( real( diagonal ) ) );
+      inv[i] = Type(1) / d->value();
+
+      for( auto element=begin; element!=d; ++element ) {
+         pos[element->index()] = nullptr;
+      }
+   }
+
+   l_.swap( l );
+   inv_.swap( inv );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the preconditioning matrix.
+//
+// \return The size of the preconditioner.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t IC0Preconditioner<Type>::size() const noexcept
+{
+   return l_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = (L L^H)^{-1} r \f$).
+//
+// \param z The target vector.
+// \param r The source vector.
+// \return void
+*/
+template< typename Type >  // Data type of the elements
+template< typename VT1     // Type of the target vector
+        , typename VT2 >   // Type of the source vector
+void IC0Preconditioner<Type>::apply( VT1& z, const VT2& r ) const
+{
+   const size_t n( l_.rows() );
+
+   z = r;
+
+   // Forward substitution with the lower triangular factor L
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const auto d( l_.end(i) - 1 );
+
+      Type sum( z[i] );
+      for( auto element=l_.begin(i); element!=d; ++element ) {
+         sum -= element->value() * z[element->index()];
+      }
+      z[i] = sum * inv_[i];
+   }
+
+   // Backward substitution with the upper triangular factor L^H
+   for( size_t i=n; i-->0UL; )
+   {
+      const auto d( l_.end(i) - 1 );
+
+      z[i] *= inv_[i];
+
+      const Type zi( z[i] );
+      for( auto element=l_.begin(i); element!=d; ++element ) {
+         z[element->index()] -= conj( element->value() ) * zi;
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
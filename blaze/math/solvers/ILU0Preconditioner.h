@@ -0,0 +1,322 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/ILU0Preconditioner.h
+//  \brief Header file for the ILU(0) preconditioner of the iterative solvers
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_ILU0PRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_ILU0PRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete LU preconditioner without fill-in (ILU(0)) for the iterative solvers.
+// \ingroup math
+//
+// The ILU0Preconditioner class template represents the preconditioning matrix \f$ M = L U \f$,
+// where the unit lower triangular matrix \a L and the upper triangular matrix \a U have the same
+// sparsity pattern as the lower and upper part of the system matrix \a A, respectively. Both
+// factors are stored in a single row-major compressed matrix. The factorization requires a
+// structurally nonzero diagonal and is performed without pivoting:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::ILU0Preconditioner<double> ilu( A );
+   blaze::BiCGStabSolver<double> bicgstab;
+   bicgstab.solve( A, x, b, ilu );
+   \endcode
+
+// The application of the preconditioner consists of a forward and a backward substitution,
+// which are performed sequentially.
+*/
+template< typename Type >  // Data type of the elements
+class ILU0Preconditioner
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline ILU0Preconditioner();
+
+   template< typename MT, bool SO >
+   explicit inline ILU0Preconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Setup functions*****************************************************************************
+   /*!\name Setup functions */
+   //@{
+   template< typename MT, bool SO > void compute( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+
+   template< typename VT1, typename VT2 >
+   void apply( VT1& z, const VT2& r ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   CompressedMatrix<Type,rowMajor> lu_;    //!< The combined incomplete factors L and U.
+   std::vector<size_t>             diag_;  //!< The position of the diagonal element per row.
+   DynamicVector<Type>             inv_;   //!< The inverse diagonal of U.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for ILU0Preconditioner.
+*/
+template< typename Type >  // Data type of the elements
+inline ILU0Preconditioner<Type>::ILU0Preconditioner()
+   : lu_  ()  // The combined incomplete factors L and U
+   , diag_()  // The position of the diagonal element per row
+   , inv_ ()  // The inverse diagonal of U
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the ILU(0) preconditioner of the given matrix.
+//
+// \param A The system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Incomplete decomposition of singular matrix failed.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+inline ILU0Preconditioner<Type>::ILU0Preconditioner( const Matrix<MT,SO>& A )
+   : ILU0Preconditioner()
+{
+   compute( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SETUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the ILU(0) preconditioner of the given matrix.
+//
+// \param A The system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Incomplete decomposition of singular matrix failed.
+//
+// This function computes the incomplete LU decomposition of the given matrix by means of the
+// row-wise IKJ variant of Gaussian elimination, restricted to the sparsity pattern of \a A.
+// Dense matrices are treated as sparse matrices with their nonzero elements as pattern.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+void ILU0Preconditioner<Type>::compute( const Matrix<MT,SO>& A )
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   CompressedMatrix<Type,rowMajor> lu( *A );
+
+   const size_t n( lu.rows() );
+
+   std::vector<size_t> diag( n );
+   DynamicVector<Type> inv( n );
+   std::vector<Type*> pos( n, nullptr );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const auto begin( lu.begin(i) );
+      const auto end  ( lu.end(i) );
+      const auto d    ( lu.find( i, i ) );
+
+      if( d == end ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Incomplete decomposition of singular matrix failed" );
+      }
+
+      for( auto element=begin; element!=end; ++element ) {
+         pos[element->index()] = &element->value();
+      }
+
+      for( auto element=begin; element!=d; ++element )
+      {
+         const size_t k( element->index() );
+
+         element->value() *= inv[k];
+
+         for( auto upper=lu.begin(k)+diag[k]+1UL; upper!=lu.end(k); ++upper ) {
+            if( pos[upper->index()] != nullptr ) {
+               *pos[upper->index()] -= element->value() * upper->value();
+            }
+         }
+      }
+
+      if( isDefault( d->value() ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Incomplete decomposition of singular matrix failed" );
+      }
+
+      diag[i] = static_cast<size_t>( d - begin );
+      inv[i] = Type(1) / d->value();
+
+      for( auto element=begin; element!=end; ++element ) {
+         pos[element->index()] = nullptr;
+      }
+   }
+
+   lu_.swap( lu );
+   diag_.swap( diag );
+   inv_.swap( inv );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the preconditioning matrix.
+//
+// \return The size of the preconditioner.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t ILU0Preconditioner<Type>::size() const noexcept
+{
+   return lu_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = (LU)^{-1} r \f$).
+//
+// \param z The target vector.
+// \param r The source vector.
+// \return void
+*/
+template< typename Type >  // Data type of the elements
+template< typename VT1     // Type of the target vector
+        , typename VT2 >   // Type of the source vector
+void ILU0Preconditioner<Type>::apply( VT1& z, const VT2& r ) const
+{
+   const size_t n( lu_.rows() );
+
+   z = r;
+
+   // Forward substitution with the unit lower triangular factor L
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const auto begin( lu_.begin(i) );
+      const auto d    ( begin + diag_[i] );
+
+      Type sum( z[i] );
+      for( auto element=begin; element!=d; ++element ) {
+         sum -= element->value() * z[element->index()];
+      }
+      z[i] = sum;
+   }
+
+   // Backward substitution with the upper triangular factor U
+   for( size_t i=n; i-->0UL; )
+   {
+      const auto end( lu_.end(i) );
+
+      Type sum( z[i] );
+      for( auto element=lu_.begin(i)+diag_[i]+1UL; element!=end; ++element ) {
+         sum -= element->value() * z[element->index()];
+      }
+      z[i] = sum * inv_[i];
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,97 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/IdentityPreconditioner.h
+//  \brief Header file for the identity preconditioner of the iterative solvers
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_IDENTITYPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_IDENTITYPRECONDITIONER_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Identity preconditioner for the iterative solvers.
+// \ingroup math
+//
+// The IdentityPreconditioner class represents the absence of a preconditioner. It is used by
+// default by all iterative solvers, which detect it at compile time and skip its application.
+//
+// Every preconditioner of the iterative solvers provides an \c apply() member function with the
+// same signature, which computes \f$ z = M^{-1} r \f$ for the preconditioning matrix \a M. Any
+// user-defined class with an according \c apply() function can be used as preconditioner.
+*/
+class IdentityPreconditioner
+{
+ public:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void apply( VT1& z, const VT2& r ) const;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = r \f$).
+//
+// \param z The target vector.
+// \param r The source vector.
+// \return void
+*/
+template< typename VT1   // Type of the target vector
+        , typename VT2 > // Type of the source vector
+inline void IdentityPreconditioner::apply( VT1& z, const VT2& r ) const
+{
+   z = r;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,220 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/IterativeSolver.h
+//  \brief Header file for the common settings of the iterative solvers
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_ITERATIVESOLVER_H_
+#define _BLAZE_MATH_SOLVERS_ITERATIVESOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Exception.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Result of an iterative solution of a linear system of equations.
+// \ingroup math
+//
+// The IterativeSolverInfo class describes the outcome of a single call to the \c solve() function
+// of an iterative solver (as for instance the CGSolver or the GMRESSolver class template).
+*/
+struct IterativeSolverInfo
+{
+   bool   converged;   //!< \a true in case the requested tolerance has been reached.
+   size_t iterations;  //!< The number of performed iterations.
+   double residual;    //!< The final relative residual norm.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Base class for all iterative solvers.
+// \ingroup math
+//
+// The IterativeSolver class holds the stopping criteria shared by all iterative solvers. An
+// iterative solution is considered converged as soon as the relative residual norm drops below
+// the given tolerance:
+
+      \f[ \frac{\|b - A x\|}{\|b\|} \le tolerance \f]
+
+// The default tolerance is \f$ 10^{-8} \f$. The number of iterations is limited to the given
+// maximum number of iterations. By default, the limit is twice the number of unknowns.
+*/
+class IterativeSolver
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline IterativeSolver() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline double tolerance    () const noexcept;
+   inline size_t maxIterations() const noexcept;
+
+   inline void setTolerance    ( double tolerance );
+   inline void setMaxIterations( size_t iterations ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ protected:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t iterationLimit( size_t n ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   double tolerance_;      //!< The relative residual tolerance.
+   size_t maxIterations_;  //!< The maximum number of iterations (0 for the default limit).
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for IterativeSolver.
+*/
+inline IterativeSolver::IterativeSolver() noexcept
+   : tolerance_    ( 1E-8 )  // The relative residual tolerance
+   , maxIterations_( 0UL )   // The maximum number of iterations
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the relative residual tolerance.
+//
+// \return The relative residual tolerance.
+*/
+inline double IterativeSolver::tolerance() const noexcept
+{
+   return tolerance_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of iterations.
+//
+// \return The maximum number of iterations (0 in case the default limit is used).
+*/
+inline size_t IterativeSolver::maxIterations() const noexcept
+{
+   return maxIterations_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the relative residual tolerance.
+//
+// \param tolerance The new relative residual tolerance.
+// \return void
+// \exception std::invalid_argument Invalid tolerance specified.
+*/
+inline void IterativeSolver::setTolerance( double tolerance )
+{
+   if( !( tolerance > 0.0 ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid tolerance specified" );
+   }
+
+   tolerance_ = tolerance;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the maximum number of iterations.
+//
+// \param iterations The new maximum number of iterations (0 for the default limit).
+// \return void
+*/
+inline void IterativeSolver::setMaxIterations( size_t iterations ) noexcept
+{
+   maxIterations_ = iterations;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the effective iteration limit for a system with \a n unknowns.
+//
+// \param n The number of unknowns.
+// \return The maximum number of iterations.
+*/
+inline size_t IterativeSolver::iterationLimit( size_t n ) const noexcept
+{
+   return ( maxIterations_ != 0UL ? maxIterations_ : 2UL*n );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
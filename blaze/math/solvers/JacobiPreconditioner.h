@@ -0,0 +1,241 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/JacobiPreconditioner.h
+//  \brief Header file for the Jacobi preconditioner of the iterative solvers
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_JACOBIPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_JACOBIPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/views/Band.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Jacobi (diagonal) preconditioner for the iterative solvers.
+// \ingroup math
+//
+// The JacobiPreconditioner class template represents the preconditioning matrix \f$ M = D \f$,
+// where \a D is the diagonal of the system matrix. The inverse diagonal is stored explicitly,
+// such that the application of the preconditioner is a single (vectorized and parallelized)
+// componentwise multiplication:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::JacobiPreconditioner<double> jacobi( A );
+   blaze::CGSolver<double> cg;
+   cg.solve( A, x, b, jacobi );
+   \endcode
+*/
+template< typename Type >  // Data type of the elements
+class JacobiPreconditioner
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline JacobiPreconditioner();
+
+   template< typename MT, bool SO >
+   explicit inline JacobiPreconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Setup functions*****************************************************************************
+   /*!\name Setup functions */
+   //@{
+   template< typename MT, bool SO > void compute( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+
+   template< typename VT1, typename VT2 >
+   inline void apply( VT1& z, const VT2& r ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DynamicVector<Type> inv_;  //!< The inverse diagonal of the system matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for JacobiPreconditioner.
+*/
+template< typename Type >  // Data type of the elements
+inline JacobiPreconditioner<Type>::JacobiPreconditioner()
+   : inv_()  // The inverse diagonal of the system matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the Jacobi preconditioner of the given matrix.
+//
+// \param A The system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Zero diagonal element detected.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+inline JacobiPreconditioner<Type>::JacobiPreconditioner( const Matrix<MT,SO>& A )
+   : JacobiPreconditioner()
+{
+   compute( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SETUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the Jacobi preconditioner of the given matrix.
+//
+// \param A The system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Zero diagonal element detected.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+void JacobiPreconditioner<Type>::compute( const Matrix<MT,SO>& A )
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   DynamicVector<Type> inv( diagonal( *A ) );
+
+   for( size_t i=0UL; i<inv.size(); ++i ) {
+      if( isDefault( inv[i] ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Zero diagonal element detected" );
+      }
+      inv[i] = Type(1) / inv[i];
+   }
+
+   inv_.swap( inv );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the preconditioning matrix.
+//
+// \return The size of the preconditioner.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t JacobiPreconditioner<Type>::size() const noexcept
+{
+   return inv_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = D^{-1} r \f$).
+//
+// \param z The target vector.
+// \param r The source vector.
+// \return void
+*/
+template< typename Type >  // Data type of the elements
+template< typename VT1     // Type of the target vector
+        , typename VT2 >   // Type of the source vector
+inline void JacobiPreconditioner<Type>::apply( VT1& z, const VT2& r ) const
+{
+   z = inv_ * r;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,302 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/LinearOperator.h
+//  \brief Header file for the matrix-free linear operators of the iterative solvers
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_LINEAROPERATOR_H_
+#define _BLAZE_MATH_SOLVERS_LINEAROPERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Matrix-free square linear operator.
+// \ingroup math
+//
+// The LinearOperator class template represents a square \a n x \a n linear operator, which is
+// only given by its action on a vector. It enables the iterative solvers to work on operators
+// that are never assembled as a matrix. The given function \a op is called with the target
+// and the source vector as arguments and has to compute \f$ y = A x \f$:
+
+   \code
+   using blaze::DynamicVector;
+
+   // One-dimensional Laplacian with Dirichlet boundaries
+   auto A = blaze::linearOperator( n, []( DynamicVector<double>& y, const DynamicVector<double>& x )
+   {
+      const size_t n( x.size() );
+      for( size_t i=0UL; i<n; ++i ) {
+         y[i] = 2.0*x[i] - ( i > 0UL ? x[i-1UL] : 0.0 ) - ( i+1UL < n ? x[i+1UL] : 0.0 );
+      }
+   } );
+
+   blaze::CGSolver<double> cg;
+   cg.solve( A, x, b );
+   \endcode
+
+// The target vector passed to \a op is already resized to \a n elements.
+*/
+template< typename OP >  // Type of the operator function
+class LinearOperator
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline LinearOperator( size_t n, OP op );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows   () const noexcept;
+   inline size_t columns() const noexcept;
+
+   template< typename VT1, typename VT2 >
+   inline void apply( VT1& y, const VT2& x ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;   //!< The number of rows and columns of the operator.
+   OP     op_;  //!< The operator function.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for LinearOperator.
+//
+// \param n The number of rows and columns of the operator.
+// \param op The operator function computing \f$ y = A x \f$.
+*/
+template< typename OP >  // Type of the operator function
+inline LinearOperator<OP>::LinearOperator( size_t n, OP op )
+   : n_ ( n )              // The number of rows and columns of the operator
+   , op_( std::move(op) )  // The operator function
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the operator.
+//
+// \return The number of rows of the operator.
+*/
+template< typename OP >  // Type of the operator function
+inline size_t LinearOperator<OP>::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the operator.
+//
+// \return The number of columns of the operator.
+*/
+template< typename OP >  // Type of the operator function
+inline size_t LinearOperator<OP>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the operator to the given vector (\f$ y = A x \f$).
+//
+// \param y The target vector.
+// \param x The source vector.
+// \return void
+*/
+template< typename OP >  // Type of the operator function
+template< typename VT1   // Type of the target vector
+        , typename VT2 > // Type of the source vector
+inline void LinearOperator<OP>::apply( VT1& y, const VT2& x ) const
+{
+   op_( y, x );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a matrix-free square linear operator.
+// \ingroup math
+//
+// \param n The number of rows and columns of the operator.
+// \param op The operator function computing \f$ y = A x \f$.
+// \return The linear operator.
+*/
+template< typename OP >  // Type of the operator function
+inline LinearOperator<OP> linearOperator( size_t n, OP op )
+{
+   return LinearOperator<OP>( n, std::move(op) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of unknowns of the given system matrix.
+// \ingroup math
+//
+// \param A The system matrix.
+// \return The number of rows and columns of the matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+inline size_t operatorSize( const Matrix<MT,SO>& A )
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   return (*A).rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of unknowns of the given linear operator.
+// \ingroup math
+//
+// \param A The linear operator.
+// \return The number of rows and columns of the operator.
+*/
+template< typename OP >  // Type of the operator function
+inline size_t operatorSize( const LinearOperator<OP>& A ) noexcept
+{
+   return A.rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given system matrix to a dense vector (\f$ y = A x \f$).
+// \ingroup math
+//
+// \param A The system matrix.
+// \param y The target vector.
+// \param x The source vector.
+// \return void
+//
+// The product is evaluated by the regular matrix/vector multiplication, which is parallelized
+// by the active SMP backend for sufficiently large dense and sparse matrices.
+*/
+template< typename MT    // Type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename VT1   // Type of the target vector
+        , typename VT2 > // Type of the source vector
+inline void applyOperator( const Matrix<MT,SO>& A, VT1& y, const VT2& x )
+{
+   y = (*A) * x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given linear operator to a dense vector (\f$ y = A x \f$).
+// \ingroup math
+//
+// \param A The linear operator.
+// \param y The target vector.
+// \param x The source vector.
+// \return void
+*/
+template< typename OP    // Type of the operator function
+        , typename VT1   // Type of the target vector
+        , typename VT2 > // Type of the source vector
+inline void applyOperator( const LinearOperator<OP>& A, VT1& y, const VT2& x )
+{
+   A.apply( y, x );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
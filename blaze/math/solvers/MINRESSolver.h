@@ -0,0 +1,337 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/MINRESSolver.h
+//  \brief Header file for the minimal residual (MINRES) solver
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_MINRESSOLVER_H_
+#define _BLAZE_MATH_SOLVERS_MINRESSOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Fuse.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/IterativeSolver.h>
+#include <blaze/math/solvers/LinearOperator.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Preconditioned minimal residual (MINRES) solver.
+// \ingroup math
+//
+// The MINRESSolver class template solves a linear system of equations \f$ A x = b \f$ with
+// symmetric (or Hermitian), possibly indefinite system matrix \a A by means of the preconditioned
+// minimal residual method of Paige and Saunders. The system matrix can be any square dense or
+// sparse matrix or a matrix-free LinearOperator, the preconditioner has to be symmetric (or
+// Hermitian) positive definite (as for instance the JacobiPreconditioner of a matrix with
+// positive diagonal or the IC0Preconditioner):
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::MINRESSolver<double> minres;
+
+   const blaze::IterativeSolverInfo info( minres.solve( A, x, b ) );
+
+   if( !info.converged ) { ... }
+   \endcode
+
+// In contrast to the other solvers the convergence of MINRES is measured in the norm induced
+// by the inverse of the preconditioner, i.e. the solver stops as soon as
+// \f$ \|b - A x\|_{M^{-1}} \le tolerance \cdot \|b\|_{M^{-1}} \f$. Without preconditioning this
+// is the regular relative residual. The internal work vectors are kept between two calls to
+// \c solve(), i.e. repeated solutions of systems of the same size don't require any memory
+// allocation.
+*/
+template< typename Type >  // Data type of the elements
+class MINRESSolver
+   : public IterativeSolver
+{
+ public:
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename OP, typename VT1, typename VT2 >
+   IterativeSolverInfo solve( const OP& A, DenseVector<VT1,false>& x,
+                              const DenseVector<VT2,false>& b );
+
+   template< typename OP, typename VT1, typename VT2, typename PC >
+   IterativeSolverInfo solve( const OP& A, DenseVector<VT1,false>& x,
+                              const DenseVector<VT2,false>& b, const PC& M );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using RealType = UnderlyingBuiltin_t<Type>;  //!< Real type of the scalar values.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DynamicVector<Type> r1_;  //!< The second to last Lanczos vector (unpreconditioned).
+   DynamicVector<Type> r2_;  //!< The last Lanczos vector (unpreconditioned).
+   DynamicVector<Type> y_;   //!< The new (preconditioned) Lanczos vector.
+   DynamicVector<Type> v_;   //!< The normalized Lanczos vector.
+   DynamicVector<Type> w_;   //!< The current search direction.
+   DynamicVector<Type> w1_;  //!< The second to last search direction.
+   DynamicVector<Type> w2_;  //!< The last search direction.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations without preconditioning.
+//
+// \param A The symmetric (or Hermitian) system matrix or linear operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \return The information about the convergence of the solver.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+*/
+template< typename Type >  // Data type of the elements
+template< typename OP      // Type of the system matrix or operator
+        , typename VT1     // Type of the solution vector
+        , typename VT2 >   // Type of the right-hand side vector
+IterativeSolverInfo MINRESSolver<Type>::solve( const OP& A, DenseVector<VT1,false>& x,
+                                               const DenseVector<VT2,false>& b )
+{
+   return solve( A, x, b, IdentityPreconditioner() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations.
+//
+// \param A The symmetric (or Hermitian) system matrix or linear operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param M The symmetric (or Hermitian) positive definite preconditioner.
+// \return The information about the convergence of the solver.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid indefinite preconditioner provided.
+//
+// In case the size of the solution vector \a x doesn't match the size of the system, \a x is
+// resized and the zero vector is used as initial guess.
+*/
+template< typename Type >  // Data type of the elements
+template< typename OP      // Type of the system matrix or operator
+        , typename VT1     // Type of the solution vector
+        , typename VT2     // Type of the right-hand side vector
+        , typename PC >    // Type of the preconditioner
+IterativeSolverInfo MINRESSolver<Type>::solve( const OP& A, DenseVector<VT1,false>& x,
+                                               const DenseVector<VT2,false>& b, const PC& M )
+{
+   using std::abs;
+   using std::sqrt;
+
+   const size_t n( operatorSize( A ) );
+
+   if( (*b).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( (*x).size() != n ) {
+      resize( *x, n, false );
+      reset( *x );
+   }
+
+   r1_.resize( n, false );
+   r2_.resize( n, false );
+   y_.resize ( n, false );
+   v_.resize ( n, false );
+   w_.resize ( n, false );
+   w1_.resize( n, false );
+   w2_.resize( n, false );
+
+   // Computing the norm of the right-hand side vector
+   M.apply( y_, *b );
+
+   const RealType bb( real( dot( conj( *b ), y_ ) ) );
+
+   if( bb < RealType(0) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid indefinite preconditioner provided" );
+   }
+
+   const RealType bnorm( sqrt( bb ) );
+
+   if( bnorm == RealType(0) ) {
+      reset( *x );
+      return IterativeSolverInfo{ true, 0UL, 0.0 };
+   }
+
+   const RealType threshold( RealType( tolerance() ) * bnorm );
+
+   // Computing the initial residual
+   v_ = *x;
+   applyOperator( A, y_, v_ );
+   r1_ = *b - y_;
+   M.apply( y_, r1_ );
+
+   const RealType rr( real( dot( conj( r1_ ), y_ ) ) );
+
+   if( rr < RealType(0) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid indefinite preconditioner provided" );
+   }
+
+   RealType beta( sqrt( rr ) );
+
+   if( beta <= threshold ) {
+      return IterativeSolverInfo{ true, 0UL, double( beta / bnorm ) };
+   }
+
+   r2_ = r1_;
+   reset( w_ );
+   reset( w2_ );
+
+   RealType oldb  ( 0 );
+   RealType dbar  ( 0 );
+   RealType epsln ( 0 );
+   RealType phibar( beta );
+   RealType cs    ( -1 );
+   RealType sn    ( 0 );
+
+   const size_t limit( iterationLimit( n ) );
+
+   for( size_t iteration=1UL; iteration<=limit; ++iteration )
+   {
+      // Lanczos step
+      v_ = y_ * ( RealType(1) / beta );
+      applyOperator( A, y_, v_ );
+
+      const RealType scale( iteration > 1UL ? beta / oldb : RealType(0) );
+
+      Type va{};
+      fuse( lazySubAssign( y_, scale * r1_ ), lazySum( va, conj( v_ ) * y_ ) );
+
+      const RealType alpha( real( va ) );
+
+      y_ -= ( alpha / beta ) * r2_;
+
+      swap( r1_, r2_ );
+      swap( r2_, y_ );
+      M.apply( y_, r2_ );
+
+      oldb = beta;
+
+      const RealType bsq( real( dot( conj( r2_ ), y_ ) ) );
+
+      if( bsq < RealType(0) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid indefinite preconditioner provided" );
+      }
+
+      beta = sqrt( bsq );
+
+      // Application of the previous and computation of the new Givens rotation
+      const RealType oldeps( epsln );
+      const RealType delta ( cs*dbar + sn*alpha );
+      const RealType gbar  ( sn*dbar - cs*alpha );
+
+      epsln = sn * beta;
+      dbar  = -cs * beta;
+
+      const RealType gamma( sqrt( gbar*gbar + beta*beta ) );
+
+      if( gamma == RealType(0) ) {
+         return IterativeSolverInfo{ false, iteration, double( phibar / bnorm ) };
+      }
+
+      cs = gbar / gamma;
+      sn = beta / gamma;
+
+      const RealType phi( cs * phibar );
+      phibar *= sn;
+
+      // Update of the search directions and the solution
+      swap( w1_, w2_ );
+      swap( w2_, w_ );
+
+      fuse( lazyAssign( w_, ( v_ - oldeps * w1_ - delta * w2_ ) * ( RealType(1) / gamma ) )
+          , lazyAddAssign( *x, phi * w_ ) );
+
+      if( phibar <= threshold ) {
+         return IterativeSolverInfo{ true, iteration, double( phibar / bnorm ) };
+      }
+
+      if( beta == RealType(0) ) {
+         return IterativeSolverInfo{ false, iteration, double( phibar / bnorm ) };
+      }
+   }
+
+   return IterativeSolverInfo{ false, limit, double( phibar / bnorm ) };
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
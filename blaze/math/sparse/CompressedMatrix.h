@@ -784,11 +784,9 @@ template< typename MT     // Type of the foreign dense matrix
 inline CompressedMatrix<Type,SO,Tag>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
    : CompressedMatrix( (*dm).rows(), (*dm).columns() )
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
-   assign( *this, *dm );
+   smpAssign( *this, *dm );
 }
 //*************************************************************************************************
 
@@ -806,11 +804,9 @@ template< typename MT     // Type of the foreign compressed matrix
 inline CompressedMatrix<Type,SO,Tag>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
    : CompressedMatrix( (*sm).rows(), (*sm).columns(), (*sm).nonZeros() )
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
-   assign( *this, *sm );
+   smpAssign( *this, *sm );
 }
 //*************************************************************************************************
 
@@ -1289,8 +1285,6 @@ template< typename MT     // Type of the right-hand side dense matrix
 inline CompressedMatrix<Type,SO,Tag>&
    CompressedMatrix<Type,SO,Tag>::operator=( const DenseMatrix<MT,SO2>& rhs ) &
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
    if( (*rhs).canAlias( this ) ) {
@@ -1299,7 +1293,7 @@ inline CompressedMatrix<Type,SO,Tag>&
    }
    else {
       resize( (*rhs).rows(), (*rhs).columns(), false );
-      assign( *this, *rhs );
+      smpAssign( *this, *rhs );
    }
 
    return *this;
@@ -1324,8 +1318,6 @@ template< typename MT     // Type of the right-hand side compressed matrix
 inline CompressedMatrix<Type,SO,Tag>&
    CompressedMatrix<Type,SO,Tag>::operator=( const SparseMatrix<MT,SO2>& rhs ) &
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
    if( (*rhs).canAlias( this ) ||
@@ -1339,7 +1331,7 @@ inline CompressedMatrix<Type,SO,Tag>&
       reset();
 
       if( !IsZero_v<MT> ) {
-         assign( *this, *rhs );
+         smpAssign( *this, *rhs );
       }
    }
 
@@ -3670,11 +3662,9 @@ template< typename MT     // Type of the foreign dense matrix
 inline CompressedMatrix<Type,true,Tag>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
    : CompressedMatrix( (*dm).rows(), (*dm).columns() )
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
-   assign( *this, *dm );
+   smpAssign( *this, *dm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3693,11 +3683,9 @@ template< typename MT     // Type of the foreign compressed matrix
 inline CompressedMatrix<Type,true,Tag>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
    : CompressedMatrix( (*sm).rows(), (*sm).columns(), (*sm).nonZeros() )
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
-   assign( *this, *sm );
+   smpAssign( *this, *sm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4167,8 +4155,6 @@ template< typename MT     // Type of the right-hand side dense matrix
 inline CompressedMatrix<Type,true,Tag>&
    CompressedMatrix<Type,true,Tag>::operator=( const DenseMatrix<MT,SO>& rhs ) &
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
    if( (*rhs).canAlias( this ) ) {
@@ -4177,7 +4163,7 @@ inline CompressedMatrix<Type,true,Tag>&
    }
    else {
       resize( (*rhs).rows(), (*rhs).columns(), false );
-      assign( *this, *rhs );
+      smpAssign( *this, *rhs );
    }
 
    return *this;
@@ -4203,8 +4189,6 @@ template< typename MT     // Type of the right-hand side compressed matrix
 inline CompressedMatrix<Type,true,Tag>&
    CompressedMatrix<Type,true,Tag>::operator=( const SparseMatrix<MT,SO>& rhs ) &
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
 
    if( (*rhs).canAlias( this ) ||
@@ -4218,7 +4202,7 @@ inline CompressedMatrix<Type,true,Tag>&
       reset();
 
       if( !IsZero_v<MT> ) {
-         assign( *this, *rhs );
+         smpAssign( *this, *rhs );
       }
    }
 
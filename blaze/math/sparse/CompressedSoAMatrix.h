@@ -0,0 +1,3346 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompressedSoAMatrix.h
+//  \brief Implementation of a structure-of-arrays compressed MxN matrix
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_COMPRESSEDSOAMATRIX_H_
+#define _BLAZE_MATH_SPARSE_COMPRESSEDSOAMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/SameTag.h>
+#include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/SoAIterator.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/IsZero.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/algorithms/Transfer.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compressed_soa_matrix CompressedSoAMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Structure-of-arrays implementation of a \f$ M \times N \f$ compressed matrix.
+// \ingroup compressed_soa_matrix
+//
+// The CompressedSoAMatrix class template is a variant of the CompressedMatrix class template,
+// which stores the values and the indices of the non-zero elements in two separate arrays
+// (structure-of-arrays layout) instead of a single array of value-index-pairs. The type of the
+// elements, the storage order, the group tag and the type of the indices of the matrix can be
+// specified via the four template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, bool SO, typename Tag, typename IT >
+   class CompressedSoAMatrix;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CompressedSoAMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::defaultStorageOrder.
+//  - Tag : optional type parameter to tag the matrix. The default type is blaze::Group0.
+//          See \ref grouping_tagging for details.
+//  - IT  : specifies the unsigned integral type of the stored column (in case of a row-major
+//          matrix) or row (in case of a column-major matrix) indices. The default type is
+//          \a size_t.
+//
+// In case of a CompressedMatrix of \c double values every non-zero element occupies 16 bytes,
+// half of which are spent on the \a size_t index. The separate storage of values and indices
+// avoids any padding within the elements and allows to choose a smaller index type, which
+// reduces the memory footprint (and therefore the memory traffic of all bandwidth-bound
+// operations as for instance sparse matrix/vector multiplications) to 12 bytes per non-zero
+// element for 32-bit indices. Additionally, both arrays are stored contiguously, which enables
+// the vectorized processing of the values and the gathering of vector elements via the indices:
+
+   \code
+   using blaze::CompressedSoAMatrix;
+   using blaze::DynamicVector;
+   using blaze::Group0;
+   using blaze::rowMajor;
+
+   // Row-major compressed matrix with 32-bit column indices
+   CompressedSoAMatrix<double,rowMajor,Group0,uint32_t> A( 1000, 1000 );
+   DynamicVector<double> x( 1000 ), y;
+   // ... Initialization
+
+   y = A * x;  // Sparse matrix/dense vector multiplication
+   \endcode
+
+// Apart from the index type and the layout of the non-zero elements CompressedSoAMatrix provides
+// the same interface as CompressedMatrix and can be used in all sparse matrix operations. Note
+// however that the iterators of a CompressedSoAMatrix don't refer to value-index-pairs but to
+// proxies of type SoAElement, which grant access to the according entries in both arrays. The
+// number of columns (in case of a row-major matrix) or rows (in case of a column-major matrix)
+// is restricted to the range of the index type. In case a larger size is requested, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+class CompressedSoAMatrix
+   : public SparseMatrix< CompressedSoAMatrix<Type,SO,Tag,IT>, SO >
+{
+ private:
+   //**Private class Uninitialized*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Auxiliary helper class for the construction of compressed matrices.
+   */
+   struct Uninitialized {};
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This       = CompressedSoAMatrix<Type,SO,Tag,IT>;  //!< Type of this CompressedSoAMatrix instance.
+   using BaseType   = SparseMatrix<This,SO>;                //!< Base type of this CompressedSoAMatrix instance.
+   using ResultType = This;                                 //!< Result type for expression template evaluations.
+
+   //! Result type with opposite storage order for expression template evaluations.
+   using OppositeType = CompressedSoAMatrix<Type,!SO,Tag,IT>;
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = CompressedSoAMatrix<Type,!SO,Tag,IT>;
+
+   using ElementType    = Type;                             //!< Type of the compressed matrix elements.
+   using TagType        = Tag;                              //!< Tag type of this CompressedSoAMatrix instance.
+   using IndexType      = IT;                               //!< Type of the stored indices.
+   using ReturnType     = const Type&;                      //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                      //!< Data type for composite expression templates.
+   using Reference      = MatrixAccessProxy<This>;          //!< Reference to a compressed matrix value.
+   using ConstReference = const Type&;                      //!< Reference to a constant compressed matrix value.
+   using Iterator       = SoAIterator<Type,IT>;             //!< Iterator over non-constant elements.
+   using ConstIterator  = SoAIterator<const Type,const IT>;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompressedSoAMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = CompressedSoAMatrix<NewType,SO,Tag,IT>;  //!< The type of the other CompressedSoAMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a CompressedSoAMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = CompressedSoAMatrix<Type,SO,Tag,IT>;  //!< The type of the other CompressedSoAMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline CompressedSoAMatrix();
+   inline CompressedSoAMatrix( size_t m, size_t n );
+   inline CompressedSoAMatrix( size_t m, size_t n, size_t nonzeros );
+          CompressedSoAMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+   inline CompressedSoAMatrix( initializer_list< initializer_list<Type> > list );
+
+   inline CompressedSoAMatrix( const CompressedSoAMatrix& sm );
+   inline CompressedSoAMatrix( CompressedSoAMatrix&& sm ) noexcept;
+
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~CompressedSoAMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline CompressedSoAMatrix& operator=( initializer_list< initializer_list<Type> > list ) &;
+   inline CompressedSoAMatrix& operator=( const CompressedSoAMatrix& rhs ) &;
+   inline CompressedSoAMatrix& operator=( CompressedSoAMatrix&& rhs ) & noexcept;
+
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator= ( const DenseMatrix<MT,SO2>&  rhs ) &;
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator= ( const SparseMatrix<MT,SO2>& rhs ) &;
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator+=( const Matrix<MT,SO2>& rhs ) &;
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator-=( const Matrix<MT,SO2>& rhs ) &;
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator%=( const DenseMatrix<MT,SO2>&  rhs ) &;
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator%=( const SparseMatrix<MT,SO2>& rhs ) &;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+          void   resize ( size_t m, size_t n, bool preserve=true );
+   inline void   reserve( size_t nonzeros );
+          void   reserve( size_t i, size_t nonzeros );
+   inline void   trim   ();
+   inline void   trim   ( size_t i );
+   inline void   shrinkToFit();
+   inline void   swap( CompressedSoAMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set     ( size_t i, size_t j, const Type& value );
+   inline Iterator insert  ( size_t i, size_t j, const Type& value );
+   inline void     append  ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void     finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Erase functions*****************************************************************************
+   /*!\name Erase functions */
+   //@{
+   inline void     erase( size_t i, size_t j );
+   inline Iterator erase( size_t i, Iterator pos );
+   inline Iterator erase( size_t i, Iterator first, Iterator last );
+
+   template< typename Pred >
+   inline void erase( Pred predicate );
+
+   template< typename Pred >
+   inline void erase( size_t i, Iterator first, Iterator last, Pred predicate );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level data access***********************************************************************
+   /*!\name Low-level data access */
+   //@{
+   inline Type*       values () noexcept;
+   inline const Type* values () const noexcept;
+   inline IT*         indices() noexcept;
+   inline const IT*   indices() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline CompressedSoAMatrix& transpose();
+   inline CompressedSoAMatrix& ctranspose();
+
+   template< typename Other > inline CompressedSoAMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign     ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT >           inline void assign     ( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT >           inline void assign     ( const SparseMatrix<MT,!SO>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void schurAssign( const DenseMatrix<MT,SO2>&  rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline CompressedSoAMatrix( size_t m, size_t n, Uninitialized );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t outerSize() const noexcept;
+   inline size_t innerSize() const noexcept;
+   inline size_t extendCapacity() const noexcept;
+          void   reserveElements( size_t nonzeros );
+
+   inline Iterator      iterator( size_t pos ) noexcept;
+   inline ConstIterator iterator( size_t pos ) const noexcept;
+   inline size_t        offset  ( ConstIterator it ) const noexcept;
+
+   template< typename Pred >
+   inline size_t removeIf( size_t first, size_t last, Pred predicate );
+
+   static inline void checkIndexRange( size_t size );
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   Iterator insert( size_t pos, size_t i, size_t j, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the compressed matrix.
+   size_t  n_;         //!< The current number of columns of the compressed matrix.
+   size_t  capacity_;  //!< The current capacity of the offset arrays.
+   size_t* begin_;     //!< Offsets of the first non-zero element of each row/column.
+   size_t* end_;       //!< Offsets one past the last non-zero element of each row/column.
+   Type*   values_;    //!< The values of the non-zero elements.
+   IT*     indices_;   //!< The column/row indices of the non-zero elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT   );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+const Type CompressedSoAMatrix<Type,SO,Tag,IT>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompressedSoAMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAMatrix<Type,SO,Tag,IT>::CompressedSoAMatrix()
+   : m_       ( 0UL )      // The current number of rows of the compressed matrix
+   , n_       ( 0UL )      // The current number of columns of the compressed matrix
+   , capacity_( 0UL )      // The current capacity of the offset arrays
+   , begin_   ( nullptr )  // Offsets of the first non-zero element of each row/column
+   , end_     ( nullptr )  // Offsets one past the last non-zero element of each row/column
+   , values_  ( nullptr )  // The values of the non-zero elements
+   , indices_ ( nullptr )  // The column/row indices of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAMatrix<Type,SO,Tag,IT>::CompressedSoAMatrix( size_t m, size_t n )
+   : CompressedSoAMatrix( m, n, Uninitialized() )
+{
+   for( size_t i=1UL; i<2UL*capacity_+2UL; ++i )
+      begin_[i] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAMatrix<Type,SO,Tag,IT>::CompressedSoAMatrix( size_t m, size_t n, size_t nonzeros )
+   : CompressedSoAMatrix( m, n, Uninitialized() )
+{
+   values_  = allocate<Type>( nonzeros );
+   indices_ = allocate<IT>( nonzeros );
+
+   for( size_t i=1UL; i<2UL*capacity_+1UL; ++i )
+      begin_[i] = 0UL;
+   end_[capacity_] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The expected number of non-zero elements in each row/column.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and will have the specified capacity in each
+// row/column. Note that in case of a row-major matrix the given vector must have at least
+// \a m elements, in case of a column-major matrix at least \a n elements.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+CompressedSoAMatrix<Type,SO,Tag,IT>::CompressedSoAMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : CompressedSoAMatrix( m, n, Uninitialized() )
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == capacity_, "Size of capacity vector and matrix size don't match" );
+
+   size_t newCapacity( 0UL );
+   for( auto it=nonzeros.begin(); it!=nonzeros.end(); ++it )
+      newCapacity += *it;
+
+   values_  = allocate<Type>( newCapacity );
+   indices_ = allocate<IT>( newCapacity );
+
+   end_[0UL] = 0UL;
+   for( size_t i=0UL; i<capacity_; ++i ) {
+      begin_[i+1UL] = end_[i+1UL] = begin_[i] + nonzeros[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// This constructor provides the option to explicitly initialize the elements of the matrix by
+// means of an initializer list:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::CompressedSoAMatrix<int,rowMajor> A{ { 1, 2, 3 },
+                                               { 4, 5 },
+                                               { 7, 8, 9 } };
+   \endcode
+
+// The matrix is sized according to the size of the initializer list and all its elements are
+// initialized by the values of the given initializer list. Missing values are considered to
+// be default values.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAMatrix<Type,SO,Tag,IT>::CompressedSoAMatrix( initializer_list< initializer_list<Type> > list )
+   : CompressedSoAMatrix( list.size(), determineColumns( list ), blaze::nonZeros( list ) )
+{
+   *this = list;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CompressedSoAMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAMatrix<Type,SO,Tag,IT>::CompressedSoAMatrix( const CompressedSoAMatrix& sm )
+   : CompressedSoAMatrix( sm.m_, sm.n_, Uninitialized() )
+{
+   const size_t nonzeros( sm.nonZeros() );
+
+   values_  = allocate<Type>( nonzeros );
+   indices_ = allocate<IT>( nonzeros );
+
+   for( size_t i=0UL; i<capacity_; ++i ) {
+      std::copy( sm.values_+sm.begin_[i], sm.values_+sm.end_[i], values_+begin_[i] );
+      std::copy( sm.indices_+sm.begin_[i], sm.indices_+sm.end_[i], indices_+begin_[i] );
+      end_[i] = begin_[i+1UL] = begin_[i] + sm.nonZeros(i);
+   }
+   end_[capacity_] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for CompressedSoAMatrix.
+//
+// \param sm The compressed matrix to be moved into this instance.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAMatrix<Type,SO,Tag,IT>::CompressedSoAMatrix( CompressedSoAMatrix&& sm ) noexcept
+   : m_       ( sm.m_ )         // The current number of rows of the compressed matrix
+   , n_       ( sm.n_ )         // The current number of columns of the compressed matrix
+   , capacity_( sm.capacity_ )  // The current capacity of the offset arrays
+   , begin_   ( sm.begin_ )     // Offsets of the first non-zero element of each row/column
+   , end_     ( sm.end_ )       // Offsets one past the last non-zero element of each row/column
+   , values_  ( sm.values_ )    // The values of the non-zero elements
+   , indices_ ( sm.indices_ )   // The column/row indices of the non-zero elements
+{
+   sm.m_        = 0UL;
+   sm.n_        = 0UL;
+   sm.capacity_ = 0UL;
+   sm.begin_    = nullptr;
+   sm.end_      = nullptr;
+   sm.values_   = nullptr;
+   sm.indices_  = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT     // Type of the foreign dense matrix
+        , bool SO2 >      // Storage order of the foreign dense matrix
+inline CompressedSoAMatrix<Type,SO,Tag,IT>::CompressedSoAMatrix( const DenseMatrix<MT,SO2>& dm )
+   : CompressedSoAMatrix( (*dm).rows(), (*dm).columns() )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   smpAssign( *this, *dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT     // Type of the foreign compressed matrix
+        , bool SO2 >      // Storage order of the foreign compressed matrix
+inline CompressedSoAMatrix<Type,SO,Tag,IT>::CompressedSoAMatrix( const SparseMatrix<MT,SO2>& sm )
+   : CompressedSoAMatrix( (*sm).rows(), (*sm).columns(), (*sm).nonZeros() )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   smpAssign( *this, *sm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an uninitialized matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAMatrix<Type,SO,Tag,IT>::CompressedSoAMatrix( size_t m, size_t n, Uninitialized )
+   : m_       ( m )           // The current number of rows of the compressed matrix
+   , n_       ( n )           // The current number of columns of the compressed matrix
+   , capacity_( SO ? n : m )  // The current capacity of the offset arrays
+   , begin_   ( nullptr )     // Offsets of the first non-zero element of each row/column
+   , end_     ( nullptr )     // Offsets one past the last non-zero element of each row/column
+   , values_  ( nullptr )     // The values of the non-zero elements
+   , indices_ ( nullptr )     // The column/row indices of the non-zero elements
+{
+   checkIndexRange( innerSize() );
+
+   begin_ = new size_t[2UL*capacity_+2UL];
+   end_   = begin_+(capacity_+1UL);
+
+   begin_[0UL] = 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for CompressedSoAMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAMatrix<Type,SO,Tag,IT>::~CompressedSoAMatrix()
+{
+   deallocate( values_ );
+   deallocate( indices_ );
+   delete[] begin_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case the
+// compressed matrix does not yet store an element at position (\a i,\a j) , a new element is
+// inserted into the compressed matrix. Note that this function only performs an index check in
+// case BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to perform a
+// check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::Reference
+   CompressedSoAMatrix<Type,SO,Tag,IT>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::ConstReference
+   CompressedSoAMatrix<Type,SO,Tag,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( SO ? j : i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case the
+// compressed matrix does not yet store an element at position (\a i,\a j) , a new element is
+// inserted into the compressed matrix. In contrast to the function call operator this function
+// always performs a check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::Reference
+   CompressedSoAMatrix<Type,SO,Tag,IT>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::ConstReference
+   CompressedSoAMatrix<Type,SO,Tag,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid compressed matrix row/column access index" );
+   return iterator( begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid compressed matrix row/column access index" );
+   return iterator( begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid compressed matrix row/column access index" );
+   return iterator( begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid compressed matrix row/column access index" );
+   return iterator( end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid compressed matrix row/column access index" );
+   return iterator( end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid compressed matrix row/column access index" );
+   return iterator( end_[i] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// This assignment operator offers the option to directly assign to all elements of the matrix
+// by means of an initializer list:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::CompressedSoAMatrix<int,rowMajor> A;
+   A = { { 1, 2, 3 },
+         { 4, 5 },
+         { 7, 8, 9 } };
+   \endcode
+
+// The matrix is resized according to the given initializer list and all its elements are
+// assigned the values from the given initializer list. Missing values are considered to
+// be default values.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAMatrix<Type,SO,Tag,IT>&
+   CompressedSoAMatrix<Type,SO,Tag,IT>::operator=( initializer_list< initializer_list<Type> > list ) &
+{
+   using blaze::nonZeros;
+
+   resize( list.size(), determineColumns( list ), false );
+   reserve( nonZeros( list ) );
+
+   if( SO )
+   {
+      for( size_t j=0UL; j<n_; ++j )
+      {
+         size_t i( 0UL );
+
+         for( const auto& rowList : list )
+         {
+            if( rowList.size() <= j ) {
+               ++i;
+               continue;
+            }
+
+            auto pos( rowList.begin() );
+            std::advance( pos, j );
+            if( !isDefault<strict>( *pos ) )
+               append( i, j, *pos );
+            ++i;
+         }
+
+         finalize( j );
+      }
+   }
+   else
+   {
+      size_t i( 0UL );
+
+      for( const auto& rowList : list )
+      {
+         size_t j( 0UL );
+
+         for( const Type& element : rowList ) {
+            if( !isDefault<strict>( element ) )
+               append( i, j, element );
+            ++j;
+         }
+
+         finalize( i );
+         ++i;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CompressedSoAMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned compressed matrix.
+//
+// The compressed matrix is resized according to the given compressed matrix and initialized
+// as a copy of this matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAMatrix<Type,SO,Tag,IT>&
+   CompressedSoAMatrix<Type,SO,Tag,IT>::operator=( const CompressedSoAMatrix& rhs ) &
+{
+   if( &rhs == this ) return *this;
+
+   const size_t nonzeros( rhs.nonZeros() );
+
+   if( begin_ == nullptr || rhs.outerSize() > capacity_ || nonzeros > capacity() ) {
+      CompressedSoAMatrix tmp( rhs );
+      swap( tmp );
+   }
+   else {
+      const size_t oldCapacity( capacity() );
+      const size_t outer( rhs.outerSize() );
+
+      for( size_t i=0UL; i<outer; ++i ) {
+         std::copy( rhs.values_+rhs.begin_[i], rhs.values_+rhs.end_[i], values_+begin_[i] );
+         std::copy( rhs.indices_+rhs.begin_[i], rhs.indices_+rhs.end_[i], indices_+begin_[i] );
+         end_[i] = begin_[i+1UL] = begin_[i] + rhs.nonZeros(i);
+      }
+      end_[outer] = oldCapacity;
+
+      m_ = rhs.m_;
+      n_ = rhs.n_;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for CompressedSoAMatrix.
+//
+// \param rhs The compressed matrix to be moved into this instance.
+// \return Reference to the assigned compressed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAMatrix<Type,SO,Tag,IT>&
+   CompressedSoAMatrix<Type,SO,Tag,IT>::operator=( CompressedSoAMatrix&& rhs ) & noexcept
+{
+   deallocate( values_ );
+   deallocate( indices_ );
+   delete[] begin_;
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   begin_    = rhs.begin_;
+   end_      = rhs.end_;
+   values_   = rhs.values_;
+   indices_  = rhs.indices_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.begin_    = nullptr;
+   rhs.end_      = nullptr;
+   rhs.values_   = nullptr;
+   rhs.indices_  = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline CompressedSoAMatrix<Type,SO,Tag,IT>&
+   CompressedSoAMatrix<Type,SO,Tag,IT>::operator=( const DenseMatrix<MT,SO2>& rhs ) &
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).canAlias( this ) ) {
+      CompressedSoAMatrix tmp( *rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (*rhs).rows(), (*rhs).columns(), false );
+      smpAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse matrices.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT     // Type of the right-hand side compressed matrix
+        , bool SO2 >      // Storage order of the right-hand side compressed matrix
+inline CompressedSoAMatrix<Type,SO,Tag,IT>&
+   CompressedSoAMatrix<Type,SO,Tag,IT>::operator=( const SparseMatrix<MT,SO2>& rhs ) &
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).canAlias( this ) ||
+       ( SO ? (*rhs).columns() : (*rhs).rows() ) > capacity_ ||
+       (*rhs).nonZeros() > capacity() ) {
+      CompressedSoAMatrix tmp( *rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (*rhs).rows(), (*rhs).columns(), false );
+      reset();
+
+      if( !IsZero_v<MT> ) {
+         smpAssign( *this, *rhs );
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline CompressedSoAMatrix<Type,SO,Tag,IT>&
+   CompressedSoAMatrix<Type,SO,Tag,IT>::operator+=( const Matrix<MT,SO2>& rhs ) &
+{
+   using blaze::addAssign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).rows() != m_ || (*rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( !IsZero_v<MT> ) {
+      addAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT     // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline CompressedSoAMatrix<Type,SO,Tag,IT>&
+   CompressedSoAMatrix<Type,SO,Tag,IT>::operator-=( const Matrix<MT,SO2>& rhs ) &
+{
+   using blaze::subAssign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).rows() != m_ || (*rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( !IsZero_v<MT> ) {
+      subAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a dense matrix
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline CompressedSoAMatrix<Type,SO,Tag,IT>&
+   CompressedSoAMatrix<Type,SO,Tag,IT>::operator%=( const DenseMatrix<MT,SO2>& rhs ) &
+{
+   using blaze::schurAssign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).rows() != m_ || (*rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (*rhs).canAlias( this ) ) {
+      CompressedSoAMatrix tmp( *this % (*rhs) );
+      swap( tmp );
+   }
+   else {
+      CompositeType_t<MT> tmp( *rhs );
+      schurAssign( *this, tmp );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a sparse matrix
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT     // Type of the right-hand side sparse matrix
+        , bool SO2 >      // Storage order of the right-hand side sparse matrix
+inline CompressedSoAMatrix<Type,SO,Tag,IT>&
+   CompressedSoAMatrix<Type,SO,Tag,IT>::operator%=( const SparseMatrix<MT,SO2>& rhs ) &
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+
+   if( (*rhs).rows() != m_ || (*rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( !IsZero_v<MT> ) {
+      CompressedSoAMatrix tmp( *this % (*rhs) );
+      swap( tmp );
+   }
+   else {
+      reset();
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the compressed matrix.
+//
+// \return The number of rows of the compressed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAMatrix<Type,SO,Tag,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the compressed matrix.
+//
+// \return The number of columns of the compressed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAMatrix<Type,SO,Tag,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the compressed matrix.
+//
+// \return The capacity of the compressed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAMatrix<Type,SO,Tag,IT>::capacity() const noexcept
+{
+   if( begin_ != nullptr )
+      return end_[outerSize()];
+   else return 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAMatrix<Type,SO,Tag,IT>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid row/column access index" );
+   return begin_[i+1UL] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the compressed matrix
+//
+// \return The number of non-zero elements in the compressed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAMatrix<Type,SO,Tag,IT>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<outerSize(); ++i )
+      nonzeros += nonZeros( i );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAMatrix<Type,SO,Tag,IT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid row/column access index" );
+   return end_[i] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::reset()
+{
+   for( size_t i=0UL; i<outerSize(); ++i )
+      end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid row/column access index" );
+   end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the compressed matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the compressed matrix is 0.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::clear()
+{
+   if( end_ != nullptr )
+      end_[0UL] = end_[outerSize()];
+   m_ = 0UL;
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the compressed matrix.
+//
+// \param m The new number of rows of the compressed matrix.
+// \param n The new number of columns of the compressed matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+void CompressedSoAMatrix<Type,SO,Tag,IT>::resize( size_t m, size_t n, bool preserve )
+{
+   using std::swap;
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( begin_ == nullptr || size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   if( m == m_ && n == n_ ) return;
+
+   checkIndexRange( SO ? m : n );
+
+   const size_t oldOuter( outerSize() );
+   const size_t oldInner( innerSize() );
+   const size_t outer   ( SO ? n : m );
+   const size_t inner   ( SO ? m : n );
+
+   if( begin_ == nullptr )
+   {
+      begin_ = new size_t[2UL*outer+2UL];
+      end_   = begin_+outer+1UL;
+
+      for( size_t i=0UL; i<2UL*outer+2UL; ++i ) {
+         begin_[i] = 0UL;
+      }
+
+      capacity_ = outer;
+   }
+   else if( outer > capacity_ )
+   {
+      size_t* newBegin( new size_t[2UL*outer+2UL] );
+      size_t* newEnd  ( newBegin+outer+1UL );
+
+      newBegin[0UL] = 0UL;
+
+      if( preserve ) {
+         for( size_t i=0UL; i<oldOuter; ++i ) {
+            newEnd  [i]     = end_  [i];
+            newBegin[i+1UL] = begin_[i+1UL];
+         }
+         for( size_t i=oldOuter; i<outer; ++i ) {
+            newBegin[i+1UL] = newEnd[i] = begin_[oldOuter];
+         }
+      }
+      else {
+         for( size_t i=0UL; i<outer; ++i ) {
+            newBegin[i+1UL] = newEnd[i] = 0UL;
+         }
+      }
+
+      newEnd[outer] = end_[oldOuter];
+
+      swap( newBegin, begin_ );
+      delete[] newBegin;
+      end_ = newEnd;
+      capacity_ = outer;
+   }
+   else if( outer > oldOuter )
+   {
+      end_[outer] = end_[oldOuter];
+
+      if( !preserve ) {
+         for( size_t i=0UL; i<oldOuter; ++i )
+            end_[i] = begin_[i];
+      }
+
+      for( size_t i=oldOuter; i<outer; ++i ) {
+         begin_[i+1UL] = end_[i] = begin_[oldOuter];
+      }
+   }
+   else
+   {
+      const size_t total( end_[oldOuter] );
+
+      if( !preserve ) {
+         for( size_t i=0UL; i<outer; ++i )
+            end_[i] = begin_[i];
+      }
+
+      end_[outer] = total;
+   }
+
+   if( preserve && inner < oldInner ) {
+      for( size_t i=0UL; i<min( outer, oldOuter ); ++i )
+         end_[i] = std::lower_bound( indices_+begin_[i], indices_+end_[i], inner ) - indices_;
+   }
+
+   m_ = m;
+   n_ = n;
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the compressed matrix.
+//
+// \param nonzeros The new minimum capacity of the compressed matrix.
+// \return void
+//
+// This function increases the capacity of the compressed matrix to at least \a nonzeros elements.
+// The current values of the matrix elements and the individual capacities of the matrix rows
+// are preserved.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::reserve( size_t nonzeros )
+{
+   if( nonzeros > capacity() )
+      reserveElements( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the compressed matrix.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// This function increases the capacity of row/column \a i of the compressed matrix to at least
+// \a nonzeros elements. The current values of the compressed matrix and all other individual
+// row/column capacities are preserved. In case the storage order is set to \a rowMajor, the
+// function reserves capacity for row \a i and the index has to be in the range \f$[0..M-1]\f$.
+// In case the storage order is set to \a columnMajor, the function reserves capacity for column
+// \a i and the index has to be in the range \f$[0..N-1]\f$.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+void CompressedSoAMatrix<Type,SO,Tag,IT>::reserve( size_t i, size_t nonzeros )
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid row/column access index" );
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   const size_t outer  ( outerSize() );
+   const size_t current( capacity(i) );
+
+   if( current >= nonzeros ) return;
+
+   const size_t additional( nonzeros - current );
+
+   if( end_[outer] - begin_[outer] < additional )
+   {
+      const size_t newCapacity( begin_[outer] + additional );
+      BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
+
+      Type* newValues ( allocate<Type>( newCapacity ) );
+      IT*   newIndices( allocate<IT>( newCapacity ) );
+
+      size_t pos( 0UL );
+
+      for( size_t k=0UL; k<outer; ++k ) {
+         transfer( values_+begin_[k], values_+end_[k], newValues+pos );
+         std::copy( indices_+begin_[k], indices_+end_[k], newIndices+pos );
+         const size_t total( k == i ? nonzeros : capacity(k) );
+         end_[k] = pos + nonZeros(k);
+         begin_[k] = pos;
+         pos += total;
+      }
+
+      BLAZE_INTERNAL_ASSERT( pos == newCapacity, "Invalid offset calculations" );
+
+      begin_[outer] = end_[outer] = newCapacity;
+
+      std::swap( values_ , newValues  );
+      std::swap( indices_, newIndices );
+      deallocate( newValues );
+      deallocate( newIndices );
+   }
+   else
+   {
+      begin_[outer] += additional;
+      for( size_t j=outer-1UL; j>i; --j ) {
+         std::move_backward( values_+begin_[j], values_+end_[j], values_+end_[j]+additional );
+         std::move_backward( indices_+begin_[j], indices_+end_[j], indices_+end_[j]+additional );
+         begin_[j] += additional;
+         end_  [j] += additional;
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+//
+// The trim() function can be used to reverse the effect of all row/column-specific reserve()
+// calls. The function removes all excessive capacity from all rows (in case of a rowMajor
+// matrix) or columns (in case of a columnMajor matrix). Note that this function does not
+// remove the overall capacity but only reduces the capacity per row/column.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::trim()
+{
+   for( size_t i=0UL; i<outerSize(); ++i )
+      trim( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity of a specific row/column of the compressed matrix.
+//
+// \param i The index of the row/column to be trimmed (\f$[0..M-1]\f$ or \f$[0..N-1]\f$).
+// \return void
+//
+// This function can be used to reverse the effect of a row/column-specific reserve() call.
+// It removes all excessive capacity from the specified row (in case of a rowMajor matrix)
+// or column (in case of a columnMajor matrix). The excessive capacity is assigned to the
+// subsequent row/column.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::trim( size_t i )
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid row/column access index" );
+
+   if( i < ( outerSize() - 1UL ) ) {
+      std::move( values_+begin_[i+1UL], values_+end_[i+1UL], values_+end_[i] );
+      std::move( indices_+begin_[i+1UL], indices_+end_[i+1UL], indices_+end_[i] );
+      end_[i+1UL] = end_[i] + nonZeros( i+1UL );
+   }
+   begin_[i+1UL] = end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+//
+// This function minimizes the capacity of the matrix by removing unused capacity. Please note
+// that in case a reallocation occurs, all iterators (including end() iterators), all pointers
+// and references to elements of this matrix are invalidated.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::shrinkToFit()
+{
+   if( nonZeros() < capacity() ) {
+      CompressedSoAMatrix( *this ).swap( *this );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The compressed matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::swap( CompressedSoAMatrix& sm ) noexcept
+{
+   using std::swap;
+
+   swap( m_, sm.m_ );
+   swap( n_, sm.n_ );
+   swap( capacity_, sm.capacity_ );
+   swap( begin_  , sm.begin_   );
+   swap( end_    , sm.end_     );
+   swap( values_ , sm.values_  );
+   swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major) or columns (column-major) of the matrix.
+//
+// \return The number of rows/columns of the compressed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAMatrix<Type,SO,Tag,IT>::outerSize() const noexcept
+{
+   return ( SO ? n_ : m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns (row-major) or rows (column-major) of the matrix.
+//
+// \return The number of columns/rows of the compressed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAMatrix<Type,SO,Tag,IT>::innerSize() const noexcept
+{
+   return ( SO ? m_ : n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new matrix capacity.
+//
+// \return The new compressed matrix capacity.
+//
+// This function calculates a new matrix capacity based on the current capacity of the sparse
+// matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAMatrix<Type,SO,Tag,IT>::extendCapacity() const noexcept
+{
+   size_t nonzeros( 2UL*capacity()+1UL );
+   nonzeros = blaze::max( nonzeros, 7UL );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity(), "Invalid capacity value" );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reserving the specified number of compressed matrix elements.
+//
+// \param nonzeros The number of matrix elements to be reserved.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+void CompressedSoAMatrix<Type,SO,Tag,IT>::reserveElements( size_t nonzeros )
+{
+   if( begin_ == nullptr ) {
+      begin_ = new size_t[2UL];
+      end_   = begin_+1UL;
+      begin_[0UL] = end_[0UL] = 0UL;
+   }
+
+   const size_t outer( outerSize() );
+
+   Type* newValues ( allocate<Type>( nonzeros ) );
+   IT*   newIndices( allocate<IT>( nonzeros ) );
+
+   for( size_t k=0UL; k<outer; ++k ) {
+      BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid row/column offsets" );
+      transfer( values_+begin_[k], values_+end_[k], newValues+begin_[k] );
+      std::copy( indices_+begin_[k], indices_+end_[k], newIndices+begin_[k] );
+   }
+
+   end_[outer] = nonzeros;
+
+   std::swap( values_ , newValues  );
+   std::swap( indices_, newIndices );
+   deallocate( newValues );
+   deallocate( newIndices );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element at the given offset.
+//
+// \param pos The offset of the element within the value and index arrays.
+// \return Iterator to the element at offset \a pos.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::iterator( size_t pos ) noexcept
+{
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element at the given offset.
+//
+// \param pos The offset of the element within the value and index arrays.
+// \return Iterator to the element at offset \a pos.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::iterator( size_t pos ) const noexcept
+{
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the element referred to by the given iterator.
+//
+// \param it Iterator to an element of the compressed matrix.
+// \return The offset of the element within the value and index arrays.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAMatrix<Type,SO,Tag,IT>::offset( ConstIterator it ) const noexcept
+{
+   return it.base() - values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compacts the elements in the given range that do not fulfill the given predicate.
+//
+// \param first The offset of the first element of the range.
+// \param last The offset one past the last element of the range.
+// \param predicate The unary predicate for the element selection.
+// \return The offset one past the last remaining element.
+//
+// This function removes all elements in the range \f$[first..last)\f$ whose value fulfills the
+// given predicate by moving the remaining elements to the front of the range.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename Pred >  // Type of the unary predicate
+inline size_t CompressedSoAMatrix<Type,SO,Tag,IT>::removeIf( size_t first, size_t last, Pred predicate )
+{
+   size_t pos( first );
+
+   for( ; first!=last; ++first ) {
+      if( !predicate( values_[first] ) ) {
+         if( pos != first ) {
+            values_ [pos] = std::move( values_[first] );
+            indices_[pos] = indices_[first];
+         }
+         ++pos;
+      }
+   }
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given number of columns/rows can be represented by the index type.
+//
+// \param size The number of columns (row-major) or rows (column-major) of the matrix.
+// \return void
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::checkIndexRange( size_t size )
+{
+   if( size > size_t( std::numeric_limits<IT>::max() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix size exceeds the range of the index type" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting an element of the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the compressed matrix. In case the compressed
+// matrix already contains an element with row index \a i and column index \a j its value is
+// modified, else a new element with the given \a value is inserted.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end( SO ? j : i ) && pos->index() == ( SO ? i : j ) ) {
+       pos->value() = value;
+       return pos;
+   }
+   else return insert( offset( pos ), i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid compressed matrix access index.
+//
+// This function inserts a new element into the compressed matrix. However, duplicate elements
+// are not allowed. In case the compressed matrix already contains an element with row index \a i
+// and column index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end( SO ? j : i ) && pos->index() == ( SO ? i : j ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   return insert( offset( pos ), i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed matrix.
+//
+// \param pos The offset of the new element within the value and index arrays.
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+typename CompressedSoAMatrix<Type,SO,Tag,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::insert( size_t pos, size_t i, size_t j, const Type& value )
+{
+   const size_t outer( outerSize() );
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   if( begin_[k+1UL] != end_[k] ) {
+      std::move_backward( values_+pos, values_+end_[k], values_+end_[k]+1UL );
+      std::move_backward( indices_+pos, indices_+end_[k], indices_+end_[k]+1UL );
+      values_ [pos] = value;
+      indices_[pos] = l;
+      ++end_[k];
+
+      return iterator( pos );
+   }
+   else if( end_[outer] != begin_[outer] ) {
+      std::move_backward( values_+pos, values_+end_[outer-1UL], values_+end_[outer-1UL]+1UL );
+      std::move_backward( indices_+pos, indices_+end_[outer-1UL], indices_+end_[outer-1UL]+1UL );
+      values_ [pos] = value;
+      indices_[pos] = l;
+
+      for( size_t q=k+1UL; q<outer+1UL; ++q ) {
+         ++begin_[q];
+         ++end_[q-1UL];
+      }
+
+      return iterator( pos );
+   }
+   else {
+      const size_t newCapacity( extendCapacity() );
+
+      Type* newValues ( allocate<Type>( newCapacity ) );
+      IT*   newIndices( allocate<IT>( newCapacity ) );
+
+      transfer( values_, values_+pos, newValues );
+      std::copy( indices_, indices_+pos, newIndices );
+      newValues [pos] = value;
+      newIndices[pos] = l;
+      transfer( values_+pos, values_+end_[outer-1UL], newValues+pos+1UL );
+      std::copy( indices_+pos, indices_+end_[outer-1UL], newIndices+pos+1UL );
+
+      for( size_t q=k+1UL; q<outer+1UL; ++q ) {
+         ++begin_[q];
+         ++end_[q-1UL];
+      }
+      end_[outer] = newCapacity;
+
+      std::swap( values_ , newValues  );
+      std::swap( indices_, newIndices );
+      deallocate( newValues );
+      deallocate( newIndices );
+
+      return iterator( pos );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a compressed matrix with elements. It
+// appends a new element to the end of the specified row (in case of a row-major matrix) or
+// column (in case of a column-major matrix) without any additional memory allocation.
+// Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified row/column of the compressed matrix
+//  - the current number of non-zero elements in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested.
+//
+// \note The \c finalize() function has to be explicitly called for each row/column, even
+// for empty ones!
+// \note Although append() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   BLAZE_USER_ASSERT( end_[k] < end_[outerSize()], "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( begin_[k] == end_[k] || l > indices_[end_[k]-1UL], "Index is not strictly increasing" );
+
+   values_[end_[k]] = value;
+
+   if( !check || !isDefault<strict>( values_[end_[k]] ) ) {
+      indices_[end_[k]] = l;
+      ++end_[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row/column.
+//
+// \param i The index of the row/column to be finalized \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// After completion of row/column \a i via the append() function, this function can be called to
+// finalize row/column \a i and prepare the next row/column for insertion process via append().
+//
+// \note Although finalize() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid row/column access index" );
+
+   begin_[i+1UL] = end_[i];
+   if( i != outerSize()-1UL )
+      end_[i+1UL] = end_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function erases an element from the compressed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const Iterator pos( find( i, j ) );
+
+   if( pos != end( k ) )
+      erase( k, pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed matrix.
+//
+// \param i The row/column index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases an element from the compressed matrix. In case the storage order is set
+// to \a rowMajor the function erases an element from row \a i, in case the storage flag is set
+// to \a columnMajor the function erases an element from column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::erase( size_t i, Iterator pos )
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( pos >= begin(i) && pos <= end(i), "Invalid compressed matrix iterator" );
+
+   return erase( i, pos, ( pos != end(i) ? pos+1UL : pos ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the compressed matrix.
+//
+// \param i The row/column index of the elements to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases a range of elements from the compressed matrix. In case the storage order
+// is set to \a rowMajor the function erases a range of elements from row \a i, in case the storage
+// flag is set to \a columnMajor the function erases a range of elements from column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::erase( size_t i, Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( first <= last  , "Invalid iterator range"          );
+   BLAZE_USER_ASSERT( first >= begin(i) && first <= end(i), "Invalid compressed matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin(i) && last  <= end(i), "Invalid compressed matrix iterator" );
+
+   if( first != last ) {
+      const size_t pos1( offset( first ) );
+      const size_t pos2( offset( last  ) );
+      std::move( values_+pos2, values_+end_[i], values_+pos1 );
+      std::move( indices_+pos2, indices_+end_[i], indices_+pos1 );
+      end_[i] -= pos2 - pos1;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from the compressed matrix.
+//
+// \param predicate The unary predicate for the element selection.
+// \return void.
+//
+// This function erases specific elements from the compressed matrix. The elements are selected
+// by the given unary predicate \a predicate, which is expected to accept a single argument of
+// the type of the elements and to be pure. The following example demonstrates how to remove
+// all elements that are smaller than a certain threshold value:
+
+   \code
+   blaze::CompressedSoAMatrix<double,blaze::rowMajor> A;
+   // ... Resizing and initialization
+
+   A.erase( []( double value ){ return value < 1E-8; } );
+   \endcode
+
+// \note The predicate is required to be pure, i.e. to produce deterministic results for elements
+// with the same value. The attempt to use an impure predicate leads to undefined behavior!
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO          // Storage order
+        , typename Tag     // Type tag
+        , typename IT >    // Index type
+template< typename Pred >  // Type of the unary predicate
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::erase( Pred predicate )
+{
+   for( size_t i=0UL; i<outerSize(); ++i ) {
+      end_[i] = removeIf( begin_[i], end_[i], predicate );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from a range of the compressed matrix.
+//
+// \param i The row/column index of the elements to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param first Iterator to first element of the range.
+// \param last Iterator just past the last element of the range.
+// \param predicate The unary predicate for the element selection.
+// \return void
+//
+// This function erases specific elements from a range of elements of the compressed matrix. The
+// elements are selected by the given unary predicate \a predicate, which is expected to accept
+// a single argument of the type of the elements and to be pure. In case the storage order is
+// set to \a rowMajor the function erases a range of elements from row \a i, in case the storage
+// flag is set to \a columnMajor the function erases a range of elements from column \a i.
+//
+// \note The predicate is required to be pure, i.e. to produce deterministic results for elements
+// with the same value. The attempt to use an impure predicate leads to undefined behavior!
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO          // Storage order
+        , typename Tag     // Type tag
+        , typename IT >    // Index type
+template< typename Pred >  // Type of the unary predicate
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::erase( size_t i, Iterator first, Iterator last, Pred predicate )
+{
+   BLAZE_USER_ASSERT( i < outerSize(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( first <= last  , "Invalid iterator range"          );
+   BLAZE_USER_ASSERT( first >= begin(i) && first <= end(i), "Invalid compressed matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin(i) && last  <= end(i), "Invalid compressed matrix iterator" );
+
+   const size_t pos1( offset( first ) );
+   const size_t pos2( offset( last  ) );
+   const size_t pos ( removeIf( pos1, pos2, predicate ) );
+
+   std::move( values_+pos2, values_+end_[i], values_+pos );
+   std::move( indices_+pos2, indices_+end_[i], indices_+pos );
+   end_[i] -= pos2 - pos;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned compressed matrix iterator is subject
+// to invalidation due to inserting operations via the function call operator, the set()
+// function or the insert() function!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::find( size_t i, size_t j )
+{
+   return iterator( offset( const_cast<const This&>( *this ).find( i, j ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned compressed matrix iterator is subject
+// to invalidation due to inserting operations via the function call operator, the set()
+// function or the insert() function!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( SO ? j : i ) && pos->index() == ( SO ? i : j ) )
+      return pos;
+   else return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less than the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less than the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call operator,
+// the set() function or the insert() function!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::lowerBound( size_t i, size_t j )
+{
+   return iterator( offset( const_cast<const This&>( *this ).lowerBound( i, j ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less than the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less than the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call operator,
+// the set() function or the insert() function!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::lowerBound( size_t i, size_t j ) const
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   BLAZE_USER_ASSERT( k < outerSize(), "Invalid row/column access index" );
+
+   const IT* const pos( std::lower_bound( indices_+begin_[k], indices_+end_[k], l ) );
+
+   return iterator( pos - indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater than the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater than the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call operator,
+// the set() function or the insert() function!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::upperBound( size_t i, size_t j )
+{
+   return iterator( offset( const_cast<const This&>( *this ).upperBound( i, j ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater than the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater than the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call operator,
+// the set() function or the insert() function!
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAMatrix<Type,SO,Tag,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,Tag,IT>::upperBound( size_t i, size_t j ) const
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   BLAZE_USER_ASSERT( k < outerSize(), "Invalid row/column access index" );
+
+   const IT* const pos( std::upper_bound( indices_+begin_[k], indices_+end_[k], l ) );
+
+   return iterator( pos - indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the values of the non-zero elements.
+//
+// \return Pointer to the array of values of the non-zero elements.
+//
+// This function returns a pointer to the array of values of the non-zero elements. Note that
+// in case of a row-major matrix the values of row \a i are stored at the offsets
+// \f$[begin(i)..end(i))\f$ relative to this pointer, i.e. the rows are not necessarily stored
+// without gaps. The same holds for the columns of a column-major matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline Type* CompressedSoAMatrix<Type,SO,Tag,IT>::values() noexcept
+{
+   return values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the values of the non-zero elements.
+//
+// \return Pointer to the array of values of the non-zero elements.
+//
+// This function returns a pointer to the array of values of the non-zero elements. Note that
+// in case of a row-major matrix the values of row \a i are stored at the offsets
+// \f$[begin(i)..end(i))\f$ relative to this pointer, i.e. the rows are not necessarily stored
+// without gaps. The same holds for the columns of a column-major matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline const Type* CompressedSoAMatrix<Type,SO,Tag,IT>::values() const noexcept
+{
+   return values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the indices of the non-zero elements.
+//
+// \return Pointer to the array of column (row-major) or row (column-major) indices.
+//
+// This function returns a pointer to the array of indices of the non-zero elements. The index
+// array is laid out in the same way as the value array (see the values() function).
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline IT* CompressedSoAMatrix<Type,SO,Tag,IT>::indices() noexcept
+{
+   return indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the indices of the non-zero elements.
+//
+// \return Pointer to the array of column (row-major) or row (column-major) indices.
+//
+// This function returns a pointer to the array of indices of the non-zero elements. The index
+// array is laid out in the same way as the value array (see the values() function).
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline const IT* CompressedSoAMatrix<Type,SO,Tag,IT>::indices() const noexcept
+{
+   return indices_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAMatrix<Type,SO,Tag,IT>& CompressedSoAMatrix<Type,SO,Tag,IT>::transpose()
+{
+   CompressedSoAMatrix tmp( trans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAMatrix<Type,SO,Tag,IT>& CompressedSoAMatrix<Type,SO,Tag,IT>::ctranspose()
+{
+   CompressedSoAMatrix tmp( ctrans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the compressed matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the compressed matrix.
+//
+// This function scales the matrix by applying the given scalar value \a scalar to each element
+// of the matrix. For built-in and \c complex data types it has the same effect as using the
+// multiplication assignment operator:
+
+   \code
+   blaze::CompressedSoAMatrix<int> A;
+   // ... Resizing and initialization
+   A *= 4;        // Scaling of the matrix
+   A.scale( 4 );  // Same effect as above
+   \endcode
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline CompressedSoAMatrix<Type,SO,Tag,IT>& CompressedSoAMatrix<Type,SO,Tag,IT>::scale( const Other& scalar )
+{
+   for( size_t i=0UL; i<outerSize(); ++i )
+      for( size_t pos=begin_[i]; pos!=end_[i]; ++pos )
+         values_[pos] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedSoAMatrix<Type,SO,Tag,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedSoAMatrix<Type,SO,Tag,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline bool CompressedSoAMatrix<Type,SO,Tag,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   if( m_ == 0UL || n_ == 0UL )
+      return;
+
+   const size_t outer( outerSize() );
+   size_t nonzeros( 0UL );
+
+   for( size_t i=1UL; i<=outer; ++i )
+      begin_[i] = end_[i] = end_[outer];
+
+   for( size_t i=0UL; i<outer; ++i )
+   {
+      begin_[i] = end_[i] = nonzeros;
+
+      const size_t jbegin( ( SO ? IsLower_v<MT> : IsUpper_v<MT> )
+                           ?( ( SO ? IsStrictlyLower_v<MT> : IsStrictlyUpper_v<MT> ) ? i+1UL : i )
+                           :( 0UL ) );
+      const size_t jend  ( ( SO ? IsUpper_v<MT> : IsLower_v<MT> )
+                           ?( ( SO ? IsStrictlyUpper_v<MT> : IsStrictlyLower_v<MT> ) ? i : i+1UL )
+                           :( innerSize() ) );
+
+      for( size_t j=jbegin; j<jend; ++j )
+      {
+         if( nonzeros == capacity() ) {
+            reserveElements( extendCapacity() );
+            for( size_t k=i+1UL; k<=outer; ++k )
+               begin_[k] = end_[k] = end_[outer];
+         }
+
+         values_[end_[i]] = ( SO ? (*rhs)(j,i) : (*rhs)(i,j) );
+
+         if( !isDefault<strict>( values_[end_[i]] ) ) {
+            indices_[end_[i]] = j;
+            ++end_[i];
+            ++nonzeros;
+         }
+      }
+   }
+
+   begin_[outer] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a compressed matrix with the same storage
+//        order.
+//
+// \param rhs The right-hand side compressed matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT >   // Type of the right-hand side compressed matrix
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (*rhs).nonZeros(), "Invalid capacity detected" );
+
+   if( outerSize() == 0UL || values_ == nullptr )
+      return;
+
+   for( size_t i=0UL; i<outerSize(); ++i )
+   {
+      size_t pos( begin_[i] );
+
+      for( auto element=(*rhs).begin(i); element!=(*rhs).end(i); ++element, ++pos ) {
+         values_ [pos] = element->value();
+         indices_[pos] = element->index();
+      }
+
+      end_[i] = begin_[i+1UL] = pos;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a compressed matrix with opposite storage
+//        order.
+//
+// \param rhs The right-hand side compressed matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT >   // Type of the right-hand side compressed matrix
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (*rhs).nonZeros(), "Invalid capacity detected" );
+
+   const size_t outer( outerSize() );
+   const size_t inner( innerSize() );
+
+   // Counting the number of elements per row/column
+   std::vector<size_t> lengths( outer, 0UL );
+   for( size_t j=0UL; j<inner; ++j ) {
+      for( auto element=(*rhs).begin(j); element!=(*rhs).end(j); ++element )
+         ++lengths[element->index()];
+   }
+
+   // Resizing the compressed matrix
+   for( size_t i=0UL; i<outer; ++i ) {
+      begin_[i+1UL] = begin_[i] + lengths[i];
+      if( i+1UL < outer )
+         end_[i+1UL] = begin_[i+1UL];
+   }
+
+   // Appending the elements to the rows/columns of the compressed matrix
+   for( size_t j=0UL; j<inner; ++j ) {
+      for( auto element=(*rhs).begin(j); element!=(*rhs).end(j); ++element ) {
+         const size_t i( element->index() );
+         values_ [end_[i]] = element->value();
+         indices_[end_[i]] = j;
+         ++end_[i];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this + (*rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a compressed matrix.
+//
+// \param rhs The right-hand side compressed matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT     // Type of the right-hand side compressed matrix
+        , bool SO2 >      // Storage order of the right-hand side compressed matrix
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this + (*rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this - (*rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a compressed matrix.
+//
+// \param rhs The right-hand side compressed matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT     // Type of the right-hand side compressed matrix
+        , bool SO2 >      // Storage order of the right-hand side compressed matrix
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this - (*rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename MT     // Type of the right-hand side dense matrix
+        , bool SO2 >      // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,Tag,IT>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (*rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (*rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MT );
+
+   for( size_t i=0UL; i<outerSize(); ++i ) {
+      for( size_t pos=begin_[i]; pos!=end_[i]; ++pos )
+         values_[pos] *= ( SO ? (*rhs)(indices_[pos],i) : (*rhs)(i,indices_[pos]) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  COMPRESSEDSOAMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompressedSoAMatrix operators */
+//@{
+template< RelaxationFlag RF, typename Type, bool SO, typename Tag, typename IT >
+bool isDefault( const CompressedSoAMatrix<Type,SO,Tag,IT>& m );
+
+template< typename Type, bool SO, typename Tag, typename IT >
+bool isIntact( const CompressedSoAMatrix<Type,SO,Tag,IT>& m );
+
+template< typename Type, bool SO, typename Tag, typename IT >
+void swap( CompressedSoAMatrix<Type,SO,Tag,IT>& a, CompressedSoAMatrix<Type,SO,Tag,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compressed matrix is in default state.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the compressed matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false.
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename Type      // Data type of the matrix
+        , bool SO            // Storage order
+        , typename Tag       // Type tag
+        , typename IT >      // Index type
+inline bool isDefault( const CompressedSoAMatrix<Type,SO,Tag,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given compressed matrix are intact.
+// \ingroup compressed_soa_matrix
+//
+// \param m The compressed matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the compressed matrix are intact, i.e. if
+// its state is valid. In case the invariants are intact, the function returns \a true, else
+// it will return \a false.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline bool isIntact( const CompressedSoAMatrix<Type,SO,Tag,IT>& m )
+{
+   return ( m.nonZeros() <= m.capacity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed matrices.
+// \ingroup compressed_soa_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void swap( CompressedSoAMatrix<Type,SO,Tag,IT>& a, CompressedSoAMatrix<Type,SO,Tag,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,2544 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompressedSoAVector.h
+//  \brief Implementation of a structure-of-arrays compressed vector
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_COMPRESSEDSOAVECTOR_H_
+#define _BLAZE_MATH_SPARSE_COMPRESSEDSOAVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/SameTag.h>
+#include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SoAIterator.h>
+#include <blaze/math/sparse/VectorAccessProxy.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/CrossTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsZero.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/algorithms/Transfer.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compressed_soa_vector CompressedSoAVector
+// \ingroup sparse_vector
+*/
+/*!\brief Structure-of-arrays implementation of an arbitrary sized compressed vector.
+// \ingroup compressed_soa_vector
+//
+// The CompressedSoAVector class template is a variant of the CompressedVector class template,
+// which stores the values and the indices of the non-zero elements in two separate arrays
+// (structure-of-arrays layout) instead of a single array of value-index-pairs. The type of the
+// elements, the transpose flag, the group tag and the type of the indices of the vector can be
+// specified via the four template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, bool TF, typename Tag, typename IT >
+   class CompressedSoAVector;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the vector elements. CompressedSoAVector can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
+//          vector (\a blaze::columnVector). The default value is \a blaze::defaultTransposeFlag.
+//  - Tag : optional type parameter to tag the vector. The default type is \a blaze::Group0.
+//          See \ref grouping_tagging for details.
+//  - IT  : specifies the unsigned integral type of the stored indices. The default type is
+//          \a size_t.
+//
+// In comparison to CompressedVector, a CompressedSoAVector of \c float values with 32-bit
+// indices requires 8 instead of 16 bytes per non-zero element, a vector of \c double values
+// 12 instead of 16 bytes:
+
+   \code
+   using blaze::CompressedSoAVector;
+   using blaze::columnVector;
+   using blaze::Group0;
+
+   // Compressed column vector with 32-bit indices
+   CompressedSoAVector<float,columnVector,Group0,uint32_t> a( 1000 );
+   a[42] = 2.0F;
+   a.set( 45, -1.2F );
+   a.insert( 50, 3.7F );
+
+   for( auto it=a.begin(); it!=a.end(); ++it ) {
+      ... = it->value();  // Access to the value of the non-zero element
+      ... = it->index();  // Access to the index of the non-zero element
+   }
+   \endcode
+
+// Apart from the index type and the layout of the non-zero elements CompressedSoAVector provides
+// the same interface as CompressedVector and can be used in all sparse vector operations. Note
+// however that the iterators of a CompressedSoAVector don't refer to value-index-pairs but to
+// proxies of type SoAElement. The size of the vector is restricted to the range of the index
+// type. In case a larger size is requested, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+class CompressedSoAVector
+   : public SparseVector< CompressedSoAVector<Type,TF,Tag,IT>, TF >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This       = CompressedSoAVector<Type,TF,Tag,IT>;  //!< Type of this CompressedSoAVector instance.
+   using BaseType   = SparseVector<This,TF>;                //!< Base type of this CompressedSoAVector instance.
+   using ResultType = This;                                 //!< Result type for expression template evaluations.
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = CompressedSoAVector<Type,!TF,Tag,IT>;
+
+   using ElementType    = Type;                             //!< Type of the compressed vector elements.
+   using TagType        = Tag;                              //!< Tag type of this CompressedSoAVector instance.
+   using IndexType      = IT;                               //!< Type of the stored indices.
+   using ReturnType     = const Type&;                      //!< Return type for expression template evaluations.
+   using CompositeType  = const CompressedSoAVector&;       //!< Data type for composite expression templates.
+   using Reference      = VectorAccessProxy<This>;          //!< Reference to a non-constant vector value.
+   using ConstReference = const Type&;                      //!< Reference to a constant vector value.
+   using Iterator       = SoAIterator<Type,IT>;             //!< Iterator over non-constant elements.
+   using ConstIterator  = SoAIterator<const Type,const IT>;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompressedSoAVector with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other vector
+   struct Rebind {
+      using Other = CompressedSoAVector<NewType,TF,Tag,IT>;  //!< The type of the other CompressedSoAVector.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a CompressedSoAVector with a different fixed number of elements.
+   */
+   template< size_t NewN >  // Number of elements of the other vector
+   struct Resize {
+      using Other = CompressedSoAVector<Type,TF,Tag,IT>;  //!< The type of the other CompressedSoAVector.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the vector can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+            inline CompressedSoAVector() noexcept;
+   explicit inline CompressedSoAVector( size_t size );
+            inline CompressedSoAVector( size_t size, size_t nonzeros );
+            inline CompressedSoAVector( initializer_list<Type> list );
+
+   inline CompressedSoAVector( const CompressedSoAVector& sv );
+   inline CompressedSoAVector( CompressedSoAVector&& sv ) noexcept;
+
+   template< typename VT > inline CompressedSoAVector( const DenseVector<VT,TF>&  dv );
+   template< typename VT > inline CompressedSoAVector( const SparseVector<VT,TF>& sv );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~CompressedSoAVector();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator[]( size_t index ) noexcept;
+   inline ConstReference operator[]( size_t index ) const noexcept;
+   inline Reference      at( size_t index );
+   inline ConstReference at( size_t index ) const;
+   inline Iterator       begin () noexcept;
+   inline ConstIterator  begin () const noexcept;
+   inline ConstIterator  cbegin() const noexcept;
+   inline Iterator       end   () noexcept;
+   inline ConstIterator  end   () const noexcept;
+   inline ConstIterator  cend  () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline CompressedSoAVector& operator=( initializer_list<Type> list ) &;
+   inline CompressedSoAVector& operator=( const CompressedSoAVector& rhs ) &;
+   inline CompressedSoAVector& operator=( CompressedSoAVector&& rhs ) & noexcept;
+
+   template< typename VT > inline CompressedSoAVector& operator= ( const DenseVector<VT,TF>& rhs ) &;
+   template< typename VT > inline CompressedSoAVector& operator= ( const SparseVector<VT,TF>& rhs ) &;
+   template< typename VT > inline CompressedSoAVector& operator+=( const Vector<VT,TF>& rhs ) &;
+   template< typename VT > inline CompressedSoAVector& operator-=( const Vector<VT,TF>& rhs ) &;
+   template< typename VT > inline CompressedSoAVector& operator*=( const DenseVector<VT,TF>& rhs ) &;
+   template< typename VT > inline CompressedSoAVector& operator*=( const SparseVector<VT,TF>& rhs ) &;
+   template< typename VT > inline CompressedSoAVector& operator/=( const DenseVector<VT,TF>& rhs ) &;
+   template< typename VT > inline CompressedSoAVector& operator%=( const Vector<VT,TF>& rhs ) &;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t nonZeros() const;
+   inline void   reset();
+   inline void   clear();
+   inline void   resize( size_t n, bool preserve=true );
+          void   reserve( size_t n );
+   inline void   shrinkToFit();
+   inline void   swap( CompressedSoAVector& sv ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set   ( size_t index, const Type& value );
+   inline Iterator insert( size_t index, const Type& value );
+   inline void     append( size_t index, const Type& value, bool check=false );
+   //@}
+   //**********************************************************************************************
+
+   //**Erase functions*****************************************************************************
+   /*!\name Erase functions */
+   //@{
+   inline void     erase( size_t index );
+   inline Iterator erase( Iterator pos );
+   inline Iterator erase( Iterator first, Iterator last );
+
+   template< typename Pred, typename = DisableIf_t< IsIntegral_v<Pred> > >
+   inline void erase( Pred predicate );
+
+   template< typename Pred >
+   inline void erase( Iterator first, Iterator last, Pred predicate );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t index );
+   inline ConstIterator find      ( size_t index ) const;
+   inline Iterator      lowerBound( size_t index );
+   inline ConstIterator lowerBound( size_t index ) const;
+   inline Iterator      upperBound( size_t index );
+   inline ConstIterator upperBound( size_t index ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   template< typename Other > inline CompressedSoAVector& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename VT > inline void assign    ( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void assign    ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline void addAssign ( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void addAssign ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline void subAssign ( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void subAssign ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline void multAssign( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void divAssign ( const DenseVector <VT,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t extendCapacity() const noexcept;
+
+   inline Iterator      iterator( size_t pos ) noexcept;
+   inline ConstIterator iterator( size_t pos ) const noexcept;
+   inline size_t        offset  ( ConstIterator it ) const noexcept;
+
+   template< typename Pred >
+   inline size_t removeIf( size_t first, size_t last, Pred predicate );
+
+   static inline void checkIndexRange( size_t size );
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   Iterator insert( size_t pos, size_t index, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;       //!< The current size/dimension of the compressed vector.
+   size_t capacity_;   //!< The maximum capacity of the compressed vector.
+   size_t nonZeros_;   //!< The current number of non-zero elements of the compressed vector.
+   Type*  values_;     //!< The values of the non-zero elements.
+   IT*    indices_;    //!< The indices of the non-zero elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT   );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+const Type CompressedSoAVector<Type,TF,Tag,IT>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompressedSoAVector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAVector<Type,TF,Tag,IT>::CompressedSoAVector() noexcept
+   : size_    ( 0UL )      // The current size/dimension of the compressed vector
+   , capacity_( 0UL )      // The maximum capacity of the compressed vector
+   , nonZeros_( 0UL )      // The current number of non-zero elements of the compressed vector
+   , values_  ( nullptr )  // The values of the non-zero elements
+   , indices_ ( nullptr )  // The indices of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a compressed vector of size \a n.
+//
+// \param n The size of the vector.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAVector<Type,TF,Tag,IT>::CompressedSoAVector( size_t n )
+   : size_    ( n   )      // The current size/dimension of the compressed vector
+   , capacity_( 0UL )      // The maximum capacity of the compressed vector
+   , nonZeros_( 0UL )      // The current number of non-zero elements of the compressed vector
+   , values_  ( nullptr )  // The values of the non-zero elements
+   , indices_ ( nullptr )  // The indices of the non-zero elements
+{
+   checkIndexRange( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a compressed vector of size \a n.
+//
+// \param n The size of the vector.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAVector<Type,TF,Tag,IT>::CompressedSoAVector( size_t n, size_t nonzeros )
+   : size_    ( n )         // The current size/dimension of the compressed vector
+   , capacity_( nonzeros )  // The maximum capacity of the compressed vector
+   , nonZeros_( 0UL )       // The current number of non-zero elements of the compressed vector
+   , values_  ( nullptr )   // The values of the non-zero elements
+   , indices_ ( nullptr )   // The indices of the non-zero elements
+{
+   checkIndexRange( n );
+
+   values_  = allocate<Type>( capacity_ );
+   indices_ = allocate<IT>( capacity_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all vector elements.
+//
+// \param list The initializer list.
+//
+// This assignment operator provides the option to explicitly initialize the elements of the
+// vector within a constructor call:
+
+   \code
+   blaze::CompressedSoAVector<double> v1{ 4.2, 6.3, -1.2 };
+   \endcode
+
+// The vector is sized according to the size of the initializer list and all its elements are
+// initialized by the non-zero elements of the given initializer list.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAVector<Type,TF,Tag,IT>::CompressedSoAVector( initializer_list<Type> list )
+   : CompressedSoAVector( list.size(), blaze::nonZeros( list ) )
+{
+   size_t i( 0UL );
+
+   for( const Type& element : list ) {
+      if( !isDefault<strict>( element ) )
+         append( i, element );
+      ++i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CompressedSoAVector.
+//
+// \param sv Compressed vector to be copied.
+//
+// The copy constructor is explicitly defined due to the required dynamic memory management
+// and in order to enable/facilitate NRV optimization.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAVector<Type,TF,Tag,IT>::CompressedSoAVector( const CompressedSoAVector& sv )
+   : CompressedSoAVector( sv.size_, sv.nonZeros_ )
+{
+   std::copy( sv.values_, sv.values_+sv.nonZeros_, values_ );
+   std::copy( sv.indices_, sv.indices_+sv.nonZeros_, indices_ );
+   nonZeros_ = sv.nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for CompressedSoAVector.
+//
+// \param sv The compressed vector to be moved into this instance.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAVector<Type,TF,Tag,IT>::CompressedSoAVector( CompressedSoAVector&& sv ) noexcept
+   : size_    ( sv.size_ )      // The current size/dimension of the compressed vector
+   , capacity_( sv.capacity_ )  // The maximum capacity of the compressed vector
+   , nonZeros_( sv.nonZeros_ )  // The current number of non-zero elements of the compressed vector
+   , values_  ( sv.values_ )    // The values of the non-zero elements
+   , indices_ ( sv.indices_ )   // The indices of the non-zero elements
+{
+   sv.size_     = 0UL;
+   sv.capacity_ = 0UL;
+   sv.nonZeros_ = 0UL;
+   sv.values_   = nullptr;
+   sv.indices_  = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense vectors.
+//
+// \param dv Dense vector to be copied.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the foreign dense vector
+inline CompressedSoAVector<Type,TF,Tag,IT>::CompressedSoAVector( const DenseVector<VT,TF>& dv )
+   : CompressedSoAVector( (*dv).size() )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+
+   smpAssign( *this, *dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse vectors.
+//
+// \param sv Sparse vector to be copied.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the foreign sparse vector
+inline CompressedSoAVector<Type,TF,Tag,IT>::CompressedSoAVector( const SparseVector<VT,TF>& sv )
+   : CompressedSoAVector( (*sv).size(), (*sv).nonZeros() )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+
+   smpAssign( *this, *sv );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for CompressedSoAVector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAVector<Type,TF,Tag,IT>::~CompressedSoAVector()
+{
+   deallocate( values_ );
+   deallocate( indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the compressed vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the accessed value at position \a index. In case the
+// compressed vector does not yet store an element for index \a index, a new element is inserted
+// into the compressed vector. An alternative for traversing the non-zero elements of the sparse
+// vector are the begin() and end() functions.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::Reference
+   CompressedSoAVector<Type,TF,Tag,IT>::operator[]( size_t index ) noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   return Reference( *this, index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the compressed vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::ConstReference
+   CompressedSoAVector<Type,TF,Tag,IT>::operator[]( size_t index ) const noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const ConstIterator pos( lowerBound( index ) );
+
+   if( pos == end() || pos->index() != index )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the compressed vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid compressed vector access index.
+//
+// This function returns a reference to the accessed value at position \a index. In case the
+// compressed vector does not yet store an element for index \a index, a new element is inserted
+// into the compressed vector. In contrast to the subscript operator this function always
+// performs a check of the given access index.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::Reference
+   CompressedSoAVector<Type,TF,Tag,IT>::at( size_t index )
+{
+   if( index >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid compressed vector access index" );
+   }
+   return (*this)[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the compressed vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid compressed vector access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::ConstReference
+   CompressedSoAVector<Type,TF,Tag,IT>::at( size_t index ) const
+{
+   if( index >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid compressed vector access index" );
+   }
+   return (*this)[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of the compressed vector.
+//
+// \return Iterator to the first non-zero element of the compressed vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::Iterator
+   CompressedSoAVector<Type,TF,Tag,IT>::begin() noexcept
+{
+   return iterator( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of the compressed vector.
+//
+// \return Iterator to the first non-zero element of the compressed vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::ConstIterator
+   CompressedSoAVector<Type,TF,Tag,IT>::begin() const noexcept
+{
+   return iterator( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of the compressed vector.
+//
+// \return Iterator to the first non-zero element of the compressed vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::ConstIterator
+   CompressedSoAVector<Type,TF,Tag,IT>::cbegin() const noexcept
+{
+   return iterator( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of the compressed vector.
+//
+// \return Iterator just past the last non-zero element of the compressed vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::Iterator
+   CompressedSoAVector<Type,TF,Tag,IT>::end() noexcept
+{
+   return iterator( nonZeros_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of the compressed vector.
+//
+// \return Iterator just past the last non-zero element of the compressed vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::ConstIterator
+   CompressedSoAVector<Type,TF,Tag,IT>::end() const noexcept
+{
+   return iterator( nonZeros_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of the compressed vector.
+//
+// \return Iterator just past the last non-zero element of the compressed vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::ConstIterator
+   CompressedSoAVector<Type,TF,Tag,IT>::cend() const noexcept
+{
+   return iterator( nonZeros_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief List assignment to all vector elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+//
+// This assignment operator offers the option to directly assign to all elements of the vector
+// by means of an initializer list:
+
+   \code
+   blaze::CompressedSoAVector<double> v;
+   v = { 4.2, 6.3, -1.2 };
+   \endcode
+
+// The vector is resized according to the size of the initializer list and all its elements are
+// assigned the non-zero values from the given initializer list.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAVector<Type,TF,Tag,IT>&
+   CompressedSoAVector<Type,TF,Tag,IT>::operator=( initializer_list<Type> list ) &
+{
+   using blaze::nonZeros;
+
+   resize( list.size(), false );
+   reserve( nonZeros( list ) );
+
+   size_t i( 0UL );
+
+   for( const Type& element : list ) {
+      if( !isDefault<strict>( element ) )
+         append( i, element );
+      ++i;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CompressedSoAVector.
+//
+// \param rhs Compressed vector to be copied.
+// \return Reference to the assigned compressed vector.
+//
+// The compressed vector is resized according to the given compressed vector and initialized
+// as a copy of this vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAVector<Type,TF,Tag,IT>&
+   CompressedSoAVector<Type,TF,Tag,IT>::operator=( const CompressedSoAVector& rhs ) &
+{
+   if( &rhs == this ) return *this;
+
+   if( rhs.nonZeros_ > capacity_ ) {
+      CompressedSoAVector tmp( rhs );
+      swap( tmp );
+   }
+   else {
+      std::copy( rhs.values_, rhs.values_+rhs.nonZeros_, values_ );
+      std::copy( rhs.indices_, rhs.indices_+rhs.nonZeros_, indices_ );
+      size_     = rhs.size_;
+      nonZeros_ = rhs.nonZeros_;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for CompressedSoAVector.
+//
+// \param rhs The compressed vector to be moved into this instance.
+// \return Reference to the assigned compressed vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CompressedSoAVector<Type,TF,Tag,IT>&
+   CompressedSoAVector<Type,TF,Tag,IT>::operator=( CompressedSoAVector&& rhs ) & noexcept
+{
+   deallocate( values_ );
+   deallocate( indices_ );
+
+   size_     = rhs.size_;
+   capacity_ = rhs.capacity_;
+   nonZeros_ = rhs.nonZeros_;
+   values_   = rhs.values_;
+   indices_  = rhs.indices_;
+
+   rhs.size_     = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.nonZeros_ = 0UL;
+   rhs.values_   = nullptr;
+   rhs.indices_  = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense vectors.
+//
+// \param rhs Dense vector to be copied.
+// \return Reference to the assigned compressed vector.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+//
+// The vector is resized according to the given dense vector and initialized as a copy of
+// this vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side dense vector
+inline CompressedSoAVector<Type,TF,Tag,IT>&
+   CompressedSoAVector<Type,TF,Tag,IT>::operator=( const DenseVector<VT,TF>& rhs ) &
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+
+   checkIndexRange( (*rhs).size() );
+
+   if( (*rhs).canAlias( this ) ) {
+      CompressedSoAVector tmp( *rhs );
+      swap( tmp );
+   }
+   else {
+      size_     = (*rhs).size();
+      nonZeros_ = 0UL;
+      smpAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse vectors.
+//
+// \param rhs Sparse vector to be copied.
+// \return Reference to the assigned compressed vector.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+//
+// The vector is resized according to the given sparse vector and initialized as a copy of
+// this vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side sparse vector
+inline CompressedSoAVector<Type,TF,Tag,IT>&
+   CompressedSoAVector<Type,TF,Tag,IT>::operator=( const SparseVector<VT,TF>& rhs ) &
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+
+   checkIndexRange( (*rhs).size() );
+
+   if( (*rhs).canAlias( this ) || (*rhs).nonZeros() > capacity_ ) {
+      CompressedSoAVector tmp( *rhs );
+      swap( tmp );
+   }
+   else {
+      size_     = (*rhs).size();
+      nonZeros_ = 0UL;
+
+      if( !IsZero_v<VT> ) {
+         smpAssign( *this, *rhs );
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a vector (\f$ \vec{a}+=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be added to the compressed vector.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side vector
+inline CompressedSoAVector<Type,TF,Tag,IT>&
+   CompressedSoAVector<Type,TF,Tag,IT>::operator+=( const Vector<VT,TF>& rhs ) &
+{
+   using blaze::addAssign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+
+   if( (*rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( !IsZero_v<VT> ) {
+      addAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a vector (\f$ \vec{a}-=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be subtracted from the compressed vector.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side vector
+inline CompressedSoAVector<Type,TF,Tag,IT>&
+   CompressedSoAVector<Type,TF,Tag,IT>::operator-=( const Vector<VT,TF>& rhs ) &
+{
+   using blaze::subAssign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+
+   if( (*rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( !IsZero_v<VT> ) {
+      subAssign( *this, *rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a dense vector
+//        (\f$ \vec{a}*=\vec{b} \f$).
+//
+// \param rhs The right-hand side dense vector to be multiplied with the compressed vector.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side vector
+inline CompressedSoAVector<Type,TF,Tag,IT>&
+   CompressedSoAVector<Type,TF,Tag,IT>::operator*=( const DenseVector<VT,TF>& rhs ) &
+{
+   using blaze::multAssign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+
+   if( (*rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (*rhs).canAlias( this ) ) {
+      CompressedSoAVector tmp( *this * (*rhs) );
+      swap( tmp );
+   }
+   else {
+      CompositeType_t<VT> tmp( *rhs );
+      multAssign( *this, tmp );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a sparse vector
+//        (\f$ \vec{a}*=\vec{b} \f$).
+//
+// \param rhs The right-hand side sparse vector to be multiplied with the compressed vector.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side vector
+inline CompressedSoAVector<Type,TF,Tag,IT>&
+   CompressedSoAVector<Type,TF,Tag,IT>::operator*=( const SparseVector<VT,TF>& rhs ) &
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+
+   if( (*rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( !IsZero_v<VT> ) {
+      CompressedSoAVector tmp( *this * (*rhs) );
+      swap( tmp );
+   }
+   else {
+      reset();
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a dense vector (\f$ \vec{a}/=\vec{b} \f$).
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side vector
+inline CompressedSoAVector<Type,TF,Tag,IT>&
+   CompressedSoAVector<Type,TF,Tag,IT>::operator/=( const DenseVector<VT,TF>& rhs ) &
+{
+   using blaze::divAssign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+
+   if( (*rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (*rhs).canAlias( this ) ) {
+      CompressedSoAVector tmp( *this / (*rhs) );
+      swap( tmp );
+   }
+   else {
+      CompositeType_t<VT> tmp( *rhs );
+      divAssign( *this, tmp );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Cross product assignment operator for the multiplication of a vector
+//        (\f$ \vec{a}\times=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector for the cross product.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Invalid vector size for cross product.
+//
+// In case the current size of any of the two vectors is not equal to 3, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side vector
+inline CompressedSoAVector<Type,TF,Tag,IT>&
+   CompressedSoAVector<Type,TF,Tag,IT>::operator%=( const Vector<VT,TF>& rhs ) &
+{
+   using blaze::assign;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType_t<VT>, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType_t<VT> );
+
+   using CrossType = CrossTrait_t< This, ResultType_t<VT> >;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( CrossType );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( CrossType, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( CrossType );
+
+   if( size_ != 3UL || (*rhs).size() != 3UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid vector size for cross product" );
+   }
+
+   if( !IsZero_v<VT> ) {
+      const CrossType tmp( *this % (*rhs) );
+      reset();
+      assign( *this, tmp );
+   }
+   else {
+      reset();
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current size/dimension of the compressed vector.
+//
+// \return The size of the compressed vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAVector<Type,TF,Tag,IT>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the compressed vector.
+//
+// \return The capacity of the compressed vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAVector<Type,TF,Tag,IT>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the compressed vector.
+//
+// \return The number of non-zero elements in the compressed vector.
+//
+// Note that the number of non-zero elements is always smaller than the current size of the
+// compressed vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAVector<Type,TF,Tag,IT>::nonZeros() const
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAVector<Type,TF,Tag,IT>::reset()
+{
+   nonZeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the compressed vector.
+//
+// \return void
+//
+// After the clear() function, the size of the compressed vector is 0.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAVector<Type,TF,Tag,IT>::clear()
+{
+   size_     = 0UL;
+   nonZeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the compressed vector.
+//
+// \param n The new size of the compressed vector.
+// \param preserve \a true if the old values of the vector should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+//
+// This function resizes the compressed vector using the given size to \a n. During this
+// operation, new dynamic memory may be allocated in case the capacity of the compressed
+// vector is too small. Note that this function may invalidate all existing views (subvectors,
+// ...) on the vector if it is used to shrink the vector. Additionally, the resize operation
+// potentially changes all vector elements. In order to preserve the old vector values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAVector<Type,TF,Tag,IT>::resize( size_t n, bool preserve )
+{
+   checkIndexRange( n );
+
+   if( preserve ) {
+      nonZeros_ = offset( lowerBound( n ) );
+   }
+   else {
+      nonZeros_ = 0UL;
+   }
+
+   size_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the compressed vector.
+//
+// \param n The new minimum capacity of the compressed vector.
+// \return void
+//
+// This function increases the capacity of the compressed vector to at least \a n elements. The
+// current values of the vector elements are preserved.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+void CompressedSoAVector<Type,TF,Tag,IT>::reserve( size_t n )
+{
+   if( n > capacity_ ) {
+      const size_t newCapacity( n );
+
+      // Allocating a new data and index array
+      Type* newValues ( allocate<Type>( newCapacity ) );
+      IT*   newIndices( allocate<IT>( newCapacity ) );
+
+      // Replacing the old data and index array
+      transfer( values_, values_+nonZeros_, newValues );
+      std::copy( indices_, indices_+nonZeros_, newIndices );
+
+      std::swap( values_ , newValues  );
+      std::swap( indices_, newIndices );
+      capacity_ = newCapacity;
+
+      deallocate( newValues );
+      deallocate( newIndices );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+//
+// This function minimizes the capacity of the vector by removing unused capacity. Please note
+// that in case a reallocation occurs, all iterators (including end() iterators), all pointers
+// and references to elements of this vector are invalidated.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAVector<Type,TF,Tag,IT>::shrinkToFit()
+{
+   if( nonZeros_ < capacity_ ) {
+      CompressedSoAVector( *this ).swap( *this );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed vectors.
+//
+// \param sv The compressed vector to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAVector<Type,TF,Tag,IT>::swap( CompressedSoAVector& sv ) noexcept
+{
+   using std::swap;
+
+   swap( size_, sv.size_ );
+   swap( capacity_, sv.capacity_ );
+   swap( nonZeros_, sv.nonZeros_ );
+   swap( values_, sv.values_ );
+   swap( indices_, sv.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new vector capacity.
+//
+// \return The new compressed vector capacity.
+//
+// This function calculates a new vector capacity based on the current capacity of the sparse
+// vector. Note that the new capacity is restricted to the interval \f$[7..size]\f$.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAVector<Type,TF,Tag,IT>::extendCapacity() const noexcept
+{
+   using blaze::max;
+   using blaze::min;
+
+   size_t nonzeros( 2UL*capacity_+1UL );
+   nonzeros = max( nonzeros, 7UL   );
+   nonzeros = min( nonzeros, size_ );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity_, "Invalid capacity value" );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element at the given offset.
+//
+// \param pos The offset of the element within the value and index arrays.
+// \return Iterator to the element at offset \a pos.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::Iterator
+   CompressedSoAVector<Type,TF,Tag,IT>::iterator( size_t pos ) noexcept
+{
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the element at the given offset.
+//
+// \param pos The offset of the element within the value and index arrays.
+// \return Iterator to the element at offset \a pos.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::ConstIterator
+   CompressedSoAVector<Type,TF,Tag,IT>::iterator( size_t pos ) const noexcept
+{
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the element referred to by the given iterator.
+//
+// \param it Iterator to an element of the compressed vector.
+// \return The offset of the element within the value and index arrays.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CompressedSoAVector<Type,TF,Tag,IT>::offset( ConstIterator it ) const noexcept
+{
+   return it.base() - values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compacts the elements in the given range that do not fulfill the given predicate.
+//
+// \param first The offset of the first element of the range.
+// \param last The offset one past the last element of the range.
+// \param predicate The unary predicate for the element selection.
+// \return The offset one past the last remaining element.
+//
+// This function removes all elements in the range \f$[first..last)\f$ whose value fulfills the
+// given predicate by moving the remaining elements to the front of the range.
+*/
+template< typename Type    // Data type of the vector
+        , bool TF          // Transpose flag
+        , typename Tag     // Type tag
+        , typename IT >    // Index type
+template< typename Pred >  // Type of the unary predicate
+inline size_t CompressedSoAVector<Type,TF,Tag,IT>::removeIf( size_t first, size_t last, Pred predicate )
+{
+   size_t pos( first );
+
+   for( ; first!=last; ++first ) {
+      if( !predicate( values_[first] ) ) {
+         if( pos != first ) {
+            values_ [pos] = std::move( values_[first] );
+            indices_[pos] = indices_[first];
+         }
+         ++pos;
+      }
+   }
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether the given vector size can be represented by the index type.
+//
+// \param size The size of the vector.
+// \return void
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAVector<Type,TF,Tag,IT>::checkIndexRange( size_t size )
+{
+   if( size > size_t( std::numeric_limits<IT>::max() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector size exceeds the range of the index type" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting an element of the compressed vector.
+//
+// \param index The index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the compressed vector. In case the sparse vector
+// already contains an element with index \a index its value is modified, else a new element with
+// the given \a value is inserted.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::Iterator
+   CompressedSoAVector<Type,TF,Tag,IT>::set( size_t index, const Type& value )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const Iterator pos( lowerBound( index ) );
+
+   if( pos != end() && pos->index() == index ) {
+      pos->value() = value;
+      return pos;
+   }
+   else return insert( offset( pos ), index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed vector.
+//
+// \param index The index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid compressed vector access index.
+//
+// This function inserts a new element into the compressed vector. However, duplicate elements
+// are not allowed. In case the sparse vector already contains an element with index \a index,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::Iterator
+   CompressedSoAVector<Type,TF,Tag,IT>::insert( size_t index, const Type& value )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const Iterator pos( lowerBound( index ) );
+
+   if( pos != end() && pos->index() == index ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   return insert( offset( pos ), index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed vector.
+//
+// \param pos The offset of the new element within the value and index arrays.
+// \param index The index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+typename CompressedSoAVector<Type,TF,Tag,IT>::Iterator
+   CompressedSoAVector<Type,TF,Tag,IT>::insert( size_t pos, size_t index, const Type& value )
+{
+   if( nonZeros_ != capacity_ ) {
+      std::move_backward( values_+pos, values_+nonZeros_, values_+nonZeros_+1UL );
+      std::move_backward( indices_+pos, indices_+nonZeros_, indices_+nonZeros_+1UL );
+      values_ [pos] = value;
+      indices_[pos] = index;
+      ++nonZeros_;
+
+      return iterator( pos );
+   }
+   else {
+      const size_t newCapacity( extendCapacity() );
+
+      Type* newValues ( allocate<Type>( newCapacity ) );
+      IT*   newIndices( allocate<IT>( newCapacity ) );
+
+      transfer( values_, values_+pos, newValues );
+      std::copy( indices_, indices_+pos, newIndices );
+      newValues [pos] = value;
+      newIndices[pos] = index;
+      transfer( values_+pos, values_+nonZeros_, newValues+pos+1UL );
+      std::copy( indices_+pos, indices_+nonZeros_, newIndices+pos+1UL );
+
+      std::swap( values_ , newValues  );
+      std::swap( indices_, newIndices );
+      deallocate( newValues );
+      deallocate( newIndices );
+      capacity_ = newCapacity;
+      ++nonZeros_;
+
+      return iterator( pos );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending an element to the compressed vector.
+//
+// \param index The index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a compressed vector with elements. It
+// appends a new element to the end of the compressed vector without any memory allocation.
+// Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the compressed vector
+//  - the current number of non-zero elements must be smaller than the capacity of the vector
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested.
+//
+// \note Although append() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAVector<Type,TF,Tag,IT>::append( size_t index, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+   BLAZE_USER_ASSERT( nonZeros_ < capacity_, "Not enough reserved capacity" );
+   BLAZE_USER_ASSERT( nonZeros_ == 0UL || indices_[nonZeros_-1UL] < index, "Index is not strictly increasing" );
+
+   values_[nonZeros_] = value;
+
+   if( !check || !isDefault<strict>( values_[nonZeros_] ) ) {
+      indices_[nonZeros_] = index;
+      ++nonZeros_;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed vector.
+//
+// \param index The index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function erases an element from the compressed vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CompressedSoAVector<Type,TF,Tag,IT>::erase( size_t index )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const Iterator pos( find( index ) );
+   if( pos != end() )
+      erase( pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed vector.
+//
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases an element from the compressed vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::Iterator
+   CompressedSoAVector<Type,TF,Tag,IT>::erase( Iterator pos )
+{
+   BLAZE_USER_ASSERT( pos >= begin() && pos <= end(), "Invalid compressed vector iterator" );
+
+   return erase( pos, ( pos != end() ? pos+1UL : pos ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the compressed vector.
+//
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases a range of elements from the compressed vector.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::Iterator
+   CompressedSoAVector<Type,TF,Tag,IT>::erase( Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
+   BLAZE_USER_ASSERT( first >= begin() && first <= end(), "Invalid compressed vector iterator" );
+   BLAZE_USER_ASSERT( last  >= begin() && last  <= end(), "Invalid compressed vector iterator" );
+
+   if( first != last ) {
+      const size_t pos1( offset( first ) );
+      const size_t pos2( offset( last  ) );
+      std::move( values_+pos2, values_+nonZeros_, values_+pos1 );
+      std::move( indices_+pos2, indices_+nonZeros_, indices_+pos1 );
+      nonZeros_ -= pos2 - pos1;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from the compressed vector.
+//
+// \param predicate The unary predicate for the element selection.
+// \return void.
+//
+// This function erases specific elements from the compressed vector. The elements are selected
+// by the given unary predicate \a predicate, which is expected to accept a single argument of
+// the type of the elements and to be pure. The following example demonstrates how to remove all
+// elements that are smaller than a certain threshold value:
+
+   \code
+   blaze::CompressedSoAVector<double> a;
+   // ... Resizing and initialization
+
+   a.erase( []( double value ){ return value < 1E-8; } );
+   \endcode
+
+// \note The predicate is required to be pure, i.e. to produce deterministic results for elements
+// with the same value. The attempt to use an impure predicate leads to undefined behavior!
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename Pred   // Type of the unary predicate
+        , typename >      // Type restriction on the unary predicate
+inline void CompressedSoAVector<Type,TF,Tag,IT>::erase( Pred predicate )
+{
+   nonZeros_ = removeIf( 0UL, nonZeros_, predicate );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from a range of the compressed vector.
+//
+// \param first Iterator to first element of the range.
+// \param last Iterator just past the last element of the range.
+// \param predicate The unary predicate for the element selection.
+// \return void.
+//
+// This function erases specific elements from a range of elements of the compressed vector.
+// The elements are selected by the given unary predicate \a predicate, which is expected to
+// accept a single argument of the type of the elements and to be pure. The following example
+// demonstrates how to remove all elements that are smaller than a certain threshold value:
+
+   \code
+   blaze::CompressedSoAVector<double> a;
+   // ... Resizing and initialization
+
+   a.erase( a.begin(), a.end(), []( double value ){ return value < 1E-8; } );
+   \endcode
+
+// \note The predicate is required to be pure, i.e. to produce deterministic results for elements
+// with the same value. The attempt to use an impure predicate leads to undefined behavior!
+*/
+template< typename Type    // Data type of the vector
+        , bool TF          // Transpose flag
+        , typename Tag     // Type tag
+        , typename IT >    // Index type
+template< typename Pred >  // Type of the unary predicate
+inline void CompressedSoAVector<Type,TF,Tag,IT>::erase( Iterator first, Iterator last, Pred predicate )
+{
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
+   BLAZE_USER_ASSERT( first >= begin() && first <= end(), "Invalid compressed vector iterator" );
+   BLAZE_USER_ASSERT( last  >= begin() && last  <= end(), "Invalid compressed vector iterator" );
+
+   const size_t pos1( offset( first ) );
+   const size_t pos2( offset( last  ) );
+   const size_t pos ( removeIf( pos1, pos2, predicate ) );
+
+   std::move( values_+pos2, values_+nonZeros_, values_+pos );
+   std::move( indices_+pos2, indices_+nonZeros_, indices_+pos );
+   nonZeros_ -= pos2 - pos;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific vector element.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// vector. It specifically searches for the element with index \a index. In case the element
+// is found, the function returns an iterator to the element. Otherwise an iterator just past
+// the last non-zero element of the compressed vector (the end() iterator) is returned. Note
+// that the returned compressed vector iterator is subject to invalidation due to inserting
+// operations via the subscript operator, the set() function or the insert() function!
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::Iterator
+   CompressedSoAVector<Type,TF,Tag,IT>::find( size_t index )
+{
+   return iterator( offset( const_cast<const This&>( *this ).find( index ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific vector element.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// vector. It specifically searches for the element with index \a index. In case the element
+// is found, the function returns an iterator to the element. Otherwise an iterator just past
+// the last non-zero element of the compressed vector (the end() iterator) is returned. Note
+// that the returned compressed vector iterator is subject to invalidation due to inserting
+// operations via the subscript operator, the set() function or the insert() function!
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::ConstIterator
+   CompressedSoAVector<Type,TF,Tag,IT>::find( size_t index ) const
+{
+   const ConstIterator pos( lowerBound( index ) );
+   if( pos != end() && pos->index() == index )
+      return pos;
+   else return end();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns an iterator to the first element with an index not less then the given
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed vector
+// iterator is subject to invalidation due to inserting operations via the subscript operator,
+// the set() function or the insert() function!
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::Iterator
+   CompressedSoAVector<Type,TF,Tag,IT>::lowerBound( size_t index )
+{
+   return iterator( offset( const_cast<const This&>( *this ).lowerBound( index ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns an iterator to the first element with an index not less then the given
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed vector
+// iterator is subject to invalidation due to inserting operations via the subscript operator,
+// the set() function or the insert() function!
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::ConstIterator
+   CompressedSoAVector<Type,TF,Tag,IT>::lowerBound( size_t index ) const
+{
+   const IT* const pos( std::lower_bound( indices_, indices_+nonZeros_, index ) );
+
+   return iterator( pos - indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// This function returns an iterator to the first element with an index greater then the given
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed vector
+// iterator is subject to invalidation due to inserting operations via the subscript operator,
+// the set() function or the insert() function!
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::Iterator
+   CompressedSoAVector<Type,TF,Tag,IT>::upperBound( size_t index )
+{
+   return iterator( offset( const_cast<const This&>( *this ).upperBound( index ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// This function returns an iterator to the first element with an index greater then the given
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed vector
+// iterator is subject to invalidation due to inserting operations via the subscript operator,
+// the set() function or the insert() function!
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CompressedSoAVector<Type,TF,Tag,IT>::ConstIterator
+   CompressedSoAVector<Type,TF,Tag,IT>::upperBound( size_t index ) const
+{
+   const IT* const pos( std::upper_bound( indices_, indices_+nonZeros_, index ) );
+
+   return iterator( pos - indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scaling of the compressed vector by the scalar value \a scalar (\f$ \vec{a}=\vec{b}*s \f$).
+//
+// \param scalar The scalar value for the vector scaling.
+// \return Reference to the compressed vector.
+//
+// This function scales the vector by applying the given scalar value \a scalar to each element
+// of the vector. For built-in and \c complex data types it has the same effect as using the
+// multiplication assignment operator:
+
+   \code
+   blaze::CompressedSoAVector<int> a;
+   // ... Resizing and initialization
+   a *= 4;        // Scaling of the vector
+   a.scale( 4 );  // Same effect as above
+   \endcode
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline CompressedSoAVector<Type,TF,Tag,IT>&
+   CompressedSoAVector<Type,TF,Tag,IT>::scale( const Other& scalar )
+{
+   for( size_t i=0UL; i<nonZeros_; ++i )
+      values_[i] *= scalar;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address can alias with the vector. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedSoAVector<Type,TF,Tag,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address is aliased with the vector. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename Tag      // Type tag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedSoAVector<Type,TF,Tag,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can be used in SMP assignments.
+//
+// \return \a true in case the vector can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the vector can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current size of the
+// vector).
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline bool CompressedSoAVector<Type,TF,Tag,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side dense vector
+inline void CompressedSoAVector<Type,TF,Tag,IT>::assign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( nonZeros_ == 0UL, "Invalid non-zero elements detected" );
+
+   for( size_t i=0UL; i<size_; ++i )
+   {
+      if( nonZeros_ == capacity_ )
+         reserve( extendCapacity() );
+
+      values_[nonZeros_] = (*rhs)[i];
+
+      if( !isDefault<strict>( values_[nonZeros_] ) ) {
+         indices_[nonZeros_] = i;
+         ++nonZeros_;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side sparse vector
+inline void CompressedSoAVector<Type,TF,Tag,IT>::assign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( nonZeros_ == 0UL, "Invalid non-zero elements detected" );
+
+   for( auto element=(*rhs).begin(); element!=(*rhs).end(); ++element )
+      append( element->index(), element->value() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side dense vector
+inline void CompressedSoAVector<Type,TF,Tag,IT>::addAssign( const DenseVector<VT,TF>& rhs )
+{
+   using AddType = AddTrait_t< This, ResultType_t<VT> >;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( AddType );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( AddType, TF );
+   BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_t<AddType> );
+
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   const AddType tmp( serial( *this + (*rhs) ) );
+   reset();
+   assign( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side sparse vector
+inline void CompressedSoAVector<Type,TF,Tag,IT>::addAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   CompressedSoAVector tmp( serial( *this + (*rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side dense vector
+inline void CompressedSoAVector<Type,TF,Tag,IT>::subAssign( const DenseVector<VT,TF>& rhs )
+{
+   using SubType = SubTrait_t< This, ResultType_t<VT> >;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( SubType );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( SubType, TF );
+   BLAZE_CONSTRAINT_MUST_BE_REFERENCE_TYPE( CompositeType_t<SubType> );
+
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   const SubType tmp( serial( *this - (*rhs) ) );
+   reset();
+   assign( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side sparse vector
+inline void CompressedSoAVector<Type,TF,Tag,IT>::subAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   CompressedSoAVector tmp( serial( *this - (*rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side dense vector
+inline void CompressedSoAVector<Type,TF,Tag,IT>::multAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( VT );
+
+   for( size_t i=0UL; i<nonZeros_; ++i ) {
+      values_[i] *= (*rhs)[indices_[i]];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the division assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+template< typename VT >   // Type of the right-hand side dense vector
+inline void CompressedSoAVector<Type,TF,Tag,IT>::divAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (*rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( VT );
+
+   for( size_t i=0UL; i<nonZeros_; ++i ) {
+      values_[i] /= (*rhs)[indices_[i]];
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPRESSEDSOAVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompressedSoAVector operators */
+//@{
+template< RelaxationFlag RF, typename Type, bool TF, typename Tag, typename IT >
+bool isDefault( const CompressedSoAVector<Type,TF,Tag,IT>& v );
+
+template< typename Type, bool TF, typename Tag, typename IT >
+bool isIntact( const CompressedSoAVector<Type,TF,Tag,IT>& v ) noexcept;
+
+template< typename Type, bool TF, typename Tag, typename IT >
+void swap( CompressedSoAVector<Type,TF,Tag,IT>& a, CompressedSoAVector<Type,TF,Tag,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compressed vector is in default state.
+// \ingroup compressed_soa_vector
+//
+// \param v The compressed vector to be tested for its default state.
+// \return \a true in case the given vector's size is zero, \a false otherwise.
+//
+// This function checks whether the compressed vector is in default (constructed) state, i.e. if
+// it's size is 0. In case it is in default state, the function returns \a true, else it will
+// return \a false.
+*/
+template< RelaxationFlag RF  // Relaxation flag
+        , typename Type      // Data type of the vector
+        , bool TF            // Transpose flag
+        , typename Tag       // Type tag
+        , typename IT >      // Index type
+inline bool isDefault( const CompressedSoAVector<Type,TF,Tag,IT>& v )
+{
+   return ( v.size() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given compressed vector are intact.
+// \ingroup compressed_soa_vector
+//
+// \param v The compressed vector to be tested.
+// \return \a true in case the given vector's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the compressed vector are intact, i.e. if
+// its state is valid. In case the invariants are intact, the function returns \a true, else
+// it will return \a false.
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline bool isIntact( const CompressedSoAVector<Type,TF,Tag,IT>& v ) noexcept
+{
+   return ( v.nonZeros() <= v.capacity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed vectors.
+// \ingroup compressed_soa_vector
+//
+// \param a The first compressed vector to be swapped.
+// \param b The second compressed vector to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the vector
+        , bool TF         // Transpose flag
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void swap( CompressedSoAVector<Type,TF,Tag,IT>& a, CompressedSoAVector<Type,TF,Tag,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
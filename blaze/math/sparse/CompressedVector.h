@@ -675,11 +675,9 @@ template< typename VT >  // Type of the foreign dense vector
 inline CompressedVector<Type,TF,Tag>::CompressedVector( const DenseVector<VT,TF>& dv )
    : CompressedVector( (*dv).size() )
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
 
-   assign( *this, *dv );
+   smpAssign( *this, *dv );
 }
 //*************************************************************************************************
 
@@ -696,11 +694,9 @@ template< typename VT >  // Type of the foreign sparse vector
 inline CompressedVector<Type,TF,Tag>::CompressedVector( const SparseVector<VT,TF>& sv )
    : CompressedVector( (*sv).size(), (*sv).nonZeros() )
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
 
-   assign( *this, *sv );
+   smpAssign( *this, *sv );
 }
 //*************************************************************************************************
 
@@ -1061,8 +1057,6 @@ template< typename VT >  // Type of the right-hand side dense vector
 inline CompressedVector<Type,TF,Tag>&
    CompressedVector<Type,TF,Tag>::operator=( const DenseVector<VT,TF>& rhs ) &
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
 
    if( (*rhs).canAlias( this ) ) {
@@ -1072,7 +1066,7 @@ inline CompressedVector<Type,TF,Tag>&
    else {
       size_ = (*rhs).size();
       end_  = begin_;
-      assign( *this, *rhs );
+      smpAssign( *this, *rhs );
    }
 
    return *this;
@@ -1096,8 +1090,6 @@ template< typename VT >  // Type of the right-hand side sparse vector
 inline CompressedVector<Type,TF,Tag>&
    CompressedVector<Type,TF,Tag>::operator=( const SparseVector<VT,TF>& rhs ) &
 {
-   using blaze::assign;
-
    BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<VT> );
 
    if( (*rhs).canAlias( this ) || (*rhs).nonZeros() > capacity_ ) {
@@ -1109,7 +1101,7 @@ inline CompressedVector<Type,TF,Tag>&
       end_  = begin_;
 
       if( !IsZero_v<VT> ) {
-         assign( *this, *rhs );
+         smpAssign( *this, *rhs );
       }
    }
 
@@ -0,0 +1,995 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CustomCompressedMatrix.h
+//  \brief Implementation of a read-only adaptor for external compressed arrays
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_CUSTOMCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_CUSTOMCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SoAIterator.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup custom_compressed_matrix CustomCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only adaptor of externally allocated compressed sparse matrix arrays.
+// \ingroup custom_compressed_matrix
+//
+// The CustomCompressedMatrix class template is the sparse counterpart of the CustomMatrix class
+// template: It represents an existing compressed row (CSR) or compressed column (CSC) array
+// triple as a sparse matrix without copying and without taking ownership of the arrays. The
+// type of the elements, the storage order, the group tag and the type of the stored indices
+// can be specified via the four template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, bool SO, typename Tag, typename IT >
+   class CustomCompressedMatrix;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CustomCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (\a blaze::rowMajor, \a blaze::columnMajor) of the
+//          matrix. The default value is \a blaze::defaultStorageOrder.
+//  - Tag : optional type parameter to tag the matrix. The default type is \a blaze::Group0.
+//          See \ref grouping_tagging for details.
+//  - IT  : specifies the unsigned integral type of the stored indices. The default type is
+//          \a size_t.
+//
+// The arrays are passed in the usual compressed format: For a row-major matrix with \a m rows,
+// the \a offsets array contains \a m+1 entries, where the column indices and the values of the
+// non-zero elements of row \a i are stored in the range \f$[offsets[i]..offsets[i+1])\f$ of the
+// \a indices and \a values arrays. Within each row the indices have to be strictly increasing.
+// For column-major matrices rows and columns are swapped:
+
+   \code
+   using blaze::CustomCompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+   using blaze::Group0;
+
+   // ( 1 0 2 )
+   // ( 0 0 3 )
+   const double   values [3] = { 1.0, 2.0, 3.0 };
+   const uint32_t indices[3] = { 0U, 2U, 2U };
+   const size_t   offsets[3] = { 0UL, 2UL, 3UL };
+
+   CustomCompressedMatrix<double,rowMajor,Group0,uint32_t> A( values, indices, offsets, 2UL, 3UL );
+
+   DynamicVector<double> x{ 1.0, 2.0, 3.0 };
+   DynamicVector<double> y( A * x );  // Results in ( 7 9 )
+   \endcode
+
+// A CustomCompressedMatrix never modifies the adapted arrays. It can be used as a read-only
+// operand in all sparse matrix operations, but not as the target of an assignment. Note that
+// it is the responsibility of the user to keep the arrays alive as long as the matrix is in
+// use. Copies of a CustomCompressedMatrix refer to the same arrays.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+class CustomCompressedMatrix
+   : public SparseMatrix< CustomCompressedMatrix<Type,SO,Tag,IT>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This     = CustomCompressedMatrix<Type,SO,Tag,IT>;  //!< Type of this CustomCompressedMatrix instance.
+   using BaseType = SparseMatrix<This,SO>;                   //!< Base type of this CustomCompressedMatrix instance.
+
+   //! Result type for expression template evaluations.
+   using ResultType = CompressedMatrix<Type,SO,Tag>;
+
+   //! Result type with opposite storage order for expression template evaluations.
+   using OppositeType = CompressedMatrix<Type,!SO,Tag>;
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = CompressedMatrix<Type,!SO,Tag>;
+
+   using ElementType    = Type;                             //!< Type of the matrix elements.
+   using TagType        = Tag;                              //!< Tag type of this CustomCompressedMatrix instance.
+   using IndexType      = IT;                               //!< Type of the stored indices.
+   using ReturnType     = const Type&;                      //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                      //!< Data type for composite expression templates.
+   using Reference      = const Type&;                      //!< Reference to a matrix element.
+   using ConstReference = const Type&;                      //!< Reference to a constant matrix element.
+   using ConstIterator  = SoAIterator<const Type,const IT>;  //!< Iterator over constant elements.
+   using Iterator       = ConstIterator;                    //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CustomCompressedMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = CustomCompressedMatrix<NewType,SO,Tag,IT>;  //!< The type of the other CustomCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a CustomCompressedMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = CustomCompressedMatrix<Type,SO,Tag,IT>;  //!< The type of the other CustomCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline CustomCompressedMatrix() noexcept;
+   inline CustomCompressedMatrix( const Type* values, const IT* indices, const size_t* offsets,
+                                  size_t m, size_t n );
+
+   CustomCompressedMatrix( const CustomCompressedMatrix& ) = default;
+   CustomCompressedMatrix( CustomCompressedMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~CustomCompressedMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   CustomCompressedMatrix& operator=( const CustomCompressedMatrix& ) & = default;
+   CustomCompressedMatrix& operator=( CustomCompressedMatrix&& ) & = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   clear() noexcept;
+   inline void   swap( CustomCompressedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Resource management functions***************************************************************
+   /*!\name Resource management functions */
+   //@{
+   inline void reset( const Type* values, const IT* indices, const size_t* offsets,
+                      size_t m, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t        m_;        //!< The current number of rows of the matrix.
+   size_t        n_;        //!< The current number of columns of the matrix.
+   const Type*   values_;   //!< The values of the non-zero elements.
+   const IT*     indices_;  //!< The inner indices of the non-zero elements.
+   const size_t* offsets_;  //!< The offsets of the rows/columns within the value and index arrays.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT   );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+const Type CustomCompressedMatrix<Type,SO,Tag,IT>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CustomCompressedMatrix.
+//
+// The default constructor creates an empty \f$ 0 \times 0 \f$ matrix that doesn't refer to any
+// arrays.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CustomCompressedMatrix<Type,SO,Tag,IT>::CustomCompressedMatrix() noexcept
+   : m_      ( 0UL )      // The current number of rows of the matrix
+   , n_      ( 0UL )      // The current number of columns of the matrix
+   , values_ ( nullptr )  // The values of the non-zero elements
+   , indices_( nullptr )  // The inner indices of the non-zero elements
+   , offsets_( nullptr )  // The offsets of the rows/columns
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a \f$ M \times N \f$ matrix adapting the given compressed arrays.
+//
+// \param values The array of the values of the non-zero elements.
+// \param indices The array of the inner indices of the non-zero elements.
+// \param offsets The array of the \f$ M+1 \f$ (row-major) or \f$ N+1 \f$ (column-major) offsets.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Invalid setup of custom compressed matrix.
+//
+// This constructor creates a matrix that refers to the given arrays. The arrays are neither
+// copied nor modified. In case the \a offsets array is not specified or the inner dimension of
+// the matrix exceeds the range of the index type, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline CustomCompressedMatrix<Type,SO,Tag,IT>::CustomCompressedMatrix( const Type* values,
+                                                                       const IT* indices,
+                                                                       const size_t* offsets,
+                                                                       size_t m, size_t n )
+   : m_      ( m )        // The current number of rows of the matrix
+   , n_      ( n )        // The current number of columns of the matrix
+   , values_ ( values )   // The values of the non-zero elements
+   , indices_( indices )  // The inner indices of the non-zero elements
+   , offsets_( offsets )  // The offsets of the rows/columns
+{
+   if( offsets == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of offsets" );
+   }
+
+   if( ( SO ? m : n ) > size_t( std::numeric_limits<IT>::max() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix size exceeds the range of the index type" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CustomCompressedMatrix<Type,SO,Tag,IT>::ConstReference
+   CustomCompressedMatrix<Type,SO,Tag,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid custom compressed matrix row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid custom compressed matrix column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( SO ? j : i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CustomCompressedMatrix<Type,SO,Tag,IT>::ConstReference
+   CustomCompressedMatrix<Type,SO,Tag,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CustomCompressedMatrix<Type,SO,Tag,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,Tag,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid custom compressed matrix row/column access index" );
+
+   return ConstIterator( values_+offsets_[i], indices_+offsets_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CustomCompressedMatrix<Type,SO,Tag,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,Tag,IT>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CustomCompressedMatrix<Type,SO,Tag,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,Tag,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid custom compressed matrix row/column access index" );
+
+   return ConstIterator( values_+offsets_[i+1UL], indices_+offsets_[i+1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CustomCompressedMatrix<Type,SO,Tag,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,Tag,IT>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CustomCompressedMatrix<Type,SO,Tag,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CustomCompressedMatrix<Type,SO,Tag,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+//
+// The capacity of a custom compressed matrix corresponds to the number of adapted non-zero
+// elements.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CustomCompressedMatrix<Type,SO,Tag,IT>::capacity() const noexcept
+{
+   return nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CustomCompressedMatrix<Type,SO,Tag,IT>::capacity( size_t i ) const noexcept
+{
+   return nonZeros( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CustomCompressedMatrix<Type,SO,Tag,IT>::nonZeros() const noexcept
+{
+   if( offsets_ == nullptr )
+      return 0UL;
+
+   const size_t outer( SO ? n_ : m_ );
+   return offsets_[outer] - offsets_[0UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline size_t CustomCompressedMatrix<Type,SO,Tag,IT>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid custom compressed matrix row/column access index" );
+
+   return offsets_[i+1UL] - offsets_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0 and it doesn't refer to any arrays.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CustomCompressedMatrix<Type,SO,Tag,IT>::clear() noexcept
+{
+   m_       = 0UL;
+   n_       = 0UL;
+   values_  = nullptr;
+   indices_ = nullptr;
+   offsets_ = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CustomCompressedMatrix<Type,SO,Tag,IT>::swap( CustomCompressedMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( m_, m.m_ );
+   swap( n_, m.n_ );
+   swap( values_, m.values_ );
+   swap( indices_, m.indices_ );
+   swap( offsets_, m.offsets_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RESOURCE MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Resets the custom compressed matrix and replaces the adapted arrays.
+//
+// \param values The array of the values of the non-zero elements.
+// \param indices The array of the inner indices of the non-zero elements.
+// \param offsets The array of the \f$ M+1 \f$ (row-major) or \f$ N+1 \f$ (column-major) offsets.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::invalid_argument Invalid setup of custom compressed matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void CustomCompressedMatrix<Type,SO,Tag,IT>::reset( const Type* values, const IT* indices,
+                                                           const size_t* offsets, size_t m, size_t n )
+{
+   CustomCompressedMatrix tmp( values, indices, offsets, m, n );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. In case the element is found, the function returns an row/column iterator to the
+// element. Otherwise an iterator just past the last non-zero element of row \a i or column
+// \a j (the end() iterator) is returned.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CustomCompressedMatrix<Type,SO,Tag,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,Tag,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos != end( SO ? j : i ) && pos->index() == ( SO ? i : j ) )
+      return pos;
+   else
+      return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CustomCompressedMatrix<Type,SO,Tag,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,Tag,IT>::lowerBound( size_t i, size_t j ) const
+{
+   const size_t outer( SO ? j : i );
+   const size_t inner( SO ? i : j );
+
+   BLAZE_USER_ASSERT( outer < ( SO ? n_ : m_ ), "Invalid custom compressed matrix row/column access index" );
+
+   const IT* const pos( std::lower_bound( indices_+offsets_[outer], indices_+offsets_[outer+1UL], inner ) );
+
+   return ConstIterator( values_+( pos - indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline typename CustomCompressedMatrix<Type,SO,Tag,IT>::ConstIterator
+   CustomCompressedMatrix<Type,SO,Tag,IT>::upperBound( size_t i, size_t j ) const
+{
+   const size_t outer( SO ? j : i );
+   const size_t inner( SO ? i : j );
+
+   BLAZE_USER_ASSERT( outer < ( SO ? n_ : m_ ), "Invalid custom compressed matrix row/column access index" );
+
+   const IT* const pos( std::upper_bound( indices_+offsets_[outer], indices_+offsets_[outer+1UL], inner ) );
+
+   return ConstIterator( values_+( pos - indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool CustomCompressedMatrix<Type,SO,Tag,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename Tag      // Type tag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool CustomCompressedMatrix<Type,SO,Tag,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline bool CustomCompressedMatrix<Type,SO,Tag,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CUSTOMCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CustomCompressedMatrix operators */
+//@{
+template< typename Type, bool SO, typename Tag, typename IT >
+void clear( CustomCompressedMatrix<Type,SO,Tag,IT>& m ) noexcept;
+
+template< typename Type, bool SO, typename Tag, typename IT >
+bool isIntact( const CustomCompressedMatrix<Type,SO,Tag,IT>& m ) noexcept;
+
+template< typename Type, bool SO, typename Tag, typename IT >
+void swap( CustomCompressedMatrix<Type,SO,Tag,IT>& a, CustomCompressedMatrix<Type,SO,Tag,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given custom compressed matrix.
+// \ingroup custom_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void clear( CustomCompressedMatrix<Type,SO,Tag,IT>& m ) noexcept
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given custom compressed matrix are intact.
+// \ingroup custom_compressed_matrix
+//
+// \param m The custom compressed matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the custom compressed matrix are intact, i.e.
+// if the offsets are non-decreasing and the inner indices of each row/column are strictly
+// increasing and within the range of the inner dimension.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline bool isIntact( const CustomCompressedMatrix<Type,SO,Tag,IT>& m ) noexcept
+{
+   const size_t outer( SO ? m.columns() : m.rows() );
+   const size_t inner( SO ? m.rows() : m.columns() );
+
+   for( size_t i=0UL; i<outer; ++i )
+   {
+      if( m.end( i ) < m.begin( i ) )
+         return false;
+
+      size_t next( 0UL );
+
+      for( auto element=m.begin( i ); element!=m.end( i ); ++element ) {
+         if( element->index() < next || element->index() >= inner )
+            return false;
+         next = element->index() + 1UL;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two custom compressed matrices.
+// \ingroup custom_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO         // Storage order
+        , typename Tag    // Type tag
+        , typename IT >   // Index type
+inline void swap( CustomCompressedMatrix<Type,SO,Tag,IT>& a, CustomCompressedMatrix<Type,SO,Tag,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -43,6 +43,7 @@
 #include <blaze/math/GroupTag.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -58,16 +59,38 @@ template< typename Type                   // Data type of the vector
         , typename Tag = Group0 >         // Type tag
 class CompressedVector;
 
+template< typename Type                   // Data type of the vector
+        , bool TF = defaultTransposeFlag  // Transpose flag
+        , typename Tag = Group0           // Type tag
+        , typename IT = size_t >          // Index type
+class CompressedSoAVector;
+
 template< typename Type                  // Data type of the matrix
         , bool SO = defaultStorageOrder  // Storage order
         , typename Tag = Group0 >        // Type tag
 class CompressedMatrix;
 
+template< typename Type                  // Data type of the matrix
+        , bool SO = defaultStorageOrder  // Storage order
+        , typename Tag = Group0          // Type tag
+        , typename IT = size_t >         // Index type
+class CompressedSoAMatrix;
+
+template< typename Type                  // Data type of the matrix
+        , bool SO = defaultStorageOrder  // Storage order
+        , typename Tag = Group0          // Type tag
+        , typename IT = size_t >         // Index type
+class CustomCompressedMatrix;
+
 template< typename Type                  // Data type of the matrix
         , bool SO = defaultStorageOrder  // Storage order
         , typename Tag = Group0 >        // Type tag
 class IdentityMatrix;
 
+template< typename Type            // Data type of the matrix
+        , typename Tag = Group0 >  // Type tag
+class SlicedEllMatrix;
+
 template< typename Type                   // Data type of the vector
         , bool TF = defaultTransposeFlag  // Transpose flag
         , typename Tag = Group0 >         // Type tag
@@ -0,0 +1,1113 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SlicedEllMatrix.h
+//  \brief Implementation of a sliced ELLPACK (SELL-C-sigma) sparse matrix
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_SLICEDELLMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SLICEDELLMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/SameTag.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup sliced_ell_matrix SlicedEllMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a row-major sparse matrix in SELL-C-sigma format.
+// \ingroup sliced_ell_matrix
+//
+// The SlicedEllMatrix class template is an immutable, row-major sparse matrix that stores its
+// non-zero elements in the sliced ELLPACK format (SELL-C-\f$ \sigma \f$). The format is tailored
+// to the SIMD-accelerated multiplication with dense vectors: The rows of the matrix are grouped
+// into slices of \a C consecutive rows, where \a C corresponds to the number of elements in a
+// SIMD vector of the element type. Within each slice the non-zero elements are stored column
+// by column, i.e. the k-th elements of all \a C rows are stored consecutively in memory, which
+// enables the processing of \a C rows at once via SIMD loads of the values and SIMD gathers of
+// the corresponding vector elements. In order to keep the padding within each slice small, the
+// rows inside of each window of \f$ \sigma \f$ consecutive rows are sorted by their number of
+// non-zero elements. The type of the elements and the group tag of the matrix can be specified
+// via the two template parameters:
+
+   \code
+   namespace blaze {
+
+   template< typename Type, typename Tag >
+   class SlicedEllMatrix;
+
+   } // namespace blaze
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SlicedEllMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - Tag : optional type parameter to tag the matrix. The default type is \a blaze::Group0.
+//          See \ref grouping_tagging for details.
+//
+// A SlicedEllMatrix is created from any other matrix and cannot be modified afterwards. The
+// sorting window \f$ \sigma \f$ is rounded to a multiple of the slice height \a C:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::SlicedEllMatrix;
+
+   CompressedMatrix<double> A( 1000UL, 1000UL );
+   DynamicVector<double> x( 1000UL ), y;
+   // ... Initialization of A and x
+
+   SlicedEllMatrix<double> B( A );          // SELL-C-sigma matrix with the default sorting window
+   SlicedEllMatrix<double> C( A, 512UL );   // SELL-C-sigma matrix with a sorting window of 512 rows
+
+   y = B * x;   // SIMD-accelerated sparse matrix/dense vector multiplication
+   y += C * x;  // Addition assignment of a sparse matrix/dense vector multiplication
+   \endcode
+
+// Apart from the multiplication with dense vectors, a SlicedEllMatrix can be used as a read-only
+// operand in all operations that are supported for row-major sparse matrices.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+class SlicedEllMatrix
+   : public SparseMatrix< SlicedEllMatrix<Type,Tag>, false >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This     = SlicedEllMatrix<Type,Tag>;  //!< Type of this SlicedEllMatrix instance.
+   using BaseType = SparseMatrix<This,false>;   //!< Base type of this SlicedEllMatrix instance.
+
+   //! Result type for expression template evaluations.
+   using ResultType = CompressedMatrix<Type,false,Tag>;
+
+   //! Result type with opposite storage order for expression template evaluations.
+   using OppositeType = CompressedMatrix<Type,true,Tag>;
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = CompressedMatrix<Type,true,Tag>;
+
+   using ElementType    = Type;         //!< Type of the sliced ELLPACK matrix elements.
+   using TagType        = Tag;          //!< Tag type of this SlicedEllMatrix instance.
+   using ReturnType     = const Type;   //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;  //!< Data type for composite expression templates.
+   using Reference      = const Type;   //!< Reference to a sliced ELLPACK matrix element.
+   using ConstReference = const Type;   //!< Reference to a constant sliced ELLPACK matrix element.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SlicedEllMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = SlicedEllMatrix<NewType,Tag>;  //!< The type of the other SlicedEllMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a SlicedEllMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = SlicedEllMatrix<Type,Tag>;  //!< The type of the other SlicedEllMatrix.
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the non-zero elements of a single row of the sliced ELLPACK matrix.
+   //
+   // Since the elements of a row are interleaved with the elements of the other rows of the
+   // same slice, the iterator advances by the slice height \a C on every increment.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the sliced ELLPACK matrix.
+      using Element = ValueIndexPair<Type>;
+
+      using IteratorCategory = std::forward_iterator_tag;  //!< The iterator category.
+      using ValueType        = Element;                    //!< Type of the underlying pointers.
+      using PointerType      = ValueType*;                 //!< Pointer return type.
+      using ReferenceType    = ValueType&;                 //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                  //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying pointers.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator() noexcept
+         : value_( nullptr )  // Pointer to the current value
+         , index_( nullptr )  // Pointer to the current column index
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param value Pointer to the initial value.
+      // \param index Pointer to the initial column index.
+      */
+      inline ConstIterator( const Type* value, const size_t* index ) noexcept
+         : value_( value )  // Pointer to the current value
+         , index_( index )  // Pointer to the current column index
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() noexcept {
+         value_ += SIMDSIZE;
+         index_ += SIMDSIZE;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline ConstIterator operator++( int ) noexcept {
+         ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Element operator*() const noexcept {
+         return Element( *value_, *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Type& value() const noexcept {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const noexcept {
+         return value_ == rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return value_ != rhs.value_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return The number of elements between the two ConstIterator objects.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return ( value_ - rhs.value_ ) / DifferenceType( SIMDSIZE );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type*   value_;  //!< Pointer to the current value.
+      const size_t* index_;  //!< Pointer to the current column index.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator = ConstIterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SlicedEllMatrix();
+   explicit inline SlicedEllMatrix( const CompressedMatrix<Type,false,Tag>& sm,
+                                    size_t sigma = 256UL );
+
+   template< typename MT, bool SO >
+   explicit inline SlicedEllMatrix( const Matrix<MT,SO>& m, size_t sigma = 256UL );
+
+   SlicedEllMatrix( const SlicedEllMatrix& ) = default;
+   SlicedEllMatrix( SlicedEllMatrix&& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~SlicedEllMatrix() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   SlicedEllMatrix& operator=( const SlicedEllMatrix& ) & = default;
+   SlicedEllMatrix& operator=( SlicedEllMatrix&& ) & = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t sigma() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline size_t partition( size_t parts, size_t p ) const noexcept;
+   inline void   swap( SlicedEllMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using Values  = std::vector< Type, AlignedAllocator<Type> >;      //!< Storage of the values.
+   using Indices = std::vector< size_t, AlignedAllocator<size_t> >;  //!< Storage of the indices.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! The number of rows per slice.
+   static constexpr size_t SIMDSIZE = SIMDTrait<Type>::size;
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;         //!< The current number of rows of the sparse matrix.
+   size_t n_;         //!< The current number of columns of the sparse matrix.
+   size_t sigma_;     //!< The size of the sorting window.
+   size_t nonzeros_;  //!< The total number of non-zero elements.
+
+   std::vector<size_t> perm_;     //!< The row index of each storage position (padding: m_).
+   std::vector<size_t> pos_;      //!< The storage position of each row.
+   std::vector<size_t> length_;   //!< The number of non-zero elements of each storage position.
+   std::vector<size_t> start_;    //!< The offset of each slice within the values and indices.
+   Values              values_;   //!< The slice-wise interleaved values.
+   Indices             indices_;  //!< The slice-wise interleaved column indices.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename MT2, typename VT2 > friend class SEllMatDVecMultExpr;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SlicedEllMatrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline SlicedEllMatrix<Type,Tag>::SlicedEllMatrix()
+   : m_       ( 0UL )       // The current number of rows of the sparse matrix
+   , n_       ( 0UL )       // The current number of columns of the sparse matrix
+   , sigma_   ( SIMDSIZE )  // The size of the sorting window
+   , nonzeros_( 0UL )       // The total number of non-zero elements
+   , perm_    ()            // The row index of each storage position
+   , pos_     ()            // The storage position of each row
+   , length_  ()            // The number of non-zero elements of each storage position
+   , start_   ( 1UL, 0UL )  // The offset of each slice within the value and index arrays
+   , values_  ()            // The slice-wise interleaved values
+   , indices_ ()            // The slice-wise interleaved column indices
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a row-major compressed matrix.
+//
+// \param sm The compressed matrix to be converted.
+// \param sigma The size of the sorting window (rounded up to a multiple of the slice height).
+//
+// The rows of the given matrix are grouped into slices of \a C rows, where \a C is the number
+// of elements in a SIMD vector of type \a Type. Within each window of \a sigma consecutive rows
+// the rows are sorted by decreasing number of non-zero elements, which minimizes the padding
+// of the slices. A sorting window equal to the slice height only reorders the rows within each
+// slice. The sorting only affects the storage order, the logical order of the rows is preserved.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline SlicedEllMatrix<Type,Tag>::SlicedEllMatrix( const CompressedMatrix<Type,false,Tag>& sm,
+                                                   size_t sigma )
+   : m_       ( sm.rows() )      // The current number of rows of the sparse matrix
+   , n_       ( sm.columns() )   // The current number of columns of the sparse matrix
+   , sigma_   ( SIMDSIZE )       // The size of the sorting window
+   , nonzeros_( sm.nonZeros() )  // The total number of non-zero elements
+   , perm_    ()                 // The row index of each storage position
+   , pos_     ( m_ )             // The storage position of each row
+   , length_  ()                 // The number of non-zero elements of each storage position
+   , start_   ()                 // The offset of each slice within the value and index arrays
+   , values_  ()                 // The slice-wise interleaved values
+   , indices_ ()                 // The slice-wise interleaved column indices
+{
+   const size_t slices( ( m_ + SIMDSIZE - 1UL ) / SIMDSIZE );
+
+   if( sigma > SIMDSIZE ) {
+      sigma_ = ( sigma + SIMDSIZE - 1UL ) / SIMDSIZE * SIMDSIZE;
+   }
+
+   perm_.resize( slices*SIMDSIZE, m_ );
+   length_.resize( slices*SIMDSIZE, 0UL );
+   start_.resize( slices+1UL, 0UL );
+
+   std::iota( perm_.begin(), perm_.begin()+m_, size_t(0) );
+
+   const auto longer = [&sm]( size_t a, size_t b ) { return sm.nonZeros( a ) > sm.nonZeros( b ); };
+
+   for( size_t i=0UL; i<m_; i+=sigma_ ) {
+      std::stable_sort( perm_.begin()+i, perm_.begin()+min( i+sigma_, m_ ), longer );
+   }
+
+   for( size_t p=0UL; p<m_; ++p ) {
+      pos_[perm_[p]] = p;
+      length_[p] = sm.nonZeros( perm_[p] );
+   }
+
+   for( size_t k=0UL; k<slices; ++k ) {
+      start_[k+1UL] = start_[k] + length_[k*SIMDSIZE]*SIMDSIZE;
+   }
+
+   values_.resize( start_.back(), Type() );
+   indices_.resize( start_.back(), 0UL );
+
+   for( size_t p=0UL; p<m_; ++p )
+   {
+      size_t offset( start_[p/SIMDSIZE] + p%SIMDSIZE );
+
+      for( auto element=sm.begin( perm_[p] ); element!=sm.end( perm_[p] ); ++element ) {
+         values_ [offset] = element->value();
+         indices_[offset] = element->index();
+         offset += SIMDSIZE;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m The matrix to be converted.
+// \param sigma The size of the sorting window (rounded up to a multiple of the slice height).
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+template< typename MT     // Type of the foreign matrix
+        , bool SO >       // Storage order of the foreign matrix
+inline SlicedEllMatrix<Type,Tag>::SlicedEllMatrix( const Matrix<MT,SO>& m, size_t sigma )
+   : SlicedEllMatrix( CompressedMatrix<Type,false,Tag>( *m ), sigma )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TAG( Tag, TagType_t<MT> );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sliced ELLPACK matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename SlicedEllMatrix<Type,Tag>::ConstReference
+   SlicedEllMatrix<Type,Tag>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid sliced ELLPACK matrix row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid sliced ELLPACK matrix column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( i ) )
+      return Type();
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename SlicedEllMatrix<Type,Tag>::ConstReference
+   SlicedEllMatrix<Type,Tag>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename SlicedEllMatrix<Type,Tag>::ConstIterator
+   SlicedEllMatrix<Type,Tag>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sliced ELLPACK matrix row access index" );
+
+   const size_t p( pos_[i] );
+   const size_t offset( start_[p/SIMDSIZE] + p%SIMDSIZE );
+
+   return ConstIterator( values_.data()+offset, indices_.data()+offset );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename SlicedEllMatrix<Type,Tag>::ConstIterator
+   SlicedEllMatrix<Type,Tag>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename SlicedEllMatrix<Type,Tag>::ConstIterator
+   SlicedEllMatrix<Type,Tag>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sliced ELLPACK matrix row access index" );
+
+   const size_t p( pos_[i] );
+   const size_t offset( start_[p/SIMDSIZE] + p%SIMDSIZE + length_[p]*SIMDSIZE );
+
+   return ConstIterator( values_.data()+offset, indices_.data()+offset );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename SlicedEllMatrix<Type,Tag>::ConstIterator
+   SlicedEllMatrix<Type,Tag>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sliced ELLPACK matrix.
+//
+// \return The number of rows of the sliced ELLPACK matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t SlicedEllMatrix<Type,Tag>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sliced ELLPACK matrix.
+//
+// \return The number of columns of the sliced ELLPACK matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t SlicedEllMatrix<Type,Tag>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the sorting window of the sliced ELLPACK matrix.
+//
+// \return The number of consecutive rows that are sorted by their number of non-zero elements.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t SlicedEllMatrix<Type,Tag>::sigma() const noexcept
+{
+   return sigma_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sliced ELLPACK matrix.
+//
+// \return The capacity of the sliced ELLPACK matrix.
+//
+// The capacity includes the padding elements that are required to fill each slice.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t SlicedEllMatrix<Type,Tag>::capacity() const noexcept
+{
+   return values_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+//
+// The capacity of a row corresponds to the number of non-zero elements of the longest row of
+// its slice.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t SlicedEllMatrix<Type,Tag>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return length_[pos_[i]/SIMDSIZE*SIMDSIZE];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the sliced ELLPACK matrix
+//
+// \return The number of non-zero elements in the sliced ELLPACK matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t SlicedEllMatrix<Type,Tag>::nonZeros() const noexcept
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t SlicedEllMatrix<Type,Tag>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+   return length_[pos_[i]];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the boundaries of a load-balanced partitioning of the rows.
+//
+// \param parts The total number of parts.
+// \param p The index of the requested boundary in the range \f$[0..parts]\f$.
+// \return The first row of part \a p (or the number of rows in case \a p is equal to \a parts).
+//
+// This function splits the rows of the matrix into \a parts consecutive ranges that contain
+// approximately the same number of stored elements (including the padding). All boundaries
+// coincide with the boundaries of the sorting windows, i.e. the rows of part \a p are stored
+// exclusively in the storage positions of part \a p. Parts may be empty in case the matrix
+// consists of less sorting windows than parts.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline size_t SlicedEllMatrix<Type,Tag>::partition( size_t parts, size_t p ) const noexcept
+{
+   BLAZE_USER_ASSERT( p <= parts, "Invalid partition index" );
+
+   if( p == 0UL || m_ == 0UL )
+      return 0UL;
+
+   if( p >= parts )
+      return m_;
+
+   const size_t slices ( start_.size() - 1UL );
+   const size_t stride ( sigma_ / SIMDSIZE );
+   const size_t windows( ( slices + stride - 1UL ) / stride );
+   const size_t target ( static_cast<size_t>( double( start_.back() ) * p / parts ) );
+
+   size_t low( 0UL ), high( windows );
+
+   while( low < high ) {
+      const size_t mid( ( low + high ) / 2UL );
+      if( start_[mid*stride] < target ) low = mid + 1UL;
+      else high = mid;
+   }
+
+   return min( low*sigma_, m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sliced ELLPACK matrices.
+//
+// \param m The sliced ELLPACK matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void SlicedEllMatrix<Type,Tag>::swap( SlicedEllMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( m_, m.m_ );
+   swap( n_, m.n_ );
+   swap( sigma_, m.sigma_ );
+   swap( nonzeros_, m.nonzeros_ );
+   swap( perm_, m.perm_ );
+   swap( pos_, m.pos_ );
+   swap( length_, m.length_ );
+   swap( start_, m.start_ );
+   swap( values_, m.values_ );
+   swap( indices_, m.indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename SlicedEllMatrix<Type,Tag>::ConstIterator
+   SlicedEllMatrix<Type,Tag>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else
+      return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less than the given index, end() iterator otherwise.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename SlicedEllMatrix<Type,Tag>::ConstIterator
+   SlicedEllMatrix<Type,Tag>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
+
+   const size_t p( pos_[i] );
+   const size_t offset( start_[p/SIMDSIZE] + p%SIMDSIZE );
+
+   size_t low( 0UL ), high( length_[p] );
+
+   while( low < high ) {
+      const size_t mid( ( low + high ) / 2UL );
+      if( indices_[offset+mid*SIMDSIZE] < j ) low = mid + 1UL;
+      else high = mid;
+   }
+
+   const size_t index( offset + low*SIMDSIZE );
+
+   return ConstIterator( values_.data()+index, indices_.data()+index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater than the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater than the given index, end() iterator otherwise.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline typename SlicedEllMatrix<Type,Tag>::ConstIterator
+   SlicedEllMatrix<Type,Tag>::upperBound( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos != end( i ) && pos->index() == j )
+      return std::next( pos );
+   else
+      return pos;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllMatrix<Type,Tag>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , typename Tag >    // Type tag
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllMatrix<Type,Tag>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline bool SlicedEllMatrix<Type,Tag>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SLICEDELLMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SlicedEllMatrix operators */
+//@{
+template< typename Type, typename Tag >
+bool isIntact( const SlicedEllMatrix<Type,Tag>& m ) noexcept;
+
+template< typename Type, typename Tag >
+void swap( SlicedEllMatrix<Type,Tag>& a, SlicedEllMatrix<Type,Tag>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given sliced ELLPACK matrix are intact.
+// \ingroup sliced_ell_matrix
+//
+// \param m The sliced ELLPACK matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the sliced ELLPACK matrix are intact, i.e. if
+// its state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline bool isIntact( const SlicedEllMatrix<Type,Tag>& m ) noexcept
+{
+   return ( m.nonZeros() <= m.capacity() && m.sigma() % SIMDTrait<Type>::size == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sliced ELLPACK matrices.
+// \ingroup sliced_ell_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type   // Data type of the matrix
+        , typename Tag >  // Type tag
+inline void swap( SlicedEllMatrix<Type,Tag>& a, SlicedEllMatrix<Type,Tag>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,346 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SoAElement.h
+//  \brief Header file for the SoAElement class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_SOAELEMENT_H_
+#define _BLAZE_MATH_SPARSE_SOAELEMENT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/typetraits/IsSparseElement.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for a single element of a structure-of-arrays sparse container.
+// \ingroup math
+//
+// The SoAElement class represents a single value-index-pair of a sparse vector or matrix that
+// stores its values and indices in two separate arrays (structure-of-arrays layout). Instead of
+// holding the value and the index itself, the element refers to the according entries within
+// the two arrays. All assignments are therefore forwarded to the referenced value (and index).
+// In contrast to the ValueIndexPair class, the index type \a IT of the underlying index array
+// can be chosen freely, which for instance enables 32-bit indices.
+*/
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+class SoAElement
+   : private SparseElement
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ValueType      = Type;         //!< The value type of the element.
+   using IndexType      = size_t;       //!< The index type of the element.
+   using Reference      = Type&;        //!< Reference return type.
+   using ConstReference = const Type&;  //!< Reference-to-const return type.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   constexpr SoAElement( Type* value, IT* index ) noexcept;
+
+   SoAElement( const SoAElement& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~SoAElement() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SoAElement& operator=( const SoAElement& rhs );
+
+   template< typename Other >
+   inline auto operator=( const Other& rhs )
+      -> EnableIf_t< IsSparseElement_v<Other>, SoAElement& >;
+
+   template< typename Other >
+   inline auto operator=( const Other& v )
+      -> EnableIf_t< !IsSparseElement_v<Other>, SoAElement& >;
+
+   template< typename Other > inline SoAElement& operator+=( const Other& v );
+   template< typename Other > inline SoAElement& operator-=( const Other& v );
+   template< typename Other > inline SoAElement& operator*=( const Other& v );
+   template< typename Other > inline SoAElement& operator/=( const Other& v );
+   //@}
+   //**********************************************************************************************
+
+   //**Acess functions*****************************************************************************
+   /*!\name Access functions */
+   //@{
+   constexpr Reference value() const noexcept;
+   constexpr IndexType index() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Type* value_;  //!< Pointer to the referenced value.
+   IT*   index_;  //!< Pointer to the referenced index.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SoAElement class.
+//
+// \param value Pointer to the referenced value.
+// \param index Pointer to the referenced index.
+*/
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+constexpr SoAElement<Type,IT>::SoAElement( Type* value, IT* index ) noexcept
+   : value_( value )  // Pointer to the referenced value
+   , index_( index )  // Pointer to the referenced index
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SoAElement.
+//
+// \param rhs Element to be copied.
+// \return Reference to the assigned element.
+//
+// In contrast to the copy constructor, the copy assignment operator does not rebind the element
+// but assigns both the value and the index of the given element to the referenced entries.
+*/
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+inline SoAElement<Type,IT>& SoAElement<Type,IT>::operator=( const SoAElement& rhs )
+{
+   *value_ = *rhs.value_;
+   *index_ = *rhs.index_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse element types.
+//
+// \param rhs Sparse element to be copied.
+// \return Reference to the assigned element.
+//
+// This assignment operator enables the assignment of other sparse element types. The given
+// \a Other data type qualifies as sparse element type in case it provides a value() and an
+// index() member function.
+*/
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
+template< typename Other >  // Data type of the right-hand side sparse element
+inline auto SoAElement<Type,IT>::operator=( const Other& rhs )
+   -> EnableIf_t< IsSparseElement_v<Other>, SoAElement& >
+{
+   *value_ = rhs.value();
+   *index_ = rhs.index();
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment to the referenced value.
+//
+// \param v The new value.
+// \return Reference to the assigned element.
+*/
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
+template< typename Other >  // Data type of the right-hand side value
+inline auto SoAElement<Type,IT>::operator=( const Other& v )
+   -> EnableIf_t< !IsSparseElement_v<Other>, SoAElement& >
+{
+   *value_ = v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the referenced value.
+//
+// \param v The right-hand side value to be added to the referenced value.
+// \return Reference to the assigned element.
+*/
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
+template< typename Other >  // Data type of the right-hand side value
+inline SoAElement<Type,IT>& SoAElement<Type,IT>::operator+=( const Other& v )
+{
+   *value_ += v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the referenced value.
+//
+// \param v The right-hand side value to be subtracted from the referenced value.
+// \return Reference to the assigned element.
+*/
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
+template< typename Other >  // Data type of the right-hand side value
+inline SoAElement<Type,IT>& SoAElement<Type,IT>::operator-=( const Other& v )
+{
+   *value_ -= v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the referenced value.
+//
+// \param v The right-hand side value for the multiplication.
+// \return Reference to the assigned element.
+*/
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
+template< typename Other >  // Data type of the right-hand side value
+inline SoAElement<Type,IT>& SoAElement<Type,IT>::operator*=( const Other& v )
+{
+   *value_ *= v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the referenced value.
+//
+// \param v The right-hand side value for the division.
+// \return Reference to the assigned element.
+*/
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the index element
+template< typename Other >  // Data type of the right-hand side value
+inline SoAElement<Type,IT>& SoAElement<Type,IT>::operator/=( const Other& v )
+{
+   *value_ /= v;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the referenced value.
+//
+// \return Reference to the referenced value.
+*/
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+constexpr typename SoAElement<Type,IT>::Reference SoAElement<Type,IT>::value() const noexcept
+{
+   return *value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the referenced index.
+//
+// \return The referenced index.
+*/
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the index element
+constexpr typename SoAElement<Type,IT>::IndexType SoAElement<Type,IT>::index() const noexcept
+{
+   return *index_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,659 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SoAIterator.h
+//  \brief Header file for the SoAIterator class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_SOAITERATOR_H_
+#define _BLAZE_MATH_SPARSE_SOAITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/sparse/SoAElement.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a generic iterator for structure-of-arrays sparse containers.
+// \ingroup math
+//
+// The SoAIterator represents a generic random-access iterator over the non-zero elements of
+// sparse vectors and specific rows/columns of sparse matrices that store their values and
+// indices in two separate arrays. The iterator simultaneously traverses the value and the index
+// array. Dereferencing the iterator results in an SoAElement proxy, the value() and index()
+// functions of the currently referenced element are directly accessible via operator->().
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+class SoAIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+   using ValueType        = SoAElement<Type,IT>;              //!< Type of the underlying elements.
+   using PointerType      = const SoAIterator*;               //!< Pointer return type.
+   using ReferenceType    = SoAElement<Type,IT>;              //!< Reference return type.
+   using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+   // STL iterator requirements
+   using iterator_category = IteratorCategory;  //!< The iterator category.
+   using value_type        = ValueType;         //!< Type of the underlying elements.
+   using pointer           = PointerType;       //!< Pointer return type.
+   using reference         = ReferenceType;     //!< Reference return type.
+   using difference_type   = DifferenceType;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   constexpr SoAIterator() noexcept;
+   constexpr SoAIterator( Type* value, IT* index ) noexcept;
+
+   template< typename Other, typename OIT >
+   constexpr SoAIterator( const SoAIterator<Other,OIT>& it ) noexcept;
+
+   SoAIterator( const SoAIterator& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~SoAIterator() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   constexpr SoAIterator& operator+=( ptrdiff_t inc ) noexcept;
+   constexpr SoAIterator& operator-=( ptrdiff_t dec ) noexcept;
+
+   SoAIterator& operator=( const SoAIterator& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Increment/decrement operators***************************************************************
+   /*!\name Increment/decrement operators */
+   //@{
+   constexpr SoAIterator&      operator++()      noexcept;
+   constexpr const SoAIterator operator++( int ) noexcept;
+   constexpr SoAIterator&      operator--()      noexcept;
+   constexpr const SoAIterator operator--( int ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   constexpr ReferenceType operator[]( size_t index ) const noexcept;
+   constexpr ReferenceType operator* () const noexcept;
+   constexpr PointerType   operator->() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   constexpr Type&  value() const noexcept;
+   constexpr size_t index() const noexcept;
+   constexpr Type*  base() const noexcept;
+   constexpr IT*    indexBase() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Type* value_;  //!< Pointer to the current value.
+   IT*   index_;  //!< Pointer to the current index.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the SoAIterator class.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr SoAIterator<Type,IT>::SoAIterator() noexcept
+   : value_( nullptr )  // Pointer to the current value
+   , index_( nullptr )  // Pointer to the current index
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the SoAIterator class.
+//
+// \param value Pointer to the initial value.
+// \param index Pointer to the initial index.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr SoAIterator<Type,IT>::SoAIterator( Type* value, IT* index ) noexcept
+   : value_( value )  // Pointer to the current value
+   , index_( index )  // Pointer to the current index
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different SoAIterator instances.
+//
+// \param it The foreign SoAIterator instance to be copied.
+*/
+template< typename Type     // Type of the values
+        , typename IT >     // Type of the indices
+template< typename Other    // Type of the foreign values
+        , typename OIT >    // Type of the foreign indices
+constexpr SoAIterator<Type,IT>::SoAIterator( const SoAIterator<Other,OIT>& it ) noexcept
+   : value_( it.base() )       // Pointer to the current value
+   , index_( it.indexBase() )  // Pointer to the current index
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator.
+//
+// \param inc The increment of the iterator.
+// \return The incremented iterator.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr SoAIterator<Type,IT>& SoAIterator<Type,IT>::operator+=( ptrdiff_t inc ) noexcept
+{
+   value_ += inc;
+   index_ += inc;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator.
+//
+// \param dec The decrement of the iterator.
+// \return The decremented iterator.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr SoAIterator<Type,IT>& SoAIterator<Type,IT>::operator-=( ptrdiff_t dec ) noexcept
+{
+   value_ -= dec;
+   index_ -= dec;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INCREMENT/DECREMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Pre-increment operator.
+//
+// \return Reference to the incremented iterator.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr SoAIterator<Type,IT>& SoAIterator<Type,IT>::operator++() noexcept
+{
+   ++value_;
+   ++index_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-increment operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr const SoAIterator<Type,IT> SoAIterator<Type,IT>::operator++( int ) noexcept
+{
+   return SoAIterator( value_++, index_++ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pre-decrement operator.
+//
+// \return Reference to the decremented iterator.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr SoAIterator<Type,IT>& SoAIterator<Type,IT>::operator--() noexcept
+{
+   --value_;
+   --index_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-decrement operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr const SoAIterator<Type,IT> SoAIterator<Type,IT>::operator--( int ) noexcept
+{
+   return SoAIterator( value_--, index_-- );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the underlying elements.
+//
+// \param index Access index.
+// \return Proxy to the accessed element.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr typename SoAIterator<Type,IT>::ReferenceType
+   SoAIterator<Type,IT>::operator[]( size_t index ) const noexcept
+{
+   return ReferenceType( value_+index, index_+index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a proxy to the element at the current iterator position.
+//
+// \return Proxy to the element at the current iterator position.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr typename SoAIterator<Type,IT>::ReferenceType
+   SoAIterator<Type,IT>::operator*() const noexcept
+{
+   return ReferenceType( value_, index_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the element at the current iterator position.
+//
+// \return Pointer to the iterator providing access to the current value and index.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr typename SoAIterator<Type,IT>::PointerType
+   SoAIterator<Type,IT>::operator->() const noexcept
+{
+   return this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the current value of the element.
+//
+// \return Reference to the current value.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr Type& SoAIterator<Type,IT>::value() const noexcept
+{
+   return *value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the current index of the element.
+//
+// \return The current index.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr size_t SoAIterator<Type,IT>::index() const noexcept
+{
+   return *index_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the underlying value array.
+//
+// \return Pointer to the current value.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr Type* SoAIterator<Type,IT>::base() const noexcept
+{
+   return value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the underlying index array.
+//
+// \return Pointer to the current index.
+*/
+template< typename Type  // Type of the values
+        , typename IT >  // Type of the indices
+constexpr IT* SoAIterator<Type,IT>::indexBase() const noexcept
+{
+   return index_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SoAIterator operators */
+//@{
+template< typename T1, typename IT1, typename T2, typename IT2 >
+constexpr bool operator==( const SoAIterator<T1,IT1>& lhs, const SoAIterator<T2,IT2>& rhs ) noexcept;
+
+template< typename T1, typename IT1, typename T2, typename IT2 >
+constexpr bool operator!=( const SoAIterator<T1,IT1>& lhs, const SoAIterator<T2,IT2>& rhs ) noexcept;
+
+template< typename T1, typename IT1, typename T2, typename IT2 >
+constexpr bool operator<( const SoAIterator<T1,IT1>& lhs, const SoAIterator<T2,IT2>& rhs ) noexcept;
+
+template< typename T1, typename IT1, typename T2, typename IT2 >
+constexpr bool operator>( const SoAIterator<T1,IT1>& lhs, const SoAIterator<T2,IT2>& rhs ) noexcept;
+
+template< typename T1, typename IT1, typename T2, typename IT2 >
+constexpr bool operator<=( const SoAIterator<T1,IT1>& lhs, const SoAIterator<T2,IT2>& rhs ) noexcept;
+
+template< typename T1, typename IT1, typename T2, typename IT2 >
+constexpr bool operator>=( const SoAIterator<T1,IT1>& lhs, const SoAIterator<T2,IT2>& rhs ) noexcept;
+
+template< typename Type, typename IT >
+constexpr const SoAIterator<Type,IT>
+   operator+( const SoAIterator<Type,IT>& it, ptrdiff_t inc ) noexcept;
+
+template< typename Type, typename IT >
+constexpr const SoAIterator<Type,IT>
+   operator+( ptrdiff_t inc, const SoAIterator<Type,IT>& it ) noexcept;
+
+template< typename Type, typename IT >
+constexpr const SoAIterator<Type,IT>
+   operator-( const SoAIterator<Type,IT>& it, ptrdiff_t dec ) noexcept;
+
+template< typename T1, typename IT1, typename T2, typename IT2 >
+constexpr ptrdiff_t operator-( const SoAIterator<T1,IT1>& lhs, const SoAIterator<T2,IT2>& rhs ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two SoAIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators refer to the same element, \a false if not.
+*/
+template< typename T1     // Value type of the left-hand side iterator
+        , typename IT1    // Index type of the left-hand side iterator
+        , typename T2     // Value type of the right-hand side iterator
+        , typename IT2 >  // Index type of the right-hand side iterator
+constexpr bool operator==( const SoAIterator<T1,IT1>& lhs, const SoAIterator<T2,IT2>& rhs ) noexcept
+{
+   return lhs.base() == rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two SoAIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators don't refer to the same element, \a false if they do.
+*/
+template< typename T1     // Value type of the left-hand side iterator
+        , typename IT1    // Index type of the left-hand side iterator
+        , typename T2     // Value type of the right-hand side iterator
+        , typename IT2 >  // Index type of the right-hand side iterator
+constexpr bool operator!=( const SoAIterator<T1,IT1>& lhs, const SoAIterator<T2,IT2>& rhs ) noexcept
+{
+   return lhs.base() != rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two SoAIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is smaller, \a false if not.
+*/
+template< typename T1     // Value type of the left-hand side iterator
+        , typename IT1    // Index type of the left-hand side iterator
+        , typename T2     // Value type of the right-hand side iterator
+        , typename IT2 >  // Index type of the right-hand side iterator
+constexpr bool operator<( const SoAIterator<T1,IT1>& lhs, const SoAIterator<T2,IT2>& rhs ) noexcept
+{
+   return lhs.base() < rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between two SoAIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater, \a false if not.
+*/
+template< typename T1     // Value type of the left-hand side iterator
+        , typename IT1    // Index type of the left-hand side iterator
+        , typename T2     // Value type of the right-hand side iterator
+        , typename IT2 >  // Index type of the right-hand side iterator
+constexpr bool operator>( const SoAIterator<T1,IT1>& lhs, const SoAIterator<T2,IT2>& rhs ) noexcept
+{
+   return lhs.base() > rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between two SoAIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is less or equal, \a false if not.
+*/
+template< typename T1     // Value type of the left-hand side iterator
+        , typename IT1    // Index type of the left-hand side iterator
+        , typename T2     // Value type of the right-hand side iterator
+        , typename IT2 >  // Index type of the right-hand side iterator
+constexpr bool operator<=( const SoAIterator<T1,IT1>& lhs, const SoAIterator<T2,IT2>& rhs ) noexcept
+{
+   return lhs.base() <= rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between two SoAIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+*/
+template< typename T1     // Value type of the left-hand side iterator
+        , typename IT1    // Index type of the left-hand side iterator
+        , typename T2     // Value type of the right-hand side iterator
+        , typename IT2 >  // Index type of the right-hand side iterator
+constexpr bool operator>=( const SoAIterator<T1,IT1>& lhs, const SoAIterator<T2,IT2>& rhs ) noexcept
+{
+   return lhs.base() >= rhs.base();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between a SoAIterator and an integral value.
+//
+// \param it The iterator to be incremented.
+// \param inc The number of elements the iterator is incremented.
+// \return The incremented iterator.
+*/
+template< typename Type  // Value type of the iterator
+        , typename IT >  // Index type of the iterator
+constexpr const SoAIterator<Type,IT> operator+( const SoAIterator<Type,IT>& it, ptrdiff_t inc ) noexcept
+{
+   return SoAIterator<Type,IT>( it.base() + inc, it.indexBase() + inc );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between an integral value and a SoAIterator.
+//
+// \param inc The number of elements the iterator is incremented.
+// \param it The iterator to be incremented.
+// \return The incremented iterator.
+*/
+template< typename Type  // Value type of the iterator
+        , typename IT >  // Index type of the iterator
+constexpr const SoAIterator<Type,IT> operator+( ptrdiff_t inc, const SoAIterator<Type,IT>& it ) noexcept
+{
+   return SoAIterator<Type,IT>( it.base() + inc, it.indexBase() + inc );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction between a SoAIterator and an integral value.
+//
+// \param it The iterator to be decremented.
+// \param dec The number of elements the iterator is decremented.
+// \return The decremented iterator.
+*/
+template< typename Type  // Value type of the iterator
+        , typename IT >  // Index type of the iterator
+constexpr const SoAIterator<Type,IT> operator-( const SoAIterator<Type,IT>& it, ptrdiff_t dec ) noexcept
+{
+   return SoAIterator<Type,IT>( it.base() - dec, it.indexBase() - dec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the number of elements between two SoAIterator objects.
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return The number of elements between the two iterators.
+*/
+template< typename T1     // Value type of the left-hand side iterator
+        , typename IT1    // Index type of the left-hand side iterator
+        , typename T2     // Value type of the right-hand side iterator
+        , typename IT2 >  // Index type of the right-hand side iterator
+constexpr ptrdiff_t operator-( const SoAIterator<T1,IT1>& lhs, const SoAIterator<T2,IT2>& rhs ) noexcept
+{
+   return lhs.base() - rhs.base();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
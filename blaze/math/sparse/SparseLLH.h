@@ -0,0 +1,653 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SparseLLH.h
+//  \brief Header file for the supernodal sparse Cholesky decomposition
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPARSELLH_H_
+#define _BLAZE_MATH_SPARSE_SPARSELLH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/BlockedDecomposition.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/sparse/SparseSymbolic.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Supernodal sparse Cholesky decomposition.
+// \ingroup sparse_matrix
+//
+// The SparseLLH class template represents the Cholesky decomposition \f$ P A P^T = L L^H \f$ of a
+// sparse symmetric (or Hermitian) positive definite matrix \a A, where \a P is a fill-reducing
+// permutation and \a L is a lower triangular matrix. The decomposition is split into a symbolic
+// and a numeric phase:
+//
+//  - analyze(): The symbolic phase computes an approximate minimum degree ordering, the
+//    elimination tree, and the supernodal structure of \a L (see the SparseSymbolic class).
+//    It depends on the sparsity pattern of \a A only.
+//  - factorize(): The numeric phase computes the values of \a L. The columns of each supernode
+//    are stored as a dense column-major panel. Each panel is factorized by the native blocked
+//    dense Cholesky decomposition and the contribution to the ancestor supernodes is computed
+//    via a dense matrix/dense matrix multiplication. The numeric phase can be repeated for an
+//    arbitrary number of matrices with the sparsity pattern that has been analyzed.
+//
+// Only the lower part of the system matrix is accessed. Once factorized, the decomposition can
+// be used to solve linear systems for any number of right-hand sides:
+
+   \code
+   blaze::CompressedMatrix<double> A( 10000UL, 10000UL );
+   blaze::DynamicVector<double> x, b( 10000UL );
+   // ... Initialization of the positive definite matrix A and of b
+
+   blaze::SparseLLH<double> llh;
+   llh.analyze( A );    // Symbolic phase
+   llh.factorize( A );  // Numeric phase
+   llh.solve( x, b );   // Solving the LSE A*x=b
+
+   // ... Modification of the values (but not the sparsity pattern) of A
+
+   llh.factorize( A );  // Numeric refactorization
+   llh.solve( x, b );
+   \endcode
+
+// The SparseLLH class template can only be used with \c float, \c double, \c complex<float>, and
+// \c complex<double> element type. The attempt to instantiate the class template with any other
+// element type results in a compile time error!
+*/
+template< typename Type >  // Data type of the elements
+class SparseLLH
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SparseLLH();
+
+   template< typename MT, bool SO >
+   explicit inline SparseLLH( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO > void analyze  ( const SparseMatrix<MT,SO>& A );
+   template< typename MT, bool SO > void factorize( const SparseMatrix<MT,SO>& A );
+   template< typename MT, bool SO > void compute  ( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   void solve( DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& b ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void solve( DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& B ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t                rows    () const noexcept;
+   inline size_t                columns () const noexcept;
+   inline size_t                nonZeros() const noexcept;
+   inline const SparseSymbolic& symbolic() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void substitute( Type* y ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Panel = CustomMatrix<Type,unaligned,unpadded,columnMajor>;  //!< Type of a supernode panel.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SparseSymbolic      symbolic_;    //!< The symbolic analysis of the system matrix.
+   std::vector<size_t> offset_;      //!< The offset of the panel of each supernode.
+   std::vector<Type>   values_;      //!< The values of the panels of all supernodes.
+   bool                factorized_;  //!< Flag for a valid numeric factorization.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SparseLLH.
+*/
+template< typename Type >  // Data type of the elements
+inline SparseLLH<Type>::SparseLLH()
+   : symbolic_  ()         // The symbolic analysis of the system matrix
+   , offset_    ( 1UL )    // The offset of the panel of each supernode
+   , values_    ()         // The values of the panels of all supernodes
+   , factorized_( false )  // Flag for a valid numeric factorization
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the Cholesky decomposition of the given sparse matrix.
+//
+// \param A The symmetric (or Hermitian) positive definite system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+inline SparseLLH<Type>::SparseLLH( const SparseMatrix<MT,SO>& A )
+   : SparseLLH()
+{
+   compute( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the given sparse matrix.
+//
+// \param A The symmetric (or Hermitian) system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function performs the symbolic phase of the Cholesky decomposition based on the sparsity
+// pattern of the lower part of the given matrix. Any previous numeric factorization is discarded.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+void SparseLLH<Type>::analyze( const SparseMatrix<MT,SO>& A )
+{
+   SparseSymbolic symbolic( *A, true );
+
+   std::vector<size_t> offset( 1UL, 0UL );
+   offset.reserve( symbolic.supernodes() + 1UL );
+
+   for( size_t s=0UL; s<symbolic.supernodes(); ++s ) {
+      offset.push_back( offset.back() + symbolic.rows(s) * symbolic.columns(s) );
+   }
+
+   symbolic_ = std::move( symbolic );
+   offset_   = std::move( offset );
+   values_.clear();
+   factorized_ = false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric factorization of the given sparse matrix.
+//
+// \param A The symmetric (or Hermitian) positive definite system matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Sparsity pattern does not match the symbolic analysis.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function computes the numeric Cholesky decomposition of the given matrix based on the
+// previous symbolic analysis (see analyze()). The sparsity pattern of the lower part of \a A must
+// be contained in the analyzed pattern. Only the lower part of \a A is accessed.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+void SparseLLH<Type>::factorize( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<MT> );
+
+   const SparseSymbolic& sym( symbolic_ );
+   const size_t n ( sym.size() );
+   const size_t ns( sym.supernodes() );
+
+   if( (*A).rows() != n || (*A).columns() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   factorized_ = false;
+   values_.assign( offset_.back(), Type() );
+
+   // Assembly of the lower part of the reordered matrix
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=(*A).begin(i); element!=(*A).end(i); ++element )
+      {
+         const size_t row( SO ? element->index() : i );
+         const size_t col( SO ? i : element->index() );
+
+         if( row < col ) continue;
+
+         size_t pi( sym.inverse()[row] );
+         size_t pj( sym.inverse()[col] );
+         Type value( element->value() );
+
+         if( pi < pj ) {
+            std::swap( pi, pj );
+            value = conj( value );
+         }
+
+         const size_t s( sym.supernode( pj ) );
+         const size_t k( sym.find( s, pi ) );
+
+         if( k == sym.rows(s) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Sparsity pattern does not match the symbolic analysis" );
+         }
+
+         values_[offset_[s] + ( pj - sym.first(s) )*sym.rows(s) + k] = value;
+      }
+   }
+
+   // Right-looking supernodal factorization
+   std::vector<size_t> map( n );
+   DynamicMatrix<Type,columnMajor> update;
+
+   for( size_t s=0UL; s<ns; ++s )
+   {
+      const size_t w( sym.columns(s) );
+      const size_t m( sym.rows(s) );
+      const size_t r( m - w );
+      const size_t* rowIdx( sym.structure(s) + w );
+
+      Panel D( values_.data()+offset_[s], w, w, m );
+      blockedPotrf( D );
+
+      if( r == 0UL ) continue;
+
+      Panel L( values_.data()+offset_[s], m, w );
+      auto L21( submatrix( L, w, 0UL, r, w, unchecked ) );
+
+      for( size_t j=0UL; j<w; ++j ) {
+         auto lj( column( L21, j, unchecked ) );
+         lj *= Type(1) / D(j,j);
+         for( size_t l=j+1UL; l<w; ++l ) {
+            column( L21, l, unchecked ) -= lj * conj( D(l,j) );
+         }
+      }
+
+      // Update of the ancestor supernodes
+      for( size_t c0=0UL; c0<r; )
+      {
+         const size_t t ( sym.supernode( rowIdx[c0] ) );
+         const size_t ft( sym.first(t) );
+         const size_t mt( sym.rows(t) );
+         const size_t lt( ft + sym.columns(t) );
+         const size_t* rowIdxT( sym.structure(t) );
+
+         size_t c1( c0+1UL );
+         while( c1 < r && rowIdx[c1] < lt ) ++c1;
+
+         for( size_t k=0UL; k<mt; ++k ) {
+            map[rowIdxT[k]] = k;
+         }
+
+         update = submatrix( L21, c0, 0UL, r-c0, w, unchecked ) *
+                  ctrans( submatrix( L21, c0, 0UL, c1-c0, w, unchecked ) );
+
+         for( size_t b=0UL; b<c1-c0; ++b ) {
+            Type* target( values_.data() + offset_[t] + ( rowIdx[c0+b] - ft )*mt );
+            for( size_t a=b; a<r-c0; ++a ) {
+               target[map[rowIdx[c0+a]]] -= update(a,b);
+            }
+         }
+
+         c0 = c1;
+      }
+   }
+
+   factorized_ = true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis and numeric factorization of the given sparse matrix.
+//
+// \param A The symmetric (or Hermitian) positive definite system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+void SparseLLH<Type>::compute( const SparseMatrix<MT,SO>& A )
+{
+   analyze( A );
+   factorize( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A x = b \f$ by means of the Cholesky decomposition.
+//
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::logic_error Missing numeric factorization.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// The solution vector \a x is resized to the size of the system, if necessary.
+*/
+template< typename Type >  // Data type of the elements
+template< typename VT1     // Type of the solution vector
+        , bool TF1         // Transpose flag of the solution vector
+        , typename VT2     // Type of the right-hand side vector
+        , bool TF2 >       // Transpose flag of the right-hand side vector
+void SparseLLH<Type>::solve( DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& b ) const
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<VT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<VT2> );
+
+   if( !factorized_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "Missing numeric factorization" );
+   }
+
+   const size_t n( symbolic_.size() );
+   const std::vector<size_t>& perm( symbolic_.permutation() );
+
+   if( (*b).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   DynamicVector<Type> y( n );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      y[k] = (*b)[perm[k]];
+   }
+
+   substitute( y.data() );
+
+   resize( *x, n, false );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      (*x)[perm[k]] = y[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the linear systems \f$ A X = B \f$ by means of the Cholesky decomposition.
+//
+// \param X The resulting solution matrix.
+// \param B The matrix of right-hand sides.
+// \return void
+// \exception std::logic_error Missing numeric factorization.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+//
+// The solution matrix \a X is resized to the size of \a B, if necessary.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT1     // Type of the solution matrix
+        , bool SO1         // Storage order of the solution matrix
+        , typename MT2     // Type of the right-hand side matrix
+        , bool SO2 >       // Storage order of the right-hand side matrix
+void SparseLLH<Type>::solve( DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& B ) const
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<MT2> );
+
+   if( !factorized_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "Missing numeric factorization" );
+   }
+
+   const size_t n( symbolic_.size() );
+   const std::vector<size_t>& perm( symbolic_.permutation() );
+
+   if( (*B).rows() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   resize( *X, n, (*B).columns(), false );
+
+   DynamicVector<Type> y( n );
+
+   for( size_t j=0UL; j<(*B).columns(); ++j )
+   {
+      for( size_t k=0UL; k<n; ++k ) {
+         y[k] = (*B)(perm[k],j);
+      }
+
+      substitute( y.data() );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         (*X)(perm[k],j) = y[k];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward and backward substitution with the supernodal Cholesky factor.
+//
+// \param y The reordered right-hand side, which is overwritten with the reordered solution.
+// \return void
+*/
+template< typename Type >  // Data type of the elements
+void SparseLLH<Type>::substitute( Type* y ) const
+{
+   const SparseSymbolic& sym( symbolic_ );
+   const size_t ns( sym.supernodes() );
+
+   DynamicVector<Type> tmp;
+
+   // Forward substitution with L
+   for( size_t s=0UL; s<ns; ++s )
+   {
+      const size_t f( sym.first(s) );
+      const size_t w( sym.columns(s) );
+      const size_t m( sym.rows(s) );
+      const size_t r( m - w );
+      const size_t* rowIdx( sym.structure(s) + w );
+
+      const CustomMatrix<const Type,unaligned,unpadded,columnMajor> L( values_.data()+offset_[s], m, w );
+      CustomVector<Type,unaligned,unpadded> ys( y+f, w );
+
+      for( size_t j=0UL; j<w; ++j ) {
+         ys[j] /= L(j,j);
+         subvector( ys, j+1UL, w-j-1UL, unchecked ) -=
+            subvector( column( L, j, unchecked ), j+1UL, w-j-1UL, unchecked ) * ys[j];
+      }
+
+      if( r == 0UL ) continue;
+
+      tmp = submatrix( L, w, 0UL, r, w, unchecked ) * ys;
+
+      for( size_t a=0UL; a<r; ++a ) {
+         y[rowIdx[a]] -= tmp[a];
+      }
+   }
+
+   // Backward substitution with L^H
+   for( size_t s=ns; s-->0UL; )
+   {
+      const size_t f( sym.first(s) );
+      const size_t w( sym.columns(s) );
+      const size_t m( sym.rows(s) );
+      const size_t r( m - w );
+      const size_t* rowIdx( sym.structure(s) + w );
+
+      const CustomMatrix<const Type,unaligned,unpadded,columnMajor> L( values_.data()+offset_[s], m, w );
+      CustomVector<Type,unaligned,unpadded> ys( y+f, w );
+
+      if( r > 0UL ) {
+         tmp.resize( r, false );
+         for( size_t a=0UL; a<r; ++a ) {
+            tmp[a] = y[rowIdx[a]];
+         }
+         ys -= ctrans( submatrix( L, w, 0UL, r, w, unchecked ) ) * tmp;
+      }
+
+      for( size_t j=w; j-->0UL; ) {
+         ys[j] -= ctrans( subvector( column( L, j, unchecked ), j+1UL, w-j-1UL, unchecked ) ) *
+                  subvector( ys, j+1UL, w-j-1UL, unchecked );
+         ys[j] /= L(j,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the decomposed matrix.
+//
+// \return The number of rows of the decomposed matrix.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t SparseLLH<Type>::rows() const noexcept
+{
+   return symbolic_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the decomposed matrix.
+//
+// \return The number of columns of the decomposed matrix.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t SparseLLH<Type>::columns() const noexcept
+{
+   return symbolic_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the Cholesky factor.
+//
+// \return The number of non-zero elements of the lower triangular factor \a L.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t SparseLLH<Type>::nonZeros() const noexcept
+{
+   return symbolic_.nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the symbolic analysis of the decomposed matrix.
+//
+// \return Reference to the symbolic analysis.
+*/
+template< typename Type >  // Data type of the elements
+inline const SparseSymbolic& SparseLLH<Type>::symbolic() const noexcept
+{
+   return symbolic_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
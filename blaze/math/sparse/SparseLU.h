@@ -0,0 +1,774 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SparseLU.h
+//  \brief Header file for the supernodal sparse LU decomposition
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPARSELU_H_
+#define _BLAZE_MATH_SPARSE_SPARSELU_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/blas/Types.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/BlockedDecomposition.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/SparseSymbolic.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Supernodal sparse LU decomposition.
+// \ingroup sparse_matrix
+//
+// The SparseLU class template represents the LU decomposition of a general square sparse matrix
+// \a A. Analogous to the SparseLLH class template the decomposition is split into a symbolic and
+// a numeric phase:
+//
+//  - analyze(): The symbolic phase computes an approximate minimum degree ordering and the
+//    supernodal structure based on the sparsity pattern of \f$ A + A^T \f$ (see the
+//    SparseSymbolic class). It depends on the sparsity pattern of \a A only.
+//  - factorize(): The numeric phase computes the values of the factors \a L and \a U. Each
+//    supernode is stored as a dense column-major panel of \a L (including the diagonal block)
+//    and a dense block row of \a U. The diagonal blocks are factorized by the native blocked
+//    dense LU decomposition and the contribution to the ancestor supernodes is computed via
+//    dense matrix/dense matrix multiplications. The numeric phase can be repeated for an
+//    arbitrary number of matrices with the sparsity pattern that has been analyzed.
+//
+// In order to preserve the precomputed sparsity pattern, partial pivoting is restricted to the
+// rows of the diagonal block of each supernode (static pivoting). The decomposition is therefore
+// best suited for matrices whose diagonal elements are suitable pivots, as for instance matrices
+// arising from the discretization of partial differential equations. In case an exactly zero
+// pivot is encountered, a \a std::runtime_error exception is thrown.
+
+   \code
+   blaze::CompressedMatrix<double> A( 10000UL, 10000UL );
+   blaze::DynamicVector<double> x, b( 10000UL );
+   // ... Initialization of A and b
+
+   blaze::SparseLU<double> lu( A );  // Symbolic analysis and numeric factorization
+   lu.solve( x, b );                 // Solving the LSE A*x=b
+   \endcode
+
+// The SparseLU class template can only be used with \c float, \c double, \c complex<float>, and
+// \c complex<double> element type. The attempt to instantiate the class template with any other
+// element type results in a compile time error!
+*/
+template< typename Type >  // Data type of the elements
+class SparseLU
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SparseLU();
+
+   template< typename MT, bool SO >
+   explicit inline SparseLU( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO > void analyze  ( const SparseMatrix<MT,SO>& A );
+   template< typename MT, bool SO > void factorize( const SparseMatrix<MT,SO>& A );
+   template< typename MT, bool SO > void compute  ( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   void solve( DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& b ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void solve( DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& B ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t                rows    () const noexcept;
+   inline size_t                columns () const noexcept;
+   inline size_t                nonZeros() const noexcept;
+   inline const SparseSymbolic& symbolic() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void substitute( Type* y ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Panel = CustomMatrix<Type,unaligned,unpadded,columnMajor>;  //!< Type of a supernode panel.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SparseSymbolic          symbolic_;    //!< The symbolic analysis of the system matrix.
+   std::vector<size_t>     lower_;       //!< The offset of the L panel of each supernode.
+   std::vector<size_t>     upper_;       //!< The offset of the U block row of each supernode.
+   std::vector<Type>       lvalues_;     //!< The values of the L panels of all supernodes.
+   std::vector<Type>       uvalues_;     //!< The values of the U block rows of all supernodes.
+   std::vector<blas_int_t> ipiv_;        //!< The (local, 1-based) pivot indices of all columns.
+   bool                    factorized_;  //!< Flag for a valid numeric factorization.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SparseLU.
+*/
+template< typename Type >  // Data type of the elements
+inline SparseLU<Type>::SparseLU()
+   : symbolic_  ()         // The symbolic analysis of the system matrix
+   , lower_     ( 1UL )    // The offset of the L panel of each supernode
+   , upper_     ( 1UL )    // The offset of the U block row of each supernode
+   , lvalues_   ()         // The values of the L panels of all supernodes
+   , uvalues_   ()         // The values of the U block rows of all supernodes
+   , ipiv_      ()         // The pivot indices of all columns
+   , factorized_( false )  // Flag for a valid numeric factorization
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the LU decomposition of the given sparse matrix.
+//
+// \param A The square system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+inline SparseLU<Type>::SparseLU( const SparseMatrix<MT,SO>& A )
+   : SparseLU()
+{
+   compute( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the given sparse matrix.
+//
+// \param A The square system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function performs the symbolic phase of the LU decomposition based on the sparsity
+// pattern of \f$ A + A^T \f$. Any previous numeric factorization is discarded.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+void SparseLU<Type>::analyze( const SparseMatrix<MT,SO>& A )
+{
+   SparseSymbolic symbolic( *A, false );
+
+   std::vector<size_t> lower( 1UL, 0UL ), upper( 1UL, 0UL );
+   lower.reserve( symbolic.supernodes() + 1UL );
+   upper.reserve( symbolic.supernodes() + 1UL );
+
+   for( size_t s=0UL; s<symbolic.supernodes(); ++s ) {
+      const size_t w( symbolic.columns(s) );
+      const size_t m( symbolic.rows(s) );
+      lower.push_back( lower.back() + m*w );
+      upper.push_back( upper.back() + ( m-w )*w );
+   }
+
+   symbolic_ = std::move( symbolic );
+   lower_    = std::move( lower );
+   upper_    = std::move( upper );
+   lvalues_.clear();
+   uvalues_.clear();
+   ipiv_.clear();
+   factorized_ = false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric factorization of the given sparse matrix.
+//
+// \param A The square system matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Sparsity pattern does not match the symbolic analysis.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+//
+// This function computes the numeric LU decomposition of the given matrix based on the previous
+// symbolic analysis (see analyze()). The sparsity pattern of \a A must be contained in the
+// analyzed pattern.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+void SparseLU<Type>::factorize( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<MT> );
+
+   using std::swap;
+
+   const SparseSymbolic& sym( symbolic_ );
+   const size_t n ( sym.size() );
+   const size_t ns( sym.supernodes() );
+
+   if( (*A).rows() != n || (*A).columns() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   factorized_ = false;
+   lvalues_.assign( lower_.back(), Type() );
+   uvalues_.assign( upper_.back(), Type() );
+   ipiv_.resize( n );
+
+   // Assembly of the reordered matrix
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=(*A).begin(i); element!=(*A).end(i); ++element )
+      {
+         const size_t pi( sym.inverse()[SO ? element->index() : i] );
+         const size_t pj( sym.inverse()[SO ? i : element->index()] );
+         const size_t s ( sym.supernode( pi < pj ? pi : pj ) );
+         const size_t f ( sym.first(s) );
+         const size_t w ( sym.columns(s) );
+         const size_t m ( sym.rows(s) );
+
+         if( pi >= pj || pj < f+w ) {
+            const size_t k( pi >= pj ? sym.find( s, pi ) : pi-f );
+            if( k == m ) {
+               BLAZE_THROW_INVALID_ARGUMENT( "Sparsity pattern does not match the symbolic analysis" );
+            }
+            lvalues_[lower_[s] + ( pj-f )*m + k] = element->value();
+         }
+         else {
+            const size_t k( sym.find( s, pj ) );
+            if( k == m ) {
+               BLAZE_THROW_INVALID_ARGUMENT( "Sparsity pattern does not match the symbolic analysis" );
+            }
+            uvalues_[upper_[s] + ( k-w )*w + ( pi-f )] = element->value();
+         }
+      }
+   }
+
+   // Right-looking supernodal factorization
+   std::vector<size_t> map( n );
+   DynamicMatrix<Type,columnMajor> update;
+
+   for( size_t s=0UL; s<ns; ++s )
+   {
+      const size_t f( sym.first(s) );
+      const size_t w( sym.columns(s) );
+      const size_t m( sym.rows(s) );
+      const size_t r( m - w );
+      const size_t* rowIdx( sym.structure(s) + w );
+
+      Panel D( lvalues_.data()+lower_[s], w, w, m );
+      blockedGetrf( D, ipiv_.data()+f );
+
+      for( size_t j=0UL; j<w; ++j ) {
+         if( isDefault( D(j,j) ) ) {
+            BLAZE_THROW_DIVISION_BY_ZERO( "Decomposition of singular matrix failed" );
+         }
+      }
+
+      if( r == 0UL ) continue;
+
+      Panel L( lvalues_.data()+lower_[s], m, w );
+      Panel U( uvalues_.data()+upper_[s], w, r );
+      auto L21( submatrix( L, w, 0UL, r, w, unchecked ) );
+
+      // Computation of the block row of U
+      for( size_t j=0UL; j<w; ++j ) {
+         const size_t p( ipiv_[f+j] - 1 );
+         if( p != j ) {
+            for( size_t l=0UL; l<r; ++l ) {
+               swap( U(j,l), U(p,l) );
+            }
+         }
+      }
+
+      for( size_t i=0UL; i+1UL<w; ++i ) {
+         submatrix( U, i+1UL, 0UL, w-i-1UL, r, unchecked ) -=
+            subvector( column( D, i, unchecked ), i+1UL, w-i-1UL, unchecked ) * row( U, i, unchecked );
+      }
+
+      // Computation of the block column of L
+      for( size_t j=0UL; j<w; ++j ) {
+         auto lj( column( L21, j, unchecked ) );
+         lj *= Type(1) / D(j,j);
+         for( size_t l=j+1UL; l<w; ++l ) {
+            column( L21, l, unchecked ) -= lj * D(j,l);
+         }
+      }
+
+      // Update of the ancestor supernodes
+      for( size_t c0=0UL; c0<r; )
+      {
+         const size_t t ( sym.supernode( rowIdx[c0] ) );
+         const size_t ft( sym.first(t) );
+         const size_t wt( sym.columns(t) );
+         const size_t mt( sym.rows(t) );
+         const size_t* rowIdxT( sym.structure(t) );
+
+         size_t c1( c0+1UL );
+         while( c1 < r && rowIdx[c1] < ft+wt ) ++c1;
+
+         for( size_t k=0UL; k<mt; ++k ) {
+            map[rowIdxT[k]] = k;
+         }
+
+         update = submatrix( L21, c0, 0UL, r-c0, w, unchecked ) *
+                  submatrix( U, 0UL, c0, w, c1-c0, unchecked );
+
+         for( size_t b=0UL; b<c1-c0; ++b ) {
+            Type* target( lvalues_.data() + lower_[t] + ( rowIdx[c0+b] - ft )*mt );
+            for( size_t a=0UL; a<r-c0; ++a ) {
+               target[map[rowIdx[c0+a]]] -= update(a,b);
+            }
+         }
+
+         if( c1 < r )
+         {
+            update = submatrix( L21, c0, 0UL, c1-c0, w, unchecked ) *
+                     submatrix( U, 0UL, c1, w, r-c1, unchecked );
+
+            for( size_t b=0UL; b<r-c1; ++b ) {
+               Type* target( uvalues_.data() + upper_[t] + ( map[rowIdx[c1+b]] - wt )*wt );
+               for( size_t a=0UL; a<c1-c0; ++a ) {
+                  target[rowIdx[c0+a] - ft] -= update(a,b);
+               }
+            }
+         }
+
+         c0 = c1;
+      }
+   }
+
+   factorized_ = true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis and numeric factorization of the given sparse matrix.
+//
+// \param A The square system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+void SparseLU<Type>::compute( const SparseMatrix<MT,SO>& A )
+{
+   analyze( A );
+   factorize( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the linear system \f$ A x = b \f$ by means of the LU decomposition.
+//
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::logic_error Missing numeric factorization.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// The solution vector \a x is resized to the size of the system, if necessary.
+*/
+template< typename Type >  // Data type of the elements
+template< typename VT1     // Type of the solution vector
+        , bool TF1         // Transpose flag of the solution vector
+        , typename VT2     // Type of the right-hand side vector
+        , bool TF2 >       // Transpose flag of the right-hand side vector
+void SparseLU<Type>::solve( DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& b ) const
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<VT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<VT2> );
+
+   if( !factorized_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "Missing numeric factorization" );
+   }
+
+   const size_t n( symbolic_.size() );
+   const std::vector<size_t>& perm( symbolic_.permutation() );
+
+   if( (*b).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   DynamicVector<Type> y( n );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      y[k] = (*b)[perm[k]];
+   }
+
+   substitute( y.data() );
+
+   resize( *x, n, false );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      (*x)[perm[k]] = y[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the linear systems \f$ A X = B \f$ by means of the LU decomposition.
+//
+// \param X The resulting solution matrix.
+// \param B The matrix of right-hand sides.
+// \return void
+// \exception std::logic_error Missing numeric factorization.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+//
+// The solution matrix \a X is resized to the size of \a B, if necessary.
+*/
+template< typename Type >  // Data type of the elements
+template< typename MT1     // Type of the solution matrix
+        , bool SO1         // Storage order of the solution matrix
+        , typename MT2     // Type of the right-hand side matrix
+        , bool SO2 >       // Storage order of the right-hand side matrix
+void SparseLU<Type>::solve( DenseMatrix<MT1,SO1>& X, const DenseMatrix<MT2,SO2>& B ) const
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<MT1> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( Type, ElementType_t<MT2> );
+
+   if( !factorized_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "Missing numeric factorization" );
+   }
+
+   const size_t n( symbolic_.size() );
+   const std::vector<size_t>& perm( symbolic_.permutation() );
+
+   if( (*B).rows() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   resize( *X, n, (*B).columns(), false );
+
+   DynamicVector<Type> y( n );
+
+   for( size_t j=0UL; j<(*B).columns(); ++j )
+   {
+      for( size_t k=0UL; k<n; ++k ) {
+         y[k] = (*B)(perm[k],j);
+      }
+
+      substitute( y.data() );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         (*X)(perm[k],j) = y[k];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward and backward substitution with the supernodal LU factors.
+//
+// \param y The reordered right-hand side, which is overwritten with the reordered solution.
+// \return void
+*/
+template< typename Type >  // Data type of the elements
+void SparseLU<Type>::substitute( Type* y ) const
+{
+   using std::swap;
+
+   using ConstPanel = CustomMatrix<const Type,unaligned,unpadded,columnMajor>;
+
+   const SparseSymbolic& sym( symbolic_ );
+   const size_t ns( sym.supernodes() );
+
+   DynamicVector<Type> tmp;
+
+   // Forward substitution with the row interchanges and the unit lower triangular L
+   for( size_t s=0UL; s<ns; ++s )
+   {
+      const size_t f( sym.first(s) );
+      const size_t w( sym.columns(s) );
+      const size_t m( sym.rows(s) );
+      const size_t r( m - w );
+      const size_t* rowIdx( sym.structure(s) + w );
+
+      const ConstPanel L( lvalues_.data()+lower_[s], m, w );
+      CustomVector<Type,unaligned,unpadded> ys( y+f, w );
+
+      for( size_t j=0UL; j<w; ++j ) {
+         const size_t p( ipiv_[f+j] - 1 );
+         if( p != j ) swap( ys[j], ys[p] );
+      }
+
+      for( size_t j=0UL; j+1UL<w; ++j ) {
+         subvector( ys, j+1UL, w-j-1UL, unchecked ) -=
+            subvector( column( L, j, unchecked ), j+1UL, w-j-1UL, unchecked ) * ys[j];
+      }
+
+      if( r == 0UL ) continue;
+
+      tmp = submatrix( L, w, 0UL, r, w, unchecked ) * ys;
+
+      for( size_t a=0UL; a<r; ++a ) {
+         y[rowIdx[a]] -= tmp[a];
+      }
+   }
+
+   // Backward substitution with the upper triangular U
+   for( size_t s=ns; s-->0UL; )
+   {
+      const size_t f( sym.first(s) );
+      const size_t w( sym.columns(s) );
+      const size_t m( sym.rows(s) );
+      const size_t r( m - w );
+      const size_t* rowIdx( sym.structure(s) + w );
+
+      const ConstPanel L( lvalues_.data()+lower_[s], m, w );
+      CustomVector<Type,unaligned,unpadded> ys( y+f, w );
+
+      if( r > 0UL ) {
+         const ConstPanel U( uvalues_.data()+upper_[s], w, r );
+         tmp.resize( r, false );
+         for( size_t a=0UL; a<r; ++a ) {
+            tmp[a] = y[rowIdx[a]];
+         }
+         ys -= U * tmp;
+      }
+
+      for( size_t j=w; j-->0UL; ) {
+         ys[j] /= L(j,j);
+         subvector( ys, 0UL, j, unchecked ) -=
+            subvector( column( L, j, unchecked ), 0UL, j, unchecked ) * ys[j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the decomposed matrix.
+//
+// \return The number of rows of the decomposed matrix.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t SparseLU<Type>::rows() const noexcept
+{
+   return symbolic_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the decomposed matrix.
+//
+// \return The number of columns of the decomposed matrix.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t SparseLU<Type>::columns() const noexcept
+{
+   return symbolic_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the LU factors.
+//
+// \return The total number of non-zero elements of the factors \a L and \a U.
+//
+// The diagonal elements of the unit lower triangular factor \a L are not counted.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t SparseLU<Type>::nonZeros() const noexcept
+{
+   return 2UL*symbolic_.nonZeros() - symbolic_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the symbolic analysis of the decomposed matrix.
+//
+// \return Reference to the symbolic analysis.
+*/
+template< typename Type >  // Data type of the elements
+inline const SparseSymbolic& SparseLU<Type>::symbolic() const noexcept
+{
+   return symbolic_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solving the given sparse linear system of equations (\f$ A*x=b \f$).
+// \ingroup sparse_matrix
+//
+// \param A The sparse system matrix of the linear system of equations.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector of the linear system of equations.
+// \return void
+// \exception std::invalid_argument Invalid non-square system matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+//
+// This function computes the solution of the given sparse linear system by means of a supernodal
+// sparse LU decomposition (see the SparseLU class template) without converting the system matrix
+// into a dense matrix. In case the same system has to be solved for several right-hand sides or
+// several matrices with identical sparsity pattern have to be solved, the SparseLU and SparseLLH
+// class templates should be used directly in order to reuse the decomposition.
+
+   \code
+   blaze::CompressedMatrix<double> A( 10000UL, 10000UL );
+   blaze::DynamicVector<double> x, b( 10000UL );
+   // ... Initialization of A and b
+
+   solve( A, x, b );
+   \endcode
+
+// \note This function only works for matrices with \c float, \c double, \c complex<float>, or
+// \c complex<double> element type. The attempt to call the function with matrices of any other
+// element type results in a compile time error!
+*/
+template< typename MT    // Type of the system matrix
+        , bool SO        // Storage order of the system matrix
+        , typename VT1   // Type of the solution vector
+        , bool TF1       // Transpose flag of the solution vector
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2 >     // Transpose flag of the right-hand side vector
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,TF1>& x, const DenseVector<VT2,TF2>& b )
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square system matrix provided" );
+   }
+   else if( (*A).rows() != (*b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   const SparseLU< ElementType_t<MT> > lu( *A );
+   lu.solve( *x, *b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,787 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SparseSymbolic.h
+//  \brief Header file for the symbolic analysis of the supernodal sparse direct solvers
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPARSESYMBOLIC_H_
+#define _BLAZE_MATH_SPARSE_SPARSESYMBOLIC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ORDERING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a fill-reducing ordering of the given symmetric graph.
+// \ingroup sparse_matrix
+//
+// \param adj The adjacency lists of the symmetric graph (without self-loops).
+// \return The elimination order (the \a k-th entry is the \a k-th eliminated node).
+//
+// This function computes an approximate minimum degree (AMD) ordering of the given graph. The
+// elimination is performed on the quotient graph, i.e. eliminated nodes are represented by
+// elements instead of explicitly forming the fill-in. The external degree of each node adjacent
+// to the current pivot is approximated by the sum of the sizes of its adjacent variables and
+// elements (excluding the parts already covered by the pivot element). Elements that are fully
+// covered by the new pivot element are absorbed. Supervariable detection is not performed.
+*/
+inline std::vector<size_t> amdOrdering( std::vector< std::vector<size_t> > adj )
+{
+   constexpr size_t none( static_cast<size_t>( -1 ) );
+
+   const size_t n( adj.size() );
+
+   std::vector< std::vector<size_t> > elements( n );  // Adjacent elements of each variable
+   std::vector< std::vector<size_t> > lists( n );     // Variables of each element
+   std::vector<size_t> degree( n ), head( n, none ), next( n, none ), prev( n, none );
+   std::vector<size_t> mark( n, 0UL );
+   std::vector<size_t> weight( n, none );
+   std::vector<bool> eliminated( n, false ), absorbed( n, false );
+   std::vector<size_t> order, touched;
+
+   order.reserve( n );
+
+   const auto insert = [&]( size_t i ) {
+      const size_t d( degree[i] );
+      prev[i] = none;
+      next[i] = head[d];
+      if( head[d] != none ) prev[head[d]] = i;
+      head[d] = i;
+   };
+
+   const auto remove = [&]( size_t i ) {
+      if( prev[i] != none ) next[prev[i]] = next[i];
+      else head[degree[i]] = next[i];
+      if( next[i] != none ) prev[next[i]] = prev[i];
+   };
+
+   for( size_t i=0UL; i<n; ++i ) {
+      degree[i] = adj[i].size();
+      insert( i );
+   }
+
+   size_t mindeg( 0UL );
+   size_t stamp ( 0UL );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      // Selection of the pivot with minimum approximate degree
+      while( head[mindeg] == none ) ++mindeg;
+
+      const size_t p( head[mindeg] );
+      remove( p );
+      order.push_back( p );
+
+      // Construction of the new element as union of the adjacent variables and elements
+      ++stamp;
+      mark[p] = stamp;
+      eliminated[p] = true;
+
+      std::vector<size_t> lp;
+
+      for( size_t e : elements[p] ) {
+         if( absorbed[e] ) continue;
+         for( size_t i : lists[e] ) {
+            if( !eliminated[i] && mark[i] != stamp ) {
+               mark[i] = stamp;
+               lp.push_back( i );
+            }
+         }
+         absorbed[e] = true;
+         std::vector<size_t>().swap( lists[e] );
+      }
+
+      for( size_t i : adj[p] ) {
+         if( !eliminated[i] && mark[i] != stamp ) {
+            mark[i] = stamp;
+            lp.push_back( i );
+         }
+      }
+
+      std::vector<size_t>().swap( adj[p] );
+      std::vector<size_t>().swap( elements[p] );
+
+      // Pruning of the quotient graph and computation of the element weights
+      touched.clear();
+
+      for( size_t i : lp )
+      {
+         remove( i );
+
+         auto& ai( adj[i] );
+         ai.erase( std::remove_if( ai.begin(), ai.end(), [&]( size_t j ) {
+            return eliminated[j] || mark[j] == stamp;
+         } ), ai.end() );
+
+         auto& ei( elements[i] );
+         ei.erase( std::remove_if( ei.begin(), ei.end(), [&]( size_t e ) {
+            return absorbed[e];
+         } ), ei.end() );
+
+         for( size_t e : ei ) {
+            if( weight[e] == none ) {
+               weight[e] = lists[e].size();
+               touched.push_back( e );
+            }
+            --weight[e];
+         }
+
+         ei.push_back( p );
+      }
+
+      // Absorption of the elements covered by the new element
+      for( size_t e : touched ) {
+         if( weight[e] == 0UL ) {
+            absorbed[e] = true;
+            std::vector<size_t>().swap( lists[e] );
+         }
+      }
+
+      // Update of the approximate degrees
+      const size_t remaining( n - k - 1UL );
+
+      for( size_t i : lp )
+      {
+         size_t d( adj[i].size() + lp.size() - 1UL );
+
+         for( size_t e : elements[i] ) {
+            if( e != p && !absorbed[e] ) d += weight[e];
+         }
+
+         d = std::min( { d, degree[i] + lp.size() - 1UL, remaining - 1UL } );
+         degree[i] = d;
+         insert( i );
+         mindeg = std::min( mindeg, d );
+      }
+
+      for( size_t e : touched ) {
+         weight[e] = none;
+      }
+
+      lists[p] = std::move( lp );
+   }
+
+   return order;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of a sparse system matrix for the supernodal sparse direct solvers.
+// \ingroup sparse_matrix
+//
+// The SparseSymbolic class performs the symbolic phase of the sparse direct solvers (see the
+// SparseLLH and SparseLU class templates): Based on the sparsity pattern of a square system
+// matrix it computes a fill-reducing approximate minimum degree ordering, the elimination tree
+// of the reordered matrix, a postordering of the elimination tree, the number of non-zero
+// elements per column of the factor, the fundamental supernodes (i.e. groups of consecutive
+// columns with identical sparsity pattern), and the row structure of each supernode. The
+// analysis depends on the sparsity pattern only and can therefore be reused for an arbitrary
+// number of numeric factorizations of matrices with identical pattern.
+//
+// All indices of the supernodal structure refer to the reordered matrix. The \a k-th row and
+// column of the reordered matrix correspond to the row and column permutation()[k] of the
+// original matrix.
+*/
+class SparseSymbolic
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SparseSymbolic() noexcept;
+
+   template< typename MT, bool SO >
+   explicit inline SparseSymbolic( const SparseMatrix<MT,SO>& A, bool lower );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size      () const noexcept;
+   inline size_t supernodes() const noexcept;
+   inline size_t nonZeros  () const noexcept;
+
+   inline const std::vector<size_t>& permutation() const noexcept;
+   inline const std::vector<size_t>& inverse    () const noexcept;
+
+   inline size_t supernode( size_t j ) const noexcept;
+   inline size_t first    ( size_t s ) const noexcept;
+   inline size_t columns  ( size_t s ) const noexcept;
+   inline size_t rows     ( size_t s ) const noexcept;
+
+   inline const size_t* structure( size_t s ) const noexcept;
+   inline size_t        find     ( size_t s, size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   using Graph = std::vector< std::vector<size_t> >;  //!< Type of the adjacency lists.
+
+   inline Graph permute( const Graph& adj, const std::vector<size_t>& inv ) const;
+   inline std::vector<size_t> etree( const Graph& adj ) const;
+   inline std::vector<size_t> postorder( const std::vector<size_t>& parent ) const;
+   inline void analyze( const Graph& adj );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                    //!< The number of rows and columns of the system matrix.
+   std::vector<size_t> perm_;    //!< The fill-reducing permutation (new to original index).
+   std::vector<size_t> pinv_;    //!< The inverse permutation (original to new index).
+   std::vector<size_t> super_;   //!< The supernode of each column.
+   std::vector<size_t> first_;   //!< The first column of each supernode.
+   std::vector<size_t> rowPtr_;  //!< The offset of the row structure of each supernode.
+   std::vector<size_t> rowIdx_;  //!< The (sorted) row structures of all supernodes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SparseSymbolic.
+*/
+inline SparseSymbolic::SparseSymbolic() noexcept
+   : n_     ( 0UL )  // The number of rows and columns of the system matrix
+   , perm_  ()       // The fill-reducing permutation
+   , pinv_  ()       // The inverse permutation
+   , super_ ()       // The supernode of each column
+   , first_ ( 1UL )  // The first column of each supernode
+   , rowPtr_( 1UL )  // The offset of the row structure of each supernode
+   , rowIdx_()       // The row structures of all supernodes
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the given sparse system matrix.
+//
+// \param A The square system matrix to be analyzed.
+// \param lower \a true to consider the lower part of \a A only, \a false for the complete matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// In case \a lower is \a true, only the strictly lower part of the given matrix is considered and
+// the pattern is assumed to be symmetric (as for instance in case of a Cholesky decomposition).
+// Otherwise the analysis is based on the pattern of \f$ A + A^T \f$.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline SparseSymbolic::SparseSymbolic( const SparseMatrix<MT,SO>& A, bool lower )
+   : SparseSymbolic()
+{
+   if( !isSquare( *A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   n_ = (*A).rows();
+
+   Graph adj( n_ );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( auto element=(*A).begin(i); element!=(*A).end(i); ++element )
+      {
+         const size_t row( SO ? element->index() : i );
+         const size_t col( SO ? i : element->index() );
+
+         if( row == col || ( lower && row < col ) ) continue;
+
+         adj[row].push_back( col );
+         adj[col].push_back( row );
+      }
+   }
+
+   for( auto& list : adj ) {
+      std::sort( list.begin(), list.end() );
+      list.erase( std::unique( list.begin(), list.end() ), list.end() );
+   }
+
+   analyze( adj );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the analyzed system matrix.
+//
+// \return The number of rows and columns of the system matrix.
+*/
+inline size_t SparseSymbolic::size() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of supernodes.
+//
+// \return The number of supernodes.
+*/
+inline size_t SparseSymbolic::supernodes() const noexcept
+{
+   return first_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the lower triangular factor.
+//
+// \return The number of non-zero elements of the factor (including the diagonal elements).
+*/
+inline size_t SparseSymbolic::nonZeros() const noexcept
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t s=0UL; s<supernodes(); ++s ) {
+      const size_t w( columns(s) );
+      nonzeros += w * rows(s) - w*( w-1UL )/2UL;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the fill-reducing permutation.
+//
+// \return The fill-reducing permutation (the \a k-th entry is the original index of index \a k).
+*/
+inline const std::vector<size_t>& SparseSymbolic::permutation() const noexcept
+{
+   return perm_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the inverse of the fill-reducing permutation.
+//
+// \return The inverse permutation (the \a i-th entry is the new index of original index \a i).
+*/
+inline const std::vector<size_t>& SparseSymbolic::inverse() const noexcept
+{
+   return pinv_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the supernode containing the given column.
+//
+// \param j The index of the column of the reordered matrix.
+// \return The index of the supernode containing column \a j.
+*/
+inline size_t SparseSymbolic::supernode( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   return super_[j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the first column of the given supernode.
+//
+// \param s The index of the supernode.
+// \return The index of the first column of the supernode.
+*/
+inline size_t SparseSymbolic::first( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < supernodes(), "Invalid supernode access index" );
+
+   return first_[s];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the given supernode.
+//
+// \param s The index of the supernode.
+// \return The number of columns of the supernode.
+*/
+inline size_t SparseSymbolic::columns( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < supernodes(), "Invalid supernode access index" );
+
+   return first_[s+1UL] - first_[s];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the given supernode.
+//
+// \param s The index of the supernode.
+// \return The number of rows of the supernode (including the rows of the diagonal block).
+*/
+inline size_t SparseSymbolic::rows( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < supernodes(), "Invalid supernode access index" );
+
+   return rowPtr_[s+1UL] - rowPtr_[s];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the row structure of the given supernode.
+//
+// \param s The index of the supernode.
+// \return Pointer to the sorted row indices of the supernode.
+//
+// The first columns(s) row indices correspond to the columns of the supernode (i.e. to the rows
+// of the diagonal block), the remaining rows(s)-columns(s) indices to the rows below the diagonal
+// block.
+*/
+inline const size_t* SparseSymbolic::structure( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < supernodes(), "Invalid supernode access index" );
+
+   return rowIdx_.data() + rowPtr_[s];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches the given row in the row structure of the given supernode.
+//
+// \param s The index of the supernode.
+// \param i The index of the row of the reordered matrix.
+// \return The local index of row \a i within the supernode, rows(s) in case \a i is not contained.
+*/
+inline size_t SparseSymbolic::find( size_t s, size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < supernodes(), "Invalid supernode access index" );
+
+   const size_t* begin( structure(s) );
+   const size_t* end  ( begin + rows(s) );
+   const size_t* pos  ( std::lower_bound( begin, end, i ) );
+
+   return ( pos != end && *pos == i ) ? static_cast<size_t>( pos - begin ) : rows(s);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given inverse permutation to the given graph.
+//
+// \param adj The adjacency lists of the graph.
+// \param inv The inverse permutation (original to new index).
+// \return The adjacency lists of the permuted graph.
+*/
+inline SparseSymbolic::Graph
+   SparseSymbolic::permute( const Graph& adj, const std::vector<size_t>& inv ) const
+{
+   Graph result( adj.size() );
+
+   for( size_t i=0UL; i<adj.size(); ++i ) {
+      auto& list( result[inv[i]] );
+      list.reserve( adj[i].size() );
+      for( size_t j : adj[i] ) {
+         list.push_back( inv[j] );
+      }
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the elimination tree of the given symmetric graph.
+//
+// \param adj The adjacency lists of the symmetric graph.
+// \return The parent of each node (-1 for the roots).
+//
+// This function computes the elimination tree via Liu's algorithm with path compression.
+*/
+inline std::vector<size_t> SparseSymbolic::etree( const Graph& adj ) const
+{
+   constexpr size_t none( static_cast<size_t>( -1 ) );
+
+   std::vector<size_t> parent( n_, none ), ancestor( n_, none );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      for( size_t j : adj[k] )
+      {
+         if( j >= k ) continue;
+
+         size_t r( j );
+
+         while( ancestor[r] != none && ancestor[r] != k ) {
+            const size_t next( ancestor[r] );
+            ancestor[r] = k;
+            r = next;
+         }
+
+         if( ancestor[r] == none ) {
+            ancestor[r] = k;
+            parent[r] = k;
+         }
+      }
+   }
+
+   return parent;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a postordering of the given elimination tree.
+//
+// \param parent The parent of each node (-1 for the roots).
+// \return The postordering (the \a k-th entry is the \a k-th node in postorder).
+*/
+inline std::vector<size_t> SparseSymbolic::postorder( const std::vector<size_t>& parent ) const
+{
+   constexpr size_t none( static_cast<size_t>( -1 ) );
+
+   std::vector<size_t> head( n_, none ), next( n_, none ), stack, post;
+
+   post.reserve( n_ );
+
+   for( size_t j=n_; j-->0UL; ) {
+      if( parent[j] != none ) {
+         next[j] = head[parent[j]];
+         head[parent[j]] = j;
+      }
+   }
+
+   for( size_t root=0UL; root<n_; ++root )
+   {
+      if( parent[root] != none ) continue;
+
+      stack.push_back( root );
+
+      while( !stack.empty() )
+      {
+         const size_t j( stack.back() );
+         const size_t child( head[j] );
+
+         if( child == none ) {
+            stack.pop_back();
+            post.push_back( j );
+         }
+         else {
+            head[j] = next[child];
+            stack.push_back( child );
+         }
+      }
+   }
+
+   return post;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Performs the symbolic analysis of the given symmetric graph.
+//
+// \param adj The adjacency lists of the symmetric graph (without self-loops).
+// \return void
+*/
+inline void SparseSymbolic::analyze( const Graph& adj )
+{
+   constexpr size_t none( static_cast<size_t>( -1 ) );
+
+   // Fill-reducing ordering, combined with a postordering of the elimination tree
+   const std::vector<size_t> order( amdOrdering( adj ) );
+
+   pinv_.resize( n_ );
+   for( size_t k=0UL; k<n_; ++k ) {
+      pinv_[order[k]] = k;
+   }
+
+   const std::vector<size_t> post( postorder( etree( permute( adj, pinv_ ) ) ) );
+
+   perm_.resize( n_ );
+   for( size_t k=0UL; k<n_; ++k ) {
+      perm_[k] = order[post[k]];
+      pinv_[perm_[k]] = k;
+   }
+
+   const Graph graph( permute( adj, pinv_ ) );
+   const std::vector<size_t> parent( etree( graph ) );
+
+   // Computation of the column counts via the row subtrees
+   std::vector<size_t> count( n_, 1UL ), mark( n_, none ), children( n_, 0UL );
+
+   for( size_t i=0UL; i<n_; ++i )
+   {
+      mark[i] = i;
+
+      for( size_t j : graph[i] ) {
+         for( size_t k=j; k<i && mark[k] != i; k=parent[k] ) {
+            ++count[k];
+            mark[k] = i;
+         }
+      }
+
+      if( parent[i] != none ) {
+         ++children[parent[i]];
+      }
+   }
+
+   // Detection of the fundamental supernodes
+   super_.resize( n_ );
+   first_.assign( 1UL, 0UL );
+
+   for( size_t j=0UL; j<n_; ++j )
+   {
+      if( j > 0UL && parent[j-1UL] == j && count[j-1UL] == count[j] + 1UL && children[j] == 1UL ) {
+         super_[j] = super_[j-1UL];
+      }
+      else {
+         if( j > 0UL ) first_.push_back( j );
+         super_[j] = first_.size() - 1UL;
+      }
+   }
+
+   if( n_ > 0UL ) first_.push_back( n_ );
+
+   // Computation of the row structures of the supernodes
+   const size_t ns( supernodes() );
+
+   std::vector<size_t> head( ns, none ), next( ns, none );
+
+   rowPtr_.assign( 1UL, 0UL );
+   rowIdx_.clear();
+   std::fill( mark.begin(), mark.end(), none );
+
+   for( size_t s=0UL; s<ns; ++s )
+   {
+      const size_t f( first_[s] );
+      const size_t l( first_[s+1UL] );
+      const size_t begin( rowIdx_.size() );
+
+      for( size_t j=f; j<l; ++j ) {
+         rowIdx_.push_back( j );
+         mark[j] = s;
+      }
+
+      for( size_t j=f; j<l; ++j ) {
+         for( size_t i : graph[j] ) {
+            if( i >= l && mark[i] != s ) {
+               mark[i] = s;
+               rowIdx_.push_back( i );
+            }
+         }
+      }
+
+      for( size_t c=head[s]; c!=none; c=next[c] ) {
+         for( size_t k=rowPtr_[c]+columns(c); k<rowPtr_[c+1UL]; ++k ) {
+            const size_t i( rowIdx_[k] );
+            if( i >= l && mark[i] != s ) {
+               mark[i] = s;
+               rowIdx_.push_back( i );
+            }
+         }
+      }
+
+      std::sort( rowIdx_.begin()+begin+( l-f ), rowIdx_.end() );
+      rowPtr_.push_back( rowIdx_.size() );
+
+      BLAZE_INTERNAL_ASSERT( rows(s) == count[f], "Invalid supernode structure detected" );
+
+      if( parent[l-1UL] != none ) {
+         const size_t p( super_[parent[l-1UL]] );
+         next[s] = head[p];
+         head[p] = s;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
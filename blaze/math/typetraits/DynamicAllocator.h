@@ -42,7 +42,9 @@
 
 #include <memory>
 #include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/ArenaAllocator.h>
 #include <blaze/util/NullAllocator.h>
+#include <blaze/util/NumaAllocator.h>
 
 
 namespace blaze {
@@ -149,6 +151,96 @@ struct DynamicAllocator< AlignedAllocator<T1>, AlignedAllocator<T2> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DynamicAllocator type trait for 'ArenaAllocator'.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct DynamicAllocator< ArenaAllocator<T> >
+{
+   template< typename U >
+   using Type = ArenaAllocator<U>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DynamicAllocator type trait for two 'ArenaAllocator'.
+// \ingroup math_type_traits
+*/
+template< typename T1, typename T2 >
+struct DynamicAllocator< ArenaAllocator<T1>, ArenaAllocator<T2> >
+{
+   template< typename U >
+   using Type = ArenaAllocator<U>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DynamicAllocator type trait for 'ArenaAllocator' and 'AlignedAllocator'.
+// \ingroup math_type_traits
+*/
+template< typename T1, typename T2 >
+struct DynamicAllocator< ArenaAllocator<T1>, AlignedAllocator<T2> >
+{
+   template< typename U >
+   using Type = ArenaAllocator<U>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DynamicAllocator type trait for 'AlignedAllocator' and 'ArenaAllocator'.
+// \ingroup math_type_traits
+*/
+template< typename T1, typename T2 >
+struct DynamicAllocator< AlignedAllocator<T1>, ArenaAllocator<T2> >
+{
+   template< typename U >
+   using Type = ArenaAllocator<U>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DynamicAllocator type trait for 'NumaAllocator'.
+// \ingroup math_type_traits
+*/
+template< typename T, PagePolicy PP, PlacementPolicy NP >
+struct DynamicAllocator< NumaAllocator<T,PP,NP> >
+{
+   template< typename U >
+   using Type = NumaAllocator<U,PP,NP>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the DynamicAllocator type trait for two 'NumaAllocator'.
+// \ingroup math_type_traits
+*/
+template< typename T1, typename T2, PagePolicy PP, PlacementPolicy NP >
+struct DynamicAllocator< NumaAllocator<T1,PP,NP>, NumaAllocator<T2,PP,NP> >
+{
+   template< typename U >
+   using Type = NumaAllocator<U,PP,NP>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Specialization of the DynamicAllocator type trait for any allocator and 'NullAllocator'.
@@ -65,7 +65,8 @@ using HasSIMDSinHelper =
    BoolConstant< ( IsFloat_v<T> || IsDouble_v<T> ) &&
                  ( bool( BLAZE_SVML_MODE    ) ||
                    bool( BLAZE_SLEEF_MODE )   ||
-                   bool( BLAZE_XSIMD_MODE ) ) &&
+                   bool( BLAZE_XSIMD_MODE ) ||
+                   bool( BLAZE_BUILTIN_SIMD_MATH_MODE ) ) &&
                  ( bool( BLAZE_SSE_MODE     ) ||
                    bool( BLAZE_AVX_MODE     ) ||
                    bool( BLAZE_MIC_MODE     ) ||
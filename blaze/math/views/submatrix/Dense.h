@@ -54,6 +54,7 @@
 #include <blaze/math/constraints/TransExpr.h>
 #include <blaze/math/constraints/UniTriangular.h>
 #include <blaze/math/dense/InitializerMatrix.h>
+#include <blaze/math/dense/SIMDTranspose.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/View.h>
@@ -2691,6 +2692,9 @@ inline void Submatrix<MT,unaligned,false,true,CSAs...>::assign( const DenseMatri
    BLAZE_INTERNAL_ASSERT( rows()    == (*rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (*rhs).columns(), "Invalid number of columns" );
 
+   if( simdTranspose( *this, *rhs ) )
+      return;
+
    constexpr size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<rows(); ii+=block ) {
@@ -5923,6 +5927,9 @@ inline void Submatrix<MT,unaligned,true,true,CSAs...>::assign( const DenseMatrix
    BLAZE_INTERNAL_ASSERT( rows()    == (*rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (*rhs).columns(), "Invalid number of columns" );
 
+   if( simdTranspose( *this, *rhs ) )
+      return;
+
    constexpr size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<columns(); jj+=block ) {
@@ -8781,6 +8788,9 @@ inline void Submatrix<MT,aligned,false,true,CSAs...>::assign( const DenseMatrix<
    BLAZE_INTERNAL_ASSERT( rows()    == (*rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (*rhs).columns(), "Invalid number of columns" );
 
+   if( simdTranspose( *this, *rhs ) )
+      return;
+
    constexpr size_t block( BLOCK_SIZE );
 
    for( size_t ii=0UL; ii<rows(); ii+=block ) {
@@ -11592,6 +11602,9 @@ inline void Submatrix<MT,aligned,true,true,CSAs...>::assign( const DenseMatrix<M
    BLAZE_INTERNAL_ASSERT( rows()    == (*rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( columns() == (*rhs).columns(), "Invalid number of columns" );
 
+   if( simdTranspose( *this, *rhs ) )
+      return;
+
    constexpr size_t block( BLOCK_SIZE );
 
    for( size_t jj=0UL; jj<columns(); jj+=block ) {
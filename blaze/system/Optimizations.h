@@ -53,10 +53,13 @@ namespace blaze {
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-constexpr bool usePadding               = BLAZE_USE_PADDING;
-constexpr bool useStreaming             = BLAZE_USE_STREAMING;
-constexpr bool useOptimizedKernels      = BLAZE_USE_OPTIMIZED_KERNELS;
-constexpr bool useDefaultInitialization = BLAZE_USE_DEFAULT_INITIALIZATION;
+constexpr bool usePadding                = BLAZE_USE_PADDING;
+constexpr bool useStreaming              = BLAZE_USE_STREAMING;
+constexpr bool useOptimizedKernels       = BLAZE_USE_OPTIMIZED_KERNELS;
+constexpr bool usePackedMMMKernels       = BLAZE_USE_PACKED_MMM_KERNELS;
+constexpr bool useSIMDTransposeKernels   = BLAZE_USE_SIMD_TRANSPOSE_KERNELS;
+constexpr bool useDefaultInitialization  = BLAZE_USE_DEFAULT_INITIALIZATION;
+constexpr bool useReproducibleReductions = BLAZE_USE_REPRODUCIBLE_REDUCTIONS;
 /*! \endcond */
 //*************************************************************************************************
 
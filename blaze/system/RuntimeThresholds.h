@@ -0,0 +1,638 @@
+//=================================================================================================
+/*!
+//  \file blaze/system/RuntimeThresholds.h
+//  \brief Header file for the runtime configuration of the SMP thresholds
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_SYSTEM_RUNTIMETHRESHOLDS_H_
+#define _BLAZE_SYSTEM_RUNTIMETHRESHOLDS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SMPTHRESHOLDTABLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Table of all SMP thresholds in the runtime threshold mode.
+// \ingroup system
+//
+// The SMPThresholdTable class template holds the current values of all SMP thresholds in case
+// the \c BLAZE_USE_RUNTIME_SMP_THRESHOLDS compilation switch is set to 1. The table is
+// initialized with the compile time defaults and, in case the \c BLAZE_SMP_THRESHOLDS
+// environment variable specifies a tuning file, with the thresholds given in this file. The
+// template parameter only serves the purpose to define the static data members in a header
+// file.\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only.
+*/
+template< typename T = void >
+struct SMPThresholdTable
+{
+   //**********************************************************************************************
+   static constexpr size_t size = 52UL;  //!< The total number of SMP thresholds.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static size_t values[size];            //!< The current values of the SMP thresholds.
+   static const size_t defaults[size];    //!< The compile time defaults of the SMP thresholds.
+   static const char* const names[size];  //!< The names of the SMP thresholds.
+   static const bool initialized;         //!< Initialization flag of the table.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static inline bool init();
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+const size_t SMPThresholdTable<T>::defaults[SMPThresholdTable<T>::size] = {
+   ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD : BLAZE_SMP_DVECASSIGN_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECSCALARMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECADD_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECSUB_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECDIV_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DVECDVECOUTER_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECOUTER_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATDVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATDVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATSVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATDVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATDVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATSVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATSVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD : BLAZE_SMP_DMATASSIGN_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSCALARMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD : BLAZE_SMP_DMATDMATADD_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATADD_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD : BLAZE_SMP_DMATDMATSUB_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSUB_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATDMATSCHUR_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATTSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATTDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATTSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DMATREDUCE_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_SMATREDUCE_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DVECREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DVECREDUCE_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATFULLREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DMATFULLREDUCE_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_BATCH_DEBUG_THRESHOLD : BLAZE_SMP_BATCH_THRESHOLD )
+};
+
+template< typename T >
+size_t SMPThresholdTable<T>::values[SMPThresholdTable<T>::size] = {
+   ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD : BLAZE_SMP_DVECASSIGN_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECSCALARMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECADD_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECSUB_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECDIV_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DVECDVECOUTER_DEBUG_THRESHOLD : BLAZE_SMP_DVECDVECOUTER_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATDVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATDVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATSVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATDVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATDVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATSVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATSVECMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD : BLAZE_SMP_DMATASSIGN_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSCALARMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD : BLAZE_SMP_DMATDMATADD_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATADD_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD : BLAZE_SMP_DMATDMATSUB_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSUB_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATDMATSCHUR_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATTSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATTDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTDMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_SMATTSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DMATREDUCE_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_SMATREDUCE_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DVECREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DVECREDUCE_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_DMATFULLREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DMATFULLREDUCE_THRESHOLD ),
+   ( BLAZE_DEBUG_MODE ? SMP_BATCH_DEBUG_THRESHOLD : BLAZE_SMP_BATCH_THRESHOLD )
+};
+
+template< typename T >
+const char* const SMPThresholdTable<T>::names[SMPThresholdTable<T>::size] = {
+   "BLAZE_SMP_DVECASSIGN_THRESHOLD",
+   "BLAZE_SMP_DVECSCALARMULT_THRESHOLD",
+   "BLAZE_SMP_DVECDVECADD_THRESHOLD",
+   "BLAZE_SMP_DVECDVECSUB_THRESHOLD",
+   "BLAZE_SMP_DVECDVECMULT_THRESHOLD",
+   "BLAZE_SMP_DVECDVECDIV_THRESHOLD",
+   "BLAZE_SMP_DVECDVECOUTER_THRESHOLD",
+   "BLAZE_SMP_DMATDVECMULT_THRESHOLD",
+   "BLAZE_SMP_TDMATDVECMULT_THRESHOLD",
+   "BLAZE_SMP_TDVECDMATMULT_THRESHOLD",
+   "BLAZE_SMP_TDVECTDMATMULT_THRESHOLD",
+   "BLAZE_SMP_DMATSVECMULT_THRESHOLD",
+   "BLAZE_SMP_TDMATSVECMULT_THRESHOLD",
+   "BLAZE_SMP_TSVECDMATMULT_THRESHOLD",
+   "BLAZE_SMP_TSVECTDMATMULT_THRESHOLD",
+   "BLAZE_SMP_SMATDVECMULT_THRESHOLD",
+   "BLAZE_SMP_TSMATDVECMULT_THRESHOLD",
+   "BLAZE_SMP_TDVECSMATMULT_THRESHOLD",
+   "BLAZE_SMP_TDVECTSMATMULT_THRESHOLD",
+   "BLAZE_SMP_SMATSVECMULT_THRESHOLD",
+   "BLAZE_SMP_TSMATSVECMULT_THRESHOLD",
+   "BLAZE_SMP_TSVECSMATMULT_THRESHOLD",
+   "BLAZE_SMP_TSVECTSMATMULT_THRESHOLD",
+   "BLAZE_SMP_DMATASSIGN_THRESHOLD",
+   "BLAZE_SMP_DMATSCALARMULT_THRESHOLD",
+   "BLAZE_SMP_DMATDMATADD_THRESHOLD",
+   "BLAZE_SMP_DMATTDMATADD_THRESHOLD",
+   "BLAZE_SMP_DMATDMATSUB_THRESHOLD",
+   "BLAZE_SMP_DMATTDMATSUB_THRESHOLD",
+   "BLAZE_SMP_DMATDMATSCHUR_THRESHOLD",
+   "BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD",
+   "BLAZE_SMP_DMATDMATMULT_THRESHOLD",
+   "BLAZE_SMP_DMATTDMATMULT_THRESHOLD",
+   "BLAZE_SMP_TDMATDMATMULT_THRESHOLD",
+   "BLAZE_SMP_TDMATTDMATMULT_THRESHOLD",
+   "BLAZE_SMP_DMATSMATMULT_THRESHOLD",
+   "BLAZE_SMP_DMATTSMATMULT_THRESHOLD",
+   "BLAZE_SMP_TDMATSMATMULT_THRESHOLD",
+   "BLAZE_SMP_TDMATTSMATMULT_THRESHOLD",
+   "BLAZE_SMP_SMATDMATMULT_THRESHOLD",
+   "BLAZE_SMP_SMATTDMATMULT_THRESHOLD",
+   "BLAZE_SMP_TSMATDMATMULT_THRESHOLD",
+   "BLAZE_SMP_TSMATTDMATMULT_THRESHOLD",
+   "BLAZE_SMP_SMATSMATMULT_THRESHOLD",
+   "BLAZE_SMP_SMATTSMATMULT_THRESHOLD",
+   "BLAZE_SMP_TSMATSMATMULT_THRESHOLD",
+   "BLAZE_SMP_TSMATTSMATMULT_THRESHOLD",
+   "BLAZE_SMP_DMATREDUCE_THRESHOLD",
+   "BLAZE_SMP_SMATREDUCE_THRESHOLD",
+   "BLAZE_SMP_DVECREDUCE_THRESHOLD",
+   "BLAZE_SMP_DMATFULLREDUCE_THRESHOLD",
+   "BLAZE_SMP_BATCH_THRESHOLD"
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+const bool SMPThresholdTable<T>::initialized = SMPThresholdTable<T>::init();
+
+namespace {
+
+const bool smpThresholdTableInitialized = SMPThresholdTable<>::initialized;
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS RUNTIMESMPTHRESHOLD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Handle for a single SMP threshold in the runtime threshold mode.
+// \ingroup system
+//
+// The RuntimeSMPThreshold class represents a single entry of the SMP threshold table. It is
+// implicitly convertible to \c size_t and can therefore be used in place of the compile time
+// SMP threshold constants. Every conversion returns the current value of the threshold.\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only.
+*/
+class RuntimeSMPThreshold
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the RuntimeSMPThreshold class.
+   //
+   // \param index The index of the threshold in the SMP threshold table.
+   */
+   explicit constexpr RuntimeSMPThreshold( size_t index ) noexcept
+      : index_( index )  // The index of the threshold in the SMP threshold table
+   {}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\brief Conversion to the current value of the threshold.
+   //
+   // \return The current value of the threshold.
+   */
+   inline operator size_t() const noexcept {
+      return SMPThresholdTable<>::values[index_];
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   size_t index_;  //!< The index of the threshold in the SMP threshold table.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SMP THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr RuntimeSMPThreshold SMP_DVECASSIGN_THRESHOLD    ( 0UL );
+constexpr RuntimeSMPThreshold SMP_DVECSCALARMULT_THRESHOLD( 1UL );
+constexpr RuntimeSMPThreshold SMP_DVECDVECADD_THRESHOLD   ( 2UL );
+constexpr RuntimeSMPThreshold SMP_DVECDVECSUB_THRESHOLD   ( 3UL );
+constexpr RuntimeSMPThreshold SMP_DVECDVECMULT_THRESHOLD  ( 4UL );
+constexpr RuntimeSMPThreshold SMP_DVECDVECDIV_THRESHOLD   ( 5UL );
+constexpr RuntimeSMPThreshold SMP_DVECDVECOUTER_THRESHOLD ( 6UL );
+constexpr RuntimeSMPThreshold SMP_DMATDVECMULT_THRESHOLD  ( 7UL );
+constexpr RuntimeSMPThreshold SMP_TDMATDVECMULT_THRESHOLD ( 8UL );
+constexpr RuntimeSMPThreshold SMP_TDVECDMATMULT_THRESHOLD ( 9UL );
+constexpr RuntimeSMPThreshold SMP_TDVECTDMATMULT_THRESHOLD( 10UL );
+constexpr RuntimeSMPThreshold SMP_DMATSVECMULT_THRESHOLD  ( 11UL );
+constexpr RuntimeSMPThreshold SMP_TDMATSVECMULT_THRESHOLD ( 12UL );
+constexpr RuntimeSMPThreshold SMP_TSVECDMATMULT_THRESHOLD ( 13UL );
+constexpr RuntimeSMPThreshold SMP_TSVECTDMATMULT_THRESHOLD( 14UL );
+constexpr RuntimeSMPThreshold SMP_SMATDVECMULT_THRESHOLD  ( 15UL );
+constexpr RuntimeSMPThreshold SMP_TSMATDVECMULT_THRESHOLD ( 16UL );
+constexpr RuntimeSMPThreshold SMP_TDVECSMATMULT_THRESHOLD ( 17UL );
+constexpr RuntimeSMPThreshold SMP_TDVECTSMATMULT_THRESHOLD( 18UL );
+constexpr RuntimeSMPThreshold SMP_SMATSVECMULT_THRESHOLD  ( 19UL );
+constexpr RuntimeSMPThreshold SMP_TSMATSVECMULT_THRESHOLD ( 20UL );
+constexpr RuntimeSMPThreshold SMP_TSVECSMATMULT_THRESHOLD ( 21UL );
+constexpr RuntimeSMPThreshold SMP_TSVECTSMATMULT_THRESHOLD( 22UL );
+constexpr RuntimeSMPThreshold SMP_DMATASSIGN_THRESHOLD    ( 23UL );
+constexpr RuntimeSMPThreshold SMP_DMATSCALARMULT_THRESHOLD( 24UL );
+constexpr RuntimeSMPThreshold SMP_DMATDMATADD_THRESHOLD   ( 25UL );
+constexpr RuntimeSMPThreshold SMP_DMATTDMATADD_THRESHOLD  ( 26UL );
+constexpr RuntimeSMPThreshold SMP_DMATDMATSUB_THRESHOLD   ( 27UL );
+constexpr RuntimeSMPThreshold SMP_DMATTDMATSUB_THRESHOLD  ( 28UL );
+constexpr RuntimeSMPThreshold SMP_DMATDMATSCHUR_THRESHOLD ( 29UL );
+constexpr RuntimeSMPThreshold SMP_DMATTDMATSCHUR_THRESHOLD( 30UL );
+constexpr RuntimeSMPThreshold SMP_DMATDMATMULT_THRESHOLD  ( 31UL );
+constexpr RuntimeSMPThreshold SMP_DMATTDMATMULT_THRESHOLD ( 32UL );
+constexpr RuntimeSMPThreshold SMP_TDMATDMATMULT_THRESHOLD ( 33UL );
+constexpr RuntimeSMPThreshold SMP_TDMATTDMATMULT_THRESHOLD( 34UL );
+constexpr RuntimeSMPThreshold SMP_DMATSMATMULT_THRESHOLD  ( 35UL );
+constexpr RuntimeSMPThreshold SMP_DMATTSMATMULT_THRESHOLD ( 36UL );
+constexpr RuntimeSMPThreshold SMP_TDMATSMATMULT_THRESHOLD ( 37UL );
+constexpr RuntimeSMPThreshold SMP_TDMATTSMATMULT_THRESHOLD( 38UL );
+constexpr RuntimeSMPThreshold SMP_SMATDMATMULT_THRESHOLD  ( 39UL );
+constexpr RuntimeSMPThreshold SMP_SMATTDMATMULT_THRESHOLD ( 40UL );
+constexpr RuntimeSMPThreshold SMP_TSMATDMATMULT_THRESHOLD ( 41UL );
+constexpr RuntimeSMPThreshold SMP_TSMATTDMATMULT_THRESHOLD( 42UL );
+constexpr RuntimeSMPThreshold SMP_SMATSMATMULT_THRESHOLD  ( 43UL );
+constexpr RuntimeSMPThreshold SMP_SMATTSMATMULT_THRESHOLD ( 44UL );
+constexpr RuntimeSMPThreshold SMP_TSMATSMATMULT_THRESHOLD ( 45UL );
+constexpr RuntimeSMPThreshold SMP_TSMATTSMATMULT_THRESHOLD( 46UL );
+constexpr RuntimeSMPThreshold SMP_DMATREDUCE_THRESHOLD    ( 47UL );
+constexpr RuntimeSMPThreshold SMP_SMATREDUCE_THRESHOLD    ( 48UL );
+constexpr RuntimeSMPThreshold SMP_DVECREDUCE_THRESHOLD    ( 49UL );
+constexpr RuntimeSMPThreshold SMP_DMATFULLREDUCE_THRESHOLD( 50UL );
+constexpr RuntimeSMPThreshold SMP_BATCH_THRESHOLD         ( 51UL );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SMP THRESHOLD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SMP threshold functions */
+//@{
+inline size_t getSMPThreshold( const std::string& name );
+inline void setSMPThreshold( const std::string& name, size_t threshold );
+inline void resetSMPThresholds();
+inline void loadSMPThresholds( const std::string& filename );
+inline void saveSMPThresholds( const std::string& filename );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the SMP threshold with the given name.
+// \ingroup system
+//
+// \param name The name of the SMP threshold (as for instance "BLAZE_SMP_DVECASSIGN_THRESHOLD").
+// \return The index of the SMP threshold in the SMP threshold table.
+// \exception std::invalid_argument Unknown SMP threshold.
+*/
+inline size_t getSMPThresholdIndex( const std::string& name )
+{
+   for( size_t i=0UL; i<SMPThresholdTable<>::size; ++i ) {
+      if( name == SMPThresholdTable<>::names[i] )
+         return i;
+   }
+
+   BLAZE_THROW_INVALID_ARGUMENT( "Unknown SMP threshold" );
+
+   return SMPThresholdTable<>::size;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current value of the given SMP threshold.
+// \ingroup system
+//
+// \param name The name of the SMP threshold (as for instance "BLAZE_SMP_DVECASSIGN_THRESHOLD").
+// \return The current value of the SMP threshold.
+// \exception std::invalid_argument Unknown SMP threshold.
+//
+// This function is only available in case the \c BLAZE_USE_RUNTIME_SMP_THRESHOLDS compilation
+// switch is set to 1.
+*/
+inline size_t getSMPThreshold( const std::string& name )
+{
+   return SMPThresholdTable<>::values[getSMPThresholdIndex( name )];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changes the value of the given SMP threshold.
+// \ingroup system
+//
+// \param name The name of the SMP threshold (as for instance "BLAZE_SMP_DVECASSIGN_THRESHOLD").
+// \param threshold The new value of the SMP threshold.
+// \return void
+// \exception std::invalid_argument Unknown SMP threshold.
+//
+// This function changes the value of the given SMP threshold. All subsequent decisions between
+// a serial and a parallel execution are based on the new value. Note that this function must
+// not be called while any parallel operation is executed!
+//
+// This function is only available in case the \c BLAZE_USE_RUNTIME_SMP_THRESHOLDS compilation
+// switch is set to 1.
+*/
+inline void setSMPThreshold( const std::string& name, size_t threshold )
+{
+   SMPThresholdTable<>::values[getSMPThresholdIndex( name )] = threshold;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets all SMP thresholds to their compile time defaults.
+// \ingroup system
+//
+// \return void
+//
+// This function is only available in case the \c BLAZE_USE_RUNTIME_SMP_THRESHOLDS compilation
+// switch is set to 1.
+*/
+inline void resetSMPThresholds()
+{
+   for( size_t i=0UL; i<SMPThresholdTable<>::size; ++i ) {
+      SMPThresholdTable<>::values[i] = SMPThresholdTable<>::defaults[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loading SMP thresholds from the given tuning file.
+// \ingroup system
+//
+// \param filename The name of the tuning file.
+// \return void
+// \exception std::runtime_error Invalid tuning file.
+// \exception std::invalid_argument Unknown SMP threshold.
+//
+// This function loads SMP thresholds from the given tuning file. Every line of the file
+// contains the name of a single SMP threshold and its non-negative integral value, separated by
+// whitespace and optionally followed by a comment starting with '#'. Empty lines and lines
+// starting with '#' are ignored. Thresholds not mentioned in the file remain unchanged:
+
+   \code
+   # SMP thresholds for a 64-core system
+   BLAZE_SMP_DVECASSIGN_THRESHOLD   65536
+   BLAZE_SMP_DMATDVECMULT_THRESHOLD 256
+   \endcode
+
+// Such a file can for instance be created via the saveSMPThresholds() function after a call to
+// the calibrateSMPThresholds() function. Additionally, in case the \c BLAZE_SMP_THRESHOLDS
+// environment variable contains the name of a tuning file, the file is loaded automatically
+// at program startup. Note that this function must not be called while any parallel operation
+// is executed!
+//
+// This function is only available in case the \c BLAZE_USE_RUNTIME_SMP_THRESHOLDS compilation
+// switch is set to 1.
+*/
+inline void loadSMPThresholds( const std::string& filename )
+{
+   std::ifstream file( filename.c_str() );
+
+   if( !file.is_open() ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Tuning file could not be opened" );
+   }
+
+   std::string line;
+
+   while( std::getline( file, line ) )
+   {
+      std::istringstream iss( line );
+      std::string name;
+
+      if( !( iss >> name ) || name[0] == '#' )
+         continue;
+
+      std::string value, rest;
+      size_t threshold( 0UL );
+
+      if( !( iss >> value ) || value.find_first_not_of( "0123456789" ) != std::string::npos ||
+          !( std::istringstream( value ) >> threshold ) || ( iss >> rest && rest[0] != '#' ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Invalid SMP threshold value in tuning file" );
+      }
+
+      setSMPThreshold( name, threshold );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Saving the current SMP thresholds to the given tuning file.
+// \ingroup system
+//
+// \param filename The name of the tuning file.
+// \return void
+// \exception std::runtime_error Tuning file could not be written.
+//
+// This function writes the current values of all SMP thresholds to the given tuning file (see
+// the loadSMPThresholds() function for the file format).
+//
+// This function is only available in case the \c BLAZE_USE_RUNTIME_SMP_THRESHOLDS compilation
+// switch is set to 1.
+*/
+inline void saveSMPThresholds( const std::string& filename )
+{
+   std::ofstream file( filename.c_str() );
+
+   if( !file.is_open() ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Tuning file could not be opened" );
+   }
+
+   file << "# Blaze SMP thresholds\n";
+
+   for( size_t i=0UL; i<SMPThresholdTable<>::size; ++i ) {
+      file << SMPThresholdTable<>::names[i] << " " << SMPThresholdTable<>::values[i] << "\n";
+   }
+
+   if( !file ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Tuning file could not be written" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INITIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the SMP threshold table.
+//
+// \return \a true after the initialization.
+// \exception std::runtime_error Invalid tuning file.
+//
+// This function loads the tuning file specified via the \c BLAZE_SMP_THRESHOLDS environment
+// variable. In case the environment variable is not defined or not set, all thresholds keep
+// their compile time defaults.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename T >
+inline bool SMPThresholdTable<T>::init()
+{
+   const char* env = std::getenv( "BLAZE_SMP_THRESHOLDS" );
+
+   if( env != nullptr && env[0] != '\0' )
+      loadSMPThresholds( env );
+
+   return true;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -967,6 +967,66 @@ constexpr size_t SMP_SMATREDUCE_DEBUG_THRESHOLD = 16UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_SMP_DVECREDUCE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a total reduction of a dense vector can be executed
+// in parallel. In case the number of elements of the dense vector is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DVECREDUCE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix total reduction threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_SMP_DMATFULLREDUCE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a total reduction of a dense matrix can be executed
+// in parallel. In case the number of elements of the dense matrix is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATFULLREDUCE_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batched small matrix operation threshold.
+// \ingroup system
+//
+// This debug value is used instead of the BLAZE_SMP_BATCH_THRESHOLD while the Blaze debug mode
+// is active. It specifies when a batched operation on a batch of small matrices can be executed
+// in parallel. In case the total number of elements of the batch is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_BATCH_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+} // namespace blaze
+
+
+
+
+//=================================================================================================
+//
+//  SMP THRESHOLD CONSTANTS
+//
+//=================================================================================================
+
+#if BLAZE_USE_RUNTIME_SMP_THRESHOLDS
+
+#include <blaze/system/RuntimeThresholds.h>
+
+#else
+
+namespace blaze {
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DVECASSIGN_THRESHOLD     );
@@ -1018,11 +1078,16 @@ constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSM
 constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD );
 constexpr size_t SMP_DMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DMATREDUCE_THRESHOLD     );
 constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_SMATREDUCE_THRESHOLD     );
+constexpr size_t SMP_DVECREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DVECREDUCE_THRESHOLD     );
+constexpr size_t SMP_DMATFULLREDUCE_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATFULLREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DMATFULLREDUCE_THRESHOLD );
+constexpr size_t SMP_BATCH_THRESHOLD          = ( BLAZE_DEBUG_MODE ? SMP_BATCH_DEBUG_THRESHOLD          : BLAZE_SMP_BATCH_THRESHOLD          );
 /*! \endcond */
 //*************************************************************************************************
 
 } // namespace blaze
 
+#endif
+
 
 
 
@@ -385,6 +385,25 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Compilation switch for the built-in SIMD math mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the built-in SIMD math mode. In case the built-in
+// SIMD math mode is enabled (i.e. in case SSE2, AVX2, or AVX-512 is available and the kernels
+// are not deactivated via the BLAZE_USE_BUILTIN_SIMD_MATH switch) the Blaze library vectorizes
+// several transcendental functions by built-in polynomial kernels in case neither the SVML,
+// nor Sleef, nor XSIMD is used.
+*/
+#if BLAZE_USE_VECTORIZATION && BLAZE_USE_BUILTIN_SIMD_MATH && !BLAZE_MIC_MODE && \
+    ( BLAZE_AVX512F_MODE || BLAZE_AVX2_MODE || ( BLAZE_SSE2_MODE && !BLAZE_AVX_MODE ) )
+#  define BLAZE_BUILTIN_SIMD_MATH_MODE 1
+#else
+#  define BLAZE_BUILTIN_SIMD_MATH_MODE 0
+#endif
+//*************************************************************************************************
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
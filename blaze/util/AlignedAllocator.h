@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/util/AllocationPolicy.h>
+#include <blaze/util/Arena.h>
 #include <blaze/util/MaybeUnused.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/Types.h>
@@ -65,7 +67,8 @@ namespace blaze {
 // specified type \a T. For instance, in case the given type is a fundamental, built-in data type
 // and in case SSE vectorization is possible, the returned memory is guaranteed to be at least
 // 16-byte aligned. In case AVX is active, the memory is even guaranteed to be at least 32-byte
-// aligned.
+// aligned. Within an active blaze::Workspace, the memory is allocated from and returned to the
+// thread-local blaze::Arena instead.
 */
 template< typename T >
 class AlignedAllocator
@@ -154,6 +157,9 @@ inline AlignedAllocator<T>::AlignedAllocator( const AlignedAllocator<U>& allocat
 // the data type \a T. For instance, in case the type is a fundamental, built-in data type and
 // in case SSE vectorization is possible, the returned memory is guaranteed to be at least
 // 16-byte aligned. In case AVX is active, the memory is even guaranteed to be 32-byte aligned.
+// Large memory blocks are allocated according to the global allocation policy (see
+// blaze::setAllocationPolicy()). Within an active blaze::Workspace all other memory blocks are
+// allocated from the thread-local blaze::Arena.
 */
 template< typename T >
 inline T* AlignedAllocator<T>::allocate( size_t numObjects )
@@ -161,6 +167,15 @@ inline T* AlignedAllocator<T>::allocate( size_t numObjects )
    const size_t alignment( AlignmentOf_v<T> );
 
    if( alignment >= 8UL ) {
+      if( numObjects*sizeof(T) >= largeAllocationThreshold && alignment <= 4096UL ) {
+         const AllocationPolicy policy( getAllocationPolicy() );
+         if( isMappedAllocation( numObjects*sizeof(T), policy ) ) {
+            return reinterpret_cast<T*>( mappedAllocate( numObjects*sizeof(T), policy ) );
+         }
+      }
+      if( alignment <= Arena::alignment && Arena::isActive() ) {
+         return reinterpret_cast<T*>( Arena::allocate( numObjects*sizeof(T) ) );
+      }
       return reinterpret_cast<T*>( alignedAllocate( numObjects*sizeof(T), alignment ) );
    }
    else {
@@ -179,7 +194,9 @@ inline T* AlignedAllocator<T>::allocate( size_t numObjects )
 //
 // This function deallocates a junk of memory that was previously allocated via the allocate()
 // function. Note that the argument \a numObjects must be equal ot the first argument of the call
-// to allocate() that origianlly produced \a ptr.
+// to allocate() that origianlly produced \a ptr. Within an active blaze::Workspace all memory
+// blocks that have not been allocated according to the global allocation policy are returned
+// to the thread-local blaze::Arena.
 */
 template< typename T >
 inline void AlignedAllocator<T>::deallocate( T* ptr, size_t numObjects ) noexcept
@@ -192,7 +209,15 @@ inline void AlignedAllocator<T>::deallocate( T* ptr, size_t numObjects ) noexcep
    const size_t alignment( AlignmentOf_v<T> );
 
    if( alignment >= 8UL ) {
-      alignedDeallocate( ptr );
+      if( numObjects*sizeof(T) >= largeAllocationThreshold && mappedDeallocate( ptr ) ) {
+         return;
+      }
+      if( alignment <= Arena::alignment && Arena::isActive() ) {
+         Arena::deallocate( ptr, numObjects*sizeof(T) );
+      }
+      else {
+         alignedDeallocate( ptr );
+      }
    }
    else {
       operator delete[]( ptr );
@@ -203,6 +228,30 @@ inline void AlignedAllocator<T>::deallocate( T* ptr, size_t numObjects ) noexcep
 
 
 
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the allocation policy of the given AlignedAllocator.
+// \ingroup util
+//
+// \param alloc The given aligned allocator.
+// \return The global allocation policy.
+*/
+template< typename T >
+inline AllocationPolicy allocationPolicy( const AlignedAllocator<T>& alloc ) noexcept
+{
+   MAYBE_UNUSED( alloc );
+   return getAllocationPolicy();
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL OPERATORS
@@ -0,0 +1,309 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/AllocationPolicy.h
+//  \brief Header file for the allocation policies of large memory blocks
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_ALLOCATIONPOLICY_H_
+#define _BLAZE_UTIL_ALLOCATIONPOLICY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ALLOCATION POLICIES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Page policies for the allocation of large memory blocks.
+// \ingroup util
+//
+// The page policy selects the kind of pages backing large memory blocks (see
+// blaze::largeAllocationThreshold):
+//
+//  - \a smallPages: The memory is backed by pages of the default size of the system.
+//  - \a transparentHugePages: The memory is marked as eligible for transparent huge pages.
+//  - \a explicitHugePages: The memory is taken from the pool of explicitly reserved huge pages.
+//    In case no huge pages are available, transparent huge pages are used instead.
+//
+// Huge pages are only supported on Linux. On all other systems the page policy is ignored.
+*/
+enum class PagePolicy : int
+{
+   smallPages           = 0,  //!< Pages of the default size of the system.
+   transparentHugePages = 1,  //!< Transparent huge pages.
+   explicitHugePages    = 2   //!< Explicitly reserved huge pages.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Placement policies for the allocation of large memory blocks on NUMA systems.
+// \ingroup util
+//
+// The placement policy selects the NUMA nodes on which the pages of large memory blocks (see
+// blaze::largeAllocationThreshold) are placed:
+//
+//  - \a local: The system default; every page is placed on the NUMA node of the thread that
+//    first touches it.
+//  - \a interleaved: The pages are distributed round-robin across all NUMA nodes available to
+//    the process. This policy is only supported on Linux.
+//  - \a partitioned: Dense vectors and matrices of built-in element type initialize the memory
+//    in parallel, using the same partitioning as the shared memory parallel assignment. Thus
+//    every page is placed on the NUMA node of the thread that is responsible for it in all
+//    subsequent parallel assignments.
+*/
+enum class PlacementPolicy : int
+{
+   local       = 0,  //!< Placement on the NUMA node of the first touching thread.
+   interleaved = 1,  //!< Round-robin placement across all NUMA nodes.
+   partitioned = 2   //!< Placement according to the shared memory parallel partitioning.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation policy for large memory blocks.
+// \ingroup util
+//
+// The AllocationPolicy combines a page policy and a placement policy. It can be selected either
+// globally for all dense vectors and matrices using the blaze::AlignedAllocator (see
+// blaze::setAllocationPolicy()) or per container via the blaze::NumaAllocator:
+
+   \code
+   // Global selection
+   blaze::setAllocationPolicy( { blaze::PagePolicy::transparentHugePages
+                               , blaze::PlacementPolicy::partitioned } );
+
+   // Selection per container
+   using Alloc = blaze::NumaAllocator< double, blaze::PagePolicy::explicitHugePages
+                                             , blaze::PlacementPolicy::interleaved >;
+   blaze::DynamicMatrix<double,blaze::rowMajor,Alloc> A( 50000UL, 50000UL );
+   \endcode
+
+// The default policy (small pages and local placement) corresponds to the regular allocation
+// via blaze::alignedAllocate().
+*/
+struct AllocationPolicy
+{
+   PagePolicy      pages    ;  //!< The page policy.
+   PlacementPolicy placement;  //!< The placement policy.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The size of a single huge page in bytes.
+// \ingroup util
+//
+// Memory blocks backed by huge pages are padded to a multiple of this size.
+*/
+constexpr size_t hugePageSize = 2097152UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Threshold for the allocation of memory blocks according to the allocation policy.
+// \ingroup util
+//
+// Only memory blocks of at least this size (in bytes) are allocated according to the allocation
+// policy. All smaller memory blocks are allocated via the blaze::alignedAllocate() function.
+// The threshold corresponds to the size of a single huge page.
+*/
+constexpr size_t largeAllocationThreshold = hugePageSize;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two allocation policies.
+// \ingroup util
+//
+// \param lhs The left-hand side allocation policy.
+// \param rhs The right-hand side allocation policy.
+// \return \a true if the two policies are equal, \a false if not.
+*/
+constexpr bool operator==( const AllocationPolicy& lhs, const AllocationPolicy& rhs ) noexcept
+{
+   return lhs.pages == rhs.pages && lhs.placement == rhs.placement;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two allocation policies.
+// \ingroup util
+//
+// \param lhs The left-hand side allocation policy.
+// \param rhs The right-hand side allocation policy.
+// \return \a true if the two policies are not equal, \a false if they are.
+*/
+constexpr bool operator!=( const AllocationPolicy& lhs, const AllocationPolicy& rhs ) noexcept
+{
+   return !( lhs == rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ALLOCATION POLICY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the storage of the global allocation policy.
+// \ingroup util
+//
+// \return Reference to the global allocation policy.
+*/
+inline std::atomic<int>& globalAllocationPolicy() noexcept
+{
+   static std::atomic<int> policy( 0 );
+   return policy;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the global allocation policy.
+// \ingroup util
+//
+// \return The allocation policy of all instances of the blaze::AlignedAllocator.
+*/
+inline AllocationPolicy getAllocationPolicy() noexcept
+{
+   const int policy( globalAllocationPolicy().load( std::memory_order_relaxed ) );
+   return AllocationPolicy{ static_cast<PagePolicy>( policy & 0xFF )
+                          , static_cast<PlacementPolicy>( policy >> 8 ) };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the global allocation policy.
+// \ingroup util
+//
+// \param policy The new allocation policy of all instances of the blaze::AlignedAllocator.
+// \return void
+//
+// This function sets the allocation policy for all large memory blocks allocated by any instance
+// of the blaze::AlignedAllocator, i.e. by default by all dense vectors and matrices. The policy
+// only affects subsequent allocations. It is safe to change the policy at any time.
+*/
+inline void setAllocationPolicy( AllocationPolicy policy ) noexcept
+{
+   const int value( static_cast<int>( policy.pages ) | ( static_cast<int>( policy.placement ) << 8 ) );
+   globalAllocationPolicy().store( value, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the allocation policy of the given allocator.
+// \ingroup util
+//
+// \param alloc The given allocator.
+// \return The allocation policy of the allocator.
+//
+// This function returns the allocation policy for large memory blocks of the given allocator.
+// By default, allocators are assumed to use the default allocation policy. Allocators with a
+// different policy are expected to provide an according overload of this function.
+*/
+template< typename Alloc >
+constexpr AllocationPolicy allocationPolicy( const Alloc& alloc ) noexcept
+{
+   MAYBE_UNUSED( alloc );
+   return AllocationPolicy{ PagePolicy::smallPages, PlacementPolicy::local };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given allocation policy requires a mapped allocation.
+// \ingroup util
+//
+// \param size The size of the memory block in bytes.
+// \param policy The allocation policy.
+// \return \a true if the memory block has to be mapped, \a false if not.
+//
+// Memory blocks require a mapped allocation (see blaze::mappedAllocate()) in case they exceed
+// the blaze::largeAllocationThreshold and in case the policy differs from the default policy.
+*/
+constexpr bool isMappedAllocation( size_t size, const AllocationPolicy& policy ) noexcept
+{
+   return size >= largeAllocationThreshold &&
+          ( policy.pages != PagePolicy::smallPages || policy.placement != PlacementPolicy::local );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether a memory block of the given allocator requires a partitioned placement.
+// \ingroup util
+//
+// \param alloc The allocator of the memory block.
+// \param size The size of the memory block in bytes.
+// \return \a true in case the memory block has to be initialized in parallel, \a false if not.
+*/
+template< typename Alloc >
+inline bool isPartitionedAllocation( const Alloc& alloc, size_t size ) noexcept
+{
+   return size >= largeAllocationThreshold &&
+          allocationPolicy( alloc ).placement == PlacementPolicy::partitioned;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,410 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Arena.h
+//  \brief Header file for the thread-local memory arena
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_ARENA_H_
+#define _BLAZE_UTIL_ARENA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Assert.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/NonCreatable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thread-local, size-class based memory arena.
+// \ingroup util
+//
+// The Arena class provides a thread-local cache for aligned memory blocks. Similar to the
+// MemoryPool class template, deallocated blocks are not returned to the system but kept in
+// free lists, from which subsequent allocations are served in only a few cycles. In contrast
+// to a MemoryPool, the Arena is not restricted to a single object size: All block sizes are
+// mapped to size classes (four classes per power of two, starting at 64 bytes), each of which
+// manages its own free list. An allocation is served by a cached block of the same size class
+// that is large enough or by any cached block of the next larger size class. Only if no such
+// block is available, a new block of exactly the requested size is allocated.
+//
+// All blocks are allocated via the blaze::alignedAllocate() function and are aligned to
+// \a Arena::alignment bytes. Therefore any block can still be released via the
+// blaze::alignedDeallocate() function and blocks can safely be deallocated by a different
+// thread than the allocating thread. Every thread only caches the blocks it has deallocated
+// itself, which avoids any kind of synchronization. The cached blocks are returned to the
+// system via the release() function, at the end of the outermost Workspace (see
+// blaze::Workspace), and at the latest at the end of the thread.
+//
+// The Arena is not meant to be used directly. Instead, it serves as backend of the
+// blaze::ArenaAllocator and of all blaze::AlignedAllocator instances within an active
+// blaze::Workspace.
+*/
+class Arena
+   : private NonCreatable
+{
+ public:
+   //**Member constants****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   static constexpr size_t alignment = 64UL;  //!< Alignment of all blocks of the arena.
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Memory management functions*****************************************************************
+   /*!\name Memory management functions */
+   //@{
+   static inline byte_t* allocate  ( size_t size );
+   static inline void    deallocate( void* address, size_t size ) noexcept;
+   static inline void    release() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline bool   isActive() noexcept;
+   static inline size_t cached() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member constants****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   static constexpr size_t minShift   = 6UL;   //!< Logarithm of the smallest size class.
+   static constexpr size_t maxShift   = 47UL;  //!< Logarithm of the largest power of two class.
+   static constexpr size_t numClasses = ( maxShift - minShift + 1UL ) * 4UL;  //!< Number of size classes.
+   static constexpr size_t maxSearch  = 4UL;   //!< Maximum number of inspected blocks per class.
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**struct FreeBlock****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief A single element of a free list of the arena.
+   */
+   struct FreeBlock {
+      FreeBlock* next_;  //!< Pointer to the next free block of the same size class.
+      size_t     size_;  //!< The size of the free block in bytes.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**struct State********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief The thread-local state of the arena.
+   //
+   // The state is trivially constructible and destructible and can therefore be accessed at any
+   // time during the lifetime of a thread without any initialization overhead.
+   */
+   struct State {
+      FreeBlock* freeLists_[numClasses];  //!< The free lists of all size classes.
+      size_t     cached_;                 //!< The total number of cached bytes.
+      size_t     depth_;                  //!< The nesting depth of active workspaces.
+      bool       finalized_;              //!< Flag for the end of the thread.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**struct Finalizer****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Releases all cached blocks at the end of the thread.
+   */
+   struct Finalizer {
+      inline ~Finalizer() {
+         release();
+         state().finalized_ = true;
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   static inline State& state() noexcept;
+   static inline void   enter() noexcept;
+   static inline void   leave() noexcept;
+
+   static constexpr size_t classSize ( size_t index ) noexcept;
+   static inline    size_t floorClass( size_t size  ) noexcept;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend class Workspace;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEMORY MANAGEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocation of an aligned memory block of at least the given size.
+//
+// \param size The minimum number of bytes of the memory block.
+// \return Byte pointer to the first element of the memory block.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function returns a cached memory block that provides at least \a size bytes. For that
+// purpose, it inspects the first few blocks of the size class of \a size and the first block of
+// the next larger size class. In case no suitable block is available, a new block is allocated.
+// The returned memory block is aligned to \a Arena::alignment bytes.
+*/
+inline byte_t* Arena::allocate( size_t size )
+{
+   if( size < classSize( 0UL ) || size >= classSize( numClasses-1UL ) ) {
+      return alignedAllocate( size, alignment );
+   }
+
+   State& s( state() );
+
+   const size_t index( floorClass( size ) );
+
+   FreeBlock** link( &s.freeLists_[index] );
+   for( size_t i=0UL; *link != nullptr && i<maxSearch; ++i, link=&(*link)->next_ ) {
+      if( (*link)->size_ >= size ) break;
+   }
+
+   if( *link == nullptr || (*link)->size_ < size ) {
+      link = &s.freeLists_[index+1UL];
+   }
+
+   if( FreeBlock* const block = *link ) {
+      *link = block->next_;
+      s.cached_ -= block->size_;
+      return reinterpret_cast<byte_t*>( block );
+   }
+
+   return alignedAllocate( size, alignment );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of a memory block.
+//
+// \param address The address of the memory block to be deallocated.
+// \param size The size of the memory block in bytes.
+// \return void
+//
+// This function deallocates a memory block that has been allocated via the allocate() function
+// or via the blaze::alignedAllocate() function. The block is cached in the free list of the size
+// class of the given \a size. Blocks that are not within the range of the size classes or that
+// are not aligned to \a Arena::alignment bytes are immediately returned to the system.
+*/
+inline void Arena::deallocate( void* address, size_t size ) noexcept
+{
+   if( address == nullptr )
+      return;
+
+   State& s( state() );
+
+   if( s.finalized_ || size < classSize( 0UL ) || size >= classSize( numClasses-1UL ) ||
+       reinterpret_cast<size_t>( address ) % alignment != 0UL ) {
+      alignedDeallocate( address );
+      return;
+   }
+
+   static thread_local Finalizer finalizer;
+   MAYBE_UNUSED( finalizer );
+
+   const size_t index( floorClass( size ) );
+
+   FreeBlock* const block( static_cast<FreeBlock*>( address ) );
+   block->next_ = s.freeLists_[index];
+   block->size_ = size;
+   s.freeLists_[index] = block;
+   s.cached_ += size;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns all cached memory blocks of the calling thread to the system.
+//
+// \return void
+*/
+inline void Arena::release() noexcept
+{
+   State& s( state() );
+
+   for( size_t i=0UL; i<numClasses; ++i ) {
+      while( FreeBlock* block = s.freeLists_[i] ) {
+         s.freeLists_[i] = block->next_;
+         alignedDeallocate( block );
+      }
+   }
+
+   s.cached_ = 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether a workspace is active in the calling thread.
+//
+// \return \a true in case a workspace is active, \a false if not.
+*/
+inline bool Arena::isActive() noexcept
+{
+   return state().depth_ > 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of bytes cached by the calling thread.
+//
+// \return The total number of cached bytes.
+*/
+inline size_t Arena::cached() noexcept
+{
+   return state().cached_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the arena state of the calling thread.
+//
+// \return Reference to the thread-local arena state.
+*/
+inline Arena::State& Arena::state() noexcept
+{
+   static thread_local State s{};
+   return s;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Enters a workspace in the calling thread.
+//
+// \return void
+*/
+inline void Arena::enter() noexcept
+{
+   ++state().depth_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Leaves a workspace in the calling thread.
+//
+// \return void
+//
+// In case the outermost workspace is left, all cached memory blocks are released.
+*/
+inline void Arena::leave() noexcept
+{
+   BLAZE_INTERNAL_ASSERT( state().depth_ > 0UL, "Unbalanced workspace detected" );
+
+   if( --state().depth_ == 0UL ) {
+      release();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size of the given size class in bytes.
+//
+// \param index The index of the size class.
+// \return The size of the size class in bytes.
+*/
+constexpr size_t Arena::classSize( size_t index ) noexcept
+{
+   return ( 4UL + index % 4UL ) << ( index / 4UL + minShift - 2UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the size class of the given size.
+//
+// \param size The size in bytes (within the range of the size classes).
+// \return The index of the largest size class that does not exceed the given size.
+*/
+inline size_t Arena::floorClass( size_t size ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( size >= classSize( 0UL ), "Invalid size detected" );
+   BLAZE_INTERNAL_ASSERT( size < classSize( numClasses-1UL ), "Invalid size detected" );
+
+   size_t shift( minShift );
+   while( ( size >> ( shift+1UL ) ) != 0UL ) {
+      ++shift;
+   }
+
+   return ( shift - minShift ) * 4UL + ( ( size >> ( shift-2UL ) ) & 3UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
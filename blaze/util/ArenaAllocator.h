@@ -0,0 +1,268 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/ArenaAllocator.h
+//  \brief Header file for the ArenaAllocator implementation
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_ARENAALLOCATOR_H_
+#define _BLAZE_UTIL_ARENAALLOCATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Arena.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocator for type-specific aligned memory from the thread-local arena.
+// \ingroup util
+//
+// The ArenaAllocator class template represents an implementation of the allocator concept of
+// the standard library for the allocation of type-specific, aligned, uninitialized memory. In
+// contrast to the blaze::AlignedAllocator, the allocator performs its allocation via the
+// thread-local blaze::Arena, i.e. deallocated memory is not returned to the system but cached
+// for subsequent allocations of the same thread. This makes the ArenaAllocator the allocator of
+// choice for vectors and matrices that are frequently created and destroyed, as for instance
+// temporaries in tight loops:
+
+   \code
+   using Matrix = blaze::DynamicMatrix< double, blaze::rowMajor, blaze::ArenaAllocator<double> >;
+
+   for( size_t i=0UL; i<iterations; ++i ) {
+      Matrix tmp( A * B );  // Only the first iteration allocates memory from the system
+      // ...
+   }
+   \endcode
+
+// The returned memory is at least aligned according to the alignment restrictions of the given
+// type \a T. The cached memory of a thread is released via the blaze::Arena::release() function
+// and at the end of the thread.
+*/
+template< typename T >
+class ArenaAllocator
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ValueType      = T;          //!< Type of the allocated values.
+   using SizeType       = size_t;     //!< Size type of the arena allocator.
+   using DifferenceType = ptrdiff_t;  //!< Difference type of the arena allocator.
+
+   // STL allocator requirements
+   using value_type      = ValueType;       //!< Type of the allocated values.
+   using size_type       = SizeType;        //!< Size type of the arena allocator.
+   using difference_type = DifferenceType;  //!< Difference type of the arena allocator.
+   //**********************************************************************************************
+
+   //**rebind class definition*********************************************************************
+   /*!\brief Implementation of the ArenaAllocator rebind mechanism.
+   */
+   template< typename U >
+   struct rebind
+   {
+      using other = ArenaAllocator<U>;  //!< Type of the other allocator.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   ArenaAllocator() = default;
+
+   template< typename U >
+   inline ArenaAllocator( const ArenaAllocator<U>& );
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   inline T*   allocate  ( size_t numObjects );
+   inline void deallocate( T* ptr, size_t numObjects ) noexcept;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different ArenaAllocator instances.
+//
+// \param allocator The foreign arena allocator to be copied.
+*/
+template< typename T >
+template< typename U >
+inline ArenaAllocator<T>::ArenaAllocator( const ArenaAllocator<U>& allocator )
+{
+   MAYBE_UNUSED( allocator );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocates aligned memory for the specified number of objects.
+//
+// \param numObjects The number of objects to be allocated.
+// \return Pointer to the newly allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function allocates a junk of memory for the specified number of objects of type \a T
+// from the thread-local arena. The returned pointer is guaranteed to be aligned according to
+// the alignment restrictions of the data type \a T. Types that require a larger alignment than
+// provided by the arena are directly allocated via the blaze::alignedAllocate() function.
+*/
+template< typename T >
+inline T* ArenaAllocator<T>::allocate( size_t numObjects )
+{
+   constexpr size_t alignment( AlignmentOf_v<T> );
+
+   if( alignment <= Arena::alignment ) {
+      return reinterpret_cast<T*>( Arena::allocate( numObjects*sizeof(T) ) );
+   }
+   else {
+      return reinterpret_cast<T*>( alignedAllocate( numObjects*sizeof(T), alignment ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of memory.
+//
+// \param ptr The address of the first element of the array to be deallocated.
+// \param numObjects The number of objects to be deallocated.
+// \return void
+//
+// This function returns a junk of memory that was previously allocated via the allocate()
+// function to the thread-local arena of the calling thread. Note that the argument
+// \a numObjects must be equal to the first argument of the call to allocate() that originally
+// produced \a ptr.
+*/
+template< typename T >
+inline void ArenaAllocator<T>::deallocate( T* ptr, size_t numObjects ) noexcept
+{
+   constexpr size_t alignment( AlignmentOf_v<T> );
+
+   if( alignment <= Arena::alignment ) {
+      Arena::deallocate( ptr, numObjects*sizeof(T) );
+   }
+   else {
+      alignedDeallocate( ptr );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name ArenaAllocator operators */
+//@{
+template< typename T1, typename T2 >
+inline bool operator==( const ArenaAllocator<T1>& lhs, const ArenaAllocator<T2>& rhs ) noexcept;
+
+template< typename T1, typename T2 >
+inline bool operator!=( const ArenaAllocator<T1>& lhs, const ArenaAllocator<T2>& rhs ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two ArenaAllocator objects.
+//
+// \param lhs The left-hand side arena allocator.
+// \param rhs The right-hand side arena allocator.
+// \return \a true.
+*/
+template< typename T1    // Type of the left-hand side arena allocator
+        , typename T2 >  // Type of the right-hand side arena allocator
+inline bool operator==( const ArenaAllocator<T1>& lhs, const ArenaAllocator<T2>& rhs ) noexcept
+{
+   MAYBE_UNUSED( lhs, rhs );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two ArenaAllocator objects.
+//
+// \param lhs The left-hand side arena allocator.
+// \param rhs The right-hand side arena allocator.
+// \return \a false.
+*/
+template< typename T1    // Type of the left-hand side arena allocator
+        , typename T2 >  // Type of the right-hand side arena allocator
+inline bool operator!=( const ArenaAllocator<T1>& lhs, const ArenaAllocator<T2>& rhs ) noexcept
+{
+   MAYBE_UNUSED( lhs, rhs );
+   return false;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,20 +41,31 @@
 //*************************************************************************************************
 
 #include <cstdlib>
+#include <mutex>
 #include <new>
+#include <unordered_map>
 #include <blaze/system/Platform.h>
 #include <blaze/util/algorithms/ConstructAt.h>
 #include <blaze/util/algorithms/Destroy.h>
 #include <blaze/util/algorithms/DestroyAt.h>
+#include <blaze/util/AllocationPolicy.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Exception.h>
+#include <blaze/util/MaybeUnused.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
 
 #if BLAZE_WIN32_PLATFORM || BLAZE_WIN64_PLATFORM || BLAZE_MINGW32_PLATFORM || BLAZE_MINGW64_PLATFORM
 #  include <malloc.h>
+#else
+#  include <sys/mman.h>
+#  include <unistd.h>
+#  if defined(__linux__)
+#    include <linux/mempolicy.h>
+#    include <sys/syscall.h>
+#  endif
 #endif
 
 
@@ -127,6 +138,177 @@ inline void alignedDeallocate( const void* address ) noexcept
 
 
 
+//=================================================================================================
+//
+//  MAPPED ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Registry of all memory blocks allocated via the mappedAllocate() function.
+// \ingroup util
+*/
+struct MappedBlocks
+{
+   std::mutex mutex_;                                //!< Synchronization of the registry.
+   std::unordered_map<const void*,size_t> blocks_;  //!< The mapped blocks and their lengths.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the registry of all mapped memory blocks.
+// \ingroup util
+//
+// \return Reference to the registry of all mapped memory blocks.
+//
+// The registry is intentionally never destroyed, such that blocks can still be deallocated by
+// the destructors of static objects.
+*/
+inline MappedBlocks& mappedBlocks()
+{
+   static MappedBlocks* const blocks( new MappedBlocks() );
+   return *blocks;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of a large memory block according to the given allocation policy.
+// \ingroup util
+//
+// \param size The number of bytes to be allocated.
+// \param policy The allocation policy for the memory block.
+// \return Byte pointer to the first element of the memory block.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function maps a new, page aligned memory block directly from the operating system. The
+// pages of the block are backed by huge pages according to the page policy and are placed on
+// the NUMA nodes according to the placement policy (see blaze::AllocationPolicy). Since the
+// memory is not touched before it is returned, all pages are placed on first touch. On systems
+// without support for memory mappings, the function falls back to blaze::alignedAllocate().
+// The memory block has to be deallocated via the mappedDeallocate() function.
+*/
+inline byte_t* mappedAllocate( size_t size, const AllocationPolicy& policy )
+{
+#if BLAZE_WIN32_PLATFORM || BLAZE_WIN64_PLATFORM || BLAZE_MINGW32_PLATFORM || BLAZE_MINGW64_PLATFORM
+   MAYBE_UNUSED( policy );
+
+   void* const raw( alignedAllocate( size, 4096UL ) );
+   const size_t length( 0UL );
+#else
+   const size_t pageSize( static_cast<size_t>( sysconf( _SC_PAGESIZE ) ) );
+   const bool   huge( policy.pages != PagePolicy::smallPages );
+   const size_t granularity( huge ? hugePageSize : pageSize );
+   const size_t length( ( size + granularity - 1UL ) / granularity * granularity );
+
+   void* raw( MAP_FAILED );
+
+#  ifdef MAP_HUGETLB
+   if( policy.pages == PagePolicy::explicitHugePages ) {
+      raw = mmap( nullptr, length, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+   }
+#  endif
+
+   const bool hugetlb( raw != MAP_FAILED );
+
+   if( !hugetlb ) {
+      raw = mmap( nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+   }
+
+   if( raw == MAP_FAILED ) {
+      BLAZE_THROW_BAD_ALLOC;
+   }
+
+#  ifdef MADV_HUGEPAGE
+   if( huge && !hugetlb ) {
+      madvise( raw, length, MADV_HUGEPAGE );
+   }
+#  endif
+
+#  if defined(__linux__) && defined(SYS_mbind) && defined(SYS_get_mempolicy)
+   if( policy.placement == PlacementPolicy::interleaved )
+   {
+      constexpr size_t maxNodes( 1024UL );
+      unsigned long nodes[maxNodes/( 8UL*sizeof(unsigned long) )] = {};
+      int mode( 0 );
+
+      // The placement is only a hint: Failures (e.g. due to missing permissions) are ignored
+      if( syscall( SYS_get_mempolicy, &mode, nodes, maxNodes, nullptr, MPOL_F_MEMS_ALLOWED ) == 0 ) {
+         syscall( SYS_mbind, raw, length, MPOL_INTERLEAVE, nodes, maxNodes+1UL, 0U );
+      }
+   }
+#  endif
+#endif
+
+   try {
+      MappedBlocks& registry( mappedBlocks() );
+      std::lock_guard<std::mutex> lock( registry.mutex_ );
+      registry.blocks_.emplace( raw, length );
+   }
+   catch( ... ) {
+#if BLAZE_WIN32_PLATFORM || BLAZE_WIN64_PLATFORM || BLAZE_MINGW32_PLATFORM || BLAZE_MINGW64_PLATFORM
+      alignedDeallocate( raw );
+#else
+      munmap( raw, length );
+#endif
+      throw;
+   }
+
+   return reinterpret_cast<byte_t*>( raw );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of a memory block allocated via the mappedAllocate() function.
+// \ingroup util
+//
+// \param address The address of the memory block to be deallocated.
+// \return \a true in case the memory block has been deallocated, \a false if it is unknown.
+//
+// This function deallocates the given memory block in case it has been allocated via the
+// mappedAllocate() function. All other memory blocks are not affected and the function returns
+// \a false.
+*/
+inline bool mappedDeallocate( const void* address ) noexcept
+{
+   if( address == nullptr )
+      return false;
+
+   size_t length( 0UL );
+
+   {
+      MappedBlocks& registry( mappedBlocks() );
+      std::lock_guard<std::mutex> lock( registry.mutex_ );
+
+      const auto block( registry.blocks_.find( address ) );
+      if( block == registry.blocks_.end() )
+         return false;
+
+      length = block->second;
+      registry.blocks_.erase( block );
+   }
+
+#if BLAZE_WIN32_PLATFORM || BLAZE_WIN64_PLATFORM || BLAZE_MINGW32_PLATFORM || BLAZE_MINGW64_PLATFORM
+   MAYBE_UNUSED( length );
+   alignedDeallocate( address );
+#else
+   munmap( const_cast<void*>( address ), length );
+#endif
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  TYPE-BASED ALLOCATION FUNCTIONS
@@ -0,0 +1,316 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/NumaAllocator.h
+//  \brief Header file for the NumaAllocator implementation
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_NUMAALLOCATOR_H_
+#define _BLAZE_UTIL_NUMAALLOCATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/AllocationPolicy.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocator for type-specific aligned memory with a specific allocation policy.
+// \ingroup util
+//
+// The NumaAllocator class template represents an implementation of the allocator concept of
+// the standard library for the allocation of type-specific, aligned, uninitialized memory. In
+// contrast to the blaze::AlignedAllocator, which uses the global allocation policy, all large
+// memory blocks (see blaze::largeAllocationThreshold) are allocated according to the page
+// policy \a PP and the placement policy \a NP (see blaze::AllocationPolicy). This allows to
+// select the allocation policy per container:
+
+   \code
+   using Alloc = blaze::NumaAllocator< double, blaze::PagePolicy::transparentHugePages
+                                             , blaze::PlacementPolicy::partitioned >;
+
+   // The 20 GB matrix is backed by transparent huge pages and all pages are placed on the
+   // NUMA node of the thread that is responsible for the according rows in all shared memory
+   // parallel assignments
+   blaze::DynamicMatrix<double,blaze::rowMajor,Alloc> A( 50000UL, 50000UL );
+   \endcode
+
+// All smaller memory blocks are allocated via the blaze::alignedAllocate() function. The
+// returned memory is at least aligned according to the alignment restrictions of the given
+// type \a T.
+*/
+template< typename T                                          // Type of the allocated values
+        , PagePolicy PP = PagePolicy::transparentHugePages     // Page policy
+        , PlacementPolicy NP = PlacementPolicy::partitioned >  // Placement policy
+class NumaAllocator
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ValueType      = T;          //!< Type of the allocated values.
+   using SizeType       = size_t;     //!< Size type of the NUMA allocator.
+   using DifferenceType = ptrdiff_t;  //!< Difference type of the NUMA allocator.
+
+   // STL allocator requirements
+   using value_type      = ValueType;       //!< Type of the allocated values.
+   using size_type       = SizeType;        //!< Size type of the NUMA allocator.
+   using difference_type = DifferenceType;  //!< Difference type of the NUMA allocator.
+   //**********************************************************************************************
+
+   //**rebind class definition*********************************************************************
+   /*!\brief Implementation of the NumaAllocator rebind mechanism.
+   */
+   template< typename U >
+   struct rebind
+   {
+      using other = NumaAllocator<U,PP,NP>;  //!< Type of the other allocator.
+   };
+   //**********************************************************************************************
+
+   //**Member constants****************************************************************************
+   //! The allocation policy of the allocator.
+   static constexpr AllocationPolicy policy{ PP, NP };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   NumaAllocator() = default;
+
+   template< typename U >
+   inline NumaAllocator( const NumaAllocator<U,PP,NP>& );
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   inline T*   allocate  ( size_t numObjects );
+   inline void deallocate( T* ptr, size_t numObjects ) noexcept;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, PagePolicy PP, PlacementPolicy NP >
+constexpr AllocationPolicy NumaAllocator<T,PP,NP>::policy;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different NumaAllocator instances.
+//
+// \param allocator The foreign NUMA allocator to be copied.
+*/
+template< typename T, PagePolicy PP, PlacementPolicy NP >
+template< typename U >
+inline NumaAllocator<T,PP,NP>::NumaAllocator( const NumaAllocator<U,PP,NP>& allocator )
+{
+   MAYBE_UNUSED( allocator );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocates aligned memory for the specified number of objects.
+//
+// \param numObjects The number of objects to be allocated.
+// \return Pointer to the newly allocated memory.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function allocates a junk of memory for the specified number of objects of type \a T.
+// Large memory blocks are allocated according to the allocation policy of the allocator. The
+// returned pointer is guaranteed to be aligned according to the alignment restrictions of the
+// data type \a T.
+*/
+template< typename T, PagePolicy PP, PlacementPolicy NP >
+inline T* NumaAllocator<T,PP,NP>::allocate( size_t numObjects )
+{
+   constexpr size_t alignment( AlignmentOf_v<T> );
+
+   if( alignment <= 4096UL && isMappedAllocation( numObjects*sizeof(T), policy ) ) {
+      return reinterpret_cast<T*>( mappedAllocate( numObjects*sizeof(T), policy ) );
+   }
+   else {
+      return reinterpret_cast<T*>( alignedAllocate( numObjects*sizeof(T), alignment ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of memory.
+//
+// \param ptr The address of the first element of the array to be deallocated.
+// \param numObjects The number of objects to be deallocated.
+// \return void
+//
+// This function deallocates a junk of memory that was previously allocated via the allocate()
+// function. Note that the argument \a numObjects must be equal to the first argument of the call
+// to allocate() that originally produced \a ptr.
+*/
+template< typename T, PagePolicy PP, PlacementPolicy NP >
+inline void NumaAllocator<T,PP,NP>::deallocate( T* ptr, size_t numObjects ) noexcept
+{
+   if( ptr == nullptr )
+      return;
+
+   if( numObjects*sizeof(T) < largeAllocationThreshold || !mappedDeallocate( ptr ) ) {
+      alignedDeallocate( ptr );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the allocation policy of the given NumaAllocator.
+// \ingroup util
+//
+// \param alloc The given NUMA allocator.
+// \return The allocation policy of the NUMA allocator.
+*/
+template< typename T, PagePolicy PP, PlacementPolicy NP >
+constexpr AllocationPolicy allocationPolicy( const NumaAllocator<T,PP,NP>& alloc ) noexcept
+{
+   MAYBE_UNUSED( alloc );
+   return AllocationPolicy{ PP, NP };
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name NumaAllocator operators */
+//@{
+template< typename T1, typename T2, PagePolicy PP, PlacementPolicy NP >
+inline bool operator==( const NumaAllocator<T1,PP,NP>& lhs, const NumaAllocator<T2,PP,NP>& rhs ) noexcept;
+
+template< typename T1, typename T2, PagePolicy PP, PlacementPolicy NP >
+inline bool operator!=( const NumaAllocator<T1,PP,NP>& lhs, const NumaAllocator<T2,PP,NP>& rhs ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two NumaAllocator objects.
+//
+// \param lhs The left-hand side NUMA allocator.
+// \param rhs The right-hand side NUMA allocator.
+// \return \a true.
+*/
+template< typename T1           // Type of the left-hand side NUMA allocator
+        , typename T2           // Type of the right-hand side NUMA allocator
+        , PagePolicy PP         // Page policy
+        , PlacementPolicy NP >  // Placement policy
+inline bool operator==( const NumaAllocator<T1,PP,NP>& lhs, const NumaAllocator<T2,PP,NP>& rhs ) noexcept
+{
+   MAYBE_UNUSED( lhs, rhs );
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two NumaAllocator objects.
+//
+// \param lhs The left-hand side NUMA allocator.
+// \param rhs The right-hand side NUMA allocator.
+// \return \a false.
+*/
+template< typename T1           // Type of the left-hand side NUMA allocator
+        , typename T2           // Type of the right-hand side NUMA allocator
+        , PagePolicy PP         // Page policy
+        , PlacementPolicy NP >  // Placement policy
+inline bool operator!=( const NumaAllocator<T1,PP,NP>& lhs, const NumaAllocator<T2,PP,NP>& rhs ) noexcept
+{
+   MAYBE_UNUSED( lhs, rhs );
+   return false;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
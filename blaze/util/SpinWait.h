@@ -0,0 +1,208 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/SpinWait.h
+//  \brief Header file for the spin-waiting functionality
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_SPINWAIT_H_
+#define _BLAZE_UTIL_SPINWAIT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER) && ( defined(_M_IX86) || defined(_M_X64) )
+#  include <intrin.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPIN-WAITING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the global spin budget.
+// \ingroup util
+//
+// \return Reference to the global spin budget (in microseconds).
+//
+// On first use, the spin budget is initialized via the \c BLAZE_SPIN_BUDGET environment variable.
+// In case the environment variable is not set, the spin budget is 0, i.e. spinning is disabled.
+*/
+inline std::atomic<size_t>& spinBudget() noexcept
+{
+   static std::atomic<size_t> budget( []() {
+      const char* env = std::getenv( "BLAZE_SPIN_BUDGET" );
+      const long value( env != nullptr ? std::atol( env ) : 0L );
+      return value > 0L ? static_cast<size_t>( value ) : 0UL;
+   }() );
+
+   return budget;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current spin budget.
+// \ingroup util
+//
+// \return The spin budget in microseconds (0 in case spinning is disabled).
+*/
+inline size_t getSpinBudget() noexcept
+{
+   return spinBudget().load( std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the spin budget of all thread pools.
+// \ingroup util
+//
+// \param microseconds The new spin budget in microseconds (0 to disable spinning).
+// \return void
+//
+// This function sets the time an idle thread of the work-stealing thread pool keeps spinning
+// for a new task before it blocks, and the time a thread waiting for the completion of all tasks
+// (see the wait() function) keeps spinning before it blocks. As long as the threads are spinning,
+// scheduling and completing tasks does not require any condition variable notification, which
+// reduces the latency of the dispatch of parallel operations to a few hundred nanoseconds. This
+// enables the efficient parallelization of comparatively small operations, which are repeated
+// many times (see also the \c BLAZE_USE_RUNTIME_SMP_THRESHOLDS switch). However, spinning
+// threads keep their cores busy and therefore the spin budget should only be enabled in case
+// the number of threads does not exceed the number of available cores. Alternatively to this function, the spin budget
+// can be specified via the \c BLAZE_SPIN_BUDGET environment variable:
+
+   \code
+   export BLAZE_SPIN_BUDGET=200  // Unix systems
+   set BLAZE_SPIN_BUDGET=200     // Windows systems
+   \endcode
+
+// By default the spin budget is 0, i.e. spinning is disabled. The new budget takes effect the
+// next time a thread starts spinning.
+*/
+inline void setSpinBudget( size_t microseconds ) noexcept
+{
+   spinBudget().store( microseconds, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Hint to the processor that the calling thread is spinning.
+// \ingroup util
+//
+// \return void
+//
+// This function executes the \c pause instruction on x86 processors and the \c yield instruction
+// on ARM processors. This reduces the power consumption of spinning threads and frees resources
+// for the sibling hardware thread of the same core.
+*/
+inline void spinPause() noexcept
+{
+#if defined(__GNUC__) && ( defined(__i386__) || defined(__x86_64__) )
+   __builtin_ia32_pause();
+#elif defined(_MSC_VER) && ( defined(_M_IX86) || defined(_M_X64) )
+   _mm_pause();
+#elif defined(__GNUC__) && ( defined(__aarch64__) || defined(__arm__) )
+   __asm__ __volatile__( "yield" );
+#else
+   std::this_thread::yield();
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Spins until the given condition holds or the spin budget is exhausted.
+// \ingroup util
+//
+// \param condition The condition to be waited for.
+// \return \a true in case the condition holds, \a false in case the spin budget is exhausted.
+//
+// This function repeatedly evaluates the given condition for at most the current spin budget
+// (see the setSpinBudget() function). Between two evaluations the calling thread pauses with an
+// exponential backoff of up to 64 \c pause instructions. In case spinning is disabled, the
+// condition is evaluated exactly once.
+*/
+template< typename Condition >  // Type of the condition
+inline bool spinWait( Condition condition )
+{
+   const size_t budget( getSpinBudget() );
+
+   if( condition() )
+      return true;
+
+   if( budget == 0UL )
+      return false;
+
+   using Clock = std::chrono::steady_clock;
+
+   const Clock::time_point deadline( Clock::now() + std::chrono::microseconds( budget ) );
+   size_t backoff( 1UL );
+
+   do {
+      for( size_t i=0UL; i<backoff; ++i ) {
+         spinPause();
+      }
+
+      if( condition() )
+         return true;
+
+      if( backoff < 64UL )
+         backoff *= 2UL;
+   }
+   while( Clock::now() < deadline );
+
+   return condition();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -44,6 +44,8 @@
 #include <memory>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NonCopyable.h>
+#include <blaze/util/ThreadAffinity.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -260,7 +262,7 @@ class Thread
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
-   explicit Thread( ThreadPoolType* pool );
+   explicit Thread( ThreadPoolType* pool, size_t index );
    //@}
    //**********************************************************************************************
 
@@ -311,6 +313,7 @@ class Thread
                                       pool to learn whether the thread has terminated
                                       its execution. */
    ThreadPoolType* pool_;        //!< Handle to the managing thread pool.
+   size_t          index_;       //!< The index of the thread within the managing thread pool.
    ThreadHandle    thread_;      //!< Handle to the thread of execution.
    //@}
    //**********************************************************************************************
@@ -336,17 +339,20 @@ class Thread
 /*!\brief Starting a thread in a thread pool.
 //
 // \param pool Handle to the managing thread pool.
+// \param index The index of the thread within the managing thread pool.
 //
 // This function creates a new thread in the given thread pool. The thread is kept alive until
-// explicitly killed by the managing thread pool.
+// explicitly killed by the managing thread pool. The index of the thread determines the core
+// the thread is pinned to (see the setThreadAffinity() function).
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool )
+Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool, size_t index )
    : terminated_( false   )  // Thread termination flag
    , pool_      ( pool    )  // Handle to the managing thread pool
+   , index_     ( index   )  // The index of the thread within the managing thread pool
    , thread_    ( nullptr )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( std::bind( &Thread::run, this ) ) );
@@ -371,6 +377,7 @@ template< typename Callable   // Type of the function/functor
         , typename... Args >  // Types of the function/functor arguments
 inline Thread<TT,MT,LT,CT>::Thread( Callable func, Args&&... args )
    : pool_  ( nullptr )  // Handle to the managing thread pool
+   , index_ ( 0UL     )  // The index of the thread within the managing thread pool
    , thread_( nullptr )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( func, std::forward<Args>( args )... ) );
@@ -475,7 +482,9 @@ inline bool Thread<TT,MT,LT,CT>::hasTerminated() const
 //*************************************************************************************************
 /*!\brief Execution function for threads in a thread pool.
 //
-// This function is executed by any thread managed by a thread pool.
+// This function is executed by any thread managed by a thread pool. Before executing a task, the
+// thread is pinned to its core in case the thread affinity has changed (see the
+// setThreadAffinity() function).
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -487,7 +496,11 @@ void Thread<TT,MT,LT,CT>::run()
    BLAZE_INTERNAL_ASSERT( pool_, "Uninitialized pool handle detected" );
 
    // Executing scheduled tasks
-   while( pool_->executeTask() ) {}
+   size_t affinity( 0UL );
+
+   do {
+      updateThreadAffinity( index_, affinity );
+   } while( pool_->executeTask() );
 
    // Setting the termination flag
    terminated_ = true;
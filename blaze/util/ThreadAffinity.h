@@ -0,0 +1,531 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/ThreadAffinity.h
+//  \brief Header file for the thread affinity functionality
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADAFFINITY_H_
+#define _BLAZE_UTIL_THREADAFFINITY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <sched.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Global state of the thread affinity.
+// \ingroup util
+//
+// This auxiliary class manages the cores available to the process and the ordered list of cores
+// the threads of all thread pools are pinned to. Every change of the affinity increases the
+// version of the state, which notifies the threads that they have to pin themselves again.
+*/
+struct ThreadAffinityState
+{
+   std::mutex          mutex_;      //!< Synchronization mutex for the list of cores.
+   std::vector<size_t> available_;  //!< The cores available to the process (the process cpuset).
+   std::vector<size_t> cores_;      //!< The ordered list of cores threads are pinned to.
+   std::atomic<size_t> version_;    //!< The version of the thread affinity.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD AFFINITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Thread affinity functions */
+//@{
+std::vector<size_t> getAvailableCores();
+std::vector<size_t> getThreadAffinity();
+void setThreadAffinity( const std::string& affinity );
+void setThreadAffinity( const std::vector<size_t>& cores );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the cores available to the process.
+// \ingroup util
+//
+// \return The sorted list of cores the process is allowed to run on.
+//
+// On Linux systems this function returns the cores of the process cpuset (as for instance
+// restricted via \c taskset, \c numactl, or a batch system). On all other systems it returns
+// all cores reported by std::thread::hardware_concurrency().
+*/
+inline std::vector<size_t> detectAvailableCores()
+{
+   std::vector<size_t> cores;
+
+#if defined(__linux__)
+   cpu_set_t set;
+   CPU_ZERO( &set );
+
+   if( sched_getaffinity( 0, sizeof( set ), &set ) == 0 ) {
+      for( size_t core=0UL; core<CPU_SETSIZE; ++core ) {
+         if( CPU_ISSET( core, &set ) )
+            cores.push_back( core );
+      }
+   }
+#endif
+
+   if( cores.empty() ) {
+      const size_t n( std::max( std::thread::hardware_concurrency(), 1U ) );
+      for( size_t core=0UL; core<n; ++core )
+         cores.push_back( core );
+   }
+
+   return cores;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Orders the given cores according to the compact or scatter affinity policy.
+// \ingroup util
+//
+// \param cores The list of cores to be ordered.
+// \param scatter \a true for the scatter policy, \a false for the compact policy.
+// \return The ordered list of cores.
+//
+// The compact policy orders the cores by package and physical core, i.e. consecutive threads
+// share a physical core (SMT siblings) and a package before the next core/package is used. The
+// scatter policy distributes consecutive threads round-robin over all packages and uses all
+// physical cores of a package before their SMT siblings. The topology is read from the Linux
+// \c sysfs. In case it is not available, all cores are treated as individual physical cores
+// of a single package, i.e. both policies order the cores by their index.
+*/
+inline std::vector<size_t> orderCores( std::vector<size_t> cores, bool scatter )
+{
+   struct Core {
+      size_t package;  // The package (socket) of the core
+      size_t core;     // The physical core
+      size_t sibling;  // The index of the core among its SMT siblings
+      size_t index;    // The index of the core
+   };
+
+   const auto topology = []( size_t index, const char* name, size_t fallback ) {
+      std::ifstream in( "/sys/devices/system/cpu/cpu" + std::to_string( index ) +
+                        "/topology/" + name );
+      long value( -1L );
+      return ( in >> value && value >= 0L ) ? static_cast<size_t>( value ) : fallback;
+   };
+
+   std::vector<Core> topo;
+   topo.reserve( cores.size() );
+
+   for( size_t index : cores ) {
+      Core core{ topology( index, "physical_package_id", 0UL ),
+                 topology( index, "core_id", index ), 0UL, index };
+      for( const Core& other : topo ) {
+         if( other.package == core.package && other.core == core.core )
+            ++core.sibling;
+      }
+      topo.push_back( core );
+   }
+
+   if( !scatter ) {
+      std::sort( topo.begin(), topo.end(), []( const Core& a, const Core& b ) {
+         return std::tie( a.package, a.core, a.index ) < std::tie( b.package, b.core, b.index );
+      } );
+   }
+   else {
+      // Ranking the cores within their package, physical cores before SMT siblings
+      std::sort( topo.begin(), topo.end(), []( const Core& a, const Core& b ) {
+         return std::tie( a.package, a.sibling, a.core, a.index ) <
+                std::tie( b.package, b.sibling, b.core, b.index );
+      } );
+
+      std::vector<size_t> rank( topo.size(), 0UL );
+      for( size_t i=1UL; i<topo.size(); ++i ) {
+         rank[i] = ( topo[i].package == topo[i-1UL].package ) ? rank[i-1UL] + 1UL : 0UL;
+      }
+
+      // Distributing consecutive threads round-robin over all packages
+      std::vector<size_t> order( topo.size() );
+      for( size_t i=0UL; i<order.size(); ++i )
+         order[i] = i;
+
+      std::stable_sort( order.begin(), order.end(), [&]( size_t a, size_t b ) {
+         return std::tie( rank[a], topo[a].package ) < std::tie( rank[b], topo[b].package );
+      } );
+
+      for( size_t i=0UL; i<order.size(); ++i )
+         cores[i] = topo[order[i]].index;
+
+      return cores;
+   }
+
+   for( size_t i=0UL; i<topo.size(); ++i )
+      cores[i] = topo[i].index;
+
+   return cores;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts the given thread affinity specification into an ordered list of cores.
+// \ingroup util
+//
+// \param affinity The thread affinity specification.
+// \param available The cores available to the process.
+// \return The ordered list of cores.
+// \exception std::invalid_argument Invalid thread affinity specification.
+//
+// The specification is either \c "none", \c "compact", \c "scatter", or a comma-separated list
+// of cores and core ranges (as for instance \c "0-3,8,10-11"). Cores that are not available to
+// the process are ignored. In case the specification is malformed or none of the given cores
+// is available, a \a std::invalid_argument exception is thrown.
+*/
+inline std::vector<size_t>
+   parseThreadAffinity( const std::string& affinity, const std::vector<size_t>& available )
+{
+   if( affinity.empty() || affinity == "none" )
+      return std::vector<size_t>();
+
+   if( affinity == "compact" || affinity == "scatter" )
+      return orderCores( available, affinity == "scatter" );
+
+   std::vector<size_t> cores;
+   size_t pos( 0UL );
+
+   const auto parseIndex = [&]() {
+      const size_t begin( pos );
+      size_t value( 0UL );
+      while( pos < affinity.size() && affinity[pos] >= '0' && affinity[pos] <= '9' ) {
+         value = value*10UL + static_cast<size_t>( affinity[pos] - '0' );
+         ++pos;
+      }
+      if( pos == begin || value >= ( 1UL << 20 ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid thread affinity specification" );
+      }
+      return value;
+   };
+
+   while( true )
+   {
+      const size_t first( parseIndex() );
+      size_t last( first );
+
+      if( pos < affinity.size() && affinity[pos] == '-' ) {
+         ++pos;
+         last = parseIndex();
+      }
+
+      if( last < first ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid thread affinity specification" );
+      }
+
+      for( size_t core=first; core<=last; ++core ) {
+         if( std::binary_search( available.begin(), available.end(), core ) )
+            cores.push_back( core );
+      }
+
+      if( pos == affinity.size() )
+         break;
+
+      if( affinity[pos] != ',' ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid thread affinity specification" );
+      }
+      ++pos;
+   }
+
+   if( cores.empty() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "No available core in thread affinity specification" );
+   }
+
+   return cores;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the global state of the thread affinity.
+// \ingroup util
+//
+// \return Reference to the global thread affinity state.
+//
+// On first use, the state is initialized with the cores available to the process and the
+// thread affinity specified via the \c BLAZE_THREAD_AFFINITY environment variable. An invalid
+// specification in the environment variable is ignored. The state is deliberately never
+// destroyed since it may be accessed by threads of static thread pools during program
+// termination.
+*/
+inline ThreadAffinityState& threadAffinityState()
+{
+   static ThreadAffinityState* state = []() {
+      ThreadAffinityState* s( new ThreadAffinityState() );
+      s->available_ = detectAvailableCores();
+      s->version_ = 0UL;
+
+      if( const char* env = std::getenv( "BLAZE_THREAD_AFFINITY" ) ) {
+         try {
+            s->cores_ = parseThreadAffinity( env, s->available_ );
+            s->version_ = s->cores_.empty() ? 0UL : 1UL;
+         }
+         catch( ... ) {}
+      }
+
+      return s;
+   }();
+
+   return *state;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the cores available to the process.
+// \ingroup util
+//
+// \return The sorted list of cores the process is allowed to run on.
+//
+// On Linux systems this function returns the cores of the process cpuset at the time of the
+// first use of the thread affinity functionality. On all other systems it returns all cores
+// reported by std::thread::hardware_concurrency().
+*/
+inline std::vector<size_t> getAvailableCores()
+{
+   return threadAffinityState().available_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current thread affinity.
+// \ingroup util
+//
+// \return The ordered list of cores the threads are pinned to (empty if threads are not pinned).
+//
+// The \a i-th thread of a thread pool is pinned to the core at position \a i modulo the size of
+// the returned list.
+*/
+inline std::vector<size_t> getThreadAffinity()
+{
+   ThreadAffinityState& state( threadAffinityState() );
+   std::lock_guard<std::mutex> lock( state.mutex_ );
+   return state.cores_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the thread affinity via an affinity specification.
+// \ingroup util
+//
+// \param affinity The thread affinity specification.
+// \return void
+// \exception std::invalid_argument Invalid thread affinity specification.
+//
+// This function pins the threads of all thread pools (as for instance the threads of the C++11
+// and Boost thread-based parallelization) to individual cores. The following specifications
+// are supported:
+//
+//  - \c "none": the threads are not pinned and may run on all available cores (the default)
+//  - \c "compact": consecutive threads are placed on SMT siblings and cores of the same package
+//  - \c "scatter": consecutive threads are spread over all packages and physical cores
+//  - a comma-separated list of cores and core ranges, as for instance \c "0-3,8,10-11"
+//
+// The \a i-th thread of a thread pool is pinned to the \a i-th core of the resulting list (modulo
+// the number of cores). Only cores of the process cpuset are used, all other cores are ignored.
+// In case the specification is malformed or none of the given cores is available to the
+// process, a \a std::invalid_argument exception is thrown. Alternatively to this function, the
+// thread affinity can be specified via the \c BLAZE_THREAD_AFFINITY environment variable:
+
+   \code
+   export BLAZE_THREAD_AFFINITY=scatter  // Unix systems
+   \endcode
+
+// Threads pin themselves before executing their next task. Note that threads are currently only
+// pinned on Linux systems.
+*/
+inline void setThreadAffinity( const std::string& affinity )
+{
+   ThreadAffinityState& state( threadAffinityState() );
+   std::vector<size_t> cores( parseThreadAffinity( affinity, state.available_ ) );
+
+   std::lock_guard<std::mutex> lock( state.mutex_ );
+   state.cores_.swap( cores );
+   ++state.version_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the thread affinity via an ordered list of cores.
+// \ingroup util
+//
+// \param cores The ordered list of cores the threads are pinned to.
+// \return void
+// \exception std::invalid_argument No available core specified.
+//
+// This function pins the \a i-th thread of all thread pools to the \a i-th core of the given
+// list (modulo the number of cores). Cores that are not available to the process are ignored.
+// An empty list removes all pinning. In case none of the given cores is available to the
+// process, a \a std::invalid_argument exception is thrown.
+*/
+inline void setThreadAffinity( const std::vector<size_t>& cores )
+{
+   ThreadAffinityState& state( threadAffinityState() );
+   std::vector<size_t> valid;
+
+   for( size_t core : cores ) {
+      if( std::binary_search( state.available_.begin(), state.available_.end(), core ) )
+         valid.push_back( core );
+   }
+
+   if( !cores.empty() && valid.empty() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "No available core in thread affinity specification" );
+   }
+
+   std::lock_guard<std::mutex> lock( state.mutex_ );
+   state.cores_.swap( valid );
+   ++state.version_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the calling thread according to the current thread affinity.
+// \ingroup util
+//
+// \param index The index of the calling thread within its thread pool.
+// \return \a true if the thread was successfully pinned, \a false if not.
+//
+// This function pins the calling thread to the core at position \a index (modulo the number of
+// cores) of the current thread affinity. In case the threads are not pinned, the calling thread
+// may run on all cores available to the process.
+*/
+inline bool pinThread( size_t index )
+{
+#if defined(__linux__)
+   ThreadAffinityState& state( threadAffinityState() );
+
+   cpu_set_t set;
+   CPU_ZERO( &set );
+
+   {
+      std::lock_guard<std::mutex> lock( state.mutex_ );
+
+      if( state.cores_.empty() ) {
+         for( size_t core : state.available_ )
+            CPU_SET( core, &set );
+      }
+      else {
+         const size_t core( state.cores_[index % state.cores_.size()] );
+         if( core >= CPU_SETSIZE )
+            return false;
+         CPU_SET( core, &set );
+      }
+   }
+
+   return sched_setaffinity( 0, sizeof( set ), &set ) == 0;
+#else
+   MAYBE_UNUSED( index );
+   return false;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Updates the affinity of the calling thread in case the thread affinity has changed.
+// \ingroup util
+//
+// \param index The index of the calling thread within its thread pool.
+// \param version The thread affinity version the calling thread is currently pinned to.
+// \return void
+//
+// This function is called by the threads of a thread pool before executing a task. In case the
+// thread affinity has changed since the last call, the thread is pinned again. Otherwise the
+// function only costs a single atomic load.
+*/
+inline void updateThreadAffinity( size_t index, size_t& version )
+{
+   const size_t current( threadAffinityState().version_.load( std::memory_order_acquire ) );
+
+   if( current != version ) {
+      version = current;
+      pinThread( index );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
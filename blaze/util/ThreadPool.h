@@ -45,6 +45,7 @@
 #include <vector>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Exception.h>
+#include <blaze/util/MaybeUnused.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
@@ -355,6 +356,9 @@ class ThreadPool
    //@{
    template< typename Callable, typename... Args >
    void schedule( Callable func, Args&&... args );
+
+   template< typename Callable, typename... Args >
+   void scheduleOn( size_t index, Callable func, Args&&... args );
    //@}
    //**********************************************************************************************
 
@@ -593,6 +597,32 @@ void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution by a specific thread.
+//
+// \param index The index of the preferred thread.
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function provides the same interface as the according function of the work-stealing
+// thread pool. However, since all threads of the ThreadPool share a single task queue, the
+// preferred thread is ignored and the task is executed by the next available thread.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void ThreadPool<TT,MT,LT,CT>::scheduleOn( size_t index, Callable func, Args&&... args )
+{
+   MAYBE_UNUSED( index );
+   schedule( func, std::forward<Args>( args )... );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -741,6 +771,8 @@ void ThreadPool<TT,MT,LT,CT>::clear()
 /*!\brief Adding a new thread to the thread pool.
 //
 // \return void
+//
+// The new thread receives the smallest index that is not used by any other running thread.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -748,7 +780,20 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::createThread()
 {
-   threads_.push_back( std::unique_ptr<ManagedThread>( new ManagedThread( this ) ) );
+   size_t index( 0UL );
+
+   for( bool used=true; used; ) {
+      used = false;
+      for( const auto& thread : threads_ ) {
+         if( thread->index_ == index && !thread->hasTerminated() ) {
+            used = true;
+            ++index;
+            break;
+         }
+      }
+   }
+
+   threads_.push_back( std::unique_ptr<ManagedThread>( new ManagedThread( this, index ) ) );
    ++total_;
    ++expected_;
    ++active_;
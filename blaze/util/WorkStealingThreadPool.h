@@ -0,0 +1,805 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/WorkStealingThreadPool.h
+//  \brief Header file of the work-stealing thread pool implementation
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_WORKSTEALINGTHREADPOOL_H_
+#define _BLAZE_UTIL_WORKSTEALINGTHREADPOOL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/SpinWait.h>
+#include <blaze/util/ThreadAffinity.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/WorkStealingQueue.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a work-stealing thread pool.
+// \ingroup threads
+//
+// \section workstealingthreadpool_general General
+//
+// The WorkStealingThreadPool class template represents a thread pool with the same interface
+// as the ThreadPool class template. In contrast to the ThreadPool class, which manages all
+// scheduled tasks in a single task queue that is protected by a single mutex, each thread of a
+// WorkStealingThreadPool owns a lock-free work-stealing queue (see the WorkStealingQueue class
+// description). Scheduled tasks are distributed round-robin among these queues. Every thread
+// first processes the tasks in its own queue and subsequently steals tasks from the queues of
+// the other threads. Thus acquiring a task does not require any lock and threads only block
+// in case no task is available. This significantly reduces the synchronization overhead in
+// case of many threads and comparatively small tasks. Via the scheduleOn() function it is
+// possible to schedule a task to the queue of a specific thread. This way the same thread
+// processes the same part of the data in successive operations (as long as it does not have
+// to be stolen), which keeps the data in the caches and the memory of the thread's NUMA node.
+// Additionally, all threads are pinned to cores according to the thread affinity (see the
+// setThreadAffinity() function).
+//
+// In order to reduce the latency of the dispatch of short tasks, idle threads and threads
+// waiting for the completion of all tasks can spin for a configurable time before they block
+// (see the setSpinBudget() function). As long as the threads are spinning, neither the worker
+// threads nor the waiting thread block on a condition variable and no notification is required.
+// Note that every call to schedule() and scheduleOn() still allocates a task and briefly locks
+// the scheduling mutex, which serializes concurrent producers of the single-producer queues.
+//
+// \section workstealingthreadpool_definition Class Definition
+//
+// Analogously to the ThreadPool class template, the WorkStealingThreadPool class template can
+// be configured via four template parameters:
+
+   \code
+   template< typename TT, typename MT, typename LT, typename CT >
+   class WorkStealingThreadPool;
+   \endcode
+
+//  - TT: specifies the type of the encapsulated thread. This can either be \c std::thread,
+//        \c boost::thread, or any other standard conforming thread type.
+//  - MT: specifies the type of the used synchronization mutex. This can for instance be
+//        \c std::mutex, \c boost::mutex, or any other standard conforming mutex type.
+//  - LT: specifies the type of lock used in combination with the given mutex type. This
+//        can be any standard conforming lock type, as for instance \c std::unique_lock,
+//        \c boost::unique_lock.
+//  - CT: specifies the type of the used condition variable. This can for instance be
+//        \c std::condition_variable, \c boost::condition_variable, or any other standard
+//        conforming condition variable type.
+//
+// The following example demonstrates the use of the WorkStealingThreadPool class:
+
+   \code
+   using StdThreadPool = blaze::WorkStealingThreadPool< std::thread
+                                                      , std::mutex
+                                                      , std::unique_lock<std::mutex>
+                                                      , std::condition_variable >;
+
+   // Creating a thread pool with initially four working threads
+   StdThreadPool threadpool( 4 );
+
+   // Scheduling concurrent tasks
+   threadpool.schedule( function0 );
+   threadpool.schedule( Functor2(), 4, 6 );
+
+   // Waiting for the thread pool to complete all tasks
+   threadpool.wait();
+   \endcode
+
+// The Blaze thread-based parallelization uses the WorkStealingThreadPool instead of the
+// ThreadPool in case the \c BLAZE_USE_WORK_STEALING_THREAD_POOL compilation switch is set
+// to 1 (see the <tt>./blaze/config/SMP.h</tt> configuration file).
+//
+// Note that in contrast to the ThreadPool class, the resize() function of the work-stealing
+// thread pool always blocks until all threads have adapted to the new size and must not be
+// called from within a scheduled task.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class WorkStealingThreadPool
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   using ThreadType = TT;                                     //!< Type of the managed threads.
+   using Threads    = std::vector< std::unique_ptr<TT> >;     //!< Type of the thread container.
+   using Queue      = threadpool::WorkStealingQueue;          //!< Type of a single task queue.
+   using Queues     = std::vector< std::unique_ptr<Queue> >;  //!< Type of the queue container.
+   using Mutex      = MT;                                     //!< Type of the mutex.
+   using Lock       = LT;                                     //!< Type of a locking object.
+   using Condition  = CT;                                     //!< Condition variable type.
+   using Conditions = std::vector< std::unique_ptr<CT> >;     //!< Type of the condition container.
+   using Flags      = std::unique_ptr< std::atomic<bool>[] >; //!< Type of the flag container.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit WorkStealingThreadPool( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~WorkStealingThreadPool();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool   isEmpty() const;
+   inline size_t size()    const;
+   inline size_t active()  const;
+   inline size_t ready()   const;
+   //@}
+   //**********************************************************************************************
+
+   //**Task scheduling*****************************************************************************
+   /*!\name Task scheduling */
+   //@{
+   template< typename Callable, typename... Args >
+   void schedule( Callable func, Args&&... args );
+
+   template< typename Callable, typename... Args >
+   void scheduleOn( size_t index, Callable func, Args&&... args );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void resize( size_t n, bool block=false );
+   void wait();
+   void clear();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Thread functions****************************************************************************
+   /*!\name Thread functions */
+   //@{
+   void createThreads( size_t n );
+   void terminateThreads();
+   void push( size_t index, threadpool::Task* task );
+   void run( size_t index );
+   threadpool::Task* acquireTask( size_t index );
+   void completeTask();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<size_t> size_;        //!< Total number of threads in the thread pool.
+   std::atomic<size_t> queued_;      //!< Number of scheduled, but not yet acquired tasks.
+   std::atomic<size_t> unfinished_;  //!< Number of scheduled, but not yet completed tasks.
+   std::atomic<size_t> active_;      //!< Number of currently active/busy threads.
+   std::atomic<size_t> waiting_;     //!< Number of threads waiting for the completion of all tasks.
+   std::atomic<bool> terminate_;     //!< Termination flag for all threads.
+   size_t next_;                     //!< Index of the queue for the next scheduled task.
+   Threads threads_;                 //!< The threads contained in the thread pool.
+   Queues queues_;                   //!< The task queues of the individual threads.
+   Mutex scheduleMutex_;             //!< Synchronization mutex for the scheduling of tasks.
+   mutable Mutex mutex_;             //!< Synchronization mutex for idle threads.
+   Conditions waitForTask_;          //!< Wait conditions of the individual idle threads.
+   Flags asleep_;                    //!< Flags of the threads waiting for a new task.
+   Condition waitForCompletion_;     //!< Wait condition for the completion of all tasks.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the WorkStealingThreadPool class.
+//
+// \param n Initial number of threads \f$[1..\infty)\f$.
+//
+// This constructor creates a thread pool with initially \a n new threads. All threads are
+// initially idle until a task is scheduled.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+WorkStealingThreadPool<TT,MT,LT,CT>::WorkStealingThreadPool( size_t n )
+   : size_      ( 0UL   )  // Total number of threads in the thread pool
+   , queued_    ( 0UL   )  // Number of scheduled, but not yet acquired tasks
+   , unfinished_( 0UL   )  // Number of scheduled, but not yet completed tasks
+   , active_    ( 0UL   )  // Number of currently active/busy threads
+   , waiting_   ( 0UL   )  // Number of threads waiting for the completion of all tasks
+   , terminate_ ( false )  // Termination flag for all threads
+   , next_      ( 0UL   )  // Index of the queue for the next scheduled task
+   , threads_          ()  // The threads contained in the thread pool
+   , queues_           ()  // The task queues of the individual threads
+   , scheduleMutex_    ()  // Synchronization mutex for the scheduling of tasks
+   , mutex_            ()  // Synchronization mutex for idle threads
+   , waitForTask_      ()  // Wait conditions of the individual idle threads
+   , asleep_           ()  // Flags of the threads waiting for a new task
+   , waitForCompletion_()  // Wait condition for the completion of all tasks
+{
+   resize( n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the WorkStealingThreadPool class.
+//
+// The destructor clears all remaining tasks from the task queues and waits for the currently
+// active threads to complete their tasks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+WorkStealingThreadPool<TT,MT,LT,CT>::~WorkStealingThreadPool()
+{
+   clear();
+
+   Lock lock( scheduleMutex_ );
+   terminateThreads();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether any tasks are scheduled for execution.
+//
+// \return \a true in case task are scheduled, \a false otherwise.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool WorkStealingThreadPool<TT,MT,LT,CT>::isEmpty() const
+{
+   return queued_ == 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current size of the thread pool.
+//
+// \return The total number of threads in the thread pool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingThreadPool<TT,MT,LT,CT>::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of currently active/busy threads.
+//
+// \return The number of currently active threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingThreadPool<TT,MT,LT,CT>::active() const
+{
+   return active_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of currently ready/inactive threads.
+//
+// \return The number of currently ready threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t WorkStealingThreadPool<TT,MT,LT,CT>::ready() const
+{
+   const size_t total( size_ );
+   const size_t busy ( active_ );
+   return ( total > busy ) ? ( total - busy ) : 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHEDULING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution.
+//
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution. The given function/functor
+// must be copyable, must be callable with the given type and number of arguments and must return
+// \c void. The task is added to the queue of the next thread in round-robin order. Only in case
+// this thread is waiting for a task, it is notified.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void WorkStealingThreadPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
+{
+   std::unique_ptr<threadpool::Task> task(
+      new threadpool::Task( std::bind<void>( func, std::forward<Args>( args )... ) ) );
+
+   {
+      Lock lock( scheduleMutex_ );
+      const size_t index( next_ );
+      next_ = ( next_ + 1UL == queues_.size() ) ? 0UL : next_ + 1UL;
+      push( index, task.release() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution by a specific thread.
+//
+// \param index The index of the preferred thread.
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution by the thread with the given
+// index (modulo the number of threads). The task is added to the queue of this thread, i.e. it is
+// executed by this thread unless it is stolen by an idle thread. Scheduling the same part of the
+// data to the same thread index in successive operations keeps the data local to the thread.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void WorkStealingThreadPool<TT,MT,LT,CT>::scheduleOn( size_t index, Callable func, Args&&... args )
+{
+   std::unique_ptr<threadpool::Task> task(
+      new threadpool::Task( std::bind<void>( func, std::forward<Args>( args )... ) ) );
+
+   {
+      Lock lock( scheduleMutex_ );
+      push( index % queues_.size(), task.release() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Changes the total number of threads in the thread pool.
+//
+// \param n The new number of threads \f$[1..\infty)\f$.
+// \param block Ignored; the function always blocks until the resize is complete.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function changes the size of the thread pool, i.e. changes the total number of threads
+// contained in the pool. Since every thread owns a task queue, all threads complete their
+// current task and are replaced by \a n new threads. Tasks that have not been acquired yet are
+// redistributed among the new threads. Note that this function must not be called from within
+// a scheduled task!
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
+{
+   MAYBE_UNUSED( block );
+
+   // Checking the given number of threads
+#if !(defined _MSC_VER)
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+#endif
+
+   Lock lock( scheduleMutex_ );
+
+   if( n == threads_.size() )
+      return;
+
+   terminateThreads();
+
+   // Collecting all tasks that have not been acquired yet
+   std::vector<threadpool::Task*> tasks;
+   for( auto const& queue : queues_ ) {
+      while( threadpool::Task* task = queue->steal() )
+         tasks.push_back( task );
+   }
+
+   // Creating the new threads and redistributing the remaining tasks
+   createThreads( n );
+
+   for( size_t i=0UL; i<tasks.size(); ++i ) {
+      if( n > 0UL ) {
+         queues_[i%n]->push( tasks[i] );
+      }
+      else {
+         delete tasks[i];
+         --queued_;
+         completeTask();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all scheduled tasks to be completed.
+//
+// \return void
+//
+// This function blocks until all scheduled tasks have been completed. Before blocking, the
+// calling thread spins for at most the current spin budget (see the setSpinBudget() function).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingThreadPool<TT,MT,LT,CT>::wait()
+{
+   if( spinWait( [this]() { return unfinished_ == 0UL; } ) )
+      return;
+
+   Lock lock( mutex_ );
+   ++waiting_;
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+
+   while( unfinished_ > 0UL ) {
+      waitForCompletion_.wait( lock );
+   }
+
+   --waiting_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all scheduled tasks from the thread pool.
+//
+// \return void
+//
+// This function removes all currently scheduled tasks from the thread pool. The total number
+// of threads remains unchanged and all active threads continue completing their tasks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingThreadPool<TT,MT,LT,CT>::clear()
+{
+   Lock lock( scheduleMutex_ );
+
+   for( auto const& queue : queues_ ) {
+      while( threadpool::Task* task = queue->steal() ) {
+         delete task;
+         --queued_;
+         completeTask();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating the given number of threads and task queues.
+//
+// \param n The number of threads to be created.
+// \return void
+//
+// This function must only be called while no thread is running.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingThreadPool<TT,MT,LT,CT>::createThreads( size_t n )
+{
+   queues_.clear();
+   waitForTask_.clear();
+   for( size_t i=0UL; i<n; ++i ) {
+      queues_.push_back( std::unique_ptr<Queue>( new Queue() ) );
+      waitForTask_.push_back( std::unique_ptr<Condition>( new Condition() ) );
+   }
+   asleep_.reset( new std::atomic<bool>[n] );
+   for( size_t i=0UL; i<n; ++i ) {
+      asleep_[i] = false;
+   }
+
+   terminate_ = false;
+   next_ = 0UL;
+   size_ = n;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      threads_.push_back( std::unique_ptr<ThreadType>(
+         new ThreadType( std::bind( &WorkStealingThreadPool::run, this, i ) ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Terminating and joining all threads.
+//
+// \return void
+//
+// This function signals all threads to terminate after completing their current task and
+// blocks until all threads have been joined. Tasks that have not been acquired yet remain in
+// the task queues.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingThreadPool<TT,MT,LT,CT>::terminateThreads()
+{
+   {
+      Lock lock( mutex_ );
+      terminate_ = true;
+      for( auto const& condition : waitForTask_ ) {
+         condition->notify_all();
+      }
+   }
+
+   for( auto const& thread : threads_ ) {
+      thread->join();
+   }
+
+   threads_.clear();
+   size_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding a task to the queue of a specific thread.
+//
+// \param index The index of the thread.
+// \param task The task to be added.
+// \return void
+//
+// This function adds the given task to the queue of the thread with the given index. In case
+// this thread is idle, it is notified. Other idle threads are deliberately not notified such
+// that the task is executed by its designated thread. The task is only stolen by threads that
+// are still busy with other tasks when it is scheduled. This function must only be called while
+// holding the scheduling mutex.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingThreadPool<TT,MT,LT,CT>::push( size_t index, threadpool::Task* task )
+{
+   ++unfinished_;
+   ++queued_;
+
+   queues_[index]->push( task );
+
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+
+   if( asleep_[index] ) {
+      Lock lock( mutex_ );
+      waitForTask_[index]->notify_one();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The execution loop of a single thread.
+//
+// \param index The index of the thread.
+// \return void
+//
+// This function is executed by every thread of the thread pool. It repeatedly acquires and
+// executes scheduled tasks. In case there is no task available, the thread blocks and waits
+// for a new task to be scheduled to its own queue. Before acquiring a task, the thread is pinned
+// to its core in case the thread affinity has changed (see the setThreadAffinity() function).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingThreadPool<TT,MT,LT,CT>::run( size_t index )
+{
+   size_t affinity( 0UL );
+
+   while( !terminate_ )
+   {
+      updateThreadAffinity( index, affinity );
+
+      // Acquiring and executing a scheduled task
+      if( threadpool::Task* acquired = acquireTask( index ) )
+      {
+         std::unique_ptr<threadpool::Task> task( acquired );
+         --queued_;
+
+         ++active_;
+         (*task)();
+         --active_;
+
+         task.reset();
+         completeTask();
+         continue;
+      }
+
+      // Spinning for a new task in the own queue
+      if( spinWait( [this,index]() { return !queues_[index]->isEmpty() || terminate_; } ) )
+         continue;
+
+      // Waiting for a new task in the own queue
+      Lock lock( mutex_ );
+      asleep_[index] = true;
+      std::atomic_thread_fence( std::memory_order_seq_cst );
+      while( queues_[index]->isEmpty() && !terminate_ ) {
+         waitForTask_[index]->wait( lock );
+      }
+      asleep_[index] = false;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Acquiring a scheduled task.
+//
+// \param index The index of the acquiring thread.
+// \return The acquired task or \c nullptr in case no task could be acquired.
+//
+// This function first tries to acquire a task from the queue of the given thread. In case this
+// queue is empty, it tries to steal a task from the queues of all other threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+threadpool::Task* WorkStealingThreadPool<TT,MT,LT,CT>::acquireTask( size_t index )
+{
+   const size_t n( queues_.size() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( threadpool::Task* task = queues_[(index+i)%n]->steal() )
+         return task;
+   }
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marking a single task as completed.
+//
+// \return void
+//
+// This function marks a single task as completed. In case the last scheduled task has been
+// completed, all threads blocked in the wait() function are notified.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void WorkStealingThreadPool<TT,MT,LT,CT>::completeTask()
+{
+   if( --unfinished_ == 0UL )
+   {
+      std::atomic_thread_fence( std::memory_order_seq_cst );
+
+      if( waiting_ > 0UL ) {
+         Lock lock( mutex_ );
+         waitForCompletion_.notify_all();
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
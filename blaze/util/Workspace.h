@@ -0,0 +1,149 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Workspace.h
+//  \brief Header file for the Workspace class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_WORKSPACE_H_
+#define _BLAZE_UTIL_WORKSPACE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Arena.h>
+#include <blaze/util/NonCopyable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scoped region for the recycling of temporary memory.
+// \ingroup util
+//
+// The Workspace class represents a scoped region, in which all memory allocated via the
+// blaze::AlignedAllocator is served from the thread-local blaze::Arena. This primarily affects
+// the temporaries of expression templates (as for instance the intermediate results of nested
+// matrix multiplications or the results of the evaluate() function), which within a workspace
+// are recycled instead of being returned to the system. Therefore repeatedly evaluating the
+// same expressions in a loop only requires memory allocations in the first iteration:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C, D;
+   // ... Resizing and initialization
+
+   {
+      blaze::Workspace workspace;
+
+      for( size_t i=0UL; i<iterations; ++i ) {
+         D = A * ( B * C );  // The temporary for 'B * C' is recycled in every iteration
+      }
+   }  // All cached memory is released
+   \endcode
+
+// Workspaces can be nested. All cached memory is released at the end of the outermost workspace
+// of a thread. Memory that is still in use at the end of the workspace (as for instance the
+// memory of the matrix D in the example above) remains valid and is returned to the system as
+// usual. Note that workspaces are thread-local: They only affect allocations of the thread that
+// has created the workspace, not allocations of the threads of the shared memory
+// parallelization.
+*/
+class Workspace
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline Workspace() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~Workspace();
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Workspace class.
+//
+// The constructor activates the workspace for the calling thread.
+*/
+inline Workspace::Workspace() noexcept
+{
+   Arena::enter();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the Workspace class.
+//
+// The destructor deactivates the workspace. In case it represents the outermost workspace of the
+// calling thread, all cached memory is released.
+*/
+inline Workspace::~Workspace()
+{
+   Arena::leave();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,409 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/serialization/MappedFile.h
+//  \brief Header file for the MappedFile class
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_SERIALIZATION_MAPPEDFILE_H_
+#define _BLAZE_UTIL_SERIALIZATION_MAPPEDFILE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <utility>
+#include <blaze/system/Platform.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_WIN32_PLATFORM || BLAZE_WIN64_PLATFORM || BLAZE_MINGW32_PLATFORM || BLAZE_MINGW64_PLATFORM
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Read-only memory mapping of a file.
+// \ingroup serialization
+//
+// The MappedFile class maps the complete content of a file into the address space of the
+// process. The mapping is read-only and shared, i.e. the pages of the file are loaded lazily
+// on first access and are shared with all other processes mapping the same file. The mapping
+// is released when the MappedFile is destroyed:
+
+   \code
+   blaze::MappedFile file( "model.blaze" );
+
+   const char* data = file.data();  // Pointer to the first byte of the file
+   const size_t size = file.size();  // Size of the file in bytes
+   \endcode
+
+// The first byte of the mapping is aligned to a page boundary. In case the file cannot be opened
+// or mapped, a \a std::runtime_error exception is thrown.
+*/
+class MappedFile
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline MappedFile() noexcept;
+   explicit inline MappedFile( const std::string& filename );
+
+   MappedFile( const MappedFile& ) = delete;
+   inline MappedFile( MappedFile&& file ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MappedFile();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   MappedFile& operator=( const MappedFile& ) = delete;
+   inline MappedFile& operator=( MappedFile&& file ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const char* data() const noexcept;
+   inline size_t      size() const noexcept;
+   inline void        swap( MappedFile& file ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void unmap() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const char* data_;  //!< Pointer to the first byte of the mapping.
+   size_t      size_;  //!< The size of the mapping in bytes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for MappedFile.
+//
+// The default constructor creates an empty mapping that doesn't refer to any file.
+*/
+inline MappedFile::MappedFile() noexcept
+   : data_( nullptr )  // Pointer to the first byte of the mapping
+   , size_( 0UL )      // The size of the mapping in bytes
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Mapping the given file into memory.
+//
+// \param filename The name of the file to be mapped.
+// \exception std::runtime_error File could not be mapped.
+//
+// This constructor maps the complete content of the given file read-only into memory. In case
+// the file cannot be opened or mapped, a \a std::runtime_error exception is thrown. Empty files
+// result in an empty mapping.
+*/
+inline MappedFile::MappedFile( const std::string& filename )
+   : MappedFile()
+{
+#if BLAZE_WIN32_PLATFORM || BLAZE_WIN64_PLATFORM || BLAZE_MINGW32_PLATFORM || BLAZE_MINGW64_PLATFORM
+   const HANDLE file( CreateFileA( filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                   OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr ) );
+   if( file == INVALID_HANDLE_VALUE ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   LARGE_INTEGER size;
+   if( !GetFileSizeEx( file, &size ) ) {
+      CloseHandle( file );
+      BLAZE_THROW_RUNTIME_ERROR( "File size could not be determined" );
+   }
+
+   if( size.QuadPart > 0 )
+   {
+      const HANDLE mapping( CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr ) );
+      CloseHandle( file );
+
+      if( mapping == nullptr ) {
+         BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+      }
+
+      const void* const ptr( MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) );
+      CloseHandle( mapping );
+
+      if( ptr == nullptr ) {
+         BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+      }
+
+      data_ = static_cast<const char*>( ptr );
+      size_ = static_cast<size_t>( size.QuadPart );
+   }
+   else {
+      CloseHandle( file );
+   }
+#else
+   const int fd( ::open( filename.c_str(), O_RDONLY ) );
+   if( fd == -1 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   struct stat info;
+   if( ::fstat( fd, &info ) != 0 ) {
+      ::close( fd );
+      BLAZE_THROW_RUNTIME_ERROR( "File size could not be determined" );
+   }
+
+   if( info.st_size > 0 )
+   {
+      void* const ptr( ::mmap( nullptr, static_cast<size_t>( info.st_size ), PROT_READ, MAP_SHARED, fd, 0 ) );
+      ::close( fd );
+
+      if( ptr == MAP_FAILED ) {
+         BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+      }
+
+      data_ = static_cast<const char*>( ptr );
+      size_ = static_cast<size_t>( info.st_size );
+   }
+   else {
+      ::close( fd );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for MappedFile.
+//
+// \param file The mapping to be moved into this instance.
+*/
+inline MappedFile::MappedFile( MappedFile&& file ) noexcept
+   : data_( file.data_ )  // Pointer to the first byte of the mapping
+   , size_( file.size_ )  // The size of the mapping in bytes
+{
+   file.data_ = nullptr;
+   file.size_ = 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for MappedFile.
+//
+// The destructor releases the mapping. Note that all pointers into the mapping are invalidated!
+*/
+inline MappedFile::~MappedFile()
+{
+   unmap();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for MappedFile.
+//
+// \param file The mapping to be moved into this instance.
+// \return Reference to the assigned mapping.
+*/
+inline MappedFile& MappedFile::operator=( MappedFile&& file ) noexcept
+{
+   unmap();
+
+   data_ = file.data_;
+   size_ = file.size_;
+
+   file.data_ = nullptr;
+   file.size_ = 0UL;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapping.
+//
+// \return Pointer to the first byte of the mapping.
+*/
+inline const char* MappedFile::data() const noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapping in bytes.
+//
+// \return The size of the mapping in bytes.
+*/
+inline size_t MappedFile::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two mappings.
+//
+// \param file The mapping to be swapped.
+// \return void
+*/
+inline void MappedFile::swap( MappedFile& file ) noexcept
+{
+   std::swap( data_, file.data_ );
+   std::swap( size_, file.size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releasing the mapping.
+//
+// \return void
+*/
+inline void MappedFile::unmap() noexcept
+{
+   if( data_ != nullptr ) {
+#if BLAZE_WIN32_PLATFORM || BLAZE_WIN64_PLATFORM || BLAZE_MINGW32_PLATFORM || BLAZE_MINGW64_PLATFORM
+      UnmapViewOfFile( data_ );
+#else
+      ::munmap( const_cast<char*>( data_ ), size_ );
+#endif
+      data_ = nullptr;
+      size_ = 0UL;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MappedFile functions */
+//@{
+inline void swap( MappedFile& a, MappedFile& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two mappings.
+// \ingroup serialization
+//
+// \param a The first mapping to be swapped.
+// \param b The second mapping to be swapped.
+// \return void
+*/
+inline void swap( MappedFile& a, MappedFile& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,360 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/WorkStealingQueue.h
+//  \brief Lock-free work-stealing queue for the work-stealing thread pool
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_WORKSTEALINGQUEUE_H_
+#define _BLAZE_UTIL_THREADPOOL_WORKSTEALINGQUEUE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Lock-free work-stealing queue for the work-stealing thread pool.
+// \ingroup threads
+//
+// The WorkStealingQueue class represents the per-thread task container of the work-stealing
+// thread pool. It is based on the dynamic circular work-stealing deque by Chase and Lev [1] in
+// the formulation for weak memory models by Le et al. [2]: Tasks are added to the bottom end of
+// the queue by a single producer via push() and are removed from the top end via steal(). In
+// contrast to the TaskQueue class, the steal() function can be called concurrently by an
+// arbitrary number of threads and does not require any lock. Thus the queue uses a FIFO (first
+// in, first out) strategy from the point of view of the consumers. In case the capacity of the
+// circular buffer is exhausted, push() doubles the size of the buffer. Previous buffers are
+// kept alive until the destruction of the queue since concurrent consumers might still access
+// them.
+//
+// Note that push() must not be called concurrently, i.e. any two calls to push() must be
+// synchronized by the caller (as for instance by the WorkStealingThreadPool class). The queue
+// does not take ownership of the contained tasks.
+//
+// [1] D. Chase, Y. Lev: Dynamic Circular Work-Stealing Deque, SPAA'05, 2005\n
+// [2] N. M. Le, A. Pop, A. Cohen, F. Zappa Nardelli: Correct and Efficient Work-Stealing for
+//     Weak Memory Models, PPoPP'13, 2013\n
+*/
+class WorkStealingQueue
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief Circular buffer of the work-stealing queue.
+   */
+   struct Buffer
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Buffer class.
+      //
+      // \param n The capacity of the buffer (must be a power of two).
+      */
+      explicit inline Buffer( size_t n )
+         : mask_ ( n - 1UL )                    // Bit mask for the mapping of indices
+         , tasks_( new std::atomic<Task*>[n] )  // The slots of the circular buffer
+      {
+         BLAZE_INTERNAL_ASSERT( n > 0UL && ( n & mask_ ) == 0UL, "Invalid capacity detected" );
+      }
+      //*******************************************************************************************
+
+      //**Capacity function************************************************************************
+      /*!\brief Returns the capacity of the buffer.
+      //
+      // \return The capacity of the buffer.
+      */
+      inline size_t capacity() const noexcept {
+         return mask_ + 1UL;
+      }
+      //*******************************************************************************************
+
+      //**Load function****************************************************************************
+      /*!\brief Returns the task at the given position.
+      //
+      // \param i The position of the task.
+      // \return The task at the given position.
+      */
+      inline Task* load( size_t i ) const noexcept {
+         return tasks_[i & mask_].load( std::memory_order_relaxed );
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Stores the given task at the given position.
+      //
+      // \param i The position of the task.
+      // \param task The task to be stored.
+      // \return void
+      */
+      inline void store( size_t i, Task* task ) noexcept {
+         tasks_[i & mask_].store( task, std::memory_order_relaxed );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      size_t mask_;                                   //!< Bit mask for the mapping of indices.
+      std::unique_ptr< std::atomic<Task*>[] > tasks_;  //!< The slots of the circular buffer.
+      //*******************************************************************************************
+   };
+
+   using Buffers = std::vector< std::unique_ptr<Buffer> >;  //!< Container for all buffers.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline WorkStealingQueue( size_t capacity = 64UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size   () const noexcept;
+   inline bool   isEmpty() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline void  push ( Task* task );
+   inline Task* steal() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Buffer* grow( Buffer* buffer, size_t top, size_t bottom );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<size_t>  top_;            //!< Index of the top end of the queue.
+   byte_t               padding_[64UL];  //!< Padding to avoid false sharing of the two ends.
+   std::atomic<size_t>  bottom_;         //!< Index of the bottom end of the queue.
+   std::atomic<Buffer*> buffer_;         //!< The currently active circular buffer.
+   Buffers              buffers_;        //!< All buffers allocated by the queue.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for WorkStealingQueue.
+//
+// \param capacity The initial capacity of the queue (must be a power of two).
+*/
+inline WorkStealingQueue::WorkStealingQueue( size_t capacity )
+   : top_    ( 0UL )      // Index of the top end of the queue
+   , padding_()           // Padding to avoid false sharing of the two ends
+   , bottom_ ( 0UL )      // Index of the bottom end of the queue
+   , buffer_ ( nullptr )  // The currently active circular buffer
+   , buffers_()           // All buffers allocated by the queue
+{
+   buffers_.emplace_back( new Buffer( capacity ) );
+   buffer_.store( buffers_.back().get(), std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current size of the queue.
+//
+// \return The current size.
+//
+// This function returns the number of the currently contained tasks. Note that in case of
+// concurrent accesses the returned value is only a snapshot of the current state of the queue.
+*/
+inline size_t WorkStealingQueue::size() const noexcept
+{
+   const size_t bottom( bottom_.load( std::memory_order_acquire ) );
+   const size_t top   ( top_.load( std::memory_order_acquire ) );
+   return ( bottom > top ) ? ( bottom - top ) : 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns \a true if the queue has no elements.
+//
+// \return \a true if the queue is empty, \a false if it is not.
+*/
+inline bool WorkStealingQueue::isEmpty() const noexcept
+{
+   return size() == 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a task to the bottom end of the queue.
+//
+// \param task The task to be added to the bottom end of the queue.
+// \return void
+//
+// This function adds the given task to the bottom end of the queue. It runs in amortized
+// constant time. Note that this function must not be called concurrently!
+*/
+inline void WorkStealingQueue::push( Task* task )
+{
+   const size_t bottom( bottom_.load( std::memory_order_relaxed ) );
+   const size_t top   ( top_.load( std::memory_order_acquire ) );
+   Buffer* buffer( buffer_.load( std::memory_order_relaxed ) );
+
+   if( bottom - top >= buffer->capacity() ) {
+      buffer = grow( buffer, top, bottom );
+   }
+
+   buffer->store( bottom, task );
+   std::atomic_thread_fence( std::memory_order_release );
+   bottom_.store( bottom + 1UL, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing a task from the top end of the queue.
+//
+// \return The removed task or \c nullptr in case no task could be removed.
+//
+// This function tries to remove the task from the top end of the queue. In case the queue is
+// empty or in case the task has been removed by another thread in the meantime, the function
+// returns \c nullptr. This function can be called concurrently by any number of threads.
+*/
+inline Task* WorkStealingQueue::steal() noexcept
+{
+   size_t top( top_.load( std::memory_order_acquire ) );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   const size_t bottom( bottom_.load( std::memory_order_acquire ) );
+
+   if( top >= bottom )
+      return nullptr;
+
+   Task* task( buffer_.load( std::memory_order_acquire )->load( top ) );
+
+   if( !top_.compare_exchange_strong( top, top + 1UL, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed ) )
+      return nullptr;
+
+   return task;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Doubling the capacity of the circular buffer.
+//
+// \param buffer The currently active circular buffer.
+// \param top The current index of the top end of the queue.
+// \param bottom The current index of the bottom end of the queue.
+// \return The new active circular buffer.
+*/
+inline WorkStealingQueue::Buffer*
+   WorkStealingQueue::grow( Buffer* buffer, size_t top, size_t bottom )
+{
+   buffers_.emplace_back( new Buffer( 2UL*buffer->capacity() ) );
+   Buffer* newBuffer( buffers_.back().get() );
+
+   for( size_t i=top; i<bottom; ++i ) {
+      newBuffer->store( i, buffer->load( i ) );
+   }
+
+   buffer_.store( newBuffer, std::memory_order_release );
+   return newBuffer;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
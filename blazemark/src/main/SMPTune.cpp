@@ -0,0 +1,100 @@
+//=================================================================================================
+/*!
+//  \file src/main/SMPTune.cpp
+//  \brief Source file for the SMP threshold calibration
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#ifndef BLAZE_USE_RUNTIME_SMP_THRESHOLDS
+#  define BLAZE_USE_RUNTIME_SMP_THRESHOLDS 1
+#endif
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <blaze/Math.h>
+
+#if !BLAZE_USE_RUNTIME_SMP_THRESHOLDS
+#  error "The SMP threshold calibration requires BLAZE_USE_RUNTIME_SMP_THRESHOLDS=1"
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the SMP threshold calibration.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// This program determines the SMP thresholds for the current machine and the current number
+// of threads (as for instance specified via the \c BLAZE_NUM_THREADS or \c OMP_NUM_THREADS
+// environment variables) and writes them to the given tuning file. The tuning file can be
+// used via the \c BLAZE_SMP_THRESHOLDS environment variable or the loadSMPThresholds()
+// function by all applications compiled with \c BLAZE_USE_RUNTIME_SMP_THRESHOLDS=1.
+*/
+int main( int argc, char** argv )
+{
+   if( argc != 2 ) {
+      std::cerr << " Invalid use of program 'SMPTune'!\n"
+                << "   Use: ./smptune <tuning_file>\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   std::cout << "\n Calibrating the SMP thresholds for " << blaze::getNumThreads()
+             << " thread(s)..." << std::endl;
+
+   try {
+      blaze::calibrateSMPThresholds();
+      blaze::saveSMPThresholds( argv[1] );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during the SMP threshold calibration: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   std::cout << " SMP thresholds written to '" << argv[1] << "'\n" << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,195 @@
+//=================================================================================================
+/*!
+//  \file src/main/ThreadPool.cpp
+//  \brief Source file for the thread pool benchmark
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <condition_variable>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/Timing.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/WorkStealingThreadPool.h>
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+//! Thread pool with a single, mutex-protected task queue.
+using FifoPool = blaze::ThreadPool< std::thread
+                                  , std::mutex
+                                  , std::unique_lock<std::mutex>
+                                  , std::condition_variable >;
+
+//! Thread pool with per-thread, lock-free work-stealing queues.
+using StealingPool = blaze::WorkStealingThreadPool< std::thread
+                                                  , std::mutex
+                                                  , std::unique_lock<std::mutex>
+                                                  , std::condition_variable >;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BENCHMARK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Block-wise parallel dense vector addition via the given thread pool.
+//
+// \param pool The thread pool used for the parallel execution.
+// \param N The size of the vectors for the addition.
+// \param blocks The number of blocks (i.e. tasks) per addition.
+// \param steps The number of additions to perform.
+// \return Minimum runtime of the benchmark.
+//
+// This function mimics the thread-based SMP assignment of the Blaze library: The dense vector
+// addition is split into the given number of blocks, each block is scheduled as a single task,
+// and the calling thread waits for the completion of all tasks.
+*/
+template< typename PoolType >
+double dvecdvecadd( PoolType& pool, size_t N, size_t blocks, size_t steps )
+{
+   blaze::DynamicVector<double> a( N, 1.0 ), b( N, 2.0 ), c( N );
+   blaze::timing::WcTimer timer;
+
+   const size_t blocksize( ( N + blocks - 1UL ) / blocks );
+
+   for( size_t rep=0UL; rep<5UL; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step )
+      {
+         for( size_t i=0UL; i<N; i+=blocksize )
+         {
+            const size_t size( blaze::min( blocksize, N - i ) );
+
+            pool.schedule( [&a,&b,&c,i,size]() {
+               subvector( c, i, size, blaze::unchecked ) =
+                  subvector( a, i, size, blaze::unchecked ) +
+                  subvector( b, i, size, blaze::unchecked );
+            } );
+         }
+
+         pool.wait();
+      }
+      timer.end();
+
+      if( c[N-1UL] != 3.0 )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+   }
+
+   return timer.min();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the thread pool benchmark.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// This benchmark compares the ThreadPool class template (a single task queue protected by a
+// single mutex) with the WorkStealingThreadPool class template (per-thread work-stealing
+// queues) for a block-wise parallel dense vector addition of different sizes.
+*/
+int main( int argc, char** argv )
+{
+   if( argc != 2 ) {
+      std::cerr << " Invalid use of program 'ThreadPool'!\n"
+                << "   Use: ./threadpool <number_of_threads>\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const size_t threads( static_cast<size_t>( atoi( argv[1] ) ) );
+
+   if( threads == 0UL ) {
+      std::cerr << " Invalid number of threads!\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   FifoPool     fifo    ( threads );
+   StealingPool stealing( threads );
+
+   std::cout << "\n Thread pool benchmark (" << threads << " threads)\n"
+             << "   Block-wise parallel dense vector addition (runtime per addition in us)\n\n"
+             << "          N   Tasks    ThreadPool   WorkStealingThreadPool   Speedup\n";
+
+   for( size_t N=1000UL; N<=10000000UL; N*=10UL )
+   {
+      for( size_t blocks : { threads, 4UL*threads } )
+      {
+         const size_t steps( blaze::max( 10UL, 100000000UL / ( N + 10000UL*blocks ) ) );
+
+         const double fifoTime    ( dvecdvecadd( fifo    , N, blocks, steps ) / steps * 1E6 );
+         const double stealingTime( dvecdvecadd( stealing, N, blocks, steps ) / steps * 1E6 );
+
+         std::cout << std::setw(11) << N
+                   << std::setw(8)  << blocks
+                   << std::setw(14) << std::fixed << std::setprecision(2) << fifoTime
+                   << std::setw(25) << stealingTime
+                   << std::setw(10) << fifoTime / stealingTime << "\n";
+      }
+   }
+
+   std::cout << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,735 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lapack/IterativeSolverTest.h
+//  \brief Header file for the iterative solver test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_LAPACK_ITERATIVESOLVERTEST_H_
+#define _BLAZETEST_MATHTEST_LAPACK_ITERATIVESOLVERTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/IterativeSolvers.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lapack {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the iterative solvers.
+//
+// This class represents a test suite for the Krylov subspace solvers and the preconditioners
+// of the Blaze library.
+*/
+class IterativeSolverTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit IterativeSolverTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testCG();
+   template< typename Type > void testBiCGStab();
+   template< typename Type > void testGMRES();
+   template< typename Type > void testMINRES();
+   template< typename Type > void testPreconditioners();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > void initialize( MT& A, bool hermitian );
+
+   template< typename MT, typename VT1, typename VT2 >
+   void checkResult( const MT& A, const VT1& x, const VT2& b,
+                     const blaze::IterativeSolverInfo& info, double tolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   static constexpr size_t grid = 8UL;  //!< Number of grid points per dimension of the test systems.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the conjugate gradient solver (CGSolver).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the conjugate gradient solver for various data types. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void IterativeSolverTest::testCG()
+{
+   const double tolerance( sizeof( blaze::UnderlyingBuiltin_t<Type> ) == 4UL ? 1E-5 : 1E-10 );
+
+   blaze::CGSolver<Type> cg;
+   cg.setTolerance( tolerance );
+
+   {
+      test_ = "Conjugate gradient solver (without preconditioning)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, true );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      const blaze::IterativeSolverInfo info( cg.solve( A, x, b ) );
+
+      checkResult( A, x, b, info, tolerance );
+   }
+
+   {
+      test_ = "Conjugate gradient solver (Jacobi preconditioner)";
+
+      blaze::CompressedMatrix<Type,blaze::columnMajor> A;
+      initialize( A, true );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      const blaze::IterativeSolverInfo info(
+         cg.solve( A, x, b, blaze::JacobiPreconditioner<Type>( A ) ) );
+
+      checkResult( A, x, b, info, tolerance );
+   }
+
+   {
+      test_ = "Conjugate gradient solver (IC(0) preconditioner, repeated solution)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, true );
+
+      const blaze::IC0Preconditioner<Type> ic( A );
+
+      for( size_t i=0UL; i<3UL; ++i )
+      {
+         blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+         randomize( b );
+
+         const blaze::IterativeSolverInfo info( cg.solve( A, x, b, ic ) );
+
+         checkResult( A, x, b, info, tolerance );
+      }
+   }
+
+   {
+      test_ = "Conjugate gradient solver (dense system matrix)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> S;
+      initialize( S, true );
+
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> A( S );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      const blaze::IterativeSolverInfo info( cg.solve( A, x, b ) );
+
+      checkResult( A, x, b, info, tolerance );
+   }
+
+   {
+      test_ = "Conjugate gradient solver (matrix-free operator)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, true );
+
+      const auto op( blaze::linearOperator( A.rows(),
+         [&A]( blaze::DynamicVector<Type>& y, const blaze::DynamicVector<Type>& v ) {
+            y = A * v;
+         } ) );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      const blaze::IterativeSolverInfo info( cg.solve( op, x, b ) );
+
+      checkResult( A, x, b, info, tolerance );
+   }
+
+   {
+      test_ = "Conjugate gradient solver (zero right-hand side)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, true );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows(), Type(0) ), x( A.rows() );
+      randomize( x );
+
+      const blaze::IterativeSolverInfo info( cg.solve( A, x, b ) );
+
+      if( !info.converged || info.iterations != 0UL || !isZero( x ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Iterations:\n"
+             << "     " << info.iterations << "\n"
+             << "   Result (x):\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Conjugate gradient solver (non-matching right-hand side)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, true );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows()+1UL ), x;
+
+      try {
+         cg.solve( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a LSE with non-matching right-hand side succeeded\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the biconjugate gradient stabilized solver (BiCGStabSolver).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the biconjugate gradient stabilized solver for various data
+// types. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void IterativeSolverTest::testBiCGStab()
+{
+   const double tolerance( sizeof( blaze::UnderlyingBuiltin_t<Type> ) == 4UL ? 1E-5 : 1E-10 );
+
+   blaze::BiCGStabSolver<Type> bicgstab;
+   bicgstab.setTolerance( tolerance );
+
+   {
+      test_ = "BiCGStab solver (without preconditioning)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, false );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      const blaze::IterativeSolverInfo info( bicgstab.solve( A, x, b ) );
+
+      checkResult( A, x, b, info, tolerance );
+   }
+
+   {
+      test_ = "BiCGStab solver (Jacobi preconditioner)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, false );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      const blaze::IterativeSolverInfo info(
+         bicgstab.solve( A, x, b, blaze::JacobiPreconditioner<Type>( A ) ) );
+
+      checkResult( A, x, b, info, tolerance );
+   }
+
+   {
+      test_ = "BiCGStab solver (ILU(0) preconditioner, initial guess)";
+
+      blaze::CompressedMatrix<Type,blaze::columnMajor> A;
+      initialize( A, false );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x( A.rows() );
+      randomize( b );
+      randomize( x );
+
+      const blaze::IterativeSolverInfo info(
+         bicgstab.solve( A, x, b, blaze::ILU0Preconditioner<Type>( A ) ) );
+
+      checkResult( A, x, b, info, tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the restarted generalized minimal residual solver (GMRESSolver).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the restarted generalized minimal residual solver for various
+// data types. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void IterativeSolverTest::testGMRES()
+{
+   const double tolerance( sizeof( blaze::UnderlyingBuiltin_t<Type> ) == 4UL ? 1E-5 : 1E-10 );
+
+   blaze::GMRESSolver<Type> gmres;
+   gmres.setTolerance( tolerance );
+
+   {
+      test_ = "GMRES solver (without preconditioning)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, false );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      const blaze::IterativeSolverInfo info( gmres.solve( A, x, b ) );
+
+      checkResult( A, x, b, info, tolerance );
+   }
+
+   {
+      test_ = "GMRES solver (ILU(0) preconditioner)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, false );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      const blaze::IterativeSolverInfo info(
+         gmres.solve( A, x, b, blaze::ILU0Preconditioner<Type>( A ) ) );
+
+      checkResult( A, x, b, info, tolerance );
+   }
+
+   {
+      test_ = "GMRES solver (restarts)";
+
+      blaze::CompressedMatrix<Type,blaze::columnMajor> A;
+      initialize( A, false );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      gmres.setRestart( 3UL );
+      const blaze::IterativeSolverInfo info(
+         gmres.solve( A, x, b, blaze::JacobiPreconditioner<Type>( A ) ) );
+
+      checkResult( A, x, b, info, tolerance );
+   }
+
+   {
+      test_ = "GMRES solver (invalid restart)";
+
+      try {
+         gmres.setRestart( 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting an invalid restart succeeded\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the minimal residual solver (MINRESSolver).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the minimal residual solver for various data types. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void IterativeSolverTest::testMINRES()
+{
+   const double tolerance( sizeof( blaze::UnderlyingBuiltin_t<Type> ) == 4UL ? 1E-5 : 1E-10 );
+
+   blaze::MINRESSolver<Type> minres;
+   minres.setTolerance( tolerance );
+
+   {
+      test_ = "MINRES solver (without preconditioning)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, true );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      const blaze::IterativeSolverInfo info( minres.solve( A, x, b ) );
+
+      checkResult( A, x, b, info, tolerance );
+   }
+
+   {
+      test_ = "MINRES solver (IC(0) preconditioner)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, true );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      const blaze::IterativeSolverInfo info(
+         minres.solve( A, x, b, blaze::IC0Preconditioner<Type>( A ) ) );
+
+      checkResult( A, x, b, info, tolerance );
+   }
+
+   {
+      test_ = "MINRES solver (indefinite system matrix)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, true );
+
+      for( size_t i=0UL; i<A.rows(); i+=2UL ) {
+         A(i,i) = -Type(8);
+      }
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      const blaze::IterativeSolverInfo info( minres.solve( A, x, b ) );
+
+      checkResult( A, x, b, info, tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the preconditioners of the iterative solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the error handling of the Jacobi, ILU(0), and IC(0)
+// preconditioners for various data types. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void IterativeSolverTest::testPreconditioners()
+{
+   {
+      test_ = "Jacobi preconditioner (zero diagonal element)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, false );
+
+      A.erase( 1UL, 1UL );
+
+      try {
+         blaze::JacobiPreconditioner<Type> jacobi( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of a preconditioner with zero diagonal element succeeded\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Zero diagonal element detected" ) {
+            throw;
+         }
+      }
+   }
+
+   {
+      test_ = "ILU(0) preconditioner (zero diagonal element)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, false );
+
+      A.erase( 0UL, 0UL );
+
+      try {
+         blaze::ILU0Preconditioner<Type> ilu( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of a preconditioner with zero diagonal element succeeded\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Incomplete decomposition of singular matrix failed" ) {
+            throw;
+         }
+      }
+   }
+
+   {
+      test_ = "IC(0) preconditioner (indefinite matrix)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, true );
+
+      A(3UL,3UL) = -Type(8);
+
+      try {
+         blaze::IC0Preconditioner<Type> ic( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of a preconditioner for an indefinite matrix succeeded\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Incomplete decomposition of indefinite matrix failed" ) {
+            throw;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a sparse test system matrix.
+//
+// \param A The sparse matrix to be initialized.
+// \param hermitian \a true for a Hermitian positive definite matrix, \a false for a general matrix.
+// \return void
+//
+// This function initializes the given sparse matrix with a randomized, diagonally dominant
+// five-point stencil on a two-dimensional grid.
+*/
+template< typename MT >
+void IterativeSolverTest::initialize( MT& A, bool hermitian )
+{
+   using Type = blaze::ElementType_t<MT>;
+
+   const size_t n( grid*grid );
+
+   A.reset();
+   A.resize( n, n, false );
+
+   for( size_t i=0UL; i<grid; ++i ) {
+      for( size_t j=0UL; j<grid; ++j )
+      {
+         const size_t k( i*grid + j );
+
+         A(k,k) = Type(8);
+
+         if( i+1UL < grid ) {
+            A(k,k+grid) = blaze::rand<Type>();
+            A(k+grid,k) = hermitian ? blaze::conj( A(k,k+grid) ) : blaze::rand<Type>();
+         }
+         if( j+1UL < grid ) {
+            A(k,k+1UL) = blaze::rand<Type>();
+            A(k+1UL,k) = hermitian ? blaze::conj( A(k,k+1UL) ) : blaze::rand<Type>();
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the solution of an iterative solver.
+//
+// \param A The system matrix.
+// \param x The computed solution.
+// \param b The right-hand side vector.
+// \param info The information returned by the solver.
+// \param tolerance The requested relative residual tolerance.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the solver reports convergence and that the true relative residual
+// of the computed solution meets the requested tolerance (up to a safety factor of 10, which
+// accounts for the deviation of the recursively updated residual from the true residual).
+*/
+template< typename MT     // Type of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void IterativeSolverTest::checkResult( const MT& A, const VT1& x, const VT2& b,
+                                       const blaze::IterativeSolverInfo& info, double tolerance )
+{
+   const double residual( blaze::real( blaze::norm( b - A * x ) ) /
+                          blaze::real( blaze::norm( b ) ) );
+
+   if( !info.converged || !( residual <= 10.0*tolerance ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving the LSE failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<MT> ).name() << "\n"
+          << "   Converged:\n"
+          << "     " << info.converged << "\n"
+          << "   Iterations:\n"
+          << "     " << info.iterations << "\n"
+          << "   Reported residual:\n"
+          << "     " << info.residual << "\n"
+          << "   True residual:\n"
+          << "     " << residual << "\n"
+          << "   Result (x):\n" << x << "\n"
+          << "   Right-hand side (b):\n" << b << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the iterative solvers.
+//
+// \return void
+*/
+void runTest()
+{
+   IterativeSolverTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the iterative solver test.
+*/
+#define RUN_LAPACK_ITERATIVESOLVER_TEST \
+   blazetest::mathtest::lapack::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lapack
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,556 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lapack/SparseSolverTest.h
+//  \brief Header file for the sparse direct solver test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_LAPACK_SPARSESOLVERTEST_H_
+#define _BLAZETEST_MATHTEST_LAPACK_SPARSESOLVERTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/SparseSolvers.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lapack {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the sparse direct solvers.
+//
+// This class represents a test suite for the supernodal sparse Cholesky and LU decompositions
+// of the Blaze library.
+*/
+class SparseSolverTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseSolverTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testLLH();
+   template< typename Type > void testLU();
+   template< typename Type > void testSolve();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT > void initialize( MT& A, bool hermitian );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   static constexpr size_t grid = 6UL;  //!< Number of grid points per dimension of the test systems.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the sparse Cholesky decomposition (SparseLLH).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the sparse Cholesky decomposition for various data types.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseSolverTest::testLLH()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major sparse Cholesky decomposition (single right-hand side)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, true );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      blaze::SparseLLH<Type> llh( A );
+      llh.solve( x, b );
+
+      if( ( A * x ) != b ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result (x):\n" << x << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   A * x:\n" << ( A * x ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major sparse Cholesky decomposition (multiple right-hand sides)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, true );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> B( A.rows(), 3UL ), X;
+      randomize( B );
+
+      blaze::SparseLLH<Type> llh( A );
+      llh.solve( X, B );
+
+      if( ( A * X ) != B ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result (X):\n" << X << "\n"
+             << "   Right-hand side (B):\n" << B << "\n"
+             << "   A * X:\n" << ( A * X ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major sparse Cholesky decomposition (refactorization)";
+
+      blaze::CompressedMatrix<Type,blaze::columnMajor> A;
+      initialize( A, true );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      blaze::SparseLLH<Type> llh;
+      llh.analyze( A );
+
+      for( size_t i=0UL; i<3UL; ++i )
+      {
+         initialize( A, true );
+         llh.factorize( A );
+         llh.solve( x, b );
+
+         if( ( A * x ) != b ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solving the LSE failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Refactorization:\n"
+                << "     " << i << "\n"
+                << "   Result (x):\n" << x << "\n"
+                << "   Right-hand side (b):\n" << b << "\n"
+                << "   A * x:\n" << ( A * x ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Column-major sparse Cholesky decomposition (non-positive-definite matrix)";
+
+      blaze::CompressedMatrix<Type,blaze::columnMajor> A;
+      initialize( A, true );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         A(i,i) = -Type(8);
+      }
+
+      try {
+         blaze::SparseLLH<Type> llh( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of a non-positive-definite matrix succeeded\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Decomposition of non-positive-definite matrix failed" ) {
+            throw;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse LU decomposition (SparseLU).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the sparse LU decomposition for various data types. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseSolverTest::testLU()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major sparse LU decomposition (single right-hand side)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, false );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      blaze::SparseLU<Type> lu( A );
+      lu.solve( x, b );
+
+      if( ( A * x ) != b ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result (x):\n" << x << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   A * x:\n" << ( A * x ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major sparse LU decomposition (refactorization)";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, false );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      blaze::SparseLU<Type> lu;
+      lu.analyze( A );
+
+      for( size_t i=0UL; i<3UL; ++i )
+      {
+         initialize( A, false );
+         lu.factorize( A );
+         lu.solve( x, b );
+
+         if( ( A * x ) != b ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solving the LSE failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Refactorization:\n"
+                << "     " << i << "\n"
+                << "   Result (x):\n" << x << "\n"
+                << "   Right-hand side (b):\n" << b << "\n"
+                << "   A * x:\n" << ( A * x ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major sparse LU decomposition (multiple right-hand sides)";
+
+      blaze::CompressedMatrix<Type,blaze::columnMajor> A;
+      initialize( A, false );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> B( A.rows(), 3UL ), X;
+      randomize( B );
+
+      blaze::SparseLU<Type> lu( A );
+      lu.solve( X, B );
+
+      if( ( A * X ) != B ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result (X):\n" << X << "\n"
+             << "   Right-hand side (B):\n" << B << "\n"
+             << "   A * X:\n" << ( A * X ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major sparse LU decomposition (non-matching sparsity pattern)";
+
+      blaze::CompressedMatrix<Type,blaze::columnMajor> A;
+      initialize( A, false );
+
+      blaze::SparseLU<Type> lu;
+      lu.analyze( A );
+
+      A(0UL,A.columns()-1UL) = Type(1);
+
+      try {
+         lu.factorize( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Factorization with non-matching sparsity pattern succeeded\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse linear system solver function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the solve() function for sparse system matrices for various
+// data types. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseSolverTest::testSolve()
+{
+   {
+      test_ = "Row-major sparse LSE";
+
+      blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+      initialize( A, false );
+
+      blaze::DynamicVector<Type,blaze::columnVector> b( A.rows() ), x;
+      randomize( b );
+
+      solve( A, x, b );
+
+      if( ( A * x ) != b ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result (x):\n" << x << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   A * x:\n" << ( A * x ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major sparse LSE (non-square system matrix)";
+
+      blaze::CompressedMatrix<Type,blaze::columnMajor> A( 4UL, 3UL );
+      blaze::DynamicVector<Type,blaze::columnVector> b( 4UL ), x;
+
+      try {
+         solve( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a LSE with non-square system matrix succeeded\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a sparse test system matrix.
+//
+// \param A The sparse matrix to be initialized.
+// \param hermitian \a true for a Hermitian positive definite matrix, \a false for a general matrix.
+// \return void
+//
+// This function initializes the given sparse matrix with a randomized, diagonally dominant
+// five-point stencil on a two-dimensional grid.
+*/
+template< typename MT >
+void SparseSolverTest::initialize( MT& A, bool hermitian )
+{
+   using Type = blaze::ElementType_t<MT>;
+
+   const size_t n( grid*grid );
+
+   A.reset();
+   A.resize( n, n, false );
+
+   for( size_t i=0UL; i<grid; ++i ) {
+      for( size_t j=0UL; j<grid; ++j )
+      {
+         const size_t k( i*grid + j );
+
+         A(k,k) = Type(8);
+
+         if( i+1UL < grid ) {
+            A(k,k+grid) = blaze::rand<Type>();
+            A(k+grid,k) = hermitian ? blaze::conj( A(k,k+grid) ) : blaze::rand<Type>();
+         }
+         if( j+1UL < grid ) {
+            A(k,k+1UL) = blaze::rand<Type>();
+            A(k+1UL,k) = hermitian ? blaze::conj( A(k,k+1UL) ) : blaze::rand<Type>();
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse direct solvers.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseSolverTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse direct solver test.
+*/
+#define RUN_LAPACK_SPARSESOLVER_TEST \
+   blazetest::mathtest::lapack::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lapack
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,276 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/batchmatrix/ClassTest.h
+//  \brief Header file for the BatchMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRICES_BATCHMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_BATCHMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/BatchMatrix.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/shims/Equal.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace batchmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the BatchMatrix class template.
+//
+// This class represents a test suite for the blaze::BatchMatrix class template and the batched
+// operations. It performs a series of both compile time as well as runtime tests. The results
+// of the batched operations are compared to the results of the corresponding StaticMatrix
+// operations.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testSetGet      ();
+   void testResize      ();
+   void testMult        ();
+   void testInvert      ();
+   void testLUSolve     ();
+   void testLLHSolve    ();
+   void testDet         ();
+
+   template< typename Type >
+   void checkSize( const Type& batch, size_t expectedSize ) const;
+
+   template< typename Type, size_t N >
+   void initialize( blaze::BatchMatrix<Type,N,N>& A, bool spd );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected, size_t index ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using BT  = blaze::BatchMatrix<double,3UL,3UL>;                 //!< Batch of 3x3 matrices.
+   using CBT = blaze::BatchMatrix<blaze::complex<double>,3UL,3UL>;  //!< Batch of complex 3x3 matrices.
+   using VT  = blaze::BatchVector<double,3UL>;                      //!< Batch of 3-dimensional vectors.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( BT::ResultType  );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE    ( CBT::ResultType );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( BT::ResultType  );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( CBT::ResultType );
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( BT::ElementType , BT::ResultType::ElementType  );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( CBT::ElementType, CBT::ResultType::ElementType );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the size of the given batch.
+//
+// \param batch The batch to be checked.
+// \param expectedSize The expected number of matrices of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of matrices of the given batch. In case the actual number
+// does not correspond to the given expected number, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the batch
+void ClassTest::checkSize( const Type& batch, size_t expectedSize ) const
+{
+   if( batch.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid batch size detected\n"
+          << " Details:\n"
+          << "   Size         : " << batch.size() << "\n"
+          << "   Expected size: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializing the given batch with random, well-conditioned matrices.
+//
+// \param A The batch to be initialized.
+// \param spd \a true to create Hermitian positive definite matrices, \a false otherwise.
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t N >     // Number of rows and columns
+void ClassTest::initialize( blaze::BatchMatrix<Type,N,N>& A, bool spd )
+{
+   blaze::StaticMatrix<Type,N,N> a;
+
+   for( size_t b=0UL; b<A.size(); ++b ) {
+      randomize( a );
+      for( size_t i=0UL; i<N; ++i ) {
+         a(i,i) += Type( 2*N );
+      }
+      if( spd ) A.set( b, a * ctrans( a ) );
+      else      A.set( b, a );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparing the result of a batched operation with the expected result.
+//
+// \param result The result of the batched operation.
+// \param expected The expected result.
+// \param index The index of the compared matrix within the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void ClassTest::checkResult( const T1& result, const T2& expected, size_t index ) const
+{
+   if( !blaze::equal( result, expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of batched operation detected\n"
+          << " Details:\n"
+          << "   Batch index: " << index << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the BatchMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the BatchMatrix class test.
+*/
+#define RUN_BATCHMATRIX_CLASS_TEST \
+   blazetest::mathtest::matrices::batchmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace batchmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
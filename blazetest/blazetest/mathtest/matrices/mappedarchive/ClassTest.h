@@ -0,0 +1,206 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/mappedarchive/ClassTest.h
+//  \brief Header file for the MappedArchive class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_MATRICES_MAPPEDARCHIVE_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_MAPPEDARCHIVE_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/constraints/Vector.h>
+#include <blaze/math/serialization/MappedArchive.h>
+#include <blaze/util/serialization/Archive.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace mappedarchive {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the MappedArchive class.
+//
+// This class represents a test suite for the blaze::MappedArchive class and the accompanying
+// serializeMapped() functions. It performs a series of runtime tests with dense vectors, dense
+// matrices and sparse matrices that are written to file and bound to custom vectors and matrices
+// via memory mapping.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~ClassTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDenseVectors   ();
+   void testDenseMatrices  ();
+   void testSparseMatrices ();
+   void testMultipleRecords();
+   void testFailures       ();
+
+   template< typename T1, typename T2 >
+   void compare( const T1& src, const T2& dst );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   std::string file_;  //!< The name of the temporary archive file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Comparison of a source vector/matrix and the bound destination vector/matrix.
+//
+// \param src The source vector/matrix.
+// \param dst The destination vector/matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a comparison between the given source and destination vector or
+// matrix. In case they are not equal, a \a std::runtime_error exception is thrown.
+*/
+template< typename T1    // Type of the source vector/matrix
+        , typename T2 >  // Type of the destination vector/matrix
+void ClassTest::compare( const T1& src, const T2& dst )
+{
+   if( src != dst ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Comparison failed\n"
+          << " Details:\n"
+          << "   Source type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Destination type:\n"
+          << "     " << typeid( T2 ).name() << "\n"
+          << "   Source:\n" << src << "\n"
+          << "   Destination:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the MappedArchive class.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the MappedArchive class test.
+*/
+#define RUN_MAPPEDARCHIVE_CLASS_TEST \
+   blazetest::mathtest::matrices::mappedarchive::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace mappedarchive
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,643 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrices/slicedellmatrix/ClassTest.h
+//  \brief Header file for the SlicedEllMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_MATRICES_SLICEDELLMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MATRICES_SLICEDELLMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/constraints/ColumnMajorMatrix.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SlicedEllMatrix.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace slicedellmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the SlicedEllMatrix class template.
+//
+// This class represents a test suite for the blaze::SlicedEllMatrix class template. It performs
+// a series of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testSorting     ();
+   void testFunctionCall();
+   void testIterator    ();
+   void testFind        ();
+   void testPartition   ();
+
+   template< typename Type >
+   void testMultiply();
+
+   template< typename Type >
+   void checkMultiply( const blaze::CompressedMatrix<Type,blaze::rowMajor>& matrix, size_t sigma );
+
+   template< typename Type >
+   void checkRows( const Type& matrix, size_t expectedRows ) const;
+
+   template< typename Type >
+   void checkColumns( const Type& matrix, size_t expectedColumns ) const;
+
+   template< typename Type >
+   void checkCapacity( const Type& matrix, size_t minCapacity ) const;
+
+   template< typename Type >
+   void checkCapacity( const Type& matrix, size_t index, size_t minCapacity ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using MT  = blaze::SlicedEllMatrix<int>;     //!< Type of the sliced ELLPACK matrix.
+   using RMT = MT::Rebind<double>::Other;       //!< Rebound sliced ELLPACK matrix type.
+   using CMT = blaze::CompressedMatrix<int>;    //!< Type of the reference compressed matrix.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT                 );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT::ResultType     );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT::OppositeType   );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT::TransposeType  );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( RMT                );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( RMT::ResultType    );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( RMT::OppositeType  );
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( RMT::TransposeType );
+
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE   ( MT                 );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE   ( MT::ResultType     );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( MT::OppositeType   );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( MT::TransposeType  );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE   ( RMT                );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE   ( RMT::ResultType    );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( RMT::OppositeType  );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( RMT::TransposeType );
+
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MT::ResultType     );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MT::OppositeType   );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MT::TransposeType  );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( RMT::ResultType    );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( RMT::OppositeType  );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( RMT::TransposeType );
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MT::ElementType,  MT::ResultType::ElementType     );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MT::ElementType,  MT::OppositeType::ElementType   );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MT::ElementType,  MT::TransposeType::ElementType  );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RMT::ElementType, RMT::ResultType::ElementType    );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RMT::ElementType, RMT::OppositeType::ElementType  );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( RMT::ElementType, RMT::TransposeType::ElementType );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllMatrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment, addition assignment, and subtraction
+// assignment of the multiplication of a SlicedEllMatrix with a dense vector for the given
+// element type. The tested matrices contain empty rows, rows of equal and of different length,
+// and a remainder slice that is not completely filled. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+void ClassTest::testMultiply()
+{
+   constexpr size_t C( blaze::SIMDTrait<Type>::size );
+
+   using RefType = blaze::CompressedMatrix<Type,blaze::rowMajor>;
+
+
+   //=====================================================================================
+   // Multiplication with empty matrices
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllMatrix/dense vector multiplication (0x0)";
+
+      checkMultiply( RefType(), C );
+   }
+
+   {
+      test_ = "SlicedEllMatrix/dense vector multiplication (without non-zero elements)";
+
+      checkMultiply( RefType( 3UL*C+5UL, 17UL ), C );
+      checkMultiply( RefType( 3UL*C+5UL, 17UL ), 256UL );
+   }
+
+
+   //=====================================================================================
+   // Multiplication with empty rows
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllMatrix/dense vector multiplication (empty rows)";
+
+      RefType ref( 4UL*C+3UL, 23UL );
+      blaze::randomize( ref, 4UL*( 4UL*C+3UL ), -10, 10 );
+
+      // Resetting every third row as well as the complete second slice
+      for( size_t i=0UL; i<ref.rows(); ++i ) {
+         if( i % 3UL == 0UL || ( i >= C && i < 2UL*C ) )
+            ref.reset( i );
+      }
+
+      checkMultiply( ref, C );
+      checkMultiply( ref, 2UL*C );
+      checkMultiply( ref, 256UL );
+   }
+
+
+   //=====================================================================================
+   // Multiplication with rows of equal length
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllMatrix/dense vector multiplication (rows of equal length)";
+
+      // Odd row lengths exercise the remainder of the unrolled loop over the columns of
+      // a slice, even row lengths are processed without remainder
+      for( size_t length=1UL; length<=6UL; ++length )
+      {
+         RefType ref( 2UL*C+1UL, 31UL );
+         ref.reserve( ref.rows()*length );
+
+         for( size_t i=0UL; i<ref.rows(); ++i ) {
+            for( size_t j=0UL; j<length; ++j ) {
+               ref.append( i, ( i%5UL ) + 5UL*j, blaze::rand<Type>( -10, 10 ) );
+            }
+            ref.finalize( i );
+         }
+
+         checkMultiply( ref, C );
+         checkMultiply( ref, 256UL );
+      }
+   }
+
+
+   //=====================================================================================
+   // Multiplication with rows of different length
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllMatrix/dense vector multiplication (rows of different length)";
+
+      for( size_t rows : { 1UL, C-1UL, C, C+1UL, 5UL*C+3UL } )
+      {
+         RefType ref( rows, 40UL );
+         blaze::randomize( ref, 6UL*rows, -10, 10 );
+
+         checkMultiply( ref, 1UL );
+         checkMultiply( ref, C );
+         checkMultiply( ref, 3UL*C );
+         checkMultiply( ref, 256UL );
+      }
+   }
+
+
+   //=====================================================================================
+   // Multiplication with large matrices
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllMatrix/dense vector multiplication (large matrix)";
+
+      RefType ref( 2000UL, 500UL );
+      blaze::randomize( ref, 12000UL, -10, 10 );
+
+      checkMultiply( ref, C );
+      checkMultiply( ref, 64UL );
+      checkMultiply( ref, 256UL );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the SlicedEllMatrix/dense vector multiplication for the given matrix.
+//
+// \param matrix The compressed matrix defining the sparsity pattern.
+// \param sigma The size of the sorting window of the sliced ELLPACK matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function converts the given compressed matrix into a SlicedEllMatrix with the given
+// sorting window and compares the assignment, addition assignment, and subtraction assignment
+// of its multiplication with a random dense vector to the results of the compressed matrix.
+// Since the SELL-C-sigma kernels add the products in a different order than the compressed
+// matrix, the non-zero elements are replaced by random integral values, which makes the results
+// exact for all element types. In case any result differs, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+void ClassTest::checkMultiply( const blaze::CompressedMatrix<Type,blaze::rowMajor>& matrix,
+                               size_t sigma )
+{
+   using VT = blaze::DynamicVector<Type,blaze::columnVector>;
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> ref( matrix );
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( auto element=ref.begin( i ); element!=ref.end( i ); ++element ) {
+         element->value() = Type( blaze::rand<int>( -10, 10 ) );
+      }
+   }
+
+   const blaze::SlicedEllMatrix<Type> mat( ref, sigma );
+
+   VT vec( ref.columns() );
+   for( size_t j=0UL; j<vec.size(); ++j ) {
+      vec[j] = Type( blaze::rand<int>( -10, 10 ) );
+   }
+
+   VT init( ref.rows() );
+   for( size_t i=0UL; i<init.size(); ++i ) {
+      init[i] = Type( blaze::rand<int>( -10, 10 ) );
+   }
+
+   for( size_t op=0UL; op<3UL; ++op )
+   {
+      VT res( init );
+      VT exp( init );
+      std::string operation;
+
+      if( op == 0UL ) {
+         operation = "Assignment";
+         res  = mat * vec;
+         exp  = ref * vec;
+      }
+      else if( op == 1UL ) {
+         operation = "Addition assignment";
+         res += mat * vec;
+         exp += ref * vec;
+      }
+      else {
+         operation = "Subtraction assignment";
+         res -= mat * vec;
+         exp -= ref * vec;
+      }
+
+      if( res != exp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << operation << " of the multiplication failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Matrix size: " << ref.rows() << "x" << ref.columns() << "\n"
+             << "   Sorting window: " << mat.sigma() << "\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << exp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedRows The expected number of rows of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of rows of the given matrix. In case the actual number of
+// rows does not correspond to the given expected number of rows, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkRows( const Type& matrix, size_t expectedRows ) const
+{
+   if( rows( matrix ) != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << rows( matrix ) << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedRows The expected number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of columns of the given matrix. In case the actual number of
+// columns does not correspond to the given expected number of columns, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkColumns( const Type& matrix, size_t expectedColumns ) const
+{
+   if( columns( matrix ) != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << columns( matrix ) << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the capacity of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param minCapacity The expected minimum capacity of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the capacity of the given matrix. In case the actual capacity is smaller
+// than the given expected minimum capacity, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkCapacity( const Type& matrix, size_t minCapacity ) const
+{
+   if( capacity( matrix ) < minCapacity ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Capacity                 : " << capacity( matrix ) << "\n"
+          << "   Expected minimum capacity: " << minCapacity << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the capacity of a specific row of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param index The row to be checked.
+// \param minCapacity The expected minimum capacity of the specified row.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the capacity of a specific row of the given matrix. In case the actual
+// capacity is smaller than the given expected minimum capacity, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkCapacity( const Type& matrix, size_t index, size_t minCapacity ) const
+{
+   if( capacity( matrix, index ) < minCapacity ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected in row " << index << "\n"
+          << " Details:\n"
+          << "   Capacity                 : " << capacity( matrix, index ) << "\n"
+          << "   Expected minimum capacity: " << minCapacity << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements of the given matrix. In case the
+// actual number of non-zero elements does not correspond to the given expected number,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const
+{
+   if( nonZeros( matrix ) != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << nonZeros( matrix ) << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( capacity( matrix ) < nonZeros( matrix ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Number of non-zeros: " << nonZeros( matrix ) << "\n"
+          << "   Capacity           : " << capacity( matrix ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements in a specific row of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param index The row to be checked.
+// \param expectedNonZeros The expected number of non-zero elements in the specified row.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements in the specified row of the given
+// matrix. In case the actual number of non-zero elements does not correspond to the given
+// expected number, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const
+{
+   if( nonZeros( matrix, index ) != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements in row " << index << "\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << nonZeros( matrix, index ) << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( capacity( matrix, index ) < nonZeros( matrix, index ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected in row " << index << "\n"
+          << " Details:\n"
+          << "   Number of non-zeros: " << nonZeros( matrix, index ) << "\n"
+          << "   Capacity           : " << capacity( matrix, index ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the SlicedEllMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SlicedEllMatrix class test.
+*/
+#define RUN_SLICEDELLMATRIX_CLASS_TEST \
+   blazetest::mathtest::matrices::slicedellmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace slicedellmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
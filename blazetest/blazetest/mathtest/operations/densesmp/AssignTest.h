@@ -0,0 +1,312 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/operations/densesmp/AssignTest.h
+//  \brief Header file for the dense SMP assignment test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_OPERATIONS_DENSESMP_ASSIGNTEST_H_
+#define _BLAZETEST_MATHTEST_OPERATIONS_DENSESMP_ASSIGNTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/SMP.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace operations {
+
+namespace densesmp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the dense SMP assignment test.
+//
+// This class represents a test suite for the tiled SMP assignments to dense matrices. The results
+// of the SMP assignment, addition assignment, subtraction assignment, and Schur product assignment
+// of operands above the SMP threshold are compared to the results of the serial evaluation. The
+// tests use numbers of threads with few factors and matrix sizes that are no multiples of the SIMD
+// size or the tile size, such that the tiles at the edges of the matrix are only partially filled.
+*/
+class AssignTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit AssignTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~AssignTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type, bool SO, bool TSO >
+   void testAssign( size_t M, size_t N );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T1, typename T2 >
+   void checkResult( const std::string& operation, const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;     //!< Label of the currently performed test.
+   size_t      threads_;  //!< The current number of threads.
+   size_t      initial_;  //!< The initial number of threads.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments of an \f$ M \times N \f$ dense matrix addition.
+//
+// \param M The number of rows of the operands.
+// \param N The number of columns of the operands.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP assignments of the addition of two dense matrices with storage
+// order \a SO to a padded dense matrix, to an unaligned and unpadded custom matrix, and (in
+// transposed form) to a dense matrix with storage order \a TSO. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type, bool SO, bool TSO >
+void AssignTest::testAssign( size_t M, size_t N )
+{
+   using blaze::unaligned;
+   using blaze::unpadded;
+
+   using MT  = blaze::DynamicMatrix<Type,SO>;
+   using TMT = blaze::DynamicMatrix<Type,TSO>;
+   using CMT = blaze::CustomMatrix<Type,unaligned,unpadded,TSO>;
+
+   std::ostringstream oss;
+   oss << "Dense SMP assignment (" << M << "x" << N << ", "
+       << ( SO ? "column-major" : "row-major" ) << " operands, "
+       << ( TSO ? "column-major" : "row-major" ) << " target)";
+   test_ = oss.str();
+
+   MT A( M, N ), B( M, N );
+   blaze::randomize( A );
+   blaze::randomize( B );
+
+   TMT init( M, N );
+   blaze::randomize( init );
+
+   // The memory of the custom matrix is offset by one element to enforce an unaligned target
+   std::unique_ptr<Type[]> memory( new Type[M*N+1UL] );
+
+   for( size_t threads : { 1UL, 2UL, 3UL, 6UL, 7UL, 14UL } )
+   {
+      blaze::setNumThreads( threads );
+      threads_ = blaze::getNumThreads();
+
+      {
+         TMT C( init ), R( init );
+         C = A + B;
+         R = blaze::serial( A + B );
+         checkResult( "C = A + B", C, R );
+         C += A + B;
+         R += blaze::serial( A + B );
+         checkResult( "C += A + B", C, R );
+         C -= A + B;
+         R -= blaze::serial( A + B );
+         checkResult( "C -= A + B", C, R );
+         C %= A + B;
+         R %= blaze::serial( A + B );
+         checkResult( "C %= A + B", C, R );
+      }
+
+      {
+         CMT C( memory.get()+1UL, M, N );
+         TMT R( init );
+         C = init;
+         C = A + B;
+         R = blaze::serial( A + B );
+         checkResult( "C = A + B (unaligned, unpadded)", C, R );
+         C += A + B;
+         R += blaze::serial( A + B );
+         checkResult( "C += A + B (unaligned, unpadded)", C, R );
+         C -= A + B;
+         R -= blaze::serial( A + B );
+         checkResult( "C -= A + B (unaligned, unpadded)", C, R );
+         C %= A + B;
+         R %= blaze::serial( A + B );
+         checkResult( "C %= A + B (unaligned, unpadded)", C, R );
+      }
+
+      {
+         TMT C( N, M ), R( N, M );
+         C = trans( A + B );
+         R = blaze::serial( trans( A + B ) );
+         checkResult( "C = trans( A + B )", C, R );
+         C += trans( A + B );
+         R += blaze::serial( trans( A + B ) );
+         checkResult( "C += trans( A + B )", C, R );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the equality of the SMP result and the serial result.
+//
+// \param operation The name of the tested operation.
+// \param result The result of the SMP assignment.
+// \param expected The result of the serial assignment.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1, typename T2 >
+void AssignTest::checkResult( const std::string& operation, const T1& result,
+                              const T2& expected ) const
+{
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j )
+      {
+         if( result(i,j) != expected(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: SMP result differs from the serial result\n"
+                << " Details:\n"
+                << "   Operation: " << operation << "\n"
+                << "   Result type:\n"
+                << "     " << typeid( T1 ).name() << "\n"
+                << "   Number of threads: " << threads_ << "\n"
+                << "   Element (" << i << "," << j << "): " << result(i,j) << "\n"
+                << "   Expected element: " << expected(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP assignments to dense matrices.
+//
+// \return void
+*/
+void runTest()
+{
+   AssignTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense SMP assignment test.
+*/
+#define RUN_DENSESMP_ASSIGN_TEST \
+   blazetest::mathtest::operations::densesmp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace densesmp
+
+} // namespace operations
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -147,6 +147,7 @@ void DenseTest::testGeneral( size_t N )
    using blaze::columnMajor;
    using blaze::rowVector;
    using blaze::solve;
+   using blaze::mixedSolve;
    using blaze::isDefault;
 
 
@@ -195,6 +196,47 @@ void DenseTest::testGeneral( size_t N )
       }
    }
 
+   {
+      test_ = "General LSE (single rhs, mixed precision)";
+
+      DynamicMatrix<Type> A( N, N );
+      DynamicVector<Type> b( N );
+
+      if( N != 0UL ) {
+         do {
+            randomize( A );
+         }
+         while( isDefault( det( A ) ) );
+
+         randomize( b );
+      }
+
+      const DynamicMatrix<Type,rowMajor>    A1( A );
+      const DynamicMatrix<Type,columnMajor> A2( A );
+
+      DynamicVector<Type> x1;
+      DynamicVector<Type> x2;
+
+      mixedSolve( A1, x1, b );
+      mixedSolve( A2, x2, b );
+
+      if( A*x1 != b || A*x2 != b || x1 != x2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   Row-major solution (x1):\n" << x1 << "\n"
+             << "   Column-major solution (x2):\n" << x2 << "\n"
+             << "   A * x1 =\n" << ( A * x1 ) << "\n"
+             << "   A * x2 =\n" << ( A * x2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
    {
       test_ = "General LSE (single rhs, automatic, transpose)";
 
@@ -657,6 +699,7 @@ void DenseTest::testSymmetric( size_t N )
    using blaze::rowMajor;
    using blaze::columnMajor;
    using blaze::solve;
+   using blaze::mixedSolve;
    using blaze::isDefault;
 
 
@@ -705,6 +748,48 @@ void DenseTest::testSymmetric( size_t N )
       }
    }
 
+   {
+      test_ = "Symmetric LSE (single rhs, mixed precision)";
+
+      SymmetricMatrix< DynamicMatrix<Type> > A( N );
+      DynamicVector<Type> b( N );
+
+      if( N != 0UL ) {
+         randomize( A );
+
+         for( size_t i=0UL; i<N; ++i ) {
+            A(i,i) = Type( 2UL*N );
+         }
+
+         randomize( b );
+      }
+
+      const SymmetricMatrix< DynamicMatrix<Type,rowMajor>    > A1( A );
+      const SymmetricMatrix< DynamicMatrix<Type,columnMajor> > A2( A );
+
+      DynamicVector<Type> x1;
+      DynamicVector<Type> x2;
+
+      mixedSolve( A1, x1, b );
+      mixedSolve( A2, x2, b );
+
+      if( A*x1 != b || A*x2 != b || x1 != x2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   Row-major solution (x1):\n" << x1 << "\n"
+             << "   Column-major solution (x2):\n" << x2 << "\n"
+             << "   A * x1 =\n" << ( A * x1 ) << "\n"
+             << "   A * x2 =\n" << ( A * x2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
    {
       test_ = "Symmetric LSE (single rhs, automatic, transpose)";
 
@@ -1079,6 +1164,7 @@ void DenseTest::testHermitian( size_t N )
    using blaze::rowMajor;
    using blaze::columnMajor;
    using blaze::solve;
+   using blaze::mixedSolve;
    using blaze::isDefault;
 
 
@@ -1127,6 +1213,48 @@ void DenseTest::testHermitian( size_t N )
       }
    }
 
+   {
+      test_ = "Hermitian LSE (single rhs, mixed precision)";
+
+      HermitianMatrix< DynamicMatrix<Type> > A( N );
+      DynamicVector<Type> b( N );
+
+      if( N != 0UL ) {
+         randomize( A );
+
+         for( size_t i=0UL; i<N; ++i ) {
+            A(i,i) = Type( 2UL*N );
+         }
+
+         randomize( b );
+      }
+
+      const HermitianMatrix< DynamicMatrix<Type,rowMajor>    > A1( A );
+      const HermitianMatrix< DynamicMatrix<Type,columnMajor> > A2( A );
+
+      DynamicVector<Type> x1;
+      DynamicVector<Type> x2;
+
+      mixedSolve( A1, x1, b );
+      mixedSolve( A2, x2, b );
+
+      if( A*x1 != b || A*x2 != b || x1 != x2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   System matrix (A):\n" << A << "\n"
+             << "   Right-hand side (b):\n" << b << "\n"
+             << "   Row-major solution (x1):\n" << x1 << "\n"
+             << "   Column-major solution (x2):\n" << x2 << "\n"
+             << "   A * x1 =\n" << ( A * x1 ) << "\n"
+             << "   A * x2 =\n" << ( A * x2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
    {
       test_ = "Hermitian LSE (single rhs, automatic, transpose)";
 
@@ -141,7 +141,7 @@ class DenseTest
 template< typename Type >
 void DenseTest::testRandom()
 {
-#if BLAZETEST_MATHTEST_LAPACK_MODE
+#if BLAZETEST_MATHTEST_DECOMPOSITION_MODE
 
    test_ = "LU decomposition";
 
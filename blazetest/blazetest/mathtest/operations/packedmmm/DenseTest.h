@@ -0,0 +1,613 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/operations/packedmmm/DenseTest.h
+//  \brief Header file for the packed dense matrix multiplication test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_OPERATIONS_PACKEDMMM_DENSETEST_H_
+#define _BLAZETEST_MATHTEST_OPERATIONS_PACKEDMMM_DENSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/dense/GEBP.h>
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace operations {
+
+namespace packedmmm {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the packed dense matrix multiplication test.
+//
+// This class represents a test suite for the packed dense matrix multiplication kernels and for
+// the \c mmm(), \c lmmm(), and \c ummm() compute kernels built on top of them. The matrix sizes
+// are derived from the cache blocking of the packed kernels, such that all three dimensions
+// span several cache blocks and end in partially filled micro-tiles. All operands are filled
+// with small integral values, which is why the results are exact and can be compared to a
+// naive reference implementation element by element.
+*/
+class DenseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testKernels();
+
+   template< typename Type, bool SO, bool OSO1, bool OSO2 >
+   void testGeneral( size_t M, size_t N, size_t K );
+
+   template< typename Type, bool SO, bool OSO >
+   void testTriangular( size_t N );
+
+   template< typename Type >
+   void testScaling();
+
+   template< typename Type, bool SO >
+   void testScaling( size_t M, size_t N );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static void initialize( Type& value );
+
+   template< typename Type >
+   static void initialize( blaze::complex<Type>& value );
+
+   template< typename MT >
+   static void initialize( MT& A, bool lower, bool upper );
+
+   template< typename MT1, typename MT2 >
+   static blaze::DynamicMatrix< blaze::ElementType_t<MT1> >
+      multiply( const MT1& A, const MT2& B );
+
+   template< typename T1, typename T2, typename T3, typename ST >
+   void checkResult( const std::string& operation, const T1& result, const T2& product,
+                     const T3& init, ST alpha, ST beta, bool lower, bool upper ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the matrix multiplication kernels for a single element type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function runs the tests for all combinations of storage orders. The matrix sizes are
+// chosen such that the vectorized dimension of the target matrix exceeds the \a NC block size,
+// the other dimension exceeds twice the \a MC block size, and the inner dimension exceeds three
+// times the \a KC block size. For element types that are not handled by the packed kernels
+// (as for instance complex numbers) the same sizes are used to test the fallback kernels.
+*/
+template< typename Type >
+void DenseTest::testKernels()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   using Blocking = blaze::GEBPBlocking< blaze::UnderlyingBuiltin_t<Type> >;
+
+   const size_t vd( Blocking::NC + Blocking::NR + 5UL );
+   const size_t bd( 2UL*Blocking::MC + 7UL );
+   const size_t kd( 3UL*Blocking::KC + 5UL );
+   const size_t sd( blaze::max( Blocking::NC, 2UL*Blocking::MC ) + 7UL );
+
+   testGeneral<Type,rowMajor   ,rowMajor   ,rowMajor   >( bd, vd, kd );
+   testGeneral<Type,rowMajor   ,rowMajor   ,columnMajor>( bd, vd, kd );
+   testGeneral<Type,rowMajor   ,columnMajor,rowMajor   >( bd, vd, kd );
+   testGeneral<Type,rowMajor   ,columnMajor,columnMajor>( bd, vd, kd );
+   testGeneral<Type,columnMajor,rowMajor   ,rowMajor   >( vd, bd, kd );
+   testGeneral<Type,columnMajor,rowMajor   ,columnMajor>( vd, bd, kd );
+   testGeneral<Type,columnMajor,columnMajor,rowMajor   >( vd, bd, kd );
+   testGeneral<Type,columnMajor,columnMajor,columnMajor>( vd, bd, kd );
+
+   testTriangular<Type,rowMajor   ,rowMajor   >( sd );
+   testTriangular<Type,rowMajor   ,columnMajor>( sd );
+   testTriangular<Type,columnMajor,rowMajor   >( sd );
+   testTriangular<Type,columnMajor,columnMajor>( sd );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of two general dense matrices.
+//
+// \param M The number of rows of the target matrix.
+// \param N The number of columns of the target matrix.
+// \param K The inner dimension of the multiplication.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment, addition assignment, and subtraction assignment of plain
+// and scaled dense matrix multiplications, which map to the \c mmm() kernel with the scaling
+// factors \f$ (\alpha,\beta) \f$ set to \f$ (1,0) \f$, \f$ (2,0) \f$, \f$ (1,1) \f$, and
+// \f$ (-2,1) \f$. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type, bool SO, bool OSO1, bool OSO2 >
+void DenseTest::testGeneral( size_t M, size_t N, size_t K )
+{
+   using MT = blaze::DynamicMatrix<Type,SO>;
+
+   std::ostringstream oss;
+   oss << "Packed dense matrix multiplication (" << M << "x" << K << " times " << K << "x" << N
+       << ", " << ( SO ? "column-major" : "row-major" ) << " target, "
+       << ( OSO1 ? "column-major" : "row-major" ) << " left-hand side operand, "
+       << ( OSO2 ? "column-major" : "row-major" ) << " right-hand side operand)";
+   test_ = oss.str();
+
+   blaze::DynamicMatrix<Type,OSO1> A( M, K );
+   blaze::DynamicMatrix<Type,OSO2> B( K, N );
+   MT init( M, N );
+
+   initialize( A, true, true );
+   initialize( B, true, true );
+   initialize( init, true, true );
+
+   const auto P( multiply( A, B ) );
+
+   MT C( init );
+   C = A * B;
+   checkResult( "C = A * B", C, P, init, Type(1), Type(0), true, true );
+
+   C = init;
+   C = Type(2) * ( A * B );
+   checkResult( "C = 2 * ( A * B )", C, P, init, Type(2), Type(0), true, true );
+
+   C = init;
+   C += A * B;
+   checkResult( "C += A * B", C, P, init, Type(1), Type(1), true, true );
+
+   C = init;
+   C -= Type(2) * ( A * B );
+   checkResult( "C -= 2 * ( A * B )", C, P, init, Type(-2), Type(1), true, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of triangular dense matrices.
+//
+// \param N The number of rows and columns of the matrices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of lower and upper operands, whose zero blocks are
+// skipped by the packed kernels, and the lower and upper multiplications declared via the
+// \c decllow() and \c declupp() functions, which map to the \c lmmm() and \c ummm() kernels.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type, bool SO, bool OSO >
+void DenseTest::testTriangular( size_t N )
+{
+   using MT = blaze::DynamicMatrix<Type,SO>;
+
+   std::ostringstream oss;
+   oss << "Packed triangular dense matrix multiplication (" << N << "x" << N << ", "
+       << ( SO ? "column-major" : "row-major" ) << " target, "
+       << ( OSO ? "column-major" : "row-major" ) << " operands)";
+   test_ = oss.str();
+
+   blaze::LowerMatrix< blaze::DynamicMatrix<Type,OSO> > L1( N ), L2( N );
+   blaze::UpperMatrix< blaze::DynamicMatrix<Type,OSO> > U1( N ), U2( N );
+   blaze::DynamicMatrix<Type,OSO> A( N, N ), B( N, N );
+   MT init( N, N );
+
+   initialize( L1, true, false );
+   initialize( L2, true, false );
+   initialize( U1, false, true );
+   initialize( U2, false, true );
+   initialize( A, true, true );
+   initialize( B, true, true );
+   initialize( init, true, true );
+
+   MT C( init );
+
+   {
+      const auto P( multiply( L1, A ) );
+      C = L1 * A;
+      checkResult( "C = L * A", C, P, init, Type(1), Type(0), true, true );
+   }
+
+   {
+      const auto P( multiply( A, U1 ) );
+      C = init;
+      C += A * U1;
+      checkResult( "C += A * U", C, P, init, Type(1), Type(1), true, true );
+   }
+
+   {
+      const auto P( multiply( U1, L1 ) );
+      C = init;
+      C -= Type(2) * ( U1 * L1 );
+      checkResult( "C -= 2 * ( U * L )", C, P, init, Type(-2), Type(1), true, true );
+   }
+
+   {
+      const auto P( multiply( L1, L2 ) );
+      C = L1 * L2;
+      checkResult( "C = L1 * L2", C, P, init, Type(1), Type(0), true, true );
+   }
+
+   {
+      const auto P( multiply( A, B ) );
+      C = init;
+      C = decllow( A * B );
+      checkResult( "C = decllow( A * B )", C, P, init, Type(1), Type(0), true, false );
+
+      C = init;
+      C += declupp( A * B );
+      checkResult( "C += declupp( A * B )", C, P, init, Type(1), Type(1), false, true );
+
+      C = init;
+      C -= Type(2) * decllow( A * B );
+      checkResult( "C -= 2 * decllow( A * B )", C, P, init, Type(-2), Type(1), true, false );
+   }
+
+   {
+      const auto P( multiply( U1, U2 ) );
+      C = init;
+      C = Type(2) * declupp( U1 * U2 );
+      checkResult( "C = 2 * declupp( U1 * U2 )", C, P, init, Type(2), Type(0), false, true );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication kernels with arbitrary scaling factors for a single element type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function runs the tests of the directly called multiplication kernels for both storage
+// orders, with matrix sizes derived from the cache blocking of the packed kernels. Since the
+// kernels require SIMD combinable element types, the test is restricted to \c float and
+// \c double.
+*/
+template< typename Type >
+void DenseTest::testScaling()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   using Blocking = blaze::GEBPBlocking<Type>;
+
+   const size_t vd( Blocking::NC + Blocking::NR + 5UL );
+   const size_t bd( 2UL*Blocking::MC + 7UL );
+
+   testScaling<Type,rowMajor   >( bd, vd );
+   testScaling<Type,columnMajor>( vd, bd );
+   testScaling<Type,rowMajor   >( vd, vd );
+   testScaling<Type,columnMajor>( vd, vd );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication kernels with arbitrary scaling factors.
+//
+// \param M The number of rows of the target matrix.
+// \param N The number of columns of the target matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function calls the \c mmm(), \c lmmm(), and \c ummm() kernels directly, since scaling
+// factors \f$ \beta \f$ other than 0 and 1 cannot be expressed via the assignment operators.
+// The inner dimension of the multiplication is \a N and the operands have the storage order
+// of the target matrix \a C. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type, bool SO >
+void DenseTest::testScaling( size_t M, size_t N )
+{
+   using MT = blaze::DynamicMatrix<Type,SO>;
+
+   std::ostringstream oss;
+   oss << "Scaled packed dense matrix multiplication (" << M << "x" << N << " times "
+       << N << "x" << N << ", " << ( SO ? "column-major" : "row-major" ) << " matrices)";
+   test_ = oss.str();
+
+   MT A( M, N ), B( N, N ), init( M, N );
+   blaze::LowerMatrix<MT> L( N );
+
+   initialize( A, true, true );
+   initialize( B, true, true );
+   initialize( L, true, false );
+   initialize( init, true, true );
+
+   {
+      const auto P( multiply( A, B ) );
+      MT C( init );
+      blaze::mmm( C, A, B, Type(-2), Type(3) );
+      checkResult( "mmm( C, A, B, -2, 3 )", C, P, init, Type(-2), Type(3), true, true );
+   }
+
+   {
+      const auto P( multiply( A, L ) );
+      MT C( init );
+      blaze::mmm( C, A, L, Type(2), Type(-1) );
+      checkResult( "mmm( C, A, L, 2, -1 )", C, P, init, Type(2), Type(-1), true, true );
+   }
+
+   if( M == N )
+   {
+      const auto P( multiply( B, A ) );
+      MT C( init );
+      blaze::lmmm( C, B, A, Type(-2), Type(3) );
+      checkResult( "lmmm( C, B, A, -2, 3 )", C, P, init, Type(-2), Type(3), true, false );
+
+      C = init;
+      blaze::ummm( C, B, A, Type(2), Type(-1) );
+      checkResult( "ummm( C, B, A, 2, -1 )", C, P, init, Type(2), Type(-1), false, true );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a single value with a small random integral number.
+//
+// \param value The value to be initialized.
+// \return void
+*/
+template< typename Type >
+void DenseTest::initialize( Type& value )
+{
+   value = Type( blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of a single complex value with small random integral numbers.
+//
+// \param value The value to be initialized.
+// \return void
+*/
+template< typename Type >
+void DenseTest::initialize( blaze::complex<Type>& value )
+{
+   value = blaze::complex<Type>( blaze::rand<int>( -5, 5 ), blaze::rand<int>( -5, 5 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the lower and/or upper part of the given dense matrix.
+//
+// \param A The matrix to be initialized.
+// \param lower \a true in case the strictly lower part is initialized, \a false if not.
+// \param upper \a true in case the strictly upper part is initialized, \a false if not.
+// \return void
+*/
+template< typename MT >
+void DenseTest::initialize( MT& A, bool lower, bool upper )
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( ( i > j && !lower ) || ( i < j && !upper ) ) continue;
+         blaze::ElementType_t<MT> value{};
+         initialize( value );
+         A(i,j) = value;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Naive reference implementation of a dense matrix/dense matrix multiplication.
+//
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \return The product of the two matrices.
+*/
+template< typename MT1, typename MT2 >
+blaze::DynamicMatrix< blaze::ElementType_t<MT1> >
+   DenseTest::multiply( const MT1& A, const MT2& B )
+{
+   using ET = blaze::ElementType_t<MT1>;
+
+   blaze::DynamicMatrix<ET> C( A.rows(), B.columns() );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<B.columns(); ++j ) {
+         ET sum{};
+         for( size_t k=0UL; k<A.columns(); ++k ) {
+            sum += A(i,k) * B(k,j);
+         }
+         C(i,j) = sum;
+      }
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a dense matrix multiplication kernel.
+//
+// \param operation The name of the tested operation.
+// \param result The result of the multiplication kernel.
+// \param product The reference product of the two operands.
+// \param init The initial value of the target matrix.
+// \param alpha The scaling factor for the product.
+// \param beta The scaling factor for the initial value of the target matrix.
+// \param lower \a true in case the product contributes to the strictly lower part, \a false if not.
+// \param upper \a true in case the product contributes to the strictly upper part, \a false if not.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1, typename T2, typename T3, typename ST >
+void DenseTest::checkResult( const std::string& operation, const T1& result, const T2& product,
+                             const T3& init, ST alpha, ST beta, bool lower, bool upper ) const
+{
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j )
+      {
+         const bool computed( i == j || ( i > j && lower ) || ( i < j && upper ) );
+         const ST expected( ( beta == ST(0) ? ST(0) : beta * init(i,j) ) +
+                            ( computed ? alpha * product(i,j) : ST(0) ) );
+
+         if( result(i,j) != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Incorrect multiplication result detected\n"
+                << " Details:\n"
+                << "   Operation: " << operation << "\n"
+                << "   Element type:\n"
+                << "     " << typeid( ST ).name() << "\n"
+                << "   alpha = " << alpha << ", beta = " << beta << "\n"
+                << "   Element (" << i << "," << j << "): " << result(i,j) << "\n"
+                << "   Expected element: " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the packed dense matrix multiplication kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the packed dense matrix multiplication test.
+*/
+#define RUN_PACKEDMMM_DENSE_TEST \
+   blazetest::mathtest::operations::packedmmm::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace packedmmm
+
+} // namespace operations
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
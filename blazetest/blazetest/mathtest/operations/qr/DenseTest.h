@@ -140,7 +140,7 @@ class DenseTest
 template< typename Type >
 void DenseTest::testRandom()
 {
-#if BLAZETEST_MATHTEST_LAPACK_MODE
+#if BLAZETEST_MATHTEST_DECOMPOSITION_MODE
 
    test_ = "QR decomposition";
 
@@ -0,0 +1,456 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/operations/reproducible/DenseTest.h
+//  \brief Header file for the reproducible dense reduction test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_OPERATIONS_REPRODUCIBLE_DENSETEST_H_
+#define _BLAZETEST_MATHTEST_OPERATIONS_REPRODUCIBLE_DENSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/dense/ReproducibleReduction.h>
+#include <blaze/math/functors/SqrAbs.h>
+#include <blaze/math/functors/Sqrt.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+#if !BLAZE_USE_REPRODUCIBLE_REDUCTIONS
+#  error "The reproducible reduction test requires BLAZE_USE_REPRODUCIBLE_REDUCTIONS=1"
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace operations {
+
+namespace reproducible {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the reproducible dense reduction test.
+//
+// This class represents a test suite for the reproducible reductions of dense vectors and
+// matrices (see the \c BLAZE_USE_REPRODUCIBLE_REDUCTIONS switch). The results of the total
+// reductions, the norms, and the inner product are compared bit for bit to a scalar reference
+// implementation of the documented fixed evaluation order for several numbers of threads. Since
+// the reference does not depend on the SIMD width, this also guarantees identical results for
+// all instruction sets.
+*/
+class DenseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~DenseTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testVector( size_t N );
+   template< typename Type > void testMatrix( size_t M, size_t N );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type > static void initialize( Type& value );
+   template< typename Type > static Type reference( const std::vector<Type>& values );
+
+   template< typename Type >
+   void checkResult( const std::string& operation, const Type& result, const Type& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;     //!< Label of the currently performed test.
+   size_t      threads_;  //!< The current number of threads.
+   size_t      initial_;  //!< The initial number of threads.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the reproducible reductions of a random dense vector.
+//
+// \param N The size of the dense vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sum, the L1 norm, the L2 norm, the squared L2 norm, and the inner
+// product of random dense vectors of size \a N for several numbers of threads. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseTest::testVector( size_t N )
+{
+   using blaze::columnVector;
+
+   using Real = blaze::UnderlyingBuiltin_t<Type>;
+   using Sqr  = blaze::RemoveCVRef_t< decltype( blaze::SqrAbs()( std::declval<Type>() ) ) >;
+   using Norm = blaze::RemoveCVRef_t< decltype( blaze::Sqrt()( std::declval<Sqr>() ) ) >;
+
+   test_ = "Reproducible dense vector reductions";
+
+   blaze::DynamicVector<Type,columnVector> a( N ), b( N );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      initialize( a[i] );
+      initialize( b[i] );
+   }
+
+   std::vector<Type> values( N ), products( N );
+   std::vector<Real> magnitudes( N );
+   std::vector<Sqr>  squares( N );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      values[i]     = a[i];
+      products[i]   = a[i] * b[i];
+      magnitudes[i] = blaze::abs( a[i] );
+      squares[i]    = blaze::SqrAbs()( a[i] );
+   }
+
+   const Type sumRef( reference( values ) );
+   const Type dotRef( reference( products ) );
+   const Real l1Ref ( reference( magnitudes ) );
+   const Sqr  sqrRef( reference( squares ) );
+   const Norm l2Ref ( blaze::Sqrt()( sqrRef ) );
+
+   for( size_t threads : { 1UL, 2UL, 3UL, 4UL, 7UL } )
+   {
+      blaze::setNumThreads( threads );
+      threads_ = blaze::getNumThreads();
+
+      checkResult( "sum()"     , Type( sum( a ) )                 , sumRef );
+      checkResult( "reduce()"  , Type( reduce( a, blaze::Add() ) ), sumRef );
+      checkResult( "l1Norm()"  , Real( l1Norm( a ) )              , l1Ref  );
+      checkResult( "sqrNorm()" , Sqr ( sqrNorm( a ) )             , sqrRef );
+      checkResult( "norm()"    , Norm( norm( a ) )                , l2Ref  );
+      checkResult( "trans(a)*b", Type( trans( a ) * b )           , dotRef );
+      checkResult( "dot()"     , Type( dot( a, b ) )              , dotRef );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reproducible reductions of a random dense matrix.
+//
+// \param M The number of rows of the dense matrix.
+// \param N The number of columns of the dense matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the total sum, the L1 norm, the L2 norm, and the squared L2 norm of a
+// random row-major and column-major \f$ M \times N \f$ dense matrix for several numbers of
+// threads. The rows (row-major) or columns (column-major) are reduced individually and combined
+// in order. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseTest::testMatrix( size_t M, size_t N )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   using Real = blaze::UnderlyingBuiltin_t<Type>;
+   using Sqr  = blaze::RemoveCVRef_t< decltype( blaze::SqrAbs()( std::declval<Type>() ) ) >;
+   using Norm = blaze::RemoveCVRef_t< decltype( blaze::Sqrt()( std::declval<Sqr>() ) ) >;
+
+   test_ = "Reproducible dense matrix reductions";
+
+   blaze::DynamicMatrix<Type,rowMajor> A( M, N );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         initialize( A(i,j) );
+      }
+   }
+
+   const blaze::DynamicMatrix<Type,columnMajor> B( A );
+
+   // Computing the reference results for the row-wise (row-major) and column-wise (column-major)
+   // order of evaluation
+   Type sumRef[2] = {};
+   Real l1Ref [2] = {};
+   Sqr  sqrRef[2] = {};
+
+   for( size_t so=0UL; so<2UL; ++so )
+   {
+      const size_t outer( so ? N : M );
+      const size_t inner( so ? M : N );
+
+      for( size_t k=0UL; k<outer; ++k )
+      {
+         std::vector<Type> values( inner );
+         std::vector<Real> magnitudes( inner );
+         std::vector<Sqr>  squares( inner );
+
+         for( size_t l=0UL; l<inner; ++l ) {
+            values[l]     = so ? A(l,k) : A(k,l);
+            magnitudes[l] = blaze::abs( values[l] );
+            squares[l]    = blaze::SqrAbs()( values[l] );
+         }
+
+         if( k == 0UL ) {
+            sumRef[so] = reference( values );
+            l1Ref [so] = reference( magnitudes );
+            sqrRef[so] = reference( squares );
+         }
+         else {
+            sumRef[so] += reference( values );
+            l1Ref [so] += reference( magnitudes );
+            sqrRef[so] += reference( squares );
+         }
+      }
+   }
+
+   for( size_t threads : { 1UL, 2UL, 3UL, 4UL, 7UL } )
+   {
+      blaze::setNumThreads( threads );
+      threads_ = blaze::getNumThreads();
+
+      checkResult( "sum() (row-major)"       , Type( sum( A ) )                 , sumRef[0] );
+      checkResult( "reduce() (row-major)"    , Type( reduce( A, blaze::Add() ) ), sumRef[0] );
+      checkResult( "l1Norm() (row-major)"    , Real( l1Norm( A ) )              , l1Ref[0]  );
+      checkResult( "sqrNorm() (row-major)"   , Sqr ( sqrNorm( A ) )             , sqrRef[0] );
+      checkResult( "norm() (row-major)"      , Norm( norm( A ) )                , Norm( blaze::Sqrt()( sqrRef[0] ) ) );
+
+      checkResult( "sum() (column-major)"    , Type( sum( B ) )                 , sumRef[1] );
+      checkResult( "reduce() (column-major)" , Type( reduce( B, blaze::Add() ) ), sumRef[1] );
+      checkResult( "l1Norm() (column-major)" , Real( l1Norm( B ) )              , l1Ref[1]  );
+      checkResult( "sqrNorm() (column-major)", Sqr ( sqrNorm( B ) )             , sqrRef[1] );
+      checkResult( "norm() (column-major)"   , Norm( norm( B ) )                , Norm( blaze::Sqrt()( sqrRef[1] ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of a single value with a random number of random magnitude.
+//
+// \param value The value to be initialized.
+// \return void
+//
+// The magnitudes of the values vary over several orders of magnitude, such that the result of
+// the reduction depends on the order of evaluation in the last bits.
+*/
+template< typename Type >
+void DenseTest::initialize( Type& value )
+{
+   using Real = blaze::UnderlyingBuiltin_t<Type>;
+
+   blaze::randomize( value );
+   value *= Real( std::pow( 2.0, blaze::rand<int>( -12, 12 ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scalar reference implementation of the reproducible summation.
+//
+// \param values The values to be summed up.
+// \return The sum of all values.
+//
+// This function sums up the given values in the fixed order of the reproducible reduction
+// kernels: The values are split into blocks of \c reproducibleBlockSize elements. Within each
+// block the values are distributed cyclically among \c reproducibleLanes virtual lanes, which
+// are combined by means of a binary tree. The results of the blocks are added in order.
+*/
+template< typename Type >
+Type DenseTest::reference( const std::vector<Type>& values )
+{
+   constexpr size_t lanes    ( blaze::reproducibleLanes<Type> );
+   constexpr size_t blockSize( blaze::reproducibleBlockSize );
+
+   const size_t N( values.size() );
+
+   Type result{};
+
+   for( size_t begin=0UL; begin<N; begin+=blockSize )
+   {
+      const size_t end  ( std::min( begin+blockSize, N ) );
+      const size_t count( std::min( end-begin, lanes ) );
+
+      std::vector<Type> partial( values.begin()+begin, values.begin()+begin+count );
+
+      for( size_t i=begin+count; i<end; ++i ) {
+         partial[(i-begin)%lanes] += values[i];
+      }
+
+      size_t width( 1UL );
+      while( width < count ) {
+         width *= 2UL;
+      }
+
+      for( width/=2UL; width>0UL; width/=2UL ) {
+         for( size_t k=0UL; k<width && k+width<count; ++k ) {
+            partial[k] += partial[k+width];
+         }
+      }
+
+      result = ( begin == 0UL ) ? partial[0] : result + partial[0];
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the bitwise equality of the given result and the expected result.
+//
+// \param operation The name of the tested operation.
+// \param result The result of the operation.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >
+void DenseTest::checkResult( const std::string& operation, const Type& result,
+                             const Type& expected ) const
+{
+   if( std::memcmp( &result, &expected, sizeof( Type ) ) != 0 ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test: " << test_ << "\n"
+          << " Error: Result is not bitwise identical to the reference\n"
+          << " Details:\n"
+          << "   Operation: " << operation << "\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Number of threads: " << threads_ << "\n"
+          << "   Result: " << result << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the reproducible reductions of dense vectors and matrices.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the reproducible dense reduction test.
+*/
+#define RUN_REPRODUCIBLE_DENSE_TEST \
+   blazetest::mathtest::operations::reproducible::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace reproducible
+
+} // namespace operations
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
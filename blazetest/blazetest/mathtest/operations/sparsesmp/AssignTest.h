@@ -0,0 +1,298 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/operations/sparsesmp/AssignTest.h
+//  \brief Header file for the sparse SMP assignment test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_OPERATIONS_SPARSESMP_ASSIGNTEST_H_
+#define _BLAZETEST_MATHTEST_OPERATIONS_SPARSESMP_ASSIGNTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace operations {
+
+namespace sparsesmp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the sparse SMP assignment test.
+//
+// This class represents a test suite for the SMP assignments to sparse matrices and vectors. The
+// results of the plain and compound SMP assignments of operands above the SMP thresholds are
+// compared to the results of the serial evaluation for several numbers of threads. Since the
+// compound assignment operators of compressed matrices and vectors evaluate serially, the SMP
+// compound assignment kernels are called directly.
+*/
+class AssignTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit AssignTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~AssignTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO > void testMatrix();
+                       void testVector();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T1, typename T2 >
+   void checkResult( const std::string& operation, const T1& result, const T2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;     //!< Label of the currently performed test.
+   size_t      threads_;  //!< The current number of threads.
+   size_t      initial_;  //!< The initial number of threads.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments to a sparse matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP assignment, addition assignment, subtraction assignment, and
+// Schur product assignment to a row-major (\a SO = \a false) or column-major (\a SO = \a true)
+// compressed matrix. The operands are row-major, i.e. a row-major target is evaluated by the
+// parallel sparse matrix multiplication, whereas a column-major target is evaluated block-wise.
+// The assignment of a transposition expression additionally tests the transfer of the result
+// to a target other than a compressed matrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< bool SO >
+void AssignTest::testMatrix()
+{
+   using blaze::rowMajor;
+
+   using MT  = blaze::CompressedMatrix<int,rowMajor>;
+   using DMT = blaze::DynamicMatrix<int,rowMajor>;
+   using TMT = blaze::CompressedMatrix<int,SO>;
+
+   test_ = ( SO ? "Column-major sparse matrix SMP assignment" : "Row-major sparse matrix SMP assignment" );
+
+   // Operands above the SMP thresholds of the sparse matrix/sparse matrix multiplication and
+   // the dense matrix/dense matrix addition
+   MT A( 210UL, 170UL ), B( 170UL, 190UL );
+   blaze::randomize( A, 3000UL, -5, 5 );
+   blaze::randomize( B, 3000UL, -5, 5 );
+
+   DMT X( 210UL, 190UL ), Y( 210UL, 190UL );
+   blaze::randomize( X, -5, 5 );
+   blaze::randomize( Y, -5, 5 );
+
+   TMT init( 210UL, 190UL );
+   blaze::randomize( init, 4000UL, -5, 5 );
+
+   for( size_t threads : { 1UL, 2UL, 3UL, 4UL, 7UL } )
+   {
+      blaze::setNumThreads( threads );
+      threads_ = blaze::getNumThreads();
+
+      {
+         TMT C, R;
+         C = A * B;
+         R = blaze::serial( A * B );
+         checkResult( "C = A * B", C, R );
+      }
+
+      {
+         TMT C, R;
+         C = trans( A * B );
+         R = blaze::serial( trans( A * B ) );
+         checkResult( "C = trans( A * B )", C, R );
+      }
+
+      {
+         TMT C( init ), R( init );
+         blaze::smpAddAssign( C, A * B );
+         R += blaze::serial( A * B );
+         checkResult( "C += A * B", C, R );
+      }
+
+      {
+         TMT C( init ), R( init );
+         blaze::smpSubAssign( C, A * B );
+         R -= blaze::serial( A * B );
+         checkResult( "C -= A * B", C, R );
+      }
+
+      {
+         TMT C( init ), R( init );
+         blaze::smpSchurAssign( C, X + Y );
+         R %= blaze::serial( X + Y );
+         checkResult( "C %= X + Y", C, R );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the equality of the SMP result and the serial result.
+//
+// \param operation The name of the tested operation.
+// \param result The result of the SMP assignment.
+// \param expected The result of the serial assignment.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1, typename T2 >
+void AssignTest::checkResult( const std::string& operation, const T1& result,
+                              const T2& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: SMP result differs from the serial result\n"
+          << " Details:\n"
+          << "   Operation: " << operation << "\n"
+          << "   Result type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Number of threads: " << threads_ << "\n"
+          << "   Non-zero elements of the SMP result: " << nonZeros( result ) << "\n"
+          << "   Non-zero elements of the serial result: " << nonZeros( expected ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP assignments to sparse matrices and vectors.
+//
+// \return void
+*/
+void runTest()
+{
+   AssignTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse SMP assignment test.
+*/
+#define RUN_SPARSESMP_ASSIGN_TEST \
+   blazetest::mathtest::operations::sparsesmp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace sparsesmp
+
+} // namespace operations
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
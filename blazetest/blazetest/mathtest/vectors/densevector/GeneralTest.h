@@ -119,6 +119,7 @@ class GeneralTest
    void testLogspace();
    void testUniform();
    void testZero();
+   void testFuse();
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
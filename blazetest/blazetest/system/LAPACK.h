@@ -36,6 +36,13 @@
 #define _BLAZETEST_SYSTEM_LAPACK_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/BLAS.h>
+
+
 //=================================================================================================
 //
 //  LAPACK MODE CONFIGURATION
@@ -75,4 +82,18 @@
 #define BLAZETEST_MATHTEST_LAPACK_SUPPORTS_GESVDX 0
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the LU, Cholesky, and QR decomposition tests.
+// \ingroup system
+//
+// This compilation switch enables/disables the tests of the LU, Cholesky, and QR decompositions.
+// The tests are included in case the LAPACK mode of the math tests is enabled or in case the
+// LAPACK mode of the Blaze library is disabled (i.e. in case the native blocked decompositions
+// of the Blaze library are used).
+*/
+#define BLAZETEST_MATHTEST_DECOMPOSITION_MODE \
+   ( BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_LAPACK_MODE )
+//*************************************************************************************************
+
 #endif
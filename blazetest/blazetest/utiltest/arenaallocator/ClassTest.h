@@ -0,0 +1,225 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/arenaallocator/ClassTest.h
+//  \brief Header file for the ArenaAllocator test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_ARENAALLOCATOR_CLASSTEST_H_
+#define _BLAZETEST_UTILTEST_ARENAALLOCATOR_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Arena.h>
+#include <blaze/util/ArenaAllocator.h>
+#include <blaze/util/Workspace.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace arenaallocator {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the ArenaAllocator class template.
+//
+// This class represents the collection of tests for the ArenaAllocator class template and the
+// Workspace class.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Private class Aligned64*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief 64-byte aligned helper class.
+   */
+   struct Aligned64
+   {
+      blaze::AlignedArray<int,16UL,64UL> array_;
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class Aligned128********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief 128-byte aligned helper class.
+   */
+   struct Aligned128
+   {
+      blaze::AlignedArray<int,16UL,128UL> array_;
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename T > void testAllocation();
+                          void testRecycling();
+                          void testWorkspace();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void checkCached( size_t expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the allocation/deallocation for a specific data type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs an allocation/deallocation of aligned memory for the given type \a T.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >
+void ClassTest::testAllocation()
+{
+   for( size_t numObjects : { 1UL, 7UL, 64UL, 1000UL } )
+   {
+      blaze::ArenaAllocator<T> allocator;
+      T* const ptr = allocator.allocate( numObjects );
+
+      if( !blaze::checkAlignment( ptr ) ) {
+         std::ostringstream oss;
+         oss << " Test: Allocation test for type '" << typeid( T ).name() << "'\n"
+             << " Error: Invalid alignment detected\n"
+             << " Details:\n"
+             << "   Number of objects  = " << numObjects << "\n"
+             << "   Expected alignment = " << blaze::AlignmentOf<T>::value << "-bit\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      allocator.deallocate( ptr, numObjects );
+   }
+
+   blaze::Arena::release();
+}
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the ArenaAllocator class template.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the ArenaAllocator class test.
+*/
+#define RUN_ARENAALLOCATOR_CLASS_TEST \
+   blazetest::utiltest::arenaallocator::runTest();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace arenaallocator
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
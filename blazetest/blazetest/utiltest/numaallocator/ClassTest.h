@@ -0,0 +1,213 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/numaallocator/ClassTest.h
+//  \brief Header file for the NumaAllocator test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_NUMAALLOCATOR_CLASSTEST_H_
+#define _BLAZETEST_UTILTEST_NUMAALLOCATOR_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/AlignedArray.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/AllocationPolicy.h>
+#include <blaze/util/NumaAllocator.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace numaallocator {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the NumaAllocator class template.
+//
+// This class represents the collection of tests for the NumaAllocator class template and the
+// global allocation policy.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Private class Aligned64*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief 64-byte aligned helper class.
+   */
+   struct Aligned64
+   {
+      blaze::AlignedArray<int,16UL,64UL> array_;
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename T, blaze::PagePolicy PP, blaze::PlacementPolicy NP >
+   void testAllocation();
+
+   void testGlobalPolicy();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the allocation/deallocation for a specific data type and allocation policy.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs an allocation/deallocation of small and large memory blocks for the
+// given type \a T and the given allocation policy. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T, blaze::PagePolicy PP, blaze::PlacementPolicy NP >
+void ClassTest::testAllocation()
+{
+   test_ = "Allocation test";
+
+   const size_t largeObjects( blaze::largeAllocationThreshold / sizeof(T) + 3UL );
+
+   for( size_t numObjects : { 1UL, 64UL, largeObjects } )
+   {
+      blaze::NumaAllocator<T,PP,NP> allocator;
+      T* const ptr = allocator.allocate( numObjects );
+
+      if( !blaze::checkAlignment( ptr ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << " for type '" << typeid( T ).name() << "'\n"
+             << " Error: Invalid alignment detected\n"
+             << " Details:\n"
+             << "   Number of objects  = " << numObjects << "\n"
+             << "   Expected alignment = " << blaze::AlignmentOf<T>::value << "-bit\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Writing to the first and last byte of the memory block
+      reinterpret_cast<unsigned char*>( ptr )[0] = 1U;
+      reinterpret_cast<unsigned char*>( ptr )[numObjects*sizeof(T)-1UL] = 1U;
+
+      allocator.deallocate( ptr, numObjects );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the NumaAllocator class template.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the NumaAllocator class test.
+*/
+#define RUN_NUMAALLOCATOR_CLASS_TEST \
+   blazetest::utiltest::numaallocator::runTest();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace numaallocator
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
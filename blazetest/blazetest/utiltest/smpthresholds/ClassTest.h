@@ -0,0 +1,220 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/smpthresholds/ClassTest.h
+//  \brief Header file for the runtime SMP threshold test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_SMPTHRESHOLDS_CLASSTEST_H_
+#define _BLAZETEST_UTILTEST_SMPTHRESHOLDS_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/Thresholds.h>
+
+#if !BLAZE_USE_RUNTIME_SMP_THRESHOLDS
+#  error "The runtime SMP threshold test requires BLAZE_USE_RUNTIME_SMP_THRESHOLDS=1"
+#endif
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace smpthresholds {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the runtime SMP thresholds.
+//
+// This class represents the collection of tests for the runtime configuration of the SMP
+// thresholds, i.e. the getSMPThreshold(), setSMPThreshold(), resetSMPThresholds(),
+// loadSMPThresholds(), and saveSMPThresholds() functions and the \c BLAZE_SMP_THRESHOLDS
+// environment variable.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~ClassTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testAccess();
+   void testCanSMPAssign();
+   void testRoundTrip();
+   void testComments();
+   void testMalformed();
+   void testEnvironment();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void writeFile( const std::string& content ) const;
+   void checkThreshold( const std::string& name, size_t expected ) const;
+   void checkDefaults() const;
+   template< typename Exception > void checkLoadFailure( const std::string& content );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   std::string file_;  //!< Name of the temporary tuning file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking that loading the given tuning file fails with the given exception.
+//
+// \param content The content of the tuning file.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes the given content to the temporary tuning file and checks that the
+// loadSMPThresholds() function throws an exception of type \a Exception. In case no or a
+// different exception is thrown, a \a std::runtime_error exception is thrown.
+*/
+template< typename Exception >
+void ClassTest::checkLoadFailure( const std::string& content )
+{
+   writeFile( content );
+
+   try {
+      blaze::loadSMPThresholds( file_ );
+   }
+   catch( Exception& ) {
+      return;
+   }
+   catch( std::exception& ex ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unexpected exception for invalid tuning file\n"
+          << " Details:\n"
+          << "   Tuning file:\n" << content << "\n"
+          << "   Exception: " << ex.what() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::ostringstream oss;
+   oss << " Test: " << test_ << "\n"
+       << " Error: Loading invalid tuning file succeeded\n"
+       << " Details:\n"
+       << "   Tuning file:\n" << content << "\n";
+   throw std::runtime_error( oss.str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the runtime configuration of the SMP thresholds.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the runtime SMP threshold test.
+*/
+#define RUN_SMPTHRESHOLDS_CLASS_TEST \
+   blazetest::utiltest::smpthresholds::runTest();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smpthresholds
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,654 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/threadpool/ClassTest.h
+//  \brief Header file for the thread pool class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_THREADPOOL_CLASSTEST_H_
+#define _BLAZETEST_UTILTEST_THREADPOOL_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <sched.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <blaze/util/SpinWait.h>
+#include <blaze/util/ThreadAffinity.h>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/WorkStealingThreadPool.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the ThreadPool and WorkStealingThreadPool class templates.
+//
+// This class represents the collection of tests for the ThreadPool and WorkStealingThreadPool
+// class templates.
+*/
+template< typename PT >  // Type of the thread pool
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest( const std::string& name );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSchedule  ();
+   void testScheduleOn();
+   void testResize    ();
+   void testClear     ();
+   void testAffinity  ();
+   void testSpinning  ();
+
+   void checkSize ( const PT& pool, size_t expectedSize ) const;
+   void checkCount( size_t expectedCount ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static void increment( std::atomic<size_t>& counter, size_t value );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string name_;             //!< Name of the tested thread pool.
+   std::string test_;             //!< Label of the currently performed test.
+   std::atomic<size_t> counter_;  //!< Counter incremented by the scheduled tasks.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the thread pool class test.
+//
+// \param name The name of the tested thread pool.
+// \exception std::runtime_error Operation error detected.
+*/
+template< typename PT >  // Type of the thread pool
+ClassTest<PT>::ClassTest( const std::string& name )
+   : name_   ( name )  // Name of the tested thread pool
+   , test_   ()        // Label of the currently performed test
+   , counter_( 0UL )   // Counter incremented by the scheduled tasks
+{
+   testSchedule();
+   testScheduleOn();
+   testResize();
+   testClear();
+   testAffinity();
+   testSpinning();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the schedule() and wait() functions of the thread pool.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename PT >  // Type of the thread pool
+void ClassTest<PT>::testSchedule()
+{
+   {
+      test_ = name_ + " scheduling of a single task";
+
+      counter_ = 0UL;
+
+      PT pool( 3UL );
+      checkSize( pool, 3UL );
+
+      pool.schedule( increment, std::ref( counter_ ), 5UL );
+      pool.wait();
+
+      checkCount( 5UL );
+
+      if( !pool.isEmpty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-empty thread pool detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = name_ + " scheduling of many tasks";
+
+      counter_ = 0UL;
+
+      PT pool( 4UL );
+
+      for( size_t i=1UL; i<=1000UL; ++i ) {
+         pool.schedule( increment, std::ref( counter_ ), i );
+      }
+      pool.wait();
+
+      checkCount( 500500UL );
+   }
+
+   {
+      test_ = name_ + " repeated scheduling of tasks";
+
+      counter_ = 0UL;
+
+      PT pool( 2UL );
+
+      for( size_t rep=0UL; rep<100UL; ++rep ) {
+         for( size_t i=0UL; i<7UL; ++i ) {
+            pool.schedule( [this]() { ++counter_; } );
+         }
+         pool.wait();
+         checkCount( 7UL*(rep+1UL) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks to specific threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the scheduleOn() function of the thread pool. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename PT >  // Type of the thread pool
+void ClassTest<PT>::testScheduleOn()
+{
+   {
+      test_ = name_ + "::scheduleOn()";
+
+      counter_ = 0UL;
+
+      PT pool( 3UL );
+
+      for( size_t rep=0UL; rep<100UL; ++rep ) {
+         for( size_t i=0UL; i<10UL; ++i ) {
+            pool.scheduleOn( i, increment, std::ref( counter_ ), i );
+         }
+         pool.wait();
+         checkCount( 45UL*(rep+1UL) );
+      }
+   }
+
+   {
+      test_ = name_ + "::scheduleOn() (single thread index)";
+
+      counter_ = 0UL;
+
+      PT pool( 4UL );
+
+      for( size_t i=1UL; i<=1000UL; ++i ) {
+         pool.scheduleOn( 2UL, increment, std::ref( counter_ ), i );
+      }
+      pool.wait();
+
+      checkCount( 500500UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() function of the thread pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() function of the thread pool. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename PT >  // Type of the thread pool
+void ClassTest<PT>::testResize()
+{
+   {
+      test_ = name_ + "::resize()";
+
+      counter_ = 0UL;
+
+      PT pool( 1UL );
+      checkSize( pool, 1UL );
+
+      pool.resize( 5UL, true );
+      checkSize( pool, 5UL );
+
+      for( size_t i=0UL; i<100UL; ++i ) {
+         pool.schedule( increment, std::ref( counter_ ), 1UL );
+      }
+
+      pool.resize( 2UL, true );
+      checkSize( pool, 2UL );
+
+      for( size_t i=0UL; i<100UL; ++i ) {
+         pool.schedule( increment, std::ref( counter_ ), 1UL );
+      }
+
+      pool.wait();
+
+      checkCount( 200UL );
+   }
+
+   {
+      test_ = name_ + "::resize() (invalid size)";
+
+      PT pool( 1UL );
+
+      try {
+         pool.resize( 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing to zero threads succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the clear() function of the thread pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the clear() function of the thread pool. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename PT >  // Type of the thread pool
+void ClassTest<PT>::testClear()
+{
+   {
+      test_ = name_ + "::clear()";
+
+      counter_ = 0UL;
+
+      PT pool( 2UL );
+
+      for( size_t i=0UL; i<1000UL; ++i ) {
+         pool.schedule( increment, std::ref( counter_ ), 1UL );
+      }
+
+      pool.clear();
+      pool.wait();
+
+      if( !pool.isEmpty() || counter_ > 1000UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Clearing the thread pool failed\n"
+             << " Details:\n"
+             << "   Number of executed tasks: " << counter_ << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*!\brief Test of the thread affinity of the thread pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the pinning of the threads of the thread pool via the
+// setThreadAffinity() function. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename PT >  // Type of the thread pool
+void ClassTest<PT>::testAffinity()
+{
+   {
+      test_ = name_ + " thread affinity";
+
+      const std::vector<size_t> available( blaze::getAvailableCores() );
+
+      for( const std::string affinity : { "compact", "scatter", "0" } )
+      {
+         blaze::setThreadAffinity( affinity );
+
+         const std::vector<size_t> cores( blaze::getThreadAffinity() );
+
+         if( cores.empty() || cores.size() > available.size() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << " (" << affinity << ")\n"
+                << " Error: Invalid thread affinity detected\n"
+                << " Details:\n"
+                << "   Number of cores          : " << cores.size() << "\n"
+                << "   Number of available cores: " << available.size() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+#if defined(__linux__)
+         std::atomic<size_t> misplaced( 0UL );
+
+         PT pool( 3UL );
+
+         for( size_t i=0UL; i<30UL; ++i ) {
+            pool.scheduleOn( i, [&cores,&misplaced]() {
+               const int cpu( sched_getcpu() );
+               if( cpu >= 0 && std::count( cores.begin(), cores.end(), size_t( cpu ) ) == 0 )
+                  ++misplaced;
+            } );
+         }
+         pool.wait();
+
+         if( misplaced > 0UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << " (" << affinity << ")\n"
+                << " Error: Task executed on a core outside of the thread affinity\n"
+                << " Details:\n"
+                << "   Number of misplaced tasks: " << misplaced << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+#endif
+      }
+
+      blaze::setThreadAffinity( "none" );
+
+      if( !blaze::getThreadAffinity().empty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resetting the thread affinity failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = name_ + " thread affinity (invalid specification)";
+
+      for( const std::string affinity : { "0-", "a", "1,,2", "3-1" } )
+      {
+         try {
+            blaze::setThreadAffinity( affinity );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Setting an invalid thread affinity succeeded\n"
+                << " Details:\n"
+                << "   Thread affinity: " << affinity << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*!\brief Test of the spinning of idle and waiting threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the scheduling of tasks in case idle threads and threads
+// waiting for the completion of all tasks spin before they block (see the setSpinBudget()
+// function). In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename PT >  // Type of the thread pool
+void ClassTest<PT>::testSpinning()
+{
+   {
+      test_ = name_ + " scheduling of tasks with spinning threads";
+
+      const size_t budget( blaze::getSpinBudget() );
+
+      blaze::setSpinBudget( 50UL );
+
+      if( blaze::getSpinBudget() != 50UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting the spin budget failed\n"
+             << " Details:\n"
+             << "   Spin budget         : " << blaze::getSpinBudget() << "\n"
+             << "   Expected spin budget: 50\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      counter_ = 0UL;
+
+      PT pool( 3UL );
+
+      for( size_t rep=0UL; rep<1000UL; ++rep ) {
+         for( size_t i=0UL; i<3UL; ++i ) {
+            pool.scheduleOn( i, increment, std::ref( counter_ ), 1UL );
+         }
+         pool.wait();
+         checkCount( 3UL*(rep+1UL) );
+      }
+
+      blaze::setSpinBudget( budget );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the size of the given thread pool.
+//
+// \param pool The thread pool to be checked.
+// \param expectedSize The expected number of threads in the thread pool.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the size of the given thread pool. In case the actual size does not
+// correspond to the given expected size, a \a std::runtime_error exception is thrown.
+*/
+template< typename PT >  // Type of the thread pool
+void ClassTest<PT>::checkSize( const PT& pool, size_t expectedSize ) const
+{
+   if( pool.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size detected\n"
+          << " Details:\n"
+          << "   Size         : " << pool.size() << "\n"
+          << "   Expected size: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the value of the task counter.
+//
+// \param expectedCount The expected value of the task counter.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the value of the counter incremented by the scheduled tasks. In case
+// the actual value does not correspond to the given expected value, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename PT >  // Type of the thread pool
+void ClassTest<PT>::checkCount( size_t expectedCount ) const
+{
+   if( counter_ != expectedCount ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid count detected\n"
+          << " Details:\n"
+          << "   Count         : " << counter_ << "\n"
+          << "   Expected count: " << expectedCount << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Incrementing the given counter by the given value.
+//
+// \param counter The counter to be incremented.
+// \param value The value to be added to the counter.
+// \return void
+*/
+template< typename PT >  // Type of the thread pool
+void ClassTest<PT>::increment( std::atomic<size_t>& counter, size_t value )
+{
+   counter += value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the ThreadPool and WorkStealingThreadPool class templates.
+//
+// \return void
+*/
+inline void runTest()
+{
+   using StdThreadPool = blaze::ThreadPool< std::thread
+                                          , std::mutex
+                                          , std::unique_lock<std::mutex>
+                                          , std::condition_variable >;
+
+   using StdWorkStealingThreadPool = blaze::WorkStealingThreadPool< std::thread
+                                                                  , std::mutex
+                                                                  , std::unique_lock<std::mutex>
+                                                                  , std::condition_variable >;
+
+   ClassTest<StdThreadPool>( "ThreadPool" );
+   ClassTest<StdWorkStealingThreadPool>( "WorkStealingThreadPool" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the thread pool class test.
+*/
+#define RUN_THREADPOOL_CLASS_TEST \
+   blazetest::utiltest::threadpool::runTest();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,681 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/batchmatrix/ClassTest.cpp
+//  \brief Source file for the BatchMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/batchmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace batchmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BatchMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testSetGet();
+   testResize();
+   testMult();
+   testInvert();
+   testLUSolve();
+   testLLHSolve();
+   testDet();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BatchMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BatchMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   {
+      test_ = "BatchMatrix default constructor";
+
+      BT batch;
+
+      checkSize( batch, 0UL );
+   }
+
+   {
+      test_ = "BatchMatrix size constructor";
+
+      BT batch( 7UL );
+
+      checkSize( batch, 7UL );
+
+      for( size_t b=0UL; b<batch.size(); ++b ) {
+         checkResult( batch.get( b ), BT::ResultType(), b );
+      }
+   }
+
+   {
+      test_ = "BatchMatrix homogeneous initialization";
+
+      BT batch( 7UL, 2.0 );
+
+      checkSize( batch, 7UL );
+
+      for( size_t b=0UL; b<batch.size(); ++b ) {
+         checkResult( batch.get( b ), BT::ResultType( 2.0 ), b );
+      }
+   }
+
+   {
+      test_ = "BatchMatrix copy constructor";
+
+      BT batch1( 5UL );
+      initialize( batch1, false );
+
+      BT batch2( batch1 );
+
+      checkSize( batch2, 5UL );
+
+      for( size_t b=0UL; b<batch2.size(); ++b ) {
+         checkResult( batch2.get( b ), batch1.get( b ), b );
+      }
+   }
+
+   {
+      test_ = "BatchMatrix move constructor";
+
+      BT batch1( 5UL );
+      initialize( batch1, false );
+      const BT batch2( batch1 );
+
+      BT batch3( std::move( batch1 ) );
+
+      checkSize( batch3, 5UL );
+
+      for( size_t b=0UL; b<batch3.size(); ++b ) {
+         checkResult( batch3.get( b ), batch2.get( b ), b );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BatchMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the assignment operators of the BatchMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "BatchMatrix copy assignment";
+
+      BT batch1( 9UL );
+      initialize( batch1, false );
+
+      BT batch2( 2UL );
+      batch2 = batch1;
+
+      checkSize( batch2, 9UL );
+
+      for( size_t b=0UL; b<batch2.size(); ++b ) {
+         checkResult( batch2.get( b ), batch1.get( b ), b );
+      }
+   }
+
+   {
+      test_ = "BatchMatrix move assignment";
+
+      BT batch1( 9UL );
+      initialize( batch1, false );
+      const BT batch2( batch1 );
+
+      BT batch3( 2UL );
+      batch3 = std::move( batch1 );
+
+      checkSize( batch3, 9UL );
+
+      for( size_t b=0UL; b<batch3.size(); ++b ) {
+         checkResult( batch3.get( b ), batch2.get( b ), b );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the set() and get() member functions and the element access of BatchMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the set() and get() member functions and of the element
+// access of the BatchMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSetGet()
+{
+   {
+      test_ = "BatchMatrix::set() and BatchMatrix::get()";
+
+      BT batch( 11UL );
+      blaze::StaticMatrix<double,3UL,3UL,blaze::columnMajor> a;
+
+      for( size_t b=0UL; b<batch.size(); ++b ) {
+         randomize( a );
+         batch.set( b, a );
+         checkResult( batch.get( b ), a, b );
+
+         for( size_t i=0UL; i<3UL; ++i ) {
+            for( size_t j=0UL; j<3UL; ++j ) {
+               if( batch(b,i,j) != a(i,j) || batch.at(b,i,j) != a(i,j) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Invalid element access\n"
+                      << " Details:\n"
+                      << "   Batch index: " << b << "\n"
+                      << "   Element    : (" << i << "," << j << ")\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "BatchMatrix::set() with invalid index";
+
+      BT batch( 3UL );
+
+      try {
+         batch.set( 3UL, BT::ResultType() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a matrix beyond the end of the batch succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+
+   {
+      test_ = "BatchMatrix::set() with non-matching matrix";
+
+      BT batch( 3UL );
+
+      try {
+         batch.set( 0UL, blaze::DynamicMatrix<double>( 2UL, 3UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a non-matching matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() member function of BatchMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() member function of the BatchMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "BatchMatrix::resize()";
+
+   BT batch( 5UL );
+   initialize( batch, false );
+   const BT copy( batch );
+
+   batch.resize( 13UL );
+
+   checkSize( batch, 13UL );
+
+   for( size_t b=0UL; b<5UL; ++b ) {
+      checkResult( batch.get( b ), copy.get( b ), b );
+   }
+
+   batch.resize( 3UL );
+
+   checkSize( batch, 3UL );
+
+   for( size_t b=0UL; b<3UL; ++b ) {
+      checkResult( batch.get( b ), copy.get( b ), b );
+   }
+
+   batch.resize( 0UL );
+
+   checkSize( batch, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batchMult() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched matrix multiplication. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMult()
+{
+   {
+      test_ = "batchMult() with 3x3 matrices";
+
+      BT A( 1003UL ), B( 1003UL ), C;
+      initialize( A, false );
+      initialize( B, false );
+
+      blaze::batchMult( C, A, B );
+
+      checkSize( C, 1003UL );
+
+      for( size_t b=0UL; b<C.size(); ++b ) {
+         checkResult( C.get( b ), A.get( b ) * B.get( b ), b );
+      }
+   }
+
+   {
+      test_ = "batchMult() with 3x3 matrices and 3-dimensional vectors";
+
+      BT A( 1003UL );
+      VT x( 1003UL ), y;
+      initialize( A, false );
+
+      for( size_t b=0UL; b<x.size(); ++b ) {
+         x.set( b, blaze::rand< blaze::StaticMatrix<double,3UL,1UL> >() );
+      }
+
+      blaze::batchMult( y, A, x );
+
+      for( size_t b=0UL; b<y.size(); ++b ) {
+         checkResult( y.get( b ), A.get( b ) * x.get( b ), b );
+      }
+   }
+
+   {
+      test_ = "Aliased batchMult() with complex 3x3 matrices";
+
+      CBT A( 1003UL ), B( 1003UL );
+      initialize( A, false );
+      initialize( B, false );
+      const CBT C( A );
+
+      blaze::batchMult( A, A, B );
+
+      for( size_t b=0UL; b<A.size(); ++b ) {
+         checkResult( A.get( b ), C.get( b ) * B.get( b ), b );
+      }
+   }
+
+   {
+      test_ = "batchMult() with non-matching batch sizes";
+
+      BT A( 3UL ), B( 4UL ), C;
+
+      try {
+         blaze::batchMult( C, A, B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplying batches of different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batchInvert() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched matrix inversion. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInvert()
+{
+   {
+      test_ = "batchInvert() with 3x3 matrices";
+
+      BT A( 1003UL );
+      initialize( A, false );
+      const BT B( A );
+
+      blaze::batchInvert( A );
+
+      for( size_t b=0UL; b<A.size(); ++b ) {
+         checkResult( A.get( b ), inv( B.get( b ) ), b );
+      }
+   }
+
+   {
+      test_ = "batchInvert() with complex 3x3 matrices";
+
+      CBT A( 1003UL );
+      initialize( A, false );
+      const CBT B( A );
+
+      blaze::batchInvert( A );
+
+      for( size_t b=0UL; b<A.size(); ++b ) {
+         checkResult( A.get( b ), inv( B.get( b ) ), b );
+      }
+   }
+
+   {
+      test_ = "batchInvert() with a singular matrix";
+
+      BT A( 17UL );
+      initialize( A, false );
+      A.set( 13UL, BT::ResultType( 1.0 ) );
+
+      try {
+         blaze::batchInvert( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Inversion of singular matrix failed" ) {
+            throw;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batchLUSolve() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched solution of linear systems via LU decomposition.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLUSolve()
+{
+   {
+      test_ = "batchLUSolve() with 3x3 matrices";
+
+      BT A( 1003UL ), X( 1003UL );
+      initialize( A, false );
+      initialize( X, false );
+      const BT B( X );
+
+      blaze::batchLUSolve( A, X );
+
+      for( size_t b=0UL; b<X.size(); ++b ) {
+         checkResult( X.get( b ), inv( A.get( b ) ) * B.get( b ), b );
+      }
+   }
+
+   {
+      test_ = "batchLUSolve() with complex 3x3 matrices";
+
+      CBT A( 1003UL ), X( 1003UL );
+      initialize( A, false );
+      initialize( X, false );
+      const CBT B( X );
+
+      blaze::batchLUSolve( A, X );
+
+      for( size_t b=0UL; b<X.size(); ++b ) {
+         checkResult( X.get( b ), inv( A.get( b ) ) * B.get( b ), b );
+      }
+   }
+
+   {
+      test_ = "batchLUSolve() with a singular system matrix";
+
+      BT A( 17UL );
+      VT x( 17UL, 1.0 );
+      initialize( A, false );
+      A.set( 5UL, BT::ResultType() );
+
+      try {
+         blaze::batchLUSolve( A, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE with singular system matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Solving LSE with singular system matrix failed" ) {
+            throw;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batchLLHSolve() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched solution of positive definite linear systems
+// via Cholesky decomposition. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testLLHSolve()
+{
+   {
+      test_ = "batchLLHSolve() with 3x3 matrices";
+
+      BT A( 1003UL ), X( 1003UL );
+      initialize( A, true );
+      initialize( X, false );
+      const BT B( X );
+
+      blaze::batchLLHSolve( A, X );
+
+      for( size_t b=0UL; b<X.size(); ++b ) {
+         checkResult( X.get( b ), inv( A.get( b ) ) * B.get( b ), b );
+      }
+   }
+
+   {
+      test_ = "batchLLHSolve() with complex 3x3 matrices";
+
+      CBT A( 1003UL ), X( 1003UL );
+      initialize( A, true );
+      initialize( X, false );
+      const CBT B( X );
+
+      blaze::batchLLHSolve( A, X );
+
+      for( size_t b=0UL; b<X.size(); ++b ) {
+         checkResult( X.get( b ), inv( A.get( b ) ) * B.get( b ), b );
+      }
+   }
+
+   {
+      test_ = "batchLLHSolve() with a non-positive-definite system matrix";
+
+      BT A( 17UL );
+      VT x( 17UL, 1.0 );
+      initialize( A, true );
+      A.set( 9UL, BT::ResultType( -1.0 ) );
+
+      try {
+         blaze::batchLLHSolve( A, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving LSE with non-positive-definite system matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batchDet() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched computation of determinants. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDet()
+{
+   {
+      test_ = "batchDet() with 3x3 matrices";
+
+      BT A( 1003UL );
+      initialize( A, false );
+      A.set( 7UL, BT::ResultType( 1.0 ) );
+
+      const blaze::DynamicVector<double> d( blaze::batchDet( A ) );
+
+      checkSize( d, 1003UL );
+
+      for( size_t b=0UL; b<A.size(); ++b ) {
+         checkResult( d[b], det( A.get( b ) ), b );
+      }
+   }
+
+   {
+      test_ = "batchDet() with complex 3x3 matrices";
+
+      CBT A( 1003UL );
+      initialize( A, false );
+
+      const blaze::DynamicVector< blaze::complex<double> > d( blaze::batchDet( A ) );
+
+      for( size_t b=0UL; b<A.size(); ++b ) {
+         checkResult( d[b], det( A.get( b ) ), b );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace batchmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BatchMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BATCHMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BatchMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
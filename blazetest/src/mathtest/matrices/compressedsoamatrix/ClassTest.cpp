@@ -0,0 +1,1326 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/compressedsoamatrix/ClassTest.cpp
+//  \brief Source file for the CompressedSoAMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Views.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/compressedsoamatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace compressedsoamatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedSoAMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSchurAssign();
+   testMultiply();
+   testFunctionCall();
+   testIterator();
+   testResize();
+   testReserve();
+   testSet();
+   testInsert();
+   testAppend();
+   testErase();
+   testFind();
+   testLowerBound();
+   testTranspose();
+   testIndexRange();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CompressedSoAMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedSoAMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedSoAMatrix size constructor (3x4)";
+
+      MT mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+   }
+
+   {
+      test_ = "Row-major CompressedSoAMatrix size constructor (3x4,7)";
+
+      MT mat( 3UL, 4UL, 7UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 7UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major CompressedSoAMatrix size constructor (3x4,{2,0,3})";
+
+      MT mat( 3UL, 4UL, std::vector<size_t>{ 2UL, 0UL, 3UL } );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 5UL );
+      checkCapacity( mat, 0UL, 2UL );
+      checkCapacity( mat, 2UL, 3UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major list initialization
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedSoAMatrix initializer list constructor";
+
+      MT mat{ { 1, 0, 3 }, { 0 }, { 0, 5, 6 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 3 ||
+          mat(1,0) != 0 || mat(1,1) != 0 || mat(1,2) != 0 ||
+          mat(2,0) != 0 || mat(2,1) != 5 || mat(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 3 )\n( 0 0 0 )\n( 0 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major copy/move constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedSoAMatrix copy constructor";
+
+      MT mat1{ { 1, 0, 3 }, { 0 }, { 0, 5, 6 } };
+      MT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 4UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompressedSoAMatrix move constructor";
+
+      MT mat1{ { 1, 0, 3 }, { 0 }, { 0, 5, 6 } };
+      MT mat2( std::move( mat1 ) );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 4UL );
+
+      if( mat2(0,0) != 1 || mat2(0,2) != 3 || mat2(2,1) != 5 || mat2(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 3 )\n( 0 0 0 )\n( 0 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major/column-major conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedSoAMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> dense{ { 1, 0, 3 }, { 0, 0, 0 }, { 0, 5, 6 } };
+      MT mat( dense );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat != dense ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << dense << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix sparse matrix constructor";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> sparse( 5UL, 7UL );
+      blaze::randomize( sparse, 12UL, 1, 10 );
+      OMT mat( sparse );
+
+      checkRows    ( mat,  5UL );
+      checkColumns ( mat,  7UL );
+      checkNonZeros( mat, 12UL );
+
+      if( mat != sparse ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << sparse << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix initializer list constructor";
+
+      OMT mat{ { 1, 0, 3 }, { 0 }, { 0, 5, 6 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 3 ||
+          mat(1,0) != 0 || mat(1,1) != 0 || mat(1,2) != 0 ||
+          mat(2,0) != 0 || mat(2,1) != 5 || mat(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 3 )\n( 0 0 0 )\n( 0 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the CompressedSoAMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Row-major copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedSoAMatrix copy assignment";
+
+      MT mat1{ { 1, 0, 3 }, { 0 }, { 0, 5, 6 } };
+      MT mat2( 5UL, 5UL, 10UL );
+      mat2(4,4) = 9;
+
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkCapacity( mat2, 10UL );
+      checkNonZeros( mat2, 4UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major dense/sparse matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedSoAMatrix dense matrix assignment";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> dense( 6UL, 4UL );
+      blaze::randomize( dense, -10, 10 );
+      dense(2,3) = 0;
+
+      MT mat;
+      mat = dense;
+
+      checkRows   ( mat, 6UL );
+      checkColumns( mat, 4UL );
+
+      if( mat != dense ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << dense << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompressedSoAMatrix sparse matrix assignment (opposite storage order)";
+
+      OMT sparse( 7UL, 5UL );
+      blaze::randomize( sparse, 15UL, 1, 10 );
+
+      MT mat{ { 1, 2 }, { 3, 4 } };
+      mat = sparse;
+
+      checkRows    ( mat,  7UL );
+      checkColumns ( mat,  5UL );
+      checkNonZeros( mat, 15UL );
+
+      if( mat != sparse ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << sparse << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major list assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedSoAMatrix initializer list assignment";
+
+      OMT mat;
+      mat = { { 1, 0, 3 }, { 0 }, { 0, 5, 6 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat(0,0) != 1 || mat(0,2) != 3 || mat(2,1) != 5 || mat(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 3 )\n( 0 0 0 )\n( 0 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix addition and subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition and subtraction assignment operators of the
+// CompressedSoAMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix sparse matrix addition/subtraction assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 8UL, 9UL );
+      blaze::CompressedMatrix<int,blaze::columnMajor> rhs( 8UL, 9UL );
+      blaze::randomize( ref, 20UL, -10, 10 );
+      blaze::randomize( rhs, 25UL, -10, 10 );
+
+      MT mat( ref );
+
+      mat += rhs;
+      ref += rhs;
+      mat -= 2*rhs;
+      ref -= 2*rhs;
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition/subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix dense matrix addition assignment";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 6UL, 4UL );
+      blaze::DynamicMatrix<int,blaze::rowMajor> rhs( 6UL, 4UL );
+      blaze::randomize( ref, 10UL, -10, 10 );
+      blaze::randomize( rhs, -10, 10 );
+
+      OMT mat( ref );
+
+      mat += rhs;
+      ref += rhs;
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix Schur product assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the Schur product assignment operators of the
+// CompressedSoAMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSchurAssign()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix dense matrix Schur product assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 6UL, 5UL );
+      blaze::DynamicMatrix<int,blaze::columnMajor> rhs( 6UL, 5UL );
+      blaze::randomize( ref, 12UL, -10, 10 );
+      blaze::randomize( rhs, -10, 10 );
+
+      MT mat( ref );
+
+      mat %= rhs;
+      ref %= rhs;
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Schur product assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix sparse matrix Schur product assignment";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 6UL, 5UL );
+      blaze::CompressedMatrix<int,blaze::rowMajor> rhs( 6UL, 5UL );
+      blaze::randomize( ref, 18UL, -10, 10 );
+      blaze::randomize( rhs, 18UL, -10, 10 );
+
+      OMT mat( ref );
+
+      mat %= rhs;
+      ref %= rhs;
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Schur product assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication with a CompressedSoAMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of sparse matrix/dense vector and sparse matrix/sparse matrix
+// multiplications with CompressedSoAMatrix operands. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiply()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix/dense vector multiplication";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> ref( 40UL, 30UL );
+      blaze::DynamicVector<double,blaze::columnVector> vec( 30UL );
+      blaze::randomize( ref, 200UL, -10, 10 );
+      blaze::randomize( vec );
+
+      const RMT mat( ref );
+
+      const blaze::DynamicVector<double,blaze::columnVector> res( mat * vec );
+      const blaze::DynamicVector<double,blaze::columnVector> exp( ref * vec );
+
+      if( res != exp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << exp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix/dense vector multiplication";
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> ref( 40UL, 30UL );
+      blaze::DynamicVector<double,blaze::columnVector> vec( 30UL );
+      blaze::randomize( ref, 200UL, -10, 10 );
+      blaze::randomize( vec );
+
+      const ORMT mat( ref );
+
+      const blaze::DynamicVector<double,blaze::columnVector> res( mat * vec );
+      const blaze::DynamicVector<double,blaze::columnVector> exp( ref * vec );
+
+      if( res != exp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << exp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompressedSoAMatrix/column-major CompressedSoAMatrix multiplication";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref1( 12UL, 15UL );
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref2( 15UL, 9UL );
+      blaze::randomize( ref1, 40UL, -10, 10 );
+      blaze::randomize( ref2, 40UL, -10, 10 );
+
+      const MT  mat1( ref1 );
+      const OMT mat2( ref2 );
+
+      MT res;
+      res = mat1 * mat2;
+
+      if( res != ref1 * ref2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << ( ref1 * ref2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call operator
+// of the CompressedSoAMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::operator()";
+
+      MT mat( 3UL, 5UL );
+
+      mat(2,1) = 1;
+      mat(1,4) = 2;
+      mat(0,3) = 3;
+      mat(2,2) = 4;
+      mat(2,0) = 5;
+      mat(1,4) += 6;
+      mat(0,3) *= 2;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 3UL );
+
+      if( mat(0,3) != 6 || mat(1,4) != 8 || mat(2,0) != 5 || mat(2,1) != 1 || mat(2,2) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 6 0 )\n( 0 0 0 0 8 )\n( 5 1 4 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix::operator()";
+
+      OMT mat( 3UL, 5UL );
+
+      mat(2,1) = 1;
+      mat(1,4) = 2;
+      mat(0,3) = 3;
+      mat(2,2) = 4;
+      mat(0,1) = 5;
+      mat(1,4) -= 6;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 4UL, 1UL );
+
+      if( mat(0,1) != 5 || mat(2,1) != 1 || mat(2,2) != 4 || mat(0,3) != 3 || mat(1,4) != -4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 5 0 3 0 )\n( 0 0 0 0 -4 )\n( 0 1 4 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the CompressedSoAMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix iterator";
+
+      MT mat{ { 0, 1, 0, 2 }, { 0 }, { 3, 0, 4, 5 } };
+
+      size_t number( 0UL );
+      for( MT::ConstIterator it=mat.cbegin(2UL); it!=mat.cend(2UL); ++it ) {
+         ++number;
+      }
+
+      if( number != 3UL || mat.cend(2UL) - mat.cbegin(2UL) != 3L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      MT::ConstIterator it( mat.cbegin(2UL) );
+
+      if( it->value() != 3 || it->index() != 0UL || (it+2)->value() != 5 || it[1].index() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid element access\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( MT::Iterator it2=mat.begin(0UL); it2!=mat.end(0UL); ++it2 ) {
+         *it2 = 7;
+      }
+      for( MT::Iterator it2=mat.begin(2UL); it2!=mat.end(2UL); ++it2 ) {
+         *it2 *= 2;
+      }
+
+      if( mat(0,1) != 7 || mat(0,3) != 7 || mat(2,0) != 6 || mat(2,2) != 8 || mat(2,3) != 10 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 7 0 7 )\n( 0 0 0 0 )\n( 6 0 8 10 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the CompressedSoAMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::resize()";
+
+      MT mat{ { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+
+      mat.resize( 2UL, 2UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 2UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 2 || mat(1,0) != 4 || mat(1,1) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 )\n( 4 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat.resize( 4UL, 5UL );
+      mat(3,4) = 10;
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 2UL, 0UL );
+      checkNonZeros( mat, 3UL, 1UL );
+
+      mat.resize( 0UL, 0UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major CompressedSoAMatrix::resize()";
+
+      OMT mat{ { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+
+      mat.resize( 2UL, 4UL );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 6UL );
+      checkNonZeros( mat, 3UL, 0UL );
+
+      if( mat(0,2) != 3 || mat(1,2) != 6 || mat(1,0) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n( 4 5 6 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reserve() and \c trim() member functions of CompressedSoAMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reserve() and \c trim() member functions of the
+// CompressedSoAMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testReserve()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::reserve()";
+
+      MT mat{ { 1, 0, 2 }, { 0, 3, 0 }, { 4, 0, 5 } };
+
+      mat.reserve( 20UL );
+
+      checkCapacity( mat, 20UL );
+      checkNonZeros( mat,  5UL );
+
+      mat.reserve( 1UL, 4UL );
+
+      checkCapacity( mat, 1UL, 4UL );
+      checkNonZeros( mat, 1UL, 1UL );
+
+      mat.reserve( 2UL, 30UL );
+
+      checkCapacity( mat, 2UL, 30UL );
+      checkNonZeros( mat, 2UL,  2UL );
+
+      mat.trim();
+
+      checkCapacity( mat, 0UL, 2UL );
+      checkCapacity( mat, 1UL, 1UL );
+      checkNonZeros( mat, 5UL );
+
+      mat.shrinkToFit();
+
+      checkCapacity( mat, 5UL );
+      checkNonZeros( mat, 5UL );
+
+      if( mat(0,0) != 1 || mat(0,2) != 2 || mat(1,1) != 3 || mat(2,0) != 4 || mat(2,2) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reserving capacity failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 0 3 0 )\n( 4 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c set() member function of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c set() member function of the CompressedSoAMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSet()
+{
+   {
+      test_ = "Column-major CompressedSoAMatrix::set()";
+
+      OMT mat( 4UL, 3UL );
+
+      OMT::Iterator pos = mat.set( 2UL, 1UL, 1 );
+
+      if( pos->value() != 1 || pos->index() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid iterator returned\n"
+             << " Details:\n"
+             << "   Value: " << pos->value() << "\n"
+             << "   Index: " << pos->index() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat.set( 0UL, 1UL, 2 );
+      mat.set( 3UL, 1UL, 3 );
+      mat.set( 2UL, 1UL, 4 );
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 1UL, 3UL );
+
+      if( mat(0,1) != 2 || mat(2,1) != 4 || mat(3,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting an element failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c insert() member function of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c insert() member function of the CompressedSoAMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInsert()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::insert()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 10UL, 10UL );
+      MT mat( 10UL, 10UL );
+
+      for( size_t k=0UL; k<40UL; ++k ) {
+         const size_t i( blaze::rand<size_t>( 0UL, 9UL ) );
+         const size_t j( blaze::rand<size_t>( 0UL, 9UL ) );
+         if( ref.find( i, j ) == ref.end( i ) ) {
+            ref.insert( i, j, int( k+1UL ) );
+            mat.insert( i, j, int( k+1UL ) );
+         }
+      }
+
+      checkNonZeros( mat, ref.nonZeros() );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat(4,4) = 1;
+         mat.insert( 4UL, 4UL, 2 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting an existing element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c append() member function of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c append() member function of the CompressedSoAMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::append()";
+
+      MT mat( 4UL, 3UL, 4UL );
+
+      mat.append( 0UL, 1UL, 1 );
+      mat.finalize( 0UL );
+      mat.append( 1UL, 1UL, 2 );
+      mat.append( 1UL, 2UL, 0, true );
+      mat.finalize( 1UL );
+      mat.finalize( 2UL );
+      mat.append( 3UL, 0UL, 3 );
+      mat.append( 3UL, 2UL, 4 );
+      mat.finalize( 3UL );
+
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 0UL );
+
+      if( mat(0,1) != 1 || mat(1,1) != 2 || mat(3,0) != 3 || mat(3,2) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Append operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 )\n( 0 2 0 )\n( 0 0 0 )\n( 3 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c erase() member functions of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c erase() member functions of the CompressedSoAMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testErase()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::erase()";
+
+      MT mat{ { 1, 2, 3, 4 }, { 5, 6, 7, 8 }, { 9, 10, 11, 12 } };
+
+      mat.erase( 0UL, 1UL );
+      mat.erase( 1UL, mat.find( 1UL, 3UL ) );
+      mat.erase( 2UL, mat.lowerBound( 2UL, 1UL ), mat.upperBound( 2UL, 2UL ) );
+
+      checkNonZeros( mat, 8UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 3 || mat(1,3) != 0 || mat(1,2) != 7 ||
+          mat(2,0) != 9 || mat(2,1) != 0 || mat(2,2) != 0 || mat(2,3) != 12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 3 4 )\n( 5 6 7 0 )\n( 9 0 0 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat.erase( []( int value ){ return value > 6; } );
+
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 2UL, 0UL );
+
+      mat.erase( 1UL, mat.begin( 1UL ), mat.end( 1UL ), []( int value ){ return value == 5; } );
+
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 1UL, 1UL );
+
+      if( mat(0,0) != 1 || mat(0,2) != 3 || mat(0,3) != 4 || mat(1,1) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 3 4 )\n( 0 6 0 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the CompressedSoAMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   {
+      test_ = "Column-major CompressedSoAMatrix::find()";
+
+      OMT mat( 8UL, 6UL, 3UL );
+      mat(1,2) = 1;
+      mat(2,3) = 2;
+      mat(6,5) = 3;
+
+      const OMT::ConstIterator pos1( mat.find( 1UL, 2UL ) );
+      const OMT::ConstIterator pos2( mat.find( 6UL, 5UL ) );
+      const OMT::ConstIterator pos3( mat.find( 2UL, 2UL ) );
+
+      if( pos1 == mat.end( 2UL ) || pos1->value() != 1 || pos1->index() != 1UL ||
+          pos2 == mat.end( 5UL ) || pos2->value() != 3 || pos2->index() != 6UL ||
+          pos3 != mat.end( 2UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element search failed\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() and \c upperBound() member functions of CompressedSoAMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() and \c upperBound() member functions of
+// the CompressedSoAMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::lowerBound()/upperBound()";
+
+      MT mat( 3UL, 6UL, 3UL );
+      mat(1,1) = 1;
+      mat(1,4) = 2;
+
+      const MT::ConstIterator pos1( mat.lowerBound( 1UL, 0UL ) );
+      const MT::ConstIterator pos2( mat.lowerBound( 1UL, 2UL ) );
+      const MT::ConstIterator pos3( mat.lowerBound( 1UL, 5UL ) );
+      const MT::ConstIterator pos4( mat.upperBound( 1UL, 1UL ) );
+      const MT::ConstIterator pos5( mat.upperBound( 1UL, 4UL ) );
+
+      if( pos1->index() != 1UL || pos2->index() != 4UL || pos3 != mat.end( 1UL ) ||
+          pos4->index() != 4UL || pos5 != mat.end( 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lower/upper bound search failed\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c transpose() member function of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c transpose() member function of the CompressedSoAMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTranspose()
+{
+   {
+      test_ = "Row-major CompressedSoAMatrix::transpose()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 5UL, 3UL );
+      blaze::randomize( ref, 7UL, 1, 10 );
+
+      MT mat( ref );
+
+      mat.transpose();
+      ref.transpose();
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 7UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the range check for the index type of the CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a CompressedSoAMatrix refuses sizes that cannot be represented by
+// its index type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexRange()
+{
+   using SmallMT = blaze::CompressedSoAMatrix<int,blaze::rowMajor,blaze::Group0,unsigned char>;
+
+   {
+      test_ = "Row-major CompressedSoAMatrix with 8-bit indices";
+
+      SmallMT mat( 300UL, 255UL );
+      mat(299,254) = 1;
+
+      checkNonZeros( mat, 1UL );
+
+      try {
+         mat.resize( 10UL, 256UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing beyond the range of the index type succeeded\n"
+             << " Details:\n"
+             << "   Number of columns: " << mat.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkRows   ( mat, 300UL );
+      checkColumns( mat, 255UL );
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedsoamatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedSoAMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDSOAMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedSoAMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -5026,19 +5026,52 @@ void UnalignedPaddedTest::testTranspose()
          }
       }
 
-      // Try to self-transpose a 3x5 matrix
-      try {
-         std::unique_ptr<int[],blaze::ArrayDelete> memory( new int[48UL] );
-         MT mat( memory.get(), 3UL, 5UL, 16UL );
+      // Self-transpose of a 3x5 matrix
+      {
+         std::unique_ptr<int[],blaze::ArrayDelete> memory( new int[96UL] );
+         MT mat( memory.get(), 3UL, 5UL, 32UL );
+         mat(0,0) = 1;
+         mat(0,1) = 0;
+         mat(0,2) = 2;
+         mat(0,3) = 0;
+         mat(0,4) = 3;
+         mat(1,0) = 0;
+         mat(1,1) = 4;
+         mat(1,2) = 0;
+         mat(1,3) = 5;
+         mat(1,4) = 0;
+         mat(2,0) = 6;
+         mat(2,1) = 0;
+         mat(2,2) = 7;
+         mat(2,3) = 0;
+         mat(2,4) = 8;
 
          transpose( mat );
 
-         std::ostringstream oss;
-         oss << " Test: " << test_ << "\n"
-             << " Error: Self-transpose of a non-square matrix succeeded\n";
-         throw std::runtime_error( oss.str() );
+         checkRows    ( mat,  5UL );
+         checkColumns ( mat,  3UL );
+         checkCapacity( mat, 15UL );
+         checkNonZeros( mat,  8UL );
+         checkNonZeros( mat,  0UL, 2UL );
+         checkNonZeros( mat,  1UL, 1UL );
+         checkNonZeros( mat,  2UL, 2UL );
+         checkNonZeros( mat,  3UL, 1UL );
+         checkNonZeros( mat,  4UL, 2UL );
+
+         if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 6 ||
+             mat(1,0) != 0 || mat(1,1) != 4 || mat(1,2) != 0 ||
+             mat(2,0) != 2 || mat(2,1) != 0 || mat(2,2) != 7 ||
+             mat(3,0) != 0 || mat(3,1) != 5 || mat(3,2) != 0 ||
+             mat(4,0) != 3 || mat(4,1) != 0 || mat(4,2) != 8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Transpose operation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 1 0 6 )\n( 0 4 0 )\n( 2 0 7 )\n( 0 5 0 )\n( 3 0 8 )\n";
+            throw std::runtime_error( oss.str() );
+         }
       }
-      catch( std::logic_error& ) {}
    }
 
    {
@@ -5141,19 +5174,50 @@ void UnalignedPaddedTest::testTranspose()
          }
       }
 
-      // Try to self-transpose a 5x3 matrix
-      try {
-         std::unique_ptr<int[],blaze::ArrayDelete> memory( new int[48UL] );
-         OMT mat( memory.get(), 5UL, 3UL, 16UL );
+      // Self-transpose of a 5x3 matrix
+      {
+         std::unique_ptr<int[],blaze::ArrayDelete> memory( new int[96UL] );
+         OMT mat( memory.get(), 5UL, 3UL, 32UL );
+         mat(0,0) = 1;
+         mat(0,1) = 0;
+         mat(0,2) = 6;
+         mat(1,0) = 0;
+         mat(1,1) = 4;
+         mat(1,2) = 0;
+         mat(2,0) = 2;
+         mat(2,1) = 0;
+         mat(2,2) = 7;
+         mat(3,0) = 0;
+         mat(3,1) = 5;
+         mat(3,2) = 0;
+         mat(4,0) = 3;
+         mat(4,1) = 0;
+         mat(4,2) = 8;
 
          transpose( mat );
 
-         std::ostringstream oss;
-         oss << " Test: " << test_ << "\n"
-             << " Error: Self-transpose of a non-square matrix succeeded\n";
-         throw std::runtime_error( oss.str() );
+         checkRows    ( mat,  3UL );
+         checkColumns ( mat,  5UL );
+         checkCapacity( mat, 15UL );
+         checkNonZeros( mat,  8UL );
+         checkNonZeros( mat,  0UL, 2UL );
+         checkNonZeros( mat,  1UL, 1UL );
+         checkNonZeros( mat,  2UL, 2UL );
+         checkNonZeros( mat,  3UL, 1UL );
+         checkNonZeros( mat,  4UL, 2UL );
+
+         if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 2 || mat(0,3) != 0 || mat(0,4) != 3 ||
+             mat(1,0) != 0 || mat(1,1) != 4 || mat(1,2) != 0 || mat(1,3) != 5 || mat(1,4) != 0 ||
+             mat(2,0) != 6 || mat(2,1) != 0 || mat(2,2) != 7 || mat(2,3) != 0 || mat(2,4) != 8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Transpose operation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 1 0 2 0 3 )\n( 0 4 0 5 0 )\n( 6 0 7 0 8 )\n";
+            throw std::runtime_error( oss.str() );
+         }
       }
-      catch( std::logic_error& ) {}
    }
 
    {
@@ -5279,19 +5343,56 @@ void UnalignedPaddedTest::testCTranspose()
          }
       }
 
-      // Try to self-transpose a 3x5 matrix
-      try {
-         std::unique_ptr<cplx[],blaze::ArrayDelete> memory( new cplx[48UL] );
-         UnalignedPadded mat( memory.get(), 3UL, 5UL, 16UL );
+      // Self-transpose of a 3x5 matrix
+      {
+         std::unique_ptr<cplx[],blaze::ArrayDelete> memory( new cplx[96UL] );
+         UnalignedPadded mat( memory.get(), 3UL, 5UL, 32UL );
+         mat(0,0) = cplx(1,-1);
+         mat(0,1) = cplx(0, 0);
+         mat(0,2) = cplx(2,-2);
+         mat(0,3) = cplx(0, 0);
+         mat(0,4) = cplx(3,-3);
+         mat(1,0) = cplx(0, 0);
+         mat(1,1) = cplx(4,-4);
+         mat(1,2) = cplx(0, 0);
+         mat(1,3) = cplx(5,-5);
+         mat(1,4) = cplx(0, 0);
+         mat(2,0) = cplx(6,-6);
+         mat(2,1) = cplx(0, 0);
+         mat(2,2) = cplx(7,-7);
+         mat(2,3) = cplx(0, 0);
+         mat(2,4) = cplx(8,-8);
 
          ctranspose( mat );
 
-         std::ostringstream oss;
-         oss << " Test: " << test_ << "\n"
-             << " Error: Self-transpose of a non-square matrix succeeded\n";
-         throw std::runtime_error( oss.str() );
+         checkRows    ( mat,  5UL );
+         checkColumns ( mat,  3UL );
+         checkCapacity( mat, 15UL );
+         checkNonZeros( mat,  8UL );
+         checkNonZeros( mat,  0UL, 2UL );
+         checkNonZeros( mat,  1UL, 1UL );
+         checkNonZeros( mat,  2UL, 2UL );
+         checkNonZeros( mat,  3UL, 1UL );
+         checkNonZeros( mat,  4UL, 2UL );
+
+         if( mat(0,0) != cplx(1,1) || mat(0,1) != cplx(0,0) || mat(0,2) != cplx(6,6) ||
+             mat(1,0) != cplx(0,0) || mat(1,1) != cplx(4,4) || mat(1,2) != cplx(0,0) ||
+             mat(2,0) != cplx(2,2) || mat(2,1) != cplx(0,0) || mat(2,2) != cplx(7,7) ||
+             mat(3,0) != cplx(0,0) || mat(3,1) != cplx(5,5) || mat(3,2) != cplx(0,0) ||
+             mat(4,0) != cplx(3,3) || mat(4,1) != cplx(0,0) || mat(4,2) != cplx(8,8) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Transpose operation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( (1,1) (0,0) (6,6) )\n"
+                                        "( (0,0) (4,4) (0,0) )\n"
+                                        "( (2,2) (0,0) (7,7) )\n"
+                                        "( (0,0) (5,5) (0,0) )\n"
+                                        "( (3,3) (0,0) (8,8) )\n";
+            throw std::runtime_error( oss.str() );
+         }
       }
-      catch( std::logic_error& ) {}
    }
 
    {
@@ -5412,19 +5513,55 @@ void UnalignedPaddedTest::testCTranspose()
          }
       }
 
-      // Try to self-transpose a 5x3 matrix
-      try {
-         std::unique_ptr<cplx[],blaze::ArrayDelete> memory( new cplx[48UL] );
-         UnalignedPadded mat( memory.get(), 5UL, 3UL, 16UL );
+      // Self-transpose of a 5x3 matrix
+      {
+         std::unique_ptr<cplx[],blaze::ArrayDelete> memory( new cplx[96UL] );
+         UnalignedPadded mat( memory.get(), 5UL, 3UL, 32UL );
+         mat(0,0) = cplx(1,-1);
+         mat(0,1) = cplx(0, 0);
+         mat(0,2) = cplx(6,-6);
+         mat(1,0) = cplx(0, 0);
+         mat(1,1) = cplx(4,-4);
+         mat(1,2) = cplx(0, 0);
+         mat(2,0) = cplx(2,-2);
+         mat(2,1) = cplx(0, 0);
+         mat(2,2) = cplx(7,-7);
+         mat(3,0) = cplx(0, 0);
+         mat(3,1) = cplx(5,-5);
+         mat(3,2) = cplx(0, 0);
+         mat(4,0) = cplx(3,-3);
+         mat(4,1) = cplx(0, 0);
+         mat(4,2) = cplx(8,-8);
 
          ctranspose( mat );
 
-         std::ostringstream oss;
-         oss << " Test: " << test_ << "\n"
-             << " Error: Self-transpose of a non-square matrix succeeded\n";
-         throw std::runtime_error( oss.str() );
+         checkRows    ( mat,  3UL );
+         checkColumns ( mat,  5UL );
+         checkCapacity( mat, 15UL );
+         checkNonZeros( mat,  8UL );
+         checkNonZeros( mat,  0UL, 2UL );
+         checkNonZeros( mat,  1UL, 1UL );
+         checkNonZeros( mat,  2UL, 2UL );
+         checkNonZeros( mat,  3UL, 1UL );
+         checkNonZeros( mat,  4UL, 2UL );
+
+         if( mat(0,0) != cplx(1,1) || mat(0,1) != cplx(0,0) || mat(0,2) != cplx(2,2) ||
+             mat(0,3) != cplx(0,0) || mat(0,4) != cplx(3,3) ||
+             mat(1,0) != cplx(0,0) || mat(1,1) != cplx(4,4) || mat(1,2) != cplx(0,0) ||
+             mat(1,3) != cplx(5,5) || mat(1,4) != cplx(0,0) ||
+             mat(2,0) != cplx(6,6) || mat(2,1) != cplx(0,0) || mat(2,2) != cplx(7,7) ||
+             mat(2,3) != cplx(0,0) || mat(2,4) != cplx(8,8) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Transpose operation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( (1,1) (0,0) (2,2) (0,0) (3,3) )\n"
+                                        "( (0,0) (4,4) (0,0) (5,5) (0,0) )\n"
+                                        "( (6,6) (0,0) (7,7) (0,0) (8,8) )\n";
+            throw std::runtime_error( oss.str() );
+         }
       }
-      catch( std::logic_error& ) {}
    }
 
    {
@@ -0,0 +1,459 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/mappedarchive/ClassTest.cpp
+//  \brief Source file for the MappedArchive class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CustomCompressedMatrix.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/CustomVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrices/mappedarchive/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace mappedarchive {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MappedArchive class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()
+   , file_( "mappedarchive.blaze" )
+{
+   testDenseVectors();
+   testDenseMatrices();
+   testSparseMatrices();
+   testMultipleRecords();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the MappedArchive class test.
+//
+// The destructor removes the temporary archive file.
+*/
+ClassTest::~ClassTest()
+{
+   std::remove( file_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the zero-copy reconstitution of dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testDenseVectors()
+{
+   test_ = "Dense vectors";
+
+   for( size_t n=0UL; n<20UL; ++n )
+   {
+      blaze::DynamicVector<double> src( n );
+      randomize( src );
+
+      {
+         blaze::Archive<std::ofstream> archive( file_, std::ofstream::trunc );
+         serializeMapped( archive, src );
+      }
+
+      blaze::MappedArchive archive( file_ );
+      blaze::CustomVector<const double,blaze::aligned,blaze::unpadded> dst;
+      archive >> dst;
+
+      compare( src, dst );
+
+      if( !archive.eof() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Archive not fully consumed\n"
+             << " Details:\n"
+             << "   Size of the vector: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the zero-copy reconstitution of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testDenseMatrices()
+{
+   test_ = "Dense matrices";
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src( 7UL, 13UL );
+      randomize( src );
+
+      {
+         blaze::Archive<std::ofstream> archive( file_, std::ofstream::trunc );
+         serializeMapped( archive, src );
+      }
+
+      blaze::MappedArchive archive( file_ );
+      blaze::CustomMatrix<const int,blaze::aligned,blaze::unpadded,blaze::rowMajor> dst;
+      archive >> dst;
+
+      compare( src, dst );
+   }
+
+   {
+      blaze::DynamicMatrix<blaze::complex<float>,blaze::columnMajor> src( 13UL, 7UL );
+      randomize( src );
+
+      {
+         blaze::Archive<std::ofstream> archive( file_, std::ofstream::trunc );
+         serializeMapped( archive, src );
+      }
+
+      blaze::MappedArchive archive( file_ );
+      blaze::CustomMatrix<const blaze::complex<float>,blaze::unaligned,blaze::unpadded,blaze::columnMajor> dst;
+      archive >> dst;
+
+      compare( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the zero-copy reconstitution of sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testSparseMatrices()
+{
+   test_ = "Sparse matrices";
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> src( 31UL, 17UL );
+      randomize( src, 80UL );
+
+      {
+         blaze::Archive<std::ofstream> archive( file_, std::ofstream::trunc );
+         blaze::serializeMapped<uint32_t>( archive, src );
+      }
+
+      blaze::MappedArchive archive( file_ );
+      blaze::CustomCompressedMatrix<double,blaze::rowMajor,blaze::Group0,uint32_t> dst;
+      archive >> dst;
+
+      compare( src, dst );
+
+      if( !isIntact( dst ) || dst.nonZeros() != src.nonZeros() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid sparse matrix view\n"
+             << " Details:\n"
+             << "   Number of non-zeros: " << dst.nonZeros() << " (expected " << src.nonZeros() << ")\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::DynamicVector<double> x( blaze::generate( 17UL, []( size_t i ){ return i+1.0; } ) );
+      compare( blaze::DynamicVector<double>( src * x ), blaze::DynamicVector<double>( dst * x ) );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::columnMajor> src( 17UL, 31UL );
+      randomize( src, 60UL );
+
+      {
+         blaze::Archive<std::ofstream> archive( file_, std::ofstream::trunc );
+         serializeMapped( archive, src );
+      }
+
+      blaze::MappedArchive archive( file_ );
+      blaze::CustomCompressedMatrix<int,blaze::columnMajor> dst;
+      archive >> dst;
+
+      compare( src, dst );
+   }
+
+   {
+      blaze::CompressedMatrix<float,blaze::rowMajor> src( 5UL, 9UL );
+
+      {
+         blaze::Archive<std::ofstream> archive( file_, std::ofstream::trunc );
+         blaze::serializeMapped<uint16_t>( archive, src );
+      }
+
+      blaze::MappedArchive archive( file_ );
+      blaze::CustomCompressedMatrix<float,blaze::rowMajor,blaze::Group0,uint16_t> dst;
+      archive >> dst;
+
+      compare( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of an archive containing several records.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::testMultipleRecords()
+{
+   test_ = "Multiple records";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 9UL, 5UL );
+   blaze::DynamicVector<float> x( 3UL );
+   blaze::CompressedMatrix<double,blaze::columnMajor> S( 12UL, 8UL );
+   blaze::DynamicMatrix<short,blaze::columnMajor> B( 3UL, 11UL );
+
+   randomize( A );
+   randomize( x );
+   randomize( S, 30UL );
+   randomize( B );
+
+   {
+      blaze::Archive<std::ofstream> archive( file_, std::ofstream::trunc );
+      serializeMapped( archive, A );
+      serializeMapped( archive, x );
+      blaze::serializeMapped<uint32_t>( archive, S );
+      serializeMapped( archive, B );
+   }
+
+   blaze::MappedArchive archive( file_ );
+
+   blaze::CustomMatrix<const double,blaze::aligned,blaze::unpadded,blaze::rowMajor> A2;
+   blaze::CustomVector<const float,blaze::aligned,blaze::unpadded> x2;
+   blaze::CustomCompressedMatrix<double,blaze::columnMajor,blaze::Group0,uint32_t> S2;
+   blaze::CustomMatrix<const short,blaze::aligned,blaze::unpadded,blaze::columnMajor> B2;
+
+   archive >> A2 >> x2 >> S2 >> B2;
+
+   compare( A, A2 );
+   compare( x, x2 );
+   compare( S, S2 );
+   compare( B, B2 );
+
+   if( !archive.eof() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Archive not fully consumed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of failing reconstitution attempts.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs tests with records that do not match the bound vector or matrix. In
+// case no error is detected, i.e. in case the test is failing, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Reconstitution failures";
+
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 4UL, 5UL );
+      blaze::CompressedMatrix<double,blaze::rowMajor> S( 4UL, 5UL );
+
+      randomize( A );
+      randomize( S, 6UL );
+
+      blaze::Archive<std::ofstream> archive( file_, std::ofstream::trunc );
+      serializeMapped( archive, A );
+      blaze::serializeMapped<uint32_t>( archive, S );
+   }
+
+   try {
+      blaze::MappedArchive archive( file_ );
+      blaze::CustomVector<const double,blaze::unaligned,blaze::unpadded> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Type difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::MappedArchive archive( file_ );
+      blaze::CustomMatrix<const double,blaze::unaligned,blaze::unpadded,blaze::columnMajor> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Storage order difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::MappedArchive archive( file_ );
+      blaze::CustomMatrix<const float,blaze::unaligned,blaze::unpadded,blaze::rowMajor> dst;
+      archive >> dst;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element type difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::MappedArchive archive( file_ );
+      blaze::CustomMatrix<const double,blaze::unaligned,blaze::unpadded,blaze::rowMajor> A;
+      blaze::CustomCompressedMatrix<double,blaze::rowMajor,blaze::Group0,uint16_t> S;
+      archive >> A >> S;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Index type difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::MappedArchive archive( file_ );
+      blaze::CustomMatrix<const double,blaze::unaligned,blaze::unpadded,blaze::rowMajor> A;
+      blaze::CustomCompressedMatrix<double,blaze::rowMajor,blaze::Group0,uint32_t> S;
+      archive >> A >> S >> A;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading past the end of the archive succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+
+   try {
+      blaze::MappedArchive archive( "nonexisting_file.blaze" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a non-existing file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& )
+   {}
+}
+//*************************************************************************************************
+
+} // namespace mappedarchive
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MappedArchive class test..." << std::endl;
+
+   try
+   {
+      RUN_MAPPEDARCHIVE_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MappedArchive class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
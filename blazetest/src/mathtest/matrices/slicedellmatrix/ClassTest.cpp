@@ -0,0 +1,714 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrices/slicedellmatrix/ClassTest.cpp
+//  \brief Source file for the SlicedEllMatrix class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/matrices/slicedellmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrices {
+
+namespace slicedellmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SlicedEllMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testSorting();
+   testFunctionCall();
+   testIterator();
+   testFind();
+   testPartition();
+   testMultiply<int>();
+   testMultiply<float>();
+   testMultiply<double>();
+   testMultiply< blaze::complex<double> >();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SlicedEllMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   constexpr size_t C( blaze::SIMDTrait<int>::size );
+
+
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllMatrix default constructor";
+
+      const MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+
+      if( mat.sigma() != C ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid sorting window detected\n"
+             << " Details:\n"
+             << "   Sorting window         : " << mat.sigma() << "\n"
+             << "   Expected sorting window: " << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor from CompressedMatrix
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllMatrix conversion constructor (CompressedMatrix)";
+
+      CMT ref( 5UL, 7UL );
+      ref(0,1) = 1;
+      ref(0,6) = 2;
+      ref(2,0) = 3;
+      ref(2,3) = 4;
+      ref(2,4) = 5;
+      ref(4,5) = 6;
+
+      const MT mat( ref );
+
+      checkRows    ( mat, 5UL );
+      checkColumns ( mat, 7UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 6UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 3UL );
+      checkNonZeros( mat, 3UL, 0UL );
+      checkNonZeros( mat, 4UL, 1UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllMatrix conversion constructor (sorting window)";
+
+      CMT ref( 3UL*C+1UL, 10UL );
+      blaze::randomize( ref, 20UL, -10, 10 );
+
+      const size_t sigmas  [] = { 0UL, 1UL, C, C+1UL, 3UL*C-1UL, 256UL };
+      const size_t expected[] = { C, C, C, 2UL*C, 3UL*C, ( 256UL+C-1UL ) / C * C };
+
+      for( size_t k=0UL; k<6UL; ++k )
+      {
+         const MT mat( ref, sigmas[k] );
+
+         checkRows    ( mat, ref.rows() );
+         checkColumns ( mat, ref.columns() );
+         checkNonZeros( mat, ref.nonZeros() );
+
+         if( mat.sigma() != expected[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid sorting window detected\n"
+                << " Details:\n"
+                << "   Requested sorting window: " << sigmas[k] << "\n"
+                << "   Sorting window          : " << mat.sigma() << "\n"
+                << "   Expected sorting window : " << expected[k] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         if( mat != ref || !isIntact( mat ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction failed\n"
+                << " Details:\n"
+                << "   Sorting window: " << mat.sigma() << "\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor from other matrices
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllMatrix conversion constructor (column-major CompressedMatrix)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> ref( 9UL, 6UL );
+      blaze::randomize( ref, 20UL, -10, 10 );
+
+      const MT mat( ref );
+
+      checkRows    ( mat, 9UL );
+      checkColumns ( mat, 6UL );
+      checkNonZeros( mat, ref.nonZeros() );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllMatrix conversion constructor (DynamicMatrix)";
+
+      const blaze::DynamicMatrix<int> ref{ { 0, 1, 0, 2 },
+                                           { 0, 0, 0, 0 },
+                                           { 3, 0, 4, 0 } };
+
+      const MT mat( ref );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy and move constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllMatrix copy and move constructor";
+
+      CMT ref( 2UL*C+3UL, 8UL );
+      blaze::randomize( ref, 30UL, -10, 10 );
+
+      MT mat1( ref, 2UL*C );
+      const MT mat2( mat1 );
+      const MT mat3( std::move( mat1 ) );
+
+      checkRows    ( mat2, ref.rows() );
+      checkColumns ( mat2, ref.columns() );
+      checkNonZeros( mat2, ref.nonZeros() );
+      checkRows    ( mat3, ref.rows() );
+      checkColumns ( mat3, ref.columns() );
+      checkNonZeros( mat3, ref.nonZeros() );
+
+      if( mat2 != ref || mat3 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result of the copy construction:\n" << mat2 << "\n"
+             << "   Result of the move construction:\n" << mat3 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sorting of the rows of a SlicedEllMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the rows within each sorting window are sorted by their number of
+// non-zero elements, i.e. that the padding of the slices is minimal, and that the sorting does
+// not change the logical order of the rows. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSorting()
+{
+   test_ = "SlicedEllMatrix row sorting";
+
+   constexpr size_t C( blaze::SIMDTrait<int>::size );
+
+   // Row i contains ( 7*i ) % 11 non-zero elements, i.e. the rows have different lengths
+   // within all slices and the matrix ends with a partially filled slice
+   CMT ref( 5UL*C+3UL, 11UL );
+   ref.reserve( ref.rows()*10UL );
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<( 7UL*i )%11UL; ++j ) {
+         ref.append( i, j, int( i+j+1UL ) );
+      }
+      ref.finalize( i );
+   }
+
+   size_t unsorted( 0UL );
+
+   for( size_t sigma : { C, 2UL*C, 4UL*C, 256UL } )
+   {
+      const MT mat( ref, sigma );
+
+      // Computing the minimum padded capacity of the sorting windows
+      size_t expected( 0UL );
+
+      for( size_t i=0UL; i<ref.rows(); i+=mat.sigma() )
+      {
+         std::vector<size_t> lengths;
+         for( size_t k=i; k<std::min( i+mat.sigma(), ref.rows() ); ++k ) {
+            lengths.push_back( ref.nonZeros( k ) );
+         }
+         std::sort( lengths.begin(), lengths.end(), std::greater<size_t>() );
+
+         for( size_t k=0UL; k<lengths.size(); k+=C ) {
+            expected += lengths[k]*C;
+         }
+      }
+
+      if( mat.capacity() != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity detected\n"
+             << " Details:\n"
+             << "   Sorting window   : " << mat.sigma() << "\n"
+             << "   Capacity         : " << mat.capacity() << "\n"
+             << "   Expected capacity: " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Sorting changed the matrix\n"
+             << " Details:\n"
+             << "   Sorting window: " << mat.sigma() << "\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<ref.rows(); ++i ) {
+         checkNonZeros( mat, i, ref.nonZeros( i ) );
+      }
+
+      // With a sorting window equal to the slice height the rows stay in their slice
+      if( mat.sigma() == C )
+      {
+         unsorted = mat.capacity();
+
+         for( size_t i=0UL; i<ref.rows(); ++i )
+         {
+            size_t longest( 0UL );
+            for( size_t k=i/C*C; k<std::min( i/C*C+C, ref.rows() ); ++k ) {
+               longest = std::max( longest, ref.nonZeros( k ) );
+            }
+
+            if( mat.capacity( i ) != longest ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid capacity detected in row " << i << "\n"
+                   << " Details:\n"
+                   << "   Capacity         : " << mat.capacity( i ) << "\n"
+                   << "   Expected capacity: " << longest << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+      else if( mat.capacity() > unsorted ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Sorting increased the padding\n"
+             << " Details:\n"
+             << "   Sorting window      : " << mat.sigma() << "\n"
+             << "   Capacity            : " << mat.capacity() << "\n"
+             << "   Capacity without sorting: " << unsorted << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the function call operator and the
+// at() function of the SlicedEllMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   constexpr size_t C( blaze::SIMDTrait<int>::size );
+
+   CMT ref( 3UL*C+2UL, 9UL );
+   blaze::randomize( ref, 40UL, 1, 10 );
+
+   const MT mat( ref, 2UL*C );
+
+   {
+      test_ = "SlicedEllMatrix::operator()";
+
+      for( size_t i=0UL; i<ref.rows(); ++i ) {
+         for( size_t j=0UL; j<ref.columns(); ++j ) {
+            if( mat(i,j) != ref(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Access to element (" << i << "," << j << ") failed\n"
+                   << " Details:\n"
+                   << "   Result: " << mat(i,j) << "\n"
+                   << "   Expected result: " << ref(i,j) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "SlicedEllMatrix::at()";
+
+      for( size_t i=0UL; i<ref.rows(); ++i ) {
+         for( size_t j=0UL; j<ref.columns(); ++j ) {
+            if( mat.at(i,j) != ref(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Access to element (" << i << "," << j << ") failed\n"
+                   << " Details:\n"
+                   << "   Result: " << mat.at(i,j) << "\n"
+                   << "   Expected result: " << ref(i,j) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      try {
+         mat.at( ref.rows(), 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+
+      try {
+         mat.at( 0UL, ref.columns() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the SlicedEllMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   constexpr size_t C( blaze::SIMDTrait<int>::size );
+
+   CMT ref( 4UL*C+1UL, 12UL );
+   blaze::randomize( ref, 60UL, 1, 10 );
+   ref.reset( 1UL );
+
+   const MT mat( ref, 4UL*C );
+
+   {
+      test_ = "SlicedEllMatrix::begin() and SlicedEllMatrix::end()";
+
+      for( size_t i=0UL; i<ref.rows(); ++i )
+      {
+         const ptrdiff_t number( mat.end( i ) - mat.begin( i ) );
+
+         if( number != ptrdiff_t( ref.nonZeros( i ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of elements detected in row " << i << "\n"
+                << " Details:\n"
+                << "   Number of elements         : " << number << "\n"
+                << "   Expected number of elements: " << ref.nonZeros( i ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         auto element( ref.begin( i ) );
+
+         for( auto it=mat.begin( i ); it!=mat.end( i ); ++it, ++element ) {
+            if( it->index() != element->index() || it->value() != element->value() ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid element detected in row " << i << "\n"
+                   << " Details:\n"
+                   << "   Element         : (" << it->index() << "," << it->value() << ")\n"
+                   << "   Expected element: (" << element->index() << "," << element->value() << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "SlicedEllMatrix::cbegin() and SlicedEllMatrix::cend()";
+
+      for( size_t i=0UL; i<ref.rows(); ++i )
+      {
+         if( mat.cbegin( i ) != mat.begin( i ) || mat.cend( i ) != mat.end( i ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid iterator detected in row " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the lookup functions of the SlicedEllMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the find(), lowerBound(), and upperBound() functions of the
+// SlicedEllMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testFind()
+{
+   test_ = "SlicedEllMatrix::find(), SlicedEllMatrix::lowerBound(), and SlicedEllMatrix::upperBound()";
+
+   constexpr size_t C( blaze::SIMDTrait<int>::size );
+
+   CMT ref( 2UL*C+3UL, 15UL );
+   blaze::randomize( ref, 50UL, 1, 10 );
+
+   const MT mat( ref, 2UL*C );
+
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j )
+      {
+         const ptrdiff_t find ( mat.find      ( i, j ) - mat.begin( i ) );
+         const ptrdiff_t lower( mat.lowerBound( i, j ) - mat.begin( i ) );
+         const ptrdiff_t upper( mat.upperBound( i, j ) - mat.begin( i ) );
+
+         if( find  != ref.find      ( i, j ) - ref.begin( i ) ||
+             lower != ref.lowerBound( i, j ) - ref.begin( i ) ||
+             upper != ref.upperBound( i, j ) - ref.begin( i ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Lookup of element (" << i << "," << j << ") failed\n"
+                << " Details:\n"
+                << "   find()      : " << find  << " (expected " << ( ref.find( i, j ) - ref.begin( i ) ) << ")\n"
+                << "   lowerBound(): " << lower << " (expected " << ( ref.lowerBound( i, j ) - ref.begin( i ) ) << ")\n"
+                << "   upperBound(): " << upper << " (expected " << ( ref.upperBound( i, j ) - ref.begin( i ) ) << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the partition() function of the SlicedEllMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the boundaries returned by the partition() function cover all rows,
+// are monotonically increasing and coincide with the boundaries of the sorting windows. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testPartition()
+{
+   test_ = "SlicedEllMatrix::partition()";
+
+   {
+      const MT mat;
+
+      if( mat.partition( 4UL, 0UL ) != 0UL || mat.partition( 4UL, 2UL ) != 0UL ||
+          mat.partition( 4UL, 4UL ) != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid partitioning of an empty matrix\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      CMT ref( 1000UL, 200UL );
+      blaze::randomize( ref, 5000UL, -10, 10 );
+
+      const MT mat( ref, 64UL );
+
+      for( size_t parts : { 1UL, 2UL, 3UL, 4UL, 7UL, 100UL } )
+      {
+         size_t previous( 0UL );
+
+         for( size_t p=0UL; p<=parts; ++p )
+         {
+            const size_t boundary( mat.partition( parts, p ) );
+
+            if( ( p == 0UL && boundary != 0UL ) ||
+                ( p == parts && boundary != mat.rows() ) ||
+                ( boundary < previous ) ||
+                ( boundary != mat.rows() && boundary % mat.sigma() != 0UL ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid partition boundary detected\n"
+                   << " Details:\n"
+                   << "   Number of parts  : " << parts << "\n"
+                   << "   Part             : " << p << "\n"
+                   << "   Boundary         : " << boundary << "\n"
+                   << "   Previous boundary: " << previous << "\n"
+                   << "   Sorting window   : " << mat.sigma() << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+
+            previous = boundary;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace slicedellmatrix
+
+} // namespace matrices
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SlicedEllMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SLICEDELLMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SlicedEllMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,140 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/operations/densesmp/AssignTest.cpp
+//  \brief Source file for the dense SMP assignment test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/operations/densesmp/AssignTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace operations {
+
+namespace densesmp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the dense SMP assignment test.
+//
+// \exception std::runtime_error Assignment error detected.
+*/
+AssignTest::AssignTest()
+   : test_()
+   , threads_( 0UL )
+   , initial_( blaze::getNumThreads() )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   // Matrix sizes above the SMP threshold of the dense matrix addition, which are no multiples
+   // of the SIMD size or the tile size
+   const size_t sizes[][2] = { { 191UL, 197UL }, { 301UL, 131UL }, { 67UL, 601UL }, { 1001UL, 37UL } };
+
+   for( const auto& size : sizes )
+   {
+      testAssign< float , rowMajor   , rowMajor    >( size[0], size[1] );
+      testAssign< float , rowMajor   , columnMajor >( size[0], size[1] );
+      testAssign< float , columnMajor, rowMajor    >( size[0], size[1] );
+      testAssign< float , columnMajor, columnMajor >( size[0], size[1] );
+      testAssign< double, rowMajor   , rowMajor    >( size[0], size[1] );
+      testAssign< double, rowMajor   , columnMajor >( size[0], size[1] );
+      testAssign< double, columnMajor, rowMajor    >( size[0], size[1] );
+      testAssign< double, columnMajor, columnMajor >( size[0], size[1] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the dense SMP assignment test.
+//
+// The destructor restores the initial number of threads.
+*/
+AssignTest::~AssignTest()
+{
+   blaze::setNumThreads( initial_ );
+}
+//*************************************************************************************************
+
+} // namespace densesmp
+
+} // namespace operations
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dense SMP assignment test..." << std::endl;
+
+   try
+   {
+      RUN_DENSESMP_ASSIGN_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense SMP assignment test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
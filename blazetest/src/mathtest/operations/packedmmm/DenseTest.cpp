@@ -0,0 +1,124 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/operations/packedmmm/DenseTest.cpp
+//  \brief Source file for the packed dense matrix multiplication test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+// Small cache sizes result in small cache blocks of the packed kernels, such that moderately
+// sized matrices span several blocks in all dimensions
+#ifndef BLAZE_L1_CACHE_SIZE
+#  define BLAZE_L1_CACHE_SIZE 4096UL
+#endif
+#ifndef BLAZE_L2_CACHE_SIZE
+#  define BLAZE_L2_CACHE_SIZE 32768UL
+#endif
+#ifndef BLAZE_CACHE_SIZE
+#  define BLAZE_CACHE_SIZE 131072UL
+#endif
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/operations/packedmmm/DenseTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace operations {
+
+namespace packedmmm {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the packed dense matrix multiplication test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+DenseTest::DenseTest()
+   : test_()
+{
+   testKernels<float>();
+   testKernels<double>();
+   testKernels< blaze::complex<double> >();
+   testScaling<float>();
+   testScaling<double>();
+}
+//*************************************************************************************************
+
+} // namespace packedmmm
+
+} // namespace operations
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running packed dense matrix multiplication test..." << std::endl;
+
+   try
+   {
+      RUN_PACKEDMMM_DENSE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during packed dense matrix multiplication test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
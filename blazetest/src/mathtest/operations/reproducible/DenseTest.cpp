@@ -0,0 +1,150 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/operations/reproducible/DenseTest.cpp
+//  \brief Source file for the reproducible dense reduction test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#ifndef BLAZE_USE_REPRODUCIBLE_REDUCTIONS
+#  define BLAZE_USE_REPRODUCIBLE_REDUCTIONS 1
+#endif
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/operations/reproducible/DenseTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace operations {
+
+namespace reproducible {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the reproducible dense reduction test.
+//
+// \exception std::runtime_error Reduction error detected.
+*/
+DenseTest::DenseTest()
+   : test_()
+   , threads_( 0UL )
+   , initial_( blaze::getNumThreads() )
+{
+   using blaze::complex;
+
+   // Sizes below, at, and above the number of virtual lanes and the block size, including
+   // vectors above the SMP threshold for dense vector reductions
+   for( size_t N : { 1UL, 7UL, 31UL, 64UL, 256UL, 300UL, 4096UL, 4097UL, 10007UL, 50000UL } )
+   {
+      testVector< float           >( N );
+      testVector< double          >( N );
+      testVector< complex<double> >( N );
+   }
+
+   // Matrices below and above the SMP threshold for total dense matrix reductions
+   for( size_t M : { 1UL, 7UL, 64UL, 300UL } ) {
+      for( size_t N : { 1UL, 13UL, 100UL, 310UL } )
+      {
+         testMatrix< float           >( M, N );
+         testMatrix< double          >( M, N );
+         testMatrix< complex<double> >( M, N );
+      }
+   }
+
+   testMatrix< double >( 20UL, 5000UL );
+   testMatrix< double >( 5000UL, 20UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the reproducible dense reduction test.
+//
+// The destructor restores the initial number of threads.
+*/
+DenseTest::~DenseTest()
+{
+   blaze::setNumThreads( initial_ );
+}
+//*************************************************************************************************
+
+} // namespace reproducible
+
+} // namespace operations
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running reproducible dense reduction test..." << std::endl;
+
+   try
+   {
+      RUN_REPRODUCIBLE_DENSE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during reproducible dense reduction test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,216 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/operations/sparsesmp/AssignTest.cpp
+//  \brief Source file for the sparse SMP assignment test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/operations/sparsesmp/AssignTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace operations {
+
+namespace sparsesmp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the sparse SMP assignment test.
+//
+// \exception std::runtime_error Assignment error detected.
+*/
+AssignTest::AssignTest()
+   : test_()
+   , threads_( 0UL )
+   , initial_( blaze::getNumThreads() )
+{
+   testMatrix<blaze::rowMajor>();
+   testMatrix<blaze::columnMajor>();
+   testVector();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the sparse SMP assignment test.
+//
+// The destructor restores the initial number of threads.
+*/
+AssignTest::~AssignTest()
+{
+   blaze::setNumThreads( initial_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignments to a sparse vector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP assignment, addition assignment, subtraction assignment, and
+// multiplication assignment to a compressed vector. The assignment of a transposition expression
+// additionally tests the transfer of the result to a target other than a compressed vector. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AssignTest::testVector()
+{
+   using blaze::rowMajor;
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   using MT  = blaze::CompressedMatrix<int,rowMajor>;
+   using VT  = blaze::CompressedVector<int,columnVector>;
+   using DVT = blaze::DynamicVector<int,columnVector>;
+   using TVT = blaze::CompressedVector<int,rowVector>;
+
+   test_ = "Sparse vector SMP assignment";
+
+   // Operands above the SMP thresholds of the sparse matrix/sparse vector multiplication and
+   // the dense vector/dense vector addition
+   MT A( 40000UL, 1000UL );
+   blaze::randomize( A, 100000UL, -5, 5 );
+
+   VT x( 1000UL );
+   blaze::randomize( x, 200UL, -5, 5 );
+
+   DVT a( 40000UL ), b( 40000UL );
+   blaze::randomize( a, -5, 5 );
+   blaze::randomize( b, -5, 5 );
+
+   VT init( 40000UL );
+   blaze::randomize( init, 10000UL, -5, 5 );
+
+   for( size_t threads : { 1UL, 2UL, 3UL, 4UL, 7UL } )
+   {
+      blaze::setNumThreads( threads );
+      threads_ = blaze::getNumThreads();
+
+      {
+         VT y, r;
+         y = A * x;
+         r = blaze::serial( A * x );
+         checkResult( "y = A * x", y, r );
+      }
+
+      {
+         TVT y, r;
+         y = trans( A * x );
+         r = blaze::serial( trans( A * x ) );
+         checkResult( "y = trans( A * x )", y, r );
+      }
+
+      {
+         VT y( init ), r( init );
+         blaze::smpAddAssign( y, A * x );
+         r += blaze::serial( A * x );
+         checkResult( "y += A * x", y, r );
+      }
+
+      {
+         VT y( init ), r( init );
+         blaze::smpSubAssign( y, A * x );
+         r -= blaze::serial( A * x );
+         checkResult( "y -= A * x", y, r );
+      }
+
+      {
+         VT y( init ), r( init );
+         blaze::smpMultAssign( y, a + b );
+         r *= blaze::serial( a + b );
+         checkResult( "y *= a + b", y, r );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace sparsesmp
+
+} // namespace operations
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse SMP assignment test..." << std::endl;
+
+   try
+   {
+      RUN_SPARSESMP_ASSIGN_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse SMP assignment test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
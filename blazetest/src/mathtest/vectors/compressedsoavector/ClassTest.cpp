@@ -0,0 +1,1061 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/vectors/compressedsoavector/ClassTest.cpp
+//  \brief Source file for the CompressedSoAVector class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Views.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/vectors/compressedsoavector/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace vectors {
+
+namespace compressedsoavector {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedSoAVector class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testMultAssign();
+   testCrossAssign();
+   testSubscript();
+   testIterator();
+   testResize();
+   testReserve();
+   testSet();
+   testInsert();
+   testAppend();
+   testErase();
+   testFind();
+   testLowerBound();
+   testIndexRange();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAVector constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CompressedSoAVector class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "CompressedSoAVector default constructor";
+
+      VT vec;
+
+      checkSize    ( vec, 0UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "CompressedSoAVector size constructor (size 5)";
+
+      VT vec( 5UL );
+
+      checkSize    ( vec, 5UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+   {
+      test_ = "CompressedSoAVector size constructor (size 5, 3 non-zeros)";
+
+      VT vec( 5UL, 3UL );
+
+      checkSize    ( vec, 5UL );
+      checkCapacity( vec, 3UL );
+      checkNonZeros( vec, 0UL );
+   }
+
+
+   //=====================================================================================
+   // List initialization
+   //=====================================================================================
+
+   {
+      test_ = "CompressedSoAVector initializer list constructor";
+
+      VT vec{ 1, 0, 3, 0 };
+
+      checkSize    ( vec, 4UL );
+      checkNonZeros( vec, 2UL );
+
+      if( vec[0] != 1 || vec[1] != 0 || vec[2] != 3 || vec[3] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 0 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy and move constructor
+   //=====================================================================================
+
+   {
+      test_ = "CompressedSoAVector copy constructor";
+
+      VT vec1{ 0, 2, 0, 4 };
+      VT vec2( vec1 );
+
+      checkSize    ( vec2, 4UL );
+      checkNonZeros( vec2, 2UL );
+
+      if( vec2[1] != 2 || vec2[3] != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 0 2 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompressedSoAVector move constructor";
+
+      VT vec1{ 0, 2, 0, 4 };
+      VT vec2( std::move( vec1 ) );
+
+      checkSize    ( vec2, 4UL );
+      checkNonZeros( vec2, 2UL );
+
+      if( vec2[1] != 2 || vec2[3] != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 0 2 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Dense and sparse vector constructor
+   //=====================================================================================
+
+   {
+      test_ = "CompressedSoAVector dense vector constructor";
+
+      blaze::DynamicVector<int,blaze::rowVector> ref{ 0, 7, 0, 0, 9 };
+      VT vec( ref );
+
+      checkSize    ( vec, 5UL );
+      checkNonZeros( vec, 2UL );
+
+      if( vec != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompressedSoAVector sparse vector constructor";
+
+      blaze::CompressedVector<int,blaze::rowVector> ref( 20UL );
+      blaze::randomize( ref, 8UL, 1, 10 );
+      VT vec( ref );
+
+      checkSize    ( vec, 20UL );
+      checkNonZeros( vec, 8UL );
+
+      if( vec != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAVector assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the CompressedSoAVector class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "CompressedSoAVector initializer list assignment";
+
+      VT vec;
+      vec = { 0, 2, 0, 4 };
+
+      checkSize    ( vec, 4UL );
+      checkNonZeros( vec, 2UL );
+
+      if( vec[0] != 0 || vec[1] != 2 || vec[2] != 0 || vec[3] != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 0 2 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompressedSoAVector copy assignment";
+
+      VT vec1{ 1, 0, 3 };
+      VT vec2{ 0, 0, 0, 0, 5, 6 };
+      vec2 = vec1;
+
+      checkSize    ( vec2, 3UL );
+      checkNonZeros( vec2, 2UL );
+
+      if( vec2 != vec1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec2 << "\n"
+             << "   Expected result:\n( 1 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompressedSoAVector sparse vector assignment";
+
+      blaze::CompressedVector<int,blaze::rowVector> ref( 30UL );
+      blaze::randomize( ref, 12UL, 1, 10 );
+
+      VT vec{ 1, 2 };
+      vec = ref;
+
+      checkSize    ( vec, 30UL );
+      checkNonZeros( vec, 12UL );
+
+      if( vec != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompressedSoAVector dense vector assignment";
+
+      blaze::DynamicVector<int,blaze::rowVector> ref{ 0, 0, 3, 0, 5 };
+
+      VT vec( 2UL );
+      vec = ref;
+
+      checkSize    ( vec, 5UL );
+      checkNonZeros( vec, 2UL );
+
+      if( vec != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAVector addition and subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition and subtraction assignment operators of the
+// CompressedSoAVector class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   {
+      test_ = "CompressedSoAVector sparse vector addition/subtraction assignment";
+
+      blaze::CompressedVector<int,blaze::rowVector> ref1( 40UL ), ref2( 40UL );
+      blaze::randomize( ref1, 15UL, 1, 10 );
+      blaze::randomize( ref2, 15UL, 1, 10 );
+
+      VT vec( ref1 );
+      vec  += ref2;
+      ref1 += ref2;
+
+      if( vec != ref1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n" << ref1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      vec  -= vec;
+      ref1 -= ref1;
+
+      if( vec != ref1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n" << ref1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompressedSoAVector dense vector addition assignment";
+
+      blaze::DynamicVector<int,blaze::rowVector> ref{ 1, 0, -3, 0 };
+
+      VT vec{ 0, 2, 3, 0 };
+      vec += ref;
+
+      checkNonZeros( vec, 2UL );
+
+      if( vec[0] != 1 || vec[1] != 2 || vec[2] != 0 || vec[3] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 2 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAVector multiplication and division assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication and division assignment operators of
+// the CompressedSoAVector class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testMultAssign()
+{
+   {
+      test_ = "CompressedSoAVector dense vector multiplication/division assignment";
+
+      blaze::DynamicVector<int,blaze::rowVector> ref{ 2, 3, 4, 5 };
+
+      VT vec{ 4, 0, 8, 0 };
+      vec *= ref;
+
+      checkNonZeros( vec, 2UL );
+
+      if( vec[0] != 8 || vec[1] != 0 || vec[2] != 32 || vec[3] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 8 0 32 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      vec /= ref;
+
+      if( vec[0] != 4 || vec[1] != 0 || vec[2] != 8 || vec[3] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Division assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 4 0 8 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompressedSoAVector sparse vector multiplication assignment";
+
+      VT vec1{ 1, 0, 3, 4 };
+      VT vec2{ 2, 5, 0, 2 };
+      vec1 *= vec2;
+
+      checkNonZeros( vec1, 2UL );
+
+      if( vec1[0] != 2 || vec1[1] != 0 || vec1[2] != 0 || vec1[3] != 8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec1 << "\n"
+             << "   Expected result:\n( 2 0 0 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      vec1 *= 3;
+
+      if( vec1[0] != 6 || vec1[3] != 24 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Scaling failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec1 << "\n"
+             << "   Expected result:\n( 6 0 0 24 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAVector cross product assignment operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the cross product assignment operator of the
+// CompressedSoAVector class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testCrossAssign()
+{
+   {
+      test_ = "CompressedSoAVector cross product assignment";
+
+      TVT vec1{ 1, 0, -2 };
+      TVT vec2{ 0, 3, 1 };
+      vec1 %= vec2;
+
+      checkSize    ( vec1, 3UL );
+      checkNonZeros( vec1, 3UL );
+
+      if( vec1[0] != 6 || vec1[1] != -1 || vec1[2] != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Cross product assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec1 << "\n"
+             << "   Expected result:\n( 6 -1 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAVector subscript operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the subscript operator
+// of the CompressedSoAVector class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubscript()
+{
+   {
+      test_ = "CompressedSoAVector::operator[]";
+
+      VT vec( 7UL );
+      vec[4] = 3;
+      vec[1] = 2;
+      vec[6] = 9;
+      vec[4] += vec[1];
+      vec[1] = 0;
+
+      checkSize    ( vec, 7UL );
+      checkNonZeros( vec, 2UL );
+
+      if( vec[1] != 0 || vec[4] != 5 || vec[6] != 9 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subscript operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 0 0 0 0 5 0 9 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         vec.at( 7UL ) = 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bounds access succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedSoAVector iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the CompressedSoAVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   {
+      test_ = "CompressedSoAVector iterator traversal";
+
+      VT vec{ 0, 1, 0, -2, -3 };
+
+      VT::ConstIterator it( vec.cbegin() );
+
+      if( vec.cend() - it != 3L || it->index() != 1UL || it->value() != 1 ||
+          it[2].index() != 4UL || ( it+1 )->value() != -2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator access failed\n"
+             << " Details:\n"
+             << "   Current vector:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( VT::Iterator pos=vec.begin(); pos!=vec.end(); ++pos ) {
+         pos->value() *= 2;
+      }
+
+      if( vec[1] != 2 || vec[3] != -4 || vec[4] != -6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 0 2 0 -4 -6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the CompressedSoAVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the CompressedSoAVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "CompressedSoAVector::resize()";
+
+      VT vec{ 1, 0, 3, 0, 5 };
+
+      vec.resize( 3UL );
+
+      checkSize    ( vec, 3UL );
+      checkNonZeros( vec, 2UL );
+
+      vec.resize( 6UL );
+
+      checkSize    ( vec, 6UL );
+      checkNonZeros( vec, 2UL );
+
+      if( vec[0] != 1 || vec[2] != 3 || vec[4] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the vector failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 0 3 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      vec.resize( 4UL, false );
+
+      checkSize    ( vec, 4UL );
+      checkNonZeros( vec, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reserve() member function of the CompressedSoAVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reserve() and \c shrinkToFit() member functions of
+// the CompressedSoAVector class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testReserve()
+{
+   {
+      test_ = "CompressedSoAVector::reserve()";
+
+      VT vec{ 0, 4, 0, 5 };
+
+      vec.reserve( 20UL );
+
+      checkCapacity( vec, 20UL );
+      checkNonZeros( vec, 2UL );
+
+      vec.shrinkToFit();
+
+      if( vec.capacity() != 2UL || vec[1] != 4 || vec[3] != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Shrinking the vector failed\n"
+             << " Details:\n"
+             << "   Capacity: " << vec.capacity() << "\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 0 4 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c set() member function of the CompressedSoAVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c set() member function of the CompressedSoAVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSet()
+{
+   {
+      test_ = "CompressedSoAVector::set()";
+
+      VT vec( 10UL );
+
+      vec.set( 7UL, 1 );
+      vec.set( 2UL, 2 );
+      const VT::Iterator pos( vec.set( 7UL, 3 ) );
+
+      checkNonZeros( vec, 2UL );
+
+      if( pos->index() != 7UL || pos->value() != 3 || vec[2] != 2 || vec[7] != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting an element failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 0 0 2 0 0 0 0 3 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c insert() member function of the CompressedSoAVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c insert() member function of the CompressedSoAVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInsert()
+{
+   {
+      test_ = "CompressedSoAVector::insert()";
+
+      VT vec( 100UL );
+
+      for( size_t i=0UL; i<50UL; ++i ) {
+         vec.insert( 99UL-2UL*i, int( i+1UL ) );
+      }
+
+      checkNonZeros( vec, 50UL );
+
+      if( vec[99] != 1 || vec[1] != 50 || vec[51] != 25 || vec[50] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         vec.insert( 51UL, 2 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting an existing element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c append() member function of the CompressedSoAVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c append() member function of the CompressedSoAVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   {
+      test_ = "CompressedSoAVector::append()";
+
+      VT vec( 9UL, 4UL );
+
+      vec.append( 1UL, 1 );
+      vec.append( 3UL, 0, true );
+      vec.append( 5UL, 2 );
+      vec.append( 8UL, 3 );
+
+      checkNonZeros( vec, 3UL );
+
+      if( vec[1] != 1 || vec[3] != 0 || vec[5] != 2 || vec[8] != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Appending elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 0 1 0 0 0 2 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c erase() member functions of the CompressedSoAVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c erase() member functions of the CompressedSoAVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testErase()
+{
+   {
+      test_ = "CompressedSoAVector::erase()";
+
+      VT vec{ 1, 2, 3, 4, 5, 6, 7, 8 };
+
+      vec.erase( 0UL );
+      vec.erase( vec.find( 3UL ) );
+      vec.erase( vec.lowerBound( 5UL ), vec.upperBound( 6UL ) );
+
+      checkNonZeros( vec, 4UL );
+
+      if( vec[1] != 2 || vec[2] != 3 || vec[4] != 5 || vec[7] != 8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 0 2 3 0 5 0 0 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      vec.erase( []( int value ){ return value > 4; } );
+
+      checkNonZeros( vec, 2UL );
+
+      vec.erase( vec.begin(), vec.end(), []( int value ){ return value == 2; } );
+
+      checkNonZeros( vec, 1UL );
+
+      if( vec[2] != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 0 0 3 0 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the CompressedSoAVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the CompressedSoAVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   {
+      test_ = "CompressedSoAVector::find()";
+
+      VT vec( 8UL, 3UL );
+      vec[1] = 1;
+      vec[2] = 2;
+      vec[6] = 3;
+
+      const VT::ConstIterator pos1( vec.find( 1UL ) );
+      const VT::ConstIterator pos2( vec.find( 6UL ) );
+      const VT::ConstIterator pos3( vec.find( 5UL ) );
+
+      if( pos1 == vec.end() || pos1->value() != 1 || pos1->index() != 1UL ||
+          pos2 == vec.end() || pos2->value() != 3 || pos2->index() != 6UL ||
+          pos3 != vec.end() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element search failed\n"
+             << " Details:\n"
+             << "   Current vector:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() and \c upperBound() member functions of CompressedSoAVector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() and \c upperBound() member functions of
+// the CompressedSoAVector class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   {
+      test_ = "CompressedSoAVector::lowerBound()/upperBound()";
+
+      VT vec( 6UL, 2UL );
+      vec[1] = 1;
+      vec[4] = 2;
+
+      const VT::ConstIterator pos1( vec.lowerBound( 0UL ) );
+      const VT::ConstIterator pos2( vec.lowerBound( 2UL ) );
+      const VT::ConstIterator pos3( vec.lowerBound( 5UL ) );
+      const VT::ConstIterator pos4( vec.upperBound( 1UL ) );
+      const VT::ConstIterator pos5( vec.upperBound( 4UL ) );
+
+      if( pos1->index() != 1UL || pos2->index() != 4UL || pos3 != vec.end() ||
+          pos4->index() != 4UL || pos5 != vec.end() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lower/upper bound search failed\n"
+             << " Details:\n"
+             << "   Current vector:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the range check for the index type of the CompressedSoAVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a CompressedSoAVector refuses sizes that cannot be represented by
+// its index type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexRange()
+{
+   using SmallVT = blaze::CompressedSoAVector<int,blaze::rowVector,blaze::Group0,unsigned char>;
+
+   {
+      test_ = "CompressedSoAVector with 8-bit indices";
+
+      SmallVT vec( 255UL );
+      vec[254] = 1;
+
+      checkNonZeros( vec, 1UL );
+
+      try {
+         vec.resize( 256UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing beyond the range of the index type succeeded\n"
+             << " Details:\n"
+             << "   Size: " << vec.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkSize    ( vec, 255UL );
+      checkNonZeros( vec, 1UL );
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedsoavector
+
+} // namespace vectors
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedSoAVector class test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDSOAVECTOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedSoAVector class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
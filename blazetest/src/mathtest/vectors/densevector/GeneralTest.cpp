@@ -41,7 +41,9 @@
 #include <cstdlib>
 #include <iostream>
 #include <blaze/math/dense/DenseVector.h>
+#include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/Fuse.h>
 #include <blaze/math/StaticVector.h>
 #include <blazetest/mathtest/IsEqual.h>
 #include <blazetest/mathtest/vectors/densevector/GeneralTest.h>
@@ -106,6 +108,7 @@ GeneralTest::GeneralTest()
    testLogspace();
    testUniform();
    testZero();
+   testFuse();
 }
 //*************************************************************************************************
 
@@ -3100,6 +3103,164 @@ void GeneralTest::testZero()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c fuse() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c fuse() function for dense vectors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testFuse()
+{
+   test_ = "fuse() function";
+
+   // Fused update, residual, and norm computation
+   {
+      const size_t n( 10007UL );
+
+      blaze::DynamicVector<double> b( n ), x( n ), y( n ), r( n );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         b[i] = static_cast<double>( i % 7UL );
+         x[i] = static_cast<double>( i % 5UL ) - 2.0;
+         y[i] = static_cast<double>( i % 3UL );
+      }
+
+      blaze::DynamicVector<double> yref( 2.0*x + y );
+      blaze::DynamicVector<double> rref( b - yref );
+      const double nref( norm( rref ) );
+      const double sref( sum( yref ) );
+
+      double nrm( 0.0 ), total( 0.0 );
+
+      blaze::fuse( blaze::lazyAssign( y, 2.0*x + y )
+                 , blaze::lazyAssign( r, b - y )
+                 , blaze::lazyNorm( nrm, r )
+                 , blaze::lazySum( total, y ) );
+
+      if( y != yref || r != rref || nrm != nref || total != sref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused evaluation failed\n"
+             << " Details:\n"
+             << "   Result: norm = " << nrm << ", sum = " << total << "\n"
+             << "   Expected result: norm = " << nref << ", sum = " << sref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Fused compound assignments and squared norm computation
+   {
+      blaze::DynamicVector<int> a{ 1, 2, 3, 4, 5 };
+      blaze::DynamicVector<int> b{ 2, 2, 2, 2, 2 };
+      blaze::DynamicVector<int> c{ 1, 1, 1, 1, 1 };
+
+      int sqr( 0 );
+
+      blaze::fuse( blaze::lazyAddAssign( a, b )
+                 , blaze::lazyMultAssign( b, a )
+                 , blaze::lazySubAssign( c, b )
+                 , blaze::lazySqrNorm( sqr, c ) );
+
+      const blaze::DynamicVector<int> aref{  3,   4,   5,   6,   7 };
+      const blaze::DynamicVector<int> bref{  6,   8,  10,  12,  14 };
+      const blaze::DynamicVector<int> cref{ -5,  -7,  -9, -11, -13 };
+
+      if( a != aref || b != bref || c != cref || sqr != 445 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused compound assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << a << "\n" << b << "\n" << c << "\n" << sqr << "\n"
+             << "   Expected result:\n" << aref << "\n" << bref << "\n" << cref << "\n445\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Fallback to a sequential evaluation due to a matrix/vector multiplication
+   {
+      blaze::DynamicMatrix<int> A{ { 1, 2, 0 }, { 0, 1, 2 }, { 2, 0, 1 } };
+      blaze::DynamicVector<int> x{ 1, 2, 3 };
+      blaze::DynamicVector<int> y{ 1, 1, 1 };
+      blaze::DynamicVector<int> r( 3UL );
+
+      int total( 0 );
+
+      blaze::fuse( blaze::lazyAssign( y, x + y )
+                 , blaze::lazyAssign( r, A*y )
+                 , blaze::lazySum( total, r ) );
+
+      const blaze::DynamicVector<int> yref{ 2,  3, 4 };
+      const blaze::DynamicVector<int> rref{ 8, 11, 8 };
+
+      if( y != yref || r != rref || total != 27 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Sequential fallback failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n" << r << "\n" << total << "\n"
+             << "   Expected result:\n" << yref << "\n" << rref << "\n27\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Fused evaluation of matrix and vector statements
+   {
+      const size_t m( 1001UL );
+      const size_t n( 7UL );
+
+      blaze::DynamicMatrix<double> A( m, n ), B( m, n ), C( m, n );
+      blaze::DynamicVector<double> x( m ), y( m );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            A(i,j) = static_cast<double>( ( i + j ) % 4UL );
+            B(i,j) = static_cast<double>( ( i * j ) % 3UL );
+         }
+         x[i] = static_cast<double>( i % 9UL );
+      }
+
+      const blaze::DynamicMatrix<double> Cref( A + 3.0*B );
+      const blaze::DynamicVector<double> yref( x * 2.0 );
+      const double sref( sum( Cref ) );
+
+      double total( 0.0 );
+
+      blaze::fuse( blaze::lazyAssign( C, A + 3.0*B )
+                 , blaze::lazySum( total, C )
+                 , blaze::lazyAssign( y, x * 2.0 ) );
+
+      if( C != Cref || y != yref || total != sref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused matrix evaluation failed\n"
+             << " Details:\n"
+             << "   Result: sum = " << total << "\n"
+             << "   Expected result: sum = " << sref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Statements of different sizes
+   {
+      blaze::DynamicVector<int> a( 4UL, 1 ), b( 5UL, 2 );
+
+      try {
+         blaze::fuse( blaze::lazyAssign( a, 2*a ), blaze::lazyAssign( b, 2*b ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused evaluation of statements of different sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
 } // namespace densevector
 
 } // namespace vectors
@@ -0,0 +1,300 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/arenaallocator/ClassTest.cpp
+//  \brief Source file for the ArenaAllocator class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/utiltest/arenaallocator/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace arenaallocator {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ArenaAllocator class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testAllocation<char       >();
+   testAllocation<short      >();
+   testAllocation<int        >();
+   testAllocation<long       >();
+   testAllocation<float      >();
+   testAllocation<double     >();
+   testAllocation<long double>();
+   testAllocation<Aligned64  >();
+   testAllocation<Aligned128 >();
+
+   testRecycling();
+   testWorkspace();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the recycling of memory by the ArenaAllocator class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that deallocated memory is cached and reused by subsequent allocations.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRecycling()
+{
+   test_ = "Recycling of deallocated memory";
+
+   blaze::ArenaAllocator<double> allocator;
+
+   checkCached( 0UL );
+
+   double* const ptr1 = allocator.allocate( 100UL );
+   allocator.deallocate( ptr1, 100UL );
+
+   checkCached( 800UL );
+
+   double* const ptr2 = allocator.allocate( 100UL );
+
+   if( ptr2 != ptr1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Cached memory block has not been reused\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkCached( 0UL );
+
+   // Memory blocks of the same size class are reused for smaller requests
+   allocator.deallocate( ptr2, 100UL );
+
+   double* const ptr3 = allocator.allocate( 98UL );
+
+   if( ptr3 != ptr1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Cached memory block has not been reused for a smaller request\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Memory blocks are not reused for larger requests
+   allocator.deallocate( ptr3, 98UL );
+
+   double* const ptr4 = allocator.allocate( 100UL );
+
+   if( ptr4 == ptr1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Too small memory block has been reused\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   allocator.deallocate( ptr4, 100UL );
+
+   checkCached( 1584UL );
+
+   blaze::Arena::release();
+
+   checkCached( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Workspace class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that within a workspace the memory of the AlignedAllocator is recycled
+// and that all cached memory is released at the end of the outermost workspace. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testWorkspace()
+{
+   test_ = "Workspace";
+
+   blaze::AlignedAllocator<double> allocator;
+
+   double* const ptr1 = allocator.allocate( 100UL );
+
+   {
+      blaze::Workspace workspace;
+
+      if( !blaze::Arena::isActive() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inactive workspace detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Memory allocated outside the workspace is recycled within the workspace
+      allocator.deallocate( ptr1, 100UL );
+
+      checkCached( 800UL );
+
+      double* const ptr2 = allocator.allocate( 100UL );
+
+      if( ptr2 != ptr1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Cached memory block has not been reused\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      {
+         blaze::Workspace nested;
+
+         double* const ptr3 = allocator.allocate( 200UL );
+         allocator.deallocate( ptr3, 200UL );
+      }
+
+      // Leaving a nested workspace does not release the cached memory
+      checkCached( 1600UL );
+
+      allocator.deallocate( ptr2, 100UL );
+
+      checkCached( 2400UL );
+   }
+
+   // Leaving the outermost workspace releases the cached memory
+   checkCached( 0UL );
+
+   if( blaze::Arena::isActive() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Active workspace detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Memory allocated within a workspace remains valid beyond the workspace
+   double* ptr4( nullptr );
+
+   {
+      blaze::Workspace workspace;
+      ptr4 = allocator.allocate( 100UL );
+   }
+
+   ptr4[99] = 1.0;
+   allocator.deallocate( ptr4, 100UL );
+
+   checkCached( 0UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of bytes cached by the arena.
+//
+// \param expected The expected number of cached bytes.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkCached( size_t expected ) const
+{
+   if( blaze::Arena::cached() != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of cached bytes\n"
+          << " Details:\n"
+          << "   Number of cached bytes   : " << blaze::Arena::cached() << "\n"
+          << "   Expected number of bytes : " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace arenaallocator
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ArenaAllocator class test..." << std::endl;
+
+   try
+   {
+      RUN_ARENAALLOCATOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ArenaAllocator class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,180 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/numaallocator/ClassTest.cpp
+//  \brief Source file for the NumaAllocator class test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/utiltest/numaallocator/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace numaallocator {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the NumaAllocator class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   using blaze::PagePolicy;
+   using blaze::PlacementPolicy;
+
+   testAllocation< int      , PagePolicy::smallPages          , PlacementPolicy::local       >();
+   testAllocation< double   , PagePolicy::smallPages          , PlacementPolicy::interleaved >();
+   testAllocation< double   , PagePolicy::transparentHugePages, PlacementPolicy::partitioned >();
+   testAllocation< float    , PagePolicy::explicitHugePages   , PlacementPolicy::local       >();
+   testAllocation< Aligned64, PagePolicy::transparentHugePages, PlacementPolicy::interleaved >();
+
+   testGlobalPolicy();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the global allocation policy.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the global allocation policy of the AlignedAllocator class template. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testGlobalPolicy()
+{
+   test_ = "Global allocation policy";
+
+   const blaze::AllocationPolicy policy{ blaze::PagePolicy::transparentHugePages
+                                       , blaze::PlacementPolicy::partitioned };
+
+   if( blaze::getAllocationPolicy() != blaze::AllocationPolicy{} ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid default allocation policy detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::setAllocationPolicy( policy );
+
+   if( blaze::getAllocationPolicy() != policy ||
+       blaze::allocationPolicy( blaze::AlignedAllocator<double>() ) != policy ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting the allocation policy failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Allocating a large memory block according to the global policy
+   const size_t numObjects( blaze::largeAllocationThreshold / sizeof(double) );
+
+   blaze::AlignedAllocator<double> allocator;
+   double* const ptr = allocator.allocate( numObjects );
+
+   if( !blaze::checkAlignment( ptr ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid alignment detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   ptr[0] = ptr[numObjects-1UL] = 1.0;
+
+   // Deallocating the large memory block after resetting the global policy
+   blaze::setAllocationPolicy( blaze::AllocationPolicy{} );
+
+   allocator.deallocate( ptr, numObjects );
+
+   if( blaze::getAllocationPolicy() != blaze::AllocationPolicy{} ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resetting the allocation policy failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace numaallocator
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running NumaAllocator class test..." << std::endl;
+
+   try
+   {
+      RUN_NUMAALLOCATOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during NumaAllocator class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
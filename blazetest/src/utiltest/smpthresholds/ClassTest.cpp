@@ -0,0 +1,485 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/smpthresholds/ClassTest.cpp
+//  \brief Source file for the runtime SMP threshold test
+//
+//  Copyright (C) 2012-2020 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#ifndef BLAZE_USE_RUNTIME_SMP_THRESHOLDS
+#  define BLAZE_USE_RUNTIME_SMP_THRESHOLDS 1
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <blazetest/utiltest/smpthresholds/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace smpthresholds {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the runtime SMP threshold test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()
+   , file_( "smpthresholds.txt" )
+{
+   testAccess();
+   testCanSMPAssign();
+   testRoundTrip();
+   testComments();
+   testMalformed();
+   testEnvironment();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the runtime SMP threshold test.
+//
+// The destructor removes the temporary tuning file and resets all SMP thresholds.
+*/
+ClassTest::~ClassTest()
+{
+   std::remove( file_.c_str() );
+   blaze::resetSMPThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the getSMPThreshold(), setSMPThreshold(), and resetSMPThresholds() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the access to individual SMP thresholds by name. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAccess()
+{
+   test_ = "Access to individual SMP thresholds";
+
+   checkDefaults();
+
+   blaze::setSMPThreshold( "BLAZE_SMP_DVECASSIGN_THRESHOLD", 1234UL );
+   blaze::setSMPThreshold( "BLAZE_SMP_BATCH_THRESHOLD", 0UL );
+
+   checkThreshold( "BLAZE_SMP_DVECASSIGN_THRESHOLD", 1234UL );
+   checkThreshold( "BLAZE_SMP_BATCH_THRESHOLD", 0UL );
+
+   if( blaze::SMP_DVECASSIGN_THRESHOLD != 1234UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Changed threshold not visible via the threshold handle\n"
+          << " Details:\n"
+          << "   Result: " << size_t( blaze::SMP_DVECASSIGN_THRESHOLD ) << "\n"
+          << "   Expected result: 1234\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::resetSMPThresholds();
+
+   checkDefaults();
+
+   try {
+      blaze::getSMPThreshold( "BLAZE_SMP_UNKNOWN_THRESHOLD" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access to unknown SMP threshold succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::setSMPThreshold( "BLAZE_SMP_UNKNOWN_THRESHOLD", 10UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting unknown SMP threshold succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the effect of the runtime SMP thresholds on the parallel execution.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the canSMPAssign() functions of dense vectors and matrices are
+// based on the current values of the SMP thresholds. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCanSMPAssign()
+{
+   test_ = "Effect of the SMP thresholds on canSMPAssign()";
+
+   const blaze::DynamicVector<double> vec( 1000UL, 1.0 );
+   const blaze::DynamicMatrix<double> mat( 40UL, 40UL, 1.0 );
+
+   blaze::setSMPThreshold( "BLAZE_SMP_DVECASSIGN_THRESHOLD", 999UL );
+
+   if( !vec.canSMPAssign() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Dense vector above the threshold cannot be assigned in parallel\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::setSMPThreshold( "BLAZE_SMP_DVECASSIGN_THRESHOLD", 1000UL );
+
+   if( vec.canSMPAssign() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Dense vector below the threshold can be assigned in parallel\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::setSMPThreshold( "BLAZE_SMP_DMATASSIGN_THRESHOLD", 1600UL );
+
+   if( !mat.canSMPAssign() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Dense matrix above the threshold cannot be assigned in parallel\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::setSMPThreshold( "BLAZE_SMP_DMATASSIGN_THRESHOLD", 1601UL );
+
+   if( mat.canSMPAssign() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Dense matrix below the threshold can be assigned in parallel\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::resetSMPThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the saveSMPThresholds() and loadSMPThresholds() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a tuning file written by the saveSMPThresholds() function restores
+// all SMP thresholds via the loadSMPThresholds() function. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRoundTrip()
+{
+   test_ = "Round trip of a tuning file";
+
+   using Table = blaze::SMPThresholdTable<>;
+
+   for( size_t i=0UL; i<Table::size; ++i ) {
+      blaze::setSMPThreshold( Table::names[i], 100UL*i + 7UL );
+   }
+
+   blaze::saveSMPThresholds( file_ );
+   blaze::resetSMPThresholds();
+
+   checkDefaults();
+
+   blaze::loadSMPThresholds( file_ );
+
+   for( size_t i=0UL; i<Table::size; ++i ) {
+      checkThreshold( Table::names[i], 100UL*i + 7UL );
+   }
+
+   blaze::resetSMPThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of comments and empty lines in a tuning file.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that empty lines, comment lines, and trailing comments are ignored by
+// the loadSMPThresholds() function and that thresholds not mentioned in the tuning file remain
+// unchanged. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testComments()
+{
+   test_ = "Comments in a tuning file";
+
+   blaze::setSMPThreshold( "BLAZE_SMP_DMATASSIGN_THRESHOLD", 55UL );
+
+   writeFile( "# SMP thresholds\n"
+              "\n"
+              "   # Indented comment BLAZE_SMP_DVECASSIGN_THRESHOLD 1\n"
+              "#BLAZE_SMP_DVECSCALARMULT_THRESHOLD 2\n"
+              "BLAZE_SMP_DVECASSIGN_THRESHOLD 4096\n"
+              "  \t \n"
+              "\tBLAZE_SMP_DMATDVECMULT_THRESHOLD   128   # Trailing comment\n" );
+
+   blaze::loadSMPThresholds( file_ );
+
+   checkThreshold( "BLAZE_SMP_DVECASSIGN_THRESHOLD", 4096UL );
+   checkThreshold( "BLAZE_SMP_DMATDVECMULT_THRESHOLD", 128UL );
+   checkThreshold( "BLAZE_SMP_DMATASSIGN_THRESHOLD", 55UL );
+   checkThreshold( "BLAZE_SMP_DVECSCALARMULT_THRESHOLD",
+                   blaze::SMPThresholdTable<>::defaults[1] );
+
+   blaze::resetSMPThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the rejection of invalid tuning files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the loadSMPThresholds() function rejects missing tuning files,
+// malformed lines, and unknown SMP thresholds. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMalformed()
+{
+   test_ = "Invalid tuning files";
+
+   checkLoadFailure<std::runtime_error>( "BLAZE_SMP_DVECASSIGN_THRESHOLD\n" );
+   checkLoadFailure<std::runtime_error>( "BLAZE_SMP_DVECASSIGN_THRESHOLD abc\n" );
+   checkLoadFailure<std::runtime_error>( "BLAZE_SMP_DVECASSIGN_THRESHOLD -5\n" );
+   checkLoadFailure<std::runtime_error>( "BLAZE_SMP_DVECASSIGN_THRESHOLD 100abc\n" );
+   checkLoadFailure<std::runtime_error>( "BLAZE_SMP_DVECASSIGN_THRESHOLD 100 200\n" );
+   checkLoadFailure<std::runtime_error>( "BLAZE_SMP_DVECASSIGN_THRESHOLD 1.5\n" );
+   checkLoadFailure<std::runtime_error>( "BLAZE_SMP_DVECASSIGN_THRESHOLD 99999999999999999999999\n" );
+   checkLoadFailure<std::invalid_argument>( "BLAZE_SMP_UNKNOWN_THRESHOLD 100\n" );
+   checkLoadFailure<std::invalid_argument>( "blaze_smp_dvecassign_threshold 100\n" );
+
+   std::remove( file_.c_str() );
+
+   try {
+      blaze::loadSMPThresholds( file_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Loading missing tuning file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ) != "Tuning file could not be opened" )
+         throw;
+   }
+
+   blaze::resetSMPThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c BLAZE_SMP_THRESHOLDS environment variable.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the initialization of the SMP threshold table at program startup, which
+// loads the tuning file given by the \c BLAZE_SMP_THRESHOLDS environment variable. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testEnvironment()
+{
+   test_ = "Initialization via the BLAZE_SMP_THRESHOLDS environment variable";
+
+   writeFile( "BLAZE_SMP_DVECASSIGN_THRESHOLD 321\n" );
+
+#if (defined _MSC_VER)
+   _putenv_s( "BLAZE_SMP_THRESHOLDS", "" );
+#else
+   setenv( "BLAZE_SMP_THRESHOLDS", "", 1 );
+#endif
+
+   blaze::SMPThresholdTable<>::init();
+
+   checkDefaults();
+
+#if (defined _MSC_VER)
+   _putenv_s( "BLAZE_SMP_THRESHOLDS", file_.c_str() );
+#else
+   setenv( "BLAZE_SMP_THRESHOLDS", file_.c_str(), 1 );
+#endif
+
+   blaze::SMPThresholdTable<>::init();
+
+   checkThreshold( "BLAZE_SMP_DVECASSIGN_THRESHOLD", 321UL );
+
+#if (defined _MSC_VER)
+   _putenv_s( "BLAZE_SMP_THRESHOLDS", "" );
+#else
+   unsetenv( "BLAZE_SMP_THRESHOLDS" );
+#endif
+
+   blaze::resetSMPThresholds();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writing the given content to the temporary tuning file.
+//
+// \param content The content of the tuning file.
+// \return void
+// \exception std::runtime_error Tuning file could not be written.
+*/
+void ClassTest::writeFile( const std::string& content ) const
+{
+   std::ofstream file( file_.c_str() );
+   file << content;
+
+   if( !file ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Tuning file could not be written\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the current value of the given SMP threshold.
+//
+// \param name The name of the SMP threshold.
+// \param expected The expected value of the SMP threshold.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkThreshold( const std::string& name, size_t expected ) const
+{
+   if( blaze::getSMPThreshold( name ) != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid SMP threshold detected\n"
+          << " Details:\n"
+          << "   Threshold: " << name << "\n"
+          << "   Result: " << blaze::getSMPThreshold( name ) << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that all SMP thresholds have their compile time defaults.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkDefaults() const
+{
+   using Table = blaze::SMPThresholdTable<>;
+
+   for( size_t i=0UL; i<Table::size; ++i ) {
+      checkThreshold( Table::names[i], Table::defaults[i] );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smpthresholds
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running runtime SMP threshold test..." << std::endl;
+
+   try
+   {
+      RUN_SMPTHRESHOLDS_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during runtime SMP threshold test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -150,6 +150,9 @@ function(Blaze_Import)
          THRESHOLD_SMP_TSMATTSMATMULT
          THRESHOLD_SMP_DMATREDUCE
          THRESHOLD_SMP_SMATREDUCE
+         THRESHOLD_SMP_DVECREDUCE
+         THRESHOLD_SMP_DMATFULLREDUCE
+         THRESHOLD_SMP_BATCH
       )
       set(multiValueArgs )
 
@@ -325,6 +328,7 @@ function(Blaze_Import)
       elseif("${Blaze_Import_LAPACK}" STREQUAL "")
          msg_db("Using default configuration for LAPACK.")
       else()
+         target_compile_definitions( Blaze INTERFACE BLAZE_LAPACK_MODE=0 )
          msg("Configuring LAPACK : OFF")
       endif()
 
@@ -954,6 +958,27 @@ function(Blaze_Import)
          msg_db("Using default configuration for SMP sparse matrix reduction Threshold.")
       endif()
 
+      if(Blaze_Import_THRESHOLD_SMP_DVECREDUCE)
+         target_compile_definitions( Blaze INTERFACE BLAZE_SMP_DVECREDUCE_THRESHOLD=${Blaze_Import_THRESHOLD_SMP_DVECREDUCE} )
+         msg_db("Configuring SMP dense vector reduction Threshold : ${Blaze_Import_THRESHOLD_SMP_DVECREDUCE}")
+      else()
+         msg_db("Using default configuration for SMP dense vector reduction Threshold.")
+      endif()
+
+      if(Blaze_Import_THRESHOLD_SMP_DMATFULLREDUCE)
+         target_compile_definitions( Blaze INTERFACE BLAZE_SMP_DMATFULLREDUCE_THRESHOLD=${Blaze_Import_THRESHOLD_SMP_DMATFULLREDUCE} )
+         msg_db("Configuring SMP dense matrix total reduction Threshold : ${Blaze_Import_THRESHOLD_SMP_DMATFULLREDUCE}")
+      else()
+         msg_db("Using default configuration for SMP dense matrix total reduction Threshold.")
+      endif()
+
+      if(Blaze_Import_THRESHOLD_SMP_BATCH)
+         target_compile_definitions( Blaze INTERFACE BLAZE_SMP_BATCH_THRESHOLD=${Blaze_Import_THRESHOLD_SMP_BATCH} )
+         msg_db("Configuring SMP batched small matrix operation Threshold : ${Blaze_Import_THRESHOLD_SMP_BATCH}")
+      else()
+         msg_db("Using default configuration for SMP batched small matrix operation Threshold.")
+      endif()
+
    #==================================================================================================
    #   MPI
    #==================================================================================================